@@ -23,11 +23,21 @@
 
 #include <blis.h>
 
+extern int (*ref_set_blis_threads)(int);
+
+static int set_blis_threads(int threads)
+{
+    int previous = int(bli_thread_get_num_threads());
+    bli_thread_set_num_threads(threads);
+    return previous;
+}
+
 void setup_blis()
 {
 #ifndef WIN32
     bli_init();
 #endif
+    ref_set_blis_threads = set_blis_threads;
 }
 
 static int initialize_blis = (setup_blis(), 0);
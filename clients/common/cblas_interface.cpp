@@ -28,10 +28,14 @@
 #include "cblas_interface.h"
 #include "hipblas.h"
 #include "lapack_utilities.hpp"
+#include "syrkx_reference.hpp"
 #include "utility.h"
+#include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <memory>
 #include <typeinfo>
+#include <vector>
 
 /*!\file
  * \brief provide template functions interfaces to CBLAS C89 interfaces, it is only used for testing
@@ -49,6 +53,30 @@ void dpotrf_(char* uplo, int* m, double* A, int* lda, int* info);
 void cpotrf_(char* uplo, int* m, hipblasComplex* A, int* lda, int* info);
 void zpotrf_(char* uplo, int* m, hipblasDoubleComplex* A, int* lda, int* info);
 
+void spotrs_(char* uplo, int* n, int* nrhs, float* A, int* lda, float* B, int* ldb, int* info);
+void dpotrs_(char* uplo, int* n, int* nrhs, double* A, int* lda, double* B, int* ldb, int* info);
+void cpotrs_(char*           uplo,
+             int*            n,
+             int*            nrhs,
+             hipblasComplex* A,
+             int*            lda,
+             hipblasComplex* B,
+             int*            ldb,
+             int*            info);
+void zpotrs_(char*                 uplo,
+             int*                  n,
+             int*                  nrhs,
+             hipblasDoubleComplex* A,
+             int*                  lda,
+             hipblasDoubleComplex* B,
+             int*                  ldb,
+             int*                  info);
+
+void spotri_(char* uplo, int* n, float* A, int* lda, int* info);
+void dpotri_(char* uplo, int* n, double* A, int* lda, int* info);
+void cpotri_(char* uplo, int* n, hipblasComplex* A, int* lda, int* info);
+void zpotri_(char* uplo, int* n, hipblasDoubleComplex* A, int* lda, int* info);
+
 void sgetrf_(int* m, int* n, float* A, int* lda, int* ipiv, int* info);
 void dgetrf_(int* m, int* n, double* A, int* lda, int* ipiv, int* info);
 void cgetrf_(int* m, int* n, hipblasComplex* A, int* lda, int* ipiv, int* info);
@@ -2559,6 +2587,214 @@ void ref_geam(hipblasOperation_t    transa,
 }
 
 // gemm
+namespace
+{
+    // The 16-bit float types take part in arithmetic as float
+    inline float ref_gemm_load(hipblasHalf x)
+    {
+        return half_to_float(x);
+    }
+
+    inline float ref_gemm_load(hipblasBfloat16 x)
+    {
+        return bfloat16_to_float(x);
+    }
+
+    inline float ref_gemm_load(float x)
+    {
+        return x;
+    }
+
+    inline double ref_gemm_load(double x)
+    {
+        return x;
+    }
+
+    template <typename T, typename U>
+    inline T ref_gemm_store(U x)
+    {
+        if constexpr(std::is_same_v<T, hipblasHalf>)
+            return float_to_half(float(x));
+        else if constexpr(std::is_same_v<T, hipblasBfloat16>)
+            return float_to_bfloat16(float(x));
+        else
+            return T(x);
+    }
+
+    // Converts count contiguous elements to float
+    inline void ref_gemm_convert(const hipblasHalf* src, float* dst, int64_t count)
+    {
+        int64_t i = 0;
+#ifdef __F16C__
+        for(; i + 8 <= count; i += 8)
+        {
+            __m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+            _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(h));
+        }
+#endif
+        for(; i < count; i++)
+            dst[i] = half_to_float(src[i]);
+    }
+
+    inline void ref_gemm_convert(const hipblasBfloat16* src, float* dst, int64_t count)
+    {
+        for(int64_t i = 0; i < count; i++)
+            dst[i] = bfloat16_to_float(src[i]);
+    }
+
+    // Block sizes of the 16-bit gemm: C is computed in mc x nc blocks kept in float over
+    // the whole of k, from kc deep panels of A and B packed to float. Each mr x nr tile of
+    // a block is accumulated in registers.
+    constexpr int64_t ref_gemm_mc = 128;
+    constexpr int64_t ref_gemm_nc = 192;
+    constexpr int64_t ref_gemm_kc = 256;
+    constexpr int64_t ref_gemm_mr = 16;
+    constexpr int64_t ref_gemm_nr = 6;
+
+    // Packs xb x kb values of X, element (x, p) at X[x * sx + p * sp], into panels of w
+    // values of x for each p, converted to float and zero padded past xb. One of sx and
+    // sp is 1, so either the w values or the kb values are contiguous; row holds kb floats.
+    template <typename T>
+    void ref_gemm_pack(const T* X,
+                       int64_t  sx,
+                       int64_t  sp,
+                       int64_t  xb,
+                       int64_t  kb,
+                       int64_t  w,
+                       float*   packed,
+                       float*   row)
+    {
+        for(int64_t x0 = 0; x0 < xb; x0 += w)
+        {
+            int64_t wb    = std::min(w, xb - x0);
+            float*  panel = packed + x0 * kb;
+            if(sx == 1)
+            {
+                for(int64_t p = 0; p < kb; p++)
+                {
+                    ref_gemm_convert(X + x0 + p * sp, panel + p * w, wb);
+                    std::fill(panel + p * w + wb, panel + (p + 1) * w, 0.0f);
+                }
+            }
+            else
+            {
+                for(int64_t x = 0; x < w; x++)
+                {
+                    if(x < wb)
+                        ref_gemm_convert(X + (x0 + x) * sx, row, kb);
+                    for(int64_t p = 0; p < kb; p++)
+                        panel[p * w + x] = x < wb ? row[p] : 0.0f;
+                }
+            }
+        }
+    }
+
+    // Adds the product of an mr x kb panel of A and a kb x nr panel of B to an mr x nr tile
+    inline void ref_gemm_tile(int64_t kb, const float* a, const float* b, float* c, int64_t ldc)
+    {
+        float acc[ref_gemm_nr][ref_gemm_mr] = {};
+        for(int64_t p = 0; p < kb; p++)
+            for(int64_t j = 0; j < ref_gemm_nr; j++)
+                for(int64_t i = 0; i < ref_gemm_mr; i++)
+                    acc[j][i] += a[p * ref_gemm_mr + i] * b[p * ref_gemm_nr + j];
+
+        for(int64_t j = 0; j < ref_gemm_nr; j++)
+            for(int64_t i = 0; i < ref_gemm_mr; i++)
+                c[i + j * ldc] += acc[j][i];
+    }
+
+    // C = alpha * op(A) * op(B) + beta * C for 16-bit float A and B, with float
+    // accumulation and C rounded once, as if A, B and C were converted to float for
+    // cblas_sgemm, but without converting whole matrices. Blocks of C run in parallel.
+    template <typename Ti, typename To>
+    void ref_gemm_16bit(hipblasOperation_t transA,
+                        hipblasOperation_t transB,
+                        int64_t            m,
+                        int64_t            n,
+                        int64_t            k,
+                        float              alpha,
+                        const Ti*          A,
+                        int64_t            lda,
+                        const Ti*          B,
+                        int64_t            ldb,
+                        float              beta,
+                        To*                C,
+                        int64_t            ldc)
+    {
+        if(m <= 0 || n <= 0)
+            return;
+
+        // Strides of op(A)(i, p) and op(B)(p, j) along their panel and depth dimensions;
+        // the matrices are real, so a conjugate transpose is a transpose
+        int64_t a_si = transA == HIPBLAS_OP_N ? 1 : lda, a_sp = transA == HIPBLAS_OP_N ? lda : 1;
+        int64_t b_sj = transB == HIPBLAS_OP_N ? ldb : 1, b_sp = transB == HIPBLAS_OP_N ? 1 : ldb;
+        bool    product = alpha != 0 && k > 0;
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        {
+            std::vector<float> Ap(ref_gemm_mc * ref_gemm_kc), Bp(ref_gemm_kc * ref_gemm_nc);
+            std::vector<float> Cb(ref_gemm_mc * ref_gemm_nc), row(ref_gemm_kc);
+
+#ifdef _OPENMP
+#pragma omp for collapse(2) schedule(dynamic)
+#endif
+            for(int64_t jc = 0; jc < n; jc += ref_gemm_nc)
+            {
+                for(int64_t ic = 0; ic < m; ic += ref_gemm_mc)
+                {
+                    int64_t nb = std::min(ref_gemm_nc, n - jc);
+                    int64_t mb = std::min(ref_gemm_mc, m - ic);
+
+                    std::fill(Cb.begin(), Cb.end(), 0.0f);
+                    for(int64_t pc = 0; product && pc < k; pc += ref_gemm_kc)
+                    {
+                        int64_t kb = std::min(ref_gemm_kc, k - pc);
+                        ref_gemm_pack(A + ic * a_si + pc * a_sp,
+                                      a_si,
+                                      a_sp,
+                                      mb,
+                                      kb,
+                                      ref_gemm_mr,
+                                      Ap.data(),
+                                      row.data());
+                        ref_gemm_pack(B + jc * b_sj + pc * b_sp,
+                                      b_sj,
+                                      b_sp,
+                                      nb,
+                                      kb,
+                                      ref_gemm_nr,
+                                      Bp.data(),
+                                      row.data());
+
+                        for(int64_t jr = 0; jr < nb; jr += ref_gemm_nr)
+                            for(int64_t ir = 0; ir < mb; ir += ref_gemm_mr)
+                                ref_gemm_tile(kb,
+                                              Ap.data() + ir * kb,
+                                              Bp.data() + jr * kb,
+                                              Cb.data() + ir + jr * ref_gemm_mc,
+                                              ref_gemm_mc);
+                    }
+
+                    // C is not read where beta is zero, matching BLAS semantics
+                    for(int64_t j = 0; j < nb; j++)
+                    {
+                        To* c = C + ic + (jc + j) * ldc;
+                        for(int64_t i = 0; i < mb; i++)
+                        {
+                            float x = alpha * Cb[i + j * ref_gemm_mc];
+                            if(beta != 0)
+                                x += beta * ref_gemm_load(c[i]);
+                            c[i] = ref_gemm_store<To>(x);
+                        }
+                    }
+                }
+            }
+        }
+    }
+} // namespace
+
 template <>
 void ref_gemm<hipblasHalf>(hipblasOperation_t transA,
                            hipblasOperation_t transB,
@@ -2574,53 +2810,19 @@ void ref_gemm<hipblasHalf>(hipblasOperation_t transA,
                            hipblasHalf*       C,
                            int64_t            ldc)
 {
-    // cblas does not support hipblasHalf, so convert to higher precision float
-    // This will give more precise result which is acceptable for testing
-    float alpha_float = half_to_float(alpha);
-    float beta_float  = half_to_float(beta);
-
-    size_t sizeA = transA == HIPBLAS_OP_N ? size_t(k) * lda : size_t(m) * lda;
-    size_t sizeB = transB == HIPBLAS_OP_N ? size_t(n) * ldb : size_t(k) * ldb;
-    size_t sizeC = size_t(n) * ldc;
-
-    std::unique_ptr<float[]> A_float(new float[sizeA]());
-    std::unique_ptr<float[]> B_float(new float[sizeB]());
-    std::unique_ptr<float[]> C_float(new float[sizeC]());
-
-    for(size_t i = 0; i < sizeA; i++)
-    {
-        A_float[i] = half_to_float(A[i]);
-    }
-    for(size_t i = 0; i < sizeB; i++)
-    {
-        B_float[i] = half_to_float(B[i]);
-    }
-    for(size_t i = 0; i < sizeC; i++)
-    {
-        C_float[i] = half_to_float(C[i]);
-    }
-
-    // just directly cast, since transA, transB are integers in the enum
-    // printf("transA: rocblas =%d, cblas=%d\n", transA, (CBLAS_TRANSPOSE)transA );
-    cblas_sgemm(CblasColMajor,
-                (CBLAS_TRANSPOSE)transA,
-                (CBLAS_TRANSPOSE)transB,
-                m,
-                n,
-                k,
-                alpha_float,
-                const_cast<const float*>(A_float.get()),
-                lda,
-                const_cast<const float*>(B_float.get()),
-                ldb,
-                beta_float,
-                static_cast<float*>(C_float.get()),
-                ldc);
-
-    for(size_t i = 0; i < sizeC; i++)
-    {
-        C[i] = float_to_half(C_float[i]);
-    }
+    ref_gemm_16bit(transA,
+                   transB,
+                   m,
+                   n,
+                   k,
+                   half_to_float(alpha),
+                   A,
+                   lda,
+                   B,
+                   ldb,
+                   half_to_float(beta),
+                   C,
+                   ldc);
 }
 
 template <>
@@ -2638,51 +2840,7 @@ void ref_gemm<hipblasHalf, hipblasHalf, float>(hipblasOperation_t transA,
                                                hipblasHalf*       C,
                                                int64_t            ldc)
 {
-    // cblas does not support hipblasHalf, so convert to higher precision float
-    // This will give more precise result which is acceptable for testing
-
-    size_t sizeA = transA == HIPBLAS_OP_N ? size_t(k) * lda : size_t(m) * lda;
-    size_t sizeB = transB == HIPBLAS_OP_N ? size_t(n) * ldb : size_t(k) * ldb;
-    size_t sizeC = n * ldc;
-
-    std::unique_ptr<float[]> A_float(new float[sizeA]());
-    std::unique_ptr<float[]> B_float(new float[sizeB]());
-    std::unique_ptr<float[]> C_float(new float[sizeC]());
-
-    for(size_t i = 0; i < sizeA; i++)
-    {
-        A_float[i] = half_to_float(A[i]);
-    }
-    for(size_t i = 0; i < sizeB; i++)
-    {
-        B_float[i] = half_to_float(B[i]);
-    }
-    for(size_t i = 0; i < sizeC; i++)
-    {
-        C_float[i] = half_to_float(C[i]);
-    }
-
-    // just directly cast, since transA, transB are integers in the enum
-    // printf("transA: rocblas =%d, cblas=%d\n", transA, (CBLAS_TRANSPOSE)transA );
-    cblas_sgemm(CblasColMajor,
-                (CBLAS_TRANSPOSE)transA,
-                (CBLAS_TRANSPOSE)transB,
-                m,
-                n,
-                k,
-                alpha,
-                const_cast<const float*>(A_float.get()),
-                lda,
-                const_cast<const float*>(B_float.get()),
-                ldb,
-                beta,
-                static_cast<float*>(C_float.get()),
-                ldc);
-
-    for(size_t i = 0; i < sizeC; i++)
-    {
-        C[i] = float_to_half(C_float[i]);
-    }
+    ref_gemm_16bit(transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
 }
 
 template <>
@@ -2700,40 +2858,7 @@ void ref_gemm<hipblasHalf, float, float>(hipblasOperation_t transA,
                                          float*             C,
                                          int64_t            ldc)
 {
-    // cblas does not support hipblasHalf, so convert to higher precision float
-    // This will give more precise result which is acceptable for testing
-
-    size_t sizeA = transA == HIPBLAS_OP_N ? size_t(k) * lda : size_t(m) * lda;
-    size_t sizeB = transB == HIPBLAS_OP_N ? size_t(n) * ldb : size_t(k) * ldb;
-
-    std::unique_ptr<float[]> A_float(new float[sizeA]());
-    std::unique_ptr<float[]> B_float(new float[sizeB]());
-
-    for(size_t i = 0; i < sizeA; i++)
-    {
-        A_float[i] = half_to_float(A[i]);
-    }
-    for(size_t i = 0; i < sizeB; i++)
-    {
-        B_float[i] = half_to_float(B[i]);
-    }
-
-    // just directly cast, since transA, transB are integers in the enum
-    // printf("transA: rocblas =%d, cblas=%d\n", transA, (CBLAS_TRANSPOSE)transA );
-    cblas_sgemm(CblasColMajor,
-                (CBLAS_TRANSPOSE)transA,
-                (CBLAS_TRANSPOSE)transB,
-                m,
-                n,
-                k,
-                alpha,
-                const_cast<const float*>(A_float.get()),
-                lda,
-                const_cast<const float*>(B_float.get()),
-                ldb,
-                beta,
-                C,
-                ldc);
+    ref_gemm_16bit(transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
 }
 
 template <>
@@ -2751,51 +2876,7 @@ void ref_gemm<hipblasBfloat16, hipblasBfloat16, float>(hipblasOperation_t transA
                                                        hipblasBfloat16*   C,
                                                        int64_t            ldc)
 {
-    // cblas does not support hipblasBfloat16, so convert to higher precision float
-    // This will give more precise result which is acceptable for testing
-
-    size_t sizeA = transA == HIPBLAS_OP_N ? size_t(k) * lda : size_t(m) * lda;
-    size_t sizeB = transB == HIPBLAS_OP_N ? size_t(n) * ldb : size_t(k) * ldb;
-    size_t sizeC = size_t(n) * ldc;
-
-    std::unique_ptr<float[]> A_float(new float[sizeA]());
-    std::unique_ptr<float[]> B_float(new float[sizeB]());
-    std::unique_ptr<float[]> C_float(new float[sizeC]());
-
-    for(size_t i = 0; i < sizeA; i++)
-    {
-        A_float[i] = bfloat16_to_float(A[i]);
-    }
-    for(size_t i = 0; i < sizeB; i++)
-    {
-        B_float[i] = bfloat16_to_float(B[i]);
-    }
-    for(size_t i = 0; i < sizeC; i++)
-    {
-        C_float[i] = bfloat16_to_float(C[i]);
-    }
-
-    // just directly cast, since transA, transB are integers in the enum
-    // printf("transA: rocblas =%d, cblas=%d\n", transA, (CBLAS_TRANSPOSE)transA );
-    cblas_sgemm(CblasColMajor,
-                (CBLAS_TRANSPOSE)transA,
-                (CBLAS_TRANSPOSE)transB,
-                m,
-                n,
-                k,
-                alpha,
-                const_cast<const float*>(A_float.get()),
-                lda,
-                const_cast<const float*>(B_float.get()),
-                ldb,
-                beta,
-                static_cast<float*>(C_float.get()),
-                ldc);
-
-    for(size_t i = 0; i < sizeC; i++)
-    {
-        C[i] = float_to_bfloat16(C_float[i]);
-    }
+    ref_gemm_16bit(transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
 }
 
 template <>
@@ -2813,40 +2894,7 @@ void ref_gemm<hipblasBfloat16, float, float>(hipblasOperation_t transA,
                                              float*             C,
                                              int64_t            ldc)
 {
-    // cblas does not support hipblasBfloat16, so convert to higher precision float
-    // This will give more precise result which is acceptable for testing
-
-    size_t sizeA = transA == HIPBLAS_OP_N ? size_t(k) * lda : size_t(m) * lda;
-    size_t sizeB = transB == HIPBLAS_OP_N ? size_t(n) * ldb : size_t(k) * ldb;
-
-    std::unique_ptr<float[]> A_float(new float[sizeA]());
-    std::unique_ptr<float[]> B_float(new float[sizeB]());
-
-    for(size_t i = 0; i < sizeA; i++)
-    {
-        A_float[i] = bfloat16_to_float(A[i]);
-    }
-    for(size_t i = 0; i < sizeB; i++)
-    {
-        B_float[i] = bfloat16_to_float(B[i]);
-    }
-
-    // just directly cast, since transA, transB are integers in the enum
-    // printf("transA: rocblas =%d, cblas=%d\n", transA, (CBLAS_TRANSPOSE)transA );
-    cblas_sgemm(CblasColMajor,
-                (CBLAS_TRANSPOSE)transA,
-                (CBLAS_TRANSPOSE)transB,
-                m,
-                n,
-                k,
-                alpha,
-                const_cast<const float*>(A_float.get()),
-                lda,
-                const_cast<const float*>(B_float.get()),
-                ldb,
-                beta,
-                C,
-                ldc);
+    ref_gemm_16bit(transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
 }
 
 template <>
@@ -2976,6 +3024,103 @@ void ref_gemm<hipblasDoubleComplex>(hipblasOperation_t    transA,
                 ldc);
 }
 
+namespace
+{
+    // Block sizes of the int8 gemm. A and B are packed to int16 pairs along k, pair q of
+    // an mr row panel of op(A) holding A(i, 2q) and A(i, 2q + 1) next to each other for
+    // each i, so that a pair of products is one pmaddwd lane. pmaddubsw is not used, it
+    // takes one unsigned operand and saturates its sums to int16.
+    constexpr int64_t ref_gemm_int8_mc = 128;
+    constexpr int64_t ref_gemm_int8_nc = 192;
+    constexpr int64_t ref_gemm_int8_kc = 256;
+    constexpr int64_t ref_gemm_int8_mr = 8;
+    constexpr int64_t ref_gemm_int8_nr = 6;
+
+    // Packs xb x kb values of X, element (x, p) at X[x * sx + p * sp], into panels of w
+    // values of x for each pair of p, zero padded past xb and kb
+    void ref_gemm_int8_pack(const int8_t* X,
+                            int64_t       sx,
+                            int64_t       sp,
+                            int64_t       xb,
+                            int64_t       kb,
+                            int64_t       w,
+                            int16_t*      packed)
+    {
+        int64_t pairs = (kb + 1) / 2;
+        for(int64_t x0 = 0; x0 < xb; x0 += w)
+        {
+            int16_t* panel = packed + x0 * 2 * pairs;
+            for(int64_t q = 0; q < pairs; q++)
+            {
+                for(int64_t x = 0; x < w; x++)
+                {
+                    const int8_t* X_x = X + (x0 + x) * sx;
+                    bool          in  = x0 + x < xb;
+
+                    panel[(q * w + x) * 2]     = in ? X_x[2 * q * sp] : 0;
+                    panel[(q * w + x) * 2 + 1] = in && 2 * q + 1 < kb ? X_x[(2 * q + 1) * sp] : 0;
+                }
+            }
+        }
+    }
+
+    // Adds the product of an mr x kb panel of A and a kb x nr panel of B, as pairs along
+    // k, to an mr x nr tile of C. The sum of kc products of int8 values fits in int32.
+    void ref_gemm_int8_tile(
+        int64_t pairs, const int16_t* a, const int16_t* b, int32_t* c, int64_t ldc)
+    {
+        int32_t acc[ref_gemm_int8_nr][ref_gemm_int8_mr] = {};
+        for(int64_t q = 0; q < pairs; q++)
+        {
+            const int16_t* a_q = a + q * ref_gemm_int8_mr * 2;
+            const int16_t* b_q = b + q * ref_gemm_int8_nr * 2;
+            for(int64_t j = 0; j < ref_gemm_int8_nr; j++)
+                for(int64_t i = 0; i < ref_gemm_int8_mr; i++)
+                    acc[j][i] += a_q[2 * i] * b_q[2 * j] + a_q[2 * i + 1] * b_q[2 * j + 1];
+        }
+
+        for(int64_t j = 0; j < ref_gemm_int8_nr; j++)
+            for(int64_t i = 0; i < ref_gemm_int8_mr; i++)
+                c[i + j * ldc] += acc[j][i];
+    }
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define HIPBLAS_REF_GEMM_INT8_AVX2
+
+    // ref_gemm_int8_tile with one pmaddwd per pair of k for the eight rows of each column
+    __attribute__((target("avx2"))) void ref_gemm_int8_tile_avx2(
+        int64_t pairs, const int16_t* a, const int16_t* b, int32_t* c, int64_t ldc)
+    {
+        static_assert(ref_gemm_int8_mr == 8, "a pair of k for the rows of a panel is 256 bits");
+
+        __m256i acc[ref_gemm_int8_nr];
+        for(int64_t j = 0; j < ref_gemm_int8_nr; j++)
+            acc[j] = _mm256_setzero_si256();
+
+        for(int64_t q = 0; q < pairs; q++)
+        {
+            const int16_t* a_q = a + q * ref_gemm_int8_mr * 2;
+            __m256i        a_v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a_q));
+            for(int64_t j = 0; j < ref_gemm_int8_nr; j++)
+            {
+                int32_t b_qj;
+                std::memcpy(&b_qj, b + (q * ref_gemm_int8_nr + j) * 2, sizeof(b_qj));
+                acc[j] = _mm256_add_epi32(acc[j], _mm256_madd_epi16(a_v, _mm256_set1_epi32(b_qj)));
+            }
+        }
+
+        for(int64_t j = 0; j < ref_gemm_int8_nr; j++)
+        {
+            __m256i* c_j = reinterpret_cast<__m256i*>(c + j * ldc);
+            _mm256_storeu_si256(c_j, _mm256_add_epi32(_mm256_loadu_si256(c_j), acc[j]));
+        }
+    }
+#endif
+} // namespace
+
+// C = alpha * op(A) * op(B) + beta * C computed exactly with integers, wrapping to int32
+// as the device does. Blocks of C run in parallel; each is accumulated in int64 across
+// kc deep slices of A and B summed in int32.
 template <>
 void ref_gemm<int8_t, int32_t, int32_t>(hipblasOperation_t transA,
                                         hipblasOperation_t transB,
@@ -2991,49 +3136,279 @@ void ref_gemm<int8_t, int32_t, int32_t>(hipblasOperation_t transA,
                                         int32_t*           C,
                                         int64_t            ldc)
 {
-    double alpha_double = static_cast<double>(alpha);
-    double beta_double  = static_cast<double>(beta);
+    if(m <= 0 || n <= 0)
+        return;
+
+    auto tile = ref_gemm_int8_tile;
+#ifdef HIPBLAS_REF_GEMM_INT8_AVX2
+    if(__builtin_cpu_supports("avx2"))
+        tile = ref_gemm_int8_tile_avx2;
+#endif
 
-    size_t const sizeA = ((transA == HIPBLAS_OP_N) ? k : m) * size_t(lda);
-    size_t const sizeB = ((transB == HIPBLAS_OP_N) ? n : k) * size_t(ldb);
-    size_t const sizeC = n * size_t(ldc);
+    // Strides of op(A)(i, p) and op(B)(p, j) along their panel and depth dimensions
+    int64_t a_si = transA == HIPBLAS_OP_N ? 1 : lda, a_sp = transA == HIPBLAS_OP_N ? lda : 1;
+    int64_t b_sj = transB == HIPBLAS_OP_N ? ldb : 1, b_sp = transB == HIPBLAS_OP_N ? 1 : ldb;
+    bool    product = alpha != 0 && k > 0;
 
-    std::unique_ptr<double[]> A_double(new double[sizeA]());
-    std::unique_ptr<double[]> B_double(new double[sizeB]());
-    std::unique_ptr<double[]> C_double(new double[sizeC]());
+    constexpr int64_t mc = ref_gemm_int8_mc, nc = ref_gemm_int8_nc, kc = ref_gemm_int8_kc;
 
-    for(int64_t i = 0; i < sizeA; i++)
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
     {
-        A_double[i] = static_cast<double>(A[i]);
+        std::vector<int16_t> Ap(mc * kc), Bp(kc * nc);
+        std::vector<int32_t> Cb(mc * nc);
+        std::vector<int64_t> Cs(mc * nc);
+
+#ifdef _OPENMP
+#pragma omp for collapse(2) schedule(dynamic)
+#endif
+        for(int64_t jc = 0; jc < n; jc += nc)
+        {
+            for(int64_t ic = 0; ic < m; ic += mc)
+            {
+                int64_t nb = std::min(nc, n - jc);
+                int64_t mb = std::min(mc, m - ic);
+
+                std::fill(Cs.begin(), Cs.end(), 0);
+                for(int64_t pc = 0; product && pc < k; pc += kc)
+                {
+                    int64_t kb = std::min(kc, k - pc), pairs = (kb + 1) / 2;
+                    ref_gemm_int8_pack(
+                        A + ic * a_si + pc * a_sp, a_si, a_sp, mb, kb, ref_gemm_int8_mr, Ap.data());
+                    ref_gemm_int8_pack(
+                        B + jc * b_sj + pc * b_sp, b_sj, b_sp, nb, kb, ref_gemm_int8_nr, Bp.data());
+
+                    std::fill(Cb.begin(), Cb.end(), 0);
+                    for(int64_t jr = 0; jr < nb; jr += ref_gemm_int8_nr)
+                        for(int64_t ir = 0; ir < mb; ir += ref_gemm_int8_mr)
+                            tile(pairs,
+                                 Ap.data() + ir * 2 * pairs,
+                                 Bp.data() + jr * 2 * pairs,
+                                 Cb.data() + ir + jr * mc,
+                                 mc);
+
+                    for(int64_t j = 0; j < nb; j++)
+                        for(int64_t i = 0; i < mb; i++)
+                            Cs[i + j * mc] += Cb[i + j * mc];
+                }
+
+                // Unsigned arithmetic wraps like the device's int32 arithmetic; C is not
+                // read where beta is zero, matching BLAS semantics
+                for(int64_t j = 0; j < nb; j++)
+                {
+                    int32_t* c = C + ic + (jc + j) * ldc;
+                    for(int64_t i = 0; i < mb; i++)
+                    {
+                        uint64_t x = uint64_t(int64_t(alpha)) * uint64_t(Cs[i + j * mc]);
+                        if(beta != 0)
+                            x += uint64_t(int64_t(beta)) * uint64_t(int64_t(c[i]));
+                        c[i] = int32_t(uint32_t(x));
+                    }
+                }
+            }
+        }
     }
-    for(int64_t i = 0; i < sizeB; i++)
+}
+
+// gemm epilogues
+template <typename T, typename Ts>
+void ref_epilogue_scale_columns(int64_t   m,
+                                int64_t   n,
+                                const T*  D,
+                                int64_t   ldd,
+                                const Ts* alphaVec,
+                                const Ts* betaVec,
+                                T*        C,
+                                int64_t   ldc)
+{
+    for(int64_t j = 0; j < n; j++)
     {
-        B_double[i] = static_cast<double>(B[i]);
+        for(int64_t i = 0; i < m; i++)
+        {
+            // C is not read where beta is zero, matching BLAS semantics
+            Ts x = alphaVec[j] * Ts(ref_gemm_load(D[i + j * ldd]));
+            if(betaVec[j] != 0)
+                x += betaVec[j] * Ts(ref_gemm_load(C[i + j * ldc]));
+            C[i + j * ldc] = ref_gemm_store<T>(x);
+        }
     }
-    for(int64_t i = 0; i < sizeC; i++)
+}
+
+template <typename T>
+void ref_epilogue_bias(int64_t m, int64_t n, T* C, int64_t ldc, const T* bias)
+{
+    for(int64_t j = 0; j < n; j++)
+        for(int64_t i = 0; i < m; i++)
+            C[i + j * ldc] = ref_gemm_store<T>(ref_gemm_load(C[i + j * ldc])
+                                                   + ref_gemm_load(bias[i]));
+}
+
+template <typename T>
+void ref_epilogue_activation(
+    int64_t m, int64_t n, T* C, int64_t ldc, hipblasEpilogueActivation_t activation)
+{
+    if(activation == HIPBLAS_EPILOGUE_ACTIVATION_NONE)
+        return;
+
+    for(int64_t j = 0; j < n; j++)
     {
-        C_double[i] = static_cast<double>(C[i]);
+        for(int64_t i = 0; i < m; i++)
+        {
+            auto x = ref_gemm_load(C[i + j * ldc]);
+            using Tx = decltype(x);
+            if(activation == HIPBLAS_EPILOGUE_ACTIVATION_RELU)
+                x = x > 0 ? x : Tx(0);
+            else
+            {
+                // tanh approximation of GELU
+                const Tx c = Tx(0.7978845608028654);
+                x = Tx(0.5) * x * (Tx(1) + std::tanh(c * (x + Tx(0.044715) * x * x * x)));
+            }
+            C[i + j * ldc] = ref_gemm_store<T>(x);
+        }
     }
+}
 
-    cblas_dgemm(CblasColMajor,
-                static_cast<CBLAS_TRANSPOSE>(transA),
-                static_cast<CBLAS_TRANSPOSE>(transB),
-                m,
-                n,
-                k,
-                alpha_double,
-                const_cast<const double*>(A_double.get()),
-                lda,
-                const_cast<const double*>(B_double.get()),
-                ldb,
-                beta_double,
-                static_cast<double*>(C_double.get()),
-                ldc);
+#define INSTANTIATE_REF_EPILOGUE(T_, Ts_)                                                   \
+    template void ref_epilogue_scale_columns<T_, Ts_>(                                      \
+        int64_t, int64_t, const T_*, int64_t, const Ts_*, const Ts_*, T_*, int64_t);        \
+    template void ref_epilogue_bias<T_>(int64_t, int64_t, T_*, int64_t, const T_*);         \
+    template void ref_epilogue_activation<T_>(                                              \
+        int64_t, int64_t, T_*, int64_t, hipblasEpilogueActivation_t);
+
+INSTANTIATE_REF_EPILOGUE(hipblasHalf, float)
+INSTANTIATE_REF_EPILOGUE(hipblasBfloat16, float)
+INSTANTIATE_REF_EPILOGUE(float, float)
+INSTANTIATE_REF_EPILOGUE(double, double)
+
+#undef INSTANTIATE_REF_EPILOGUE
+
+// fp8 gemm
+float ref_fp8_to_float(uint8_t x, hipDataType type)
+{
+    bool fnuz  = type == HIPBLAS_R_8F_E4M3_FNUZ || type == HIPBLAS_R_8F_E5M2_FNUZ;
+    int  ebits = type == HIPBLAS_R_8F_E4M3 || type == HIPBLAS_R_8F_E4M3_FNUZ ? 4 : 5;
+    int  mbits = 7 - ebits;
+    int  bias  = (1 << (ebits - 1)) - 1 + (fnuz ? 1 : 0);
+
+    int  e    = (x >> mbits) & ((1 << ebits) - 1);
+    int  mant = x & ((1 << mbits) - 1);
+    bool sign = x & 0x80;
+
+    // FNUZ has no negative zero and no infinity: 0x80 is the only NaN. E4M3 has no
+    // infinity and only S.1111.111 is NaN; E5M2 follows IEEE.
+    if(fnuz && x == 0x80)
+        return std::numeric_limits<float>::quiet_NaN();
+    if(!fnuz && ebits == 4 && e == 15 && mant == 7)
+        return std::numeric_limits<float>::quiet_NaN();
+    if(!fnuz && ebits == 5 && e == 31)
+        return mant ? std::numeric_limits<float>::quiet_NaN()
+                    : (sign ? -std::numeric_limits<float>::infinity()
+                            : std::numeric_limits<float>::infinity());
 
-    for(size_t i = 0; i < sizeC; i++)
-        C[i] = static_cast<int32_t>(C_double[i]);
+    float value = e ? std::ldexp(float(mant + (1 << mbits)), e - bias - mbits)
+                    : std::ldexp(float(mant), 1 - bias - mbits);
+    return sign ? -value : value;
 }
 
+template <typename To>
+void ref_gemm_scaled(hipblasOperation_t transA,
+                     hipblasOperation_t transB,
+                     int64_t            m,
+                     int64_t            n,
+                     int64_t            k,
+                     float              alpha,
+                     const uint8_t*     A,
+                     hipDataType        aType,
+                     int64_t            lda,
+                     const float*       scaleA,
+                     bool               vectorA,
+                     const uint8_t*     B,
+                     hipDataType        bType,
+                     int64_t            ldb,
+                     const float*       scaleB,
+                     bool               vectorB,
+                     float              beta,
+                     To*                C,
+                     int64_t            ldc)
+{
+    if(!m || !n)
+        return;
+
+    // Decode A and B to dense float matrices with their scales applied: a vector scale
+    // applies to each row of op(A) and to each column of op(B)
+    int64_t rowsA = transA == HIPBLAS_OP_N ? m : k, colsA = transA == HIPBLAS_OP_N ? k : m;
+    int64_t rowsB = transB == HIPBLAS_OP_N ? k : n, colsB = transB == HIPBLAS_OP_N ? n : k;
+
+    std::vector<float> A_float(rowsA * colsA), B_float(rowsB * colsB), D(m * n);
+    for(int64_t j = 0; j < colsA; j++)
+        for(int64_t i = 0; i < rowsA; i++)
+        {
+            float s = scaleA ? scaleA[vectorA ? (transA == HIPBLAS_OP_N ? i : j) : 0] : 1.0f;
+            A_float[i + j * rowsA] = s * ref_fp8_to_float(A[i + j * lda], aType);
+        }
+    for(int64_t j = 0; j < colsB; j++)
+        for(int64_t i = 0; i < rowsB; i++)
+        {
+            float s = scaleB ? scaleB[vectorB ? (transB == HIPBLAS_OP_N ? j : i) : 0] : 1.0f;
+            B_float[i + j * rowsB] = s * ref_fp8_to_float(B[i + j * ldb], bType);
+        }
+
+    // The decoded matrices are real, so a conjugate transpose is a transpose
+    if(k)
+        cblas_sgemm(CblasColMajor,
+                    transA == HIPBLAS_OP_N ? CblasNoTrans : CblasTrans,
+                    transB == HIPBLAS_OP_N ? CblasNoTrans : CblasTrans,
+                    m,
+                    n,
+                    k,
+                    1.0f,
+                    A_float.data(),
+                    std::max<int64_t>(rowsA, 1),
+                    B_float.data(),
+                    std::max<int64_t>(rowsB, 1),
+                    0.0f,
+                    D.data(),
+                    m);
+
+    for(int64_t j = 0; j < n; j++)
+        for(int64_t i = 0; i < m; i++)
+        {
+            float x = alpha * D[i + j * m];
+            if(beta != 0)
+                x += beta * ref_gemm_load(C[i + j * ldc]);
+            C[i + j * ldc] = ref_gemm_store<To>(x);
+        }
+}
+
+#define INSTANTIATE_REF_GEMM_SCALED(To_)                   \
+    template void ref_gemm_scaled<To_>(hipblasOperation_t, \
+                                       hipblasOperation_t, \
+                                       int64_t,            \
+                                       int64_t,            \
+                                       int64_t,            \
+                                       float,              \
+                                       const uint8_t*,     \
+                                       hipDataType,        \
+                                       int64_t,            \
+                                       const float*,       \
+                                       bool,               \
+                                       const uint8_t*,     \
+                                       hipDataType,        \
+                                       int64_t,            \
+                                       const float*,       \
+                                       bool,               \
+                                       float,              \
+                                       To_*,               \
+                                       int64_t);
+
+INSTANTIATE_REF_GEMM_SCALED(hipblasHalf)
+INSTANTIATE_REF_GEMM_SCALED(hipblasBfloat16)
+INSTANTIATE_REF_GEMM_SCALED(float)
+
+#undef INSTANTIATE_REF_GEMM_SCALED
+
 // hemm
 template <>
 void ref_hemm(hipblasSideMode_t side,
@@ -3145,89 +3520,6 @@ void ref_herk(hipblasFillMode_t     uplo,
 }
 
 // herkx
-template <typename T, typename U>
-void ref_herkx_local(hipblasFillMode_t  uplo,
-                     hipblasOperation_t transA,
-                     int64_t            n,
-                     int64_t            k,
-                     T                  alpha,
-                     T*                 A,
-                     int64_t            lda,
-                     T*                 B,
-                     int64_t            ldb,
-                     U                  beta,
-                     T*                 C,
-                     int64_t            ldc)
-{
-
-    if(n <= 0 || (beta == 1 && (k == 0 || alpha == T(0.0))))
-        return;
-
-    if(transA == HIPBLAS_OP_N)
-    {
-        if(uplo == HIPBLAS_FILL_MODE_UPPER)
-        {
-            for(int64_t j = 0; j < n; ++j)
-            {
-                for(int64_t i = 0; i <= j; i++)
-                    C[i + j * ldc] *= T(beta);
-
-                for(int64_t l = 0; l < k; l++)
-                {
-                    T temp = alpha * std::conj(B[j + l * ldb]);
-                    for(int64_t i = 0; i <= j; ++i)
-                        C[i + j * ldc] += temp * A[i + l * lda];
-                }
-            }
-        }
-        else // lower
-        {
-            for(int64_t j = 0; j < n; ++j)
-            {
-                for(int64_t i = j; i < n; i++)
-                    C[i + j * ldc] *= T(beta);
-
-                for(int64_t l = 0; l < k; l++)
-                {
-                    T temp = alpha * std::conj(B[j + l * ldb]);
-                    for(int64_t i = j; i < n; ++i)
-                        C[i + j * ldc] += temp * A[i + l * lda];
-                }
-            }
-        }
-    }
-    else // conjugate transpose
-    {
-        if(uplo == HIPBLAS_FILL_MODE_UPPER)
-        {
-            for(int64_t j = 0; j < n; ++j)
-                for(int64_t i = 0; i <= j; i++)
-                {
-                    C[i + j * ldc] *= T(beta);
-                    T temp(0);
-                    for(int64_t l = 0; l < k; l++)
-                        temp += std::conj(A[l + i * lda]) * B[l + j * ldb];
-                    C[i + j * ldc] += alpha * temp;
-                }
-        }
-        else // lower
-        {
-            for(int64_t j = 0; j < n; ++j)
-                for(int64_t i = j; i < n; i++)
-                {
-                    C[i + j * ldc] *= T(beta);
-                    T temp(0);
-                    for(int64_t l = 0; l < k; l++)
-                        temp += std::conj(A[l + i * lda]) * B[l + j * ldb];
-                    C[i + j * ldc] += alpha * temp;
-                }
-        }
-    }
-
-    for(int64_t i = 0; i < n; i++)
-        C[i + i * ldc].imag(0);
-}
-
 template <>
 void ref_herkx(hipblasFillMode_t  uplo,
                hipblasOperation_t transA,
@@ -3242,7 +3534,7 @@ void ref_herkx(hipblasFillMode_t  uplo,
                hipblasComplex*    C,
                int64_t            ldc)
 {
-    ref_herkx_local(uplo, transA, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+    syrkx_reference_blocked<true>(uplo, transA, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
 }
 
 template <>
@@ -3259,7 +3551,7 @@ void ref_herkx(hipblasFillMode_t     uplo,
                hipblasDoubleComplex* C,
                int64_t               ldc)
 {
-    ref_herkx_local(uplo, transA, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+    syrkx_reference_blocked<true>(uplo, transA, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
 }
 
 // her2k
@@ -4017,6 +4309,164 @@ int ref_potrf(char uplo, int m, hipblasDoubleComplex* A, int lda)
     return info;
 }
 
+// potrs
+template <>
+int ref_potrs(char uplo, int n, int nrhs, float* A, int lda, float* B, int ldb)
+{
+    int info;
+
+#ifdef FLA_ENABLE_ILP64
+    int64_t info_64;
+    info_64 = LAPACKE_spotrs(LAPACK_COL_MAJOR, uplo, n, nrhs, A, lda, B, ldb);
+
+    info = info_64;
+#else
+    spotrs_(&uplo, &n, &nrhs, A, &lda, B, &ldb, &info);
+#endif
+
+    return info;
+}
+
+template <>
+int ref_potrs(char uplo, int n, int nrhs, double* A, int lda, double* B, int ldb)
+{
+    int info;
+
+#ifdef FLA_ENABLE_ILP64
+    int64_t info_64;
+    info_64 = LAPACKE_dpotrs(LAPACK_COL_MAJOR, uplo, n, nrhs, A, lda, B, ldb);
+
+    info = info_64;
+#else
+    dpotrs_(&uplo, &n, &nrhs, A, &lda, B, &ldb, &info);
+#endif
+
+    return info;
+}
+
+template <>
+int ref_potrs(char uplo, int n, int nrhs, hipblasComplex* A, int lda, hipblasComplex* B, int ldb)
+{
+    int info;
+
+#ifdef FLA_ENABLE_ILP64
+    int64_t info_64;
+    info_64 = LAPACKE_cpotrs(LAPACK_COL_MAJOR,
+                             uplo,
+                             n,
+                             nrhs,
+                             (lapack_complex_float*)A,
+                             lda,
+                             (lapack_complex_float*)B,
+                             ldb);
+
+    info = info_64;
+#else
+    cpotrs_(&uplo, &n, &nrhs, A, &lda, B, &ldb, &info);
+#endif
+
+    return info;
+}
+
+template <>
+int ref_potrs(char                  uplo,
+              int                   n,
+              int                   nrhs,
+              hipblasDoubleComplex* A,
+              int                   lda,
+              hipblasDoubleComplex* B,
+              int                   ldb)
+{
+    int info;
+
+#ifdef FLA_ENABLE_ILP64
+    int64_t info_64;
+    info_64 = LAPACKE_zpotrs(LAPACK_COL_MAJOR,
+                             uplo,
+                             n,
+                             nrhs,
+                             (lapack_complex_double*)A,
+                             lda,
+                             (lapack_complex_double*)B,
+                             ldb);
+
+    info = info_64;
+#else
+    zpotrs_(&uplo, &n, &nrhs, A, &lda, B, &ldb, &info);
+#endif
+
+    return info;
+}
+
+// potri
+template <>
+int ref_potri(char uplo, int n, float* A, int lda)
+{
+    int info;
+
+#ifdef FLA_ENABLE_ILP64
+    int64_t info_64;
+    info_64 = LAPACKE_spotri(LAPACK_COL_MAJOR, uplo, n, A, lda);
+
+    info = info_64;
+#else
+    spotri_(&uplo, &n, A, &lda, &info);
+#endif
+
+    return info;
+}
+
+template <>
+int ref_potri(char uplo, int n, double* A, int lda)
+{
+    int info;
+
+#ifdef FLA_ENABLE_ILP64
+    int64_t info_64;
+    info_64 = LAPACKE_dpotri(LAPACK_COL_MAJOR, uplo, n, A, lda);
+
+    info = info_64;
+#else
+    dpotri_(&uplo, &n, A, &lda, &info);
+#endif
+
+    return info;
+}
+
+template <>
+int ref_potri(char uplo, int n, hipblasComplex* A, int lda)
+{
+    int info;
+
+#ifdef FLA_ENABLE_ILP64
+    int64_t info_64;
+    info_64 = LAPACKE_cpotri(LAPACK_COL_MAJOR, uplo, n, (lapack_complex_float*)A, lda);
+
+    info = info_64;
+#else
+    cpotri_(&uplo, &n, A, &lda, &info);
+#endif
+
+    return info;
+}
+
+template <>
+int ref_potri(char uplo, int n, hipblasDoubleComplex* A, int lda)
+{
+    int info;
+
+#ifdef FLA_ENABLE_ILP64
+    int64_t info_64;
+    info_64 = LAPACKE_zpotri(LAPACK_COL_MAJOR, uplo, n, (lapack_complex_double*)A, lda);
+
+    info = info_64;
+#else
+    zpotri_(&uplo, &n, A, &lda, &info);
+#endif
+
+    return info;
+}
+
 // getrf
 template <>
 int ref_getrf<float>(int m, int n, float* A, int lda, int* ipiv)
@@ -4501,3 +4951,34 @@ int ref_gels<hipblasDoubleComplex>(char                  trans,
 }
 
 #endif
+
+/*
+ * ===========================================================================
+ *    threading
+ * ===========================================================================
+ */
+
+// Set by blis_interface.cpp when BLIS is linked
+int (*ref_set_blis_threads)(int) = nullptr;
+
+#ifndef WIN32
+// Defined only when OpenBLAS is linked
+extern "C" int  openblas_get_num_threads() __attribute__((weak));
+extern "C" void openblas_set_num_threads(int) __attribute__((weak));
+#endif
+
+int ref_set_blas_threads(int threads)
+{
+    if(ref_set_blis_threads)
+        return ref_set_blis_threads(threads);
+
+#ifndef WIN32
+    if(openblas_get_num_threads && openblas_set_num_threads)
+    {
+        int previous = openblas_get_num_threads();
+        openblas_set_num_threads(threads);
+        return previous;
+    }
+#endif
+    return 0;
+}
@@ -162,8 +162,11 @@
 #include "blas3/testing_geam_batched.hpp"
 #include "blas3/testing_geam_strided_batched.hpp"
 #include "blas3/testing_gemm.hpp"
+#include "blas3/testing_gemm3m.hpp"
 #include "blas3/testing_gemm_batched.hpp"
+#include "blas3/testing_gemm_out_of_core.hpp"
 #include "blas3/testing_gemm_strided_batched.hpp"
+#include "blas3/testing_gemm_strided_batched_out_of_core.hpp"
 #include "blas3/testing_hemm.hpp"
 #include "blas3/testing_hemm_batched.hpp"
 #include "blas3/testing_hemm_strided_batched.hpp"
@@ -197,6 +200,10 @@
 #include "blas3/testing_trtri.hpp"
 #include "blas3/testing_trtri_batched.hpp"
 #include "blas3/testing_trtri_strided_batched.hpp"
+#include "blas3/testing_xt_gemm.hpp"
+#include "blas3/testing_xt_symm.hpp"
+#include "blas3/testing_xt_syrk.hpp"
+#include "blas3/testing_xt_trsm.hpp"
 #include "syrkx_reference.hpp"
 // blas_ex
 #include "blas_ex/testing_axpy_batched_ex.hpp"
@@ -207,6 +214,10 @@
 #include "blas_ex/testing_dot_strided_batched_ex.hpp"
 #include "blas_ex/testing_gemm_batched_ex.hpp"
 #include "blas_ex/testing_gemm_ex.hpp"
+#include "blas_ex/testing_gemm_ex_with_epilogue.hpp"
+#include "blas_ex/testing_gemm_grouped_batched_ex.hpp"
+#include "blas_ex/testing_gemm_packed_ex.hpp"
+#include "blas_ex/testing_gemm_scaled_ex.hpp"
 #include "blas_ex/testing_gemm_strided_batched_ex.hpp"
 #include "blas_ex/testing_nrm2_batched_ex.hpp"
 #include "blas_ex/testing_nrm2_ex.hpp"
@@ -236,9 +247,21 @@
 #include "solver/testing_getrf_strided_batched.hpp"
 #include "solver/testing_getri_batched.hpp"
 #include "solver/testing_getri_npvt_batched.hpp"
+#include "solver/testing_gesv.hpp"
+#include "solver/testing_gesv_batched.hpp"
+#include "solver/testing_gesv_strided_batched.hpp"
 #include "solver/testing_getrs.hpp"
 #include "solver/testing_getrs_batched.hpp"
 #include "solver/testing_getrs_strided_batched.hpp"
+#include "solver/testing_potrf.hpp"
+#include "solver/testing_potrf_batched.hpp"
+#include "solver/testing_potrf_strided_batched.hpp"
+#include "solver/testing_potri.hpp"
+#include "solver/testing_potri_batched.hpp"
+#include "solver/testing_potri_strided_batched.hpp"
+#include "solver/testing_potrs.hpp"
+#include "solver/testing_potrs_batched.hpp"
+#include "solver/testing_potrs_strided_batched.hpp"
 #endif
 
 #include "utility.h"
@@ -419,9 +442,20 @@ void get_test_name(const Arguments& arg, std::string& name)
         {"gemm", testname_gemm},
         {"gemm_batched", testname_gemm_batched},
         {"gemm_strided_batched", testname_gemm_strided_batched},
+        {"gemm_out_of_core", testname_gemm_out_of_core},
+        {"gemm_strided_batched_out_of_core", testname_gemm_strided_batched_out_of_core},
+        {"gemm3m", testname_gemm3m},
+        {"gemm3m_batched", testname_gemm3m},
+        {"gemm3m_strided_batched", testname_gemm3m},
         {"gemm_ex", testname_gemm_ex},
         {"gemm_batched_ex", testname_gemm_batched_ex},
         {"gemm_strided_batched_ex", testname_gemm_strided_batched_ex},
+        {"gemm_grouped_batched_ex", testname_gemm_grouped_batched_ex},
+        {"gemm_ex_with_epilogue", testname_gemm_ex_with_epilogue},
+        {"gemm_packed_ex", testname_gemm_packed_ex},
+        {"gemm_scaled_ex", testname_gemm_scaled_ex},
+        {"gemm_batched_scaled_ex", testname_gemm_scaled_ex},
+        {"gemm_strided_batched_scaled_ex", testname_gemm_scaled_ex},
         {"hemm", testname_hemm},
         {"hemm_batched", testname_hemm_batched},
         {"hemm_strided_batched", testname_hemm_strided_batched},
@@ -458,6 +492,10 @@ void get_test_name(const Arguments& arg, std::string& name)
         {"trtri", testname_trtri},
         {"trtri_batched", testname_trtri_batched},
         {"trtri_strided_batched", testname_trtri_strided_batched},
+        {"xt_gemm", testname_xt_gemm},
+        {"xt_syrk", testname_xt_syrk},
+        {"xt_trsm", testname_xt_trsm},
+        {"xt_symm", testname_xt_symm},
 
 #ifdef __HIP_PLATFORM_SOLVER__
         {"geqrf", testname_geqrf},
@@ -471,9 +509,21 @@ void get_test_name(const Arguments& arg, std::string& name)
         {"getrf_npvt_strided_batched", testname_getrf_npvt_strided_batched},
         {"getri_batched", testname_getri_batched},
         {"getri_npvt_batched", testname_getri_npvt_batched},
+        {"gesv", testname_gesv},
+        {"gesv_batched", testname_gesv_batched},
+        {"gesv_strided_batched", testname_gesv_strided_batched},
         {"getrs", testname_getrs},
         {"getrs_batched", testname_getrs_batched},
         {"getrs_strided_batched", testname_getrs_strided_batched},
+        {"potrf", testname_potrf},
+        {"potrf_batched", testname_potrf_batched},
+        {"potrf_strided_batched", testname_potrf_strided_batched},
+        {"potri", testname_potri},
+        {"potri_batched", testname_potri_batched},
+        {"potri_strided_batched", testname_potri_strided_batched},
+        {"potrs", testname_potrs},
+        {"potrs_batched", testname_potrs_batched},
+        {"potrs_strided_batched", testname_potrs_strided_batched},
         {"gels", testname_gels},
         {"gels_batched", testname_gels_batched},
         {"gels_strided_batched", testname_gels_strided_batched},
@@ -512,6 +562,85 @@ struct perf_gemm_ex<Ti,
         static const func_map map = {
             {"gemm_ex", testing_gemm_ex<Ti, To, Tc>},
             {"gemm_batched_ex", testing_gemm_batched_ex<Ti, To, Tc>},
+            {"gemm_grouped_batched_ex", testing_gemm_grouped_batched_ex<Ti, To, Tc>},
+        };
+        run_function(map, arg);
+    }
+};
+
+// Template to dispatch testing_gemm_ex_with_epilogue for performance tests
+// Only Ti == To == Tc == float or double is valid
+template <typename Ti, typename To = Ti, typename Tc = To, typename = void>
+struct perf_gemm_ex_with_epilogue : hipblas_test_invalid
+{
+};
+
+template <typename Ti, typename To, typename Tc>
+struct perf_gemm_ex_with_epilogue<
+    Ti,
+    To,
+    Tc,
+    std::enable_if_t<std::is_same<Ti, To>{} && std::is_same<Ti, Tc>{}
+                     && (std::is_same<Ti, float>{} || std::is_same<Ti, double>{})>>
+    : hipblas_test_valid
+{
+    void operator()(const Arguments& arg)
+    {
+        static const func_map map = {
+            {"gemm_ex_with_epilogue", testing_gemm_ex_with_epilogue<Ti, To, Tc>},
+        };
+        run_function(map, arg);
+    }
+};
+
+// Template to dispatch testing_gemm_packed_ex for performance tests
+// Only Ti == To == Tc == float, double, hipblasComplex or hipblasDoubleComplex is valid
+template <typename Ti, typename To = Ti, typename Tc = To, typename = void>
+struct perf_gemm_packed_ex : hipblas_test_invalid
+{
+};
+
+template <typename Ti, typename To, typename Tc>
+struct perf_gemm_packed_ex<
+    Ti,
+    To,
+    Tc,
+    std::enable_if_t<std::is_same<Ti, To>{} && std::is_same<Ti, Tc>{}
+                     && (std::is_same<Ti, float>{} || std::is_same<Ti, double>{}
+                         || std::is_same<Ti, hipblasComplex>{}
+                         || std::is_same<Ti, hipblasDoubleComplex>{})>> : hipblas_test_valid
+{
+    void operator()(const Arguments& arg)
+    {
+        static const func_map map = {
+            {"gemm_packed_ex", testing_gemm_packed_ex<Ti, To, Tc>},
+        };
+        run_function(map, arg);
+    }
+};
+
+// Template to dispatch testing_gemm_scaled_ex for performance tests
+// A and B are FP8, so only Tc == float with To == float, hipblasHalf or hipblasBfloat16 is valid
+template <typename Ti, typename To = Ti, typename Tc = To, typename = void>
+struct perf_gemm_scaled_ex : hipblas_test_invalid
+{
+};
+
+template <typename Ti, typename To, typename Tc>
+struct perf_gemm_scaled_ex<
+    Ti,
+    To,
+    Tc,
+    std::enable_if_t<std::is_same<Tc, float>{}
+                     && (std::is_same<To, float>{} || std::is_same<To, hipblasHalf>{}
+                         || std::is_same<To, hipblasBfloat16>{})>> : hipblas_test_valid
+{
+    void operator()(const Arguments& arg)
+    {
+        static const func_map map = {
+            {"gemm_scaled_ex", testing_gemm_scaled_ex<Ti, To, Tc>},
+            {"gemm_batched_scaled_ex", testing_gemm_batched_scaled_ex<Ti, To, Tc>},
+            {"gemm_strided_batched_scaled_ex", testing_gemm_strided_batched_scaled_ex<Ti, To, Tc>},
         };
         run_function(map, arg);
     }
@@ -655,6 +784,8 @@ struct perf_blas<T, U, std::enable_if_t<std::is_same<T, float>{} || std::is_same
             {"gemm", testing_gemm<T>},
             {"gemm_batched", testing_gemm_batched<T>},
             {"gemm_strided_batched", testing_gemm_strided_batched<T>},
+            {"gemm_out_of_core", testing_gemm_out_of_core<T>},
+            {"gemm_strided_batched_out_of_core", testing_gemm_strided_batched_out_of_core<T>},
             {"symm", testing_symm<T>},
             {"symm_batched", testing_symm_batched<T>},
             {"symm_strided_batched", testing_symm_strided_batched<T>},
@@ -667,6 +798,10 @@ struct perf_blas<T, U, std::enable_if_t<std::is_same<T, float>{} || std::is_same
             {"trtri", testing_trtri<T>},
             {"trtri_batched", testing_trtri_batched<T>},
             {"trtri_strided_batched", testing_trtri_strided_batched<T>},
+            {"xt_gemm", testing_xt_gemm<T>},
+            {"xt_syrk", testing_xt_syrk<T>},
+            {"xt_trsm", testing_xt_trsm<T>},
+            {"xt_symm", testing_xt_symm<T>},
             {"syrkx", testing_syrkx<T>},
             {"syrkx_batched", testing_syrkx_batched<T>},
             {"syrkx_strided_batched", testing_syrkx_strided_batched<T>},
@@ -689,9 +824,21 @@ struct perf_blas<T, U, std::enable_if_t<std::is_same<T, float>{} || std::is_same
             {"getrf_npvt_strided_batched", testing_getrf_npvt_strided_batched<T>},
             {"getri_batched", testing_getri_batched<T>},
             {"getri_npvt_batched", testing_getri_npvt_batched<T>},
+            {"gesv", testing_gesv<T>},
+            {"gesv_batched", testing_gesv_batched<T>},
+            {"gesv_strided_batched", testing_gesv_strided_batched<T>},
             {"getrs", testing_getrs<T>},
             {"getrs_batched", testing_getrs_batched<T>},
             {"getrs_strided_batched", testing_getrs_strided_batched<T>},
+            {"potrf", testing_potrf<T>},
+            {"potrf_batched", testing_potrf_batched<T>},
+            {"potrf_strided_batched", testing_potrf_strided_batched<T>},
+            {"potri", testing_potri<T>},
+            {"potri_batched", testing_potri_batched<T>},
+            {"potri_strided_batched", testing_potri_strided_batched<T>},
+            {"potrs", testing_potrs<T>},
+            {"potrs_batched", testing_potrs_batched<T>},
+            {"potrs_strided_batched", testing_potrs_strided_batched<T>},
             {"gels", testing_gels<T>},
             {"gels_batched", testing_gels_batched<T>},
             {"gels_strided_batched", testing_gels_strided_batched<T>},
@@ -862,6 +1009,11 @@ struct perf_blas<
             {"gemm", testing_gemm<T>},
             {"gemm_batched", testing_gemm_batched<T>},
             {"gemm_strided_batched", testing_gemm_strided_batched<T>},
+            {"gemm_out_of_core", testing_gemm_out_of_core<T>},
+            {"gemm_strided_batched_out_of_core", testing_gemm_strided_batched_out_of_core<T>},
+            {"gemm3m", testing_gemm3m<T>},
+            {"gemm3m_batched", testing_gemm3m_batched<T>},
+            {"gemm3m_strided_batched", testing_gemm3m_strided_batched<T>},
             {"hemm", testing_hemm<T>},
             {"hemm_batched", testing_hemm_batched<T>},
             {"hemm_strided_batched", testing_hemm_strided_batched<T>},
@@ -886,6 +1038,10 @@ struct perf_blas<
             {"trtri", testing_trtri<T>},
             {"trtri_batched", testing_trtri_batched<T>},
             {"trtri_strided_batched", testing_trtri_strided_batched<T>},
+            {"xt_gemm", testing_xt_gemm<T>},
+            {"xt_syrk", testing_xt_syrk<T>},
+            {"xt_trsm", testing_xt_trsm<T>},
+            {"xt_symm", testing_xt_symm<T>},
             {"syrkx", testing_syrkx<T>},
             {"syrkx_batched", testing_syrkx_batched<T>},
             {"syrkx_strided_batched", testing_syrkx_strided_batched<T>},
@@ -911,9 +1067,21 @@ struct perf_blas<
             {"getrf_npvt_strided_batched", testing_getrf_npvt_strided_batched<T>},
             {"getri_batched", testing_getri_batched<T>},
             {"getri_npvt_batched", testing_getri_npvt_batched<T>},
+            {"gesv", testing_gesv<T>},
+            {"gesv_batched", testing_gesv_batched<T>},
+            {"gesv_strided_batched", testing_gesv_strided_batched<T>},
             {"getrs", testing_getrs<T>},
             {"getrs_batched", testing_getrs_batched<T>},
             {"getrs_strided_batched", testing_getrs_strided_batched<T>},
+            {"potrf", testing_potrf<T>},
+            {"potrf_batched", testing_potrf_batched<T>},
+            {"potrf_strided_batched", testing_potrf_strided_batched<T>},
+            {"potri", testing_potri<T>},
+            {"potri_batched", testing_potri_batched<T>},
+            {"potri_strided_batched", testing_potri_strided_batched<T>},
+            {"potrs", testing_potrs<T>},
+            {"potrs_batched", testing_potrs_batched<T>},
+            {"potrs_strided_batched", testing_potrs_strided_batched<T>},
             {"gels", testing_gels<T>},
             {"gels_batched", testing_gels_batched<T>},
             {"gels_strided_batched", testing_gels_strided_batched<T>},
@@ -1208,7 +1376,11 @@ int run_bench_test(Arguments& arg, int unit_check, int timing)
     if(!strncmp(function, prefix, sizeof(prefix) - 1))
         function += sizeof(prefix) - 1;
 
-    if(!strcmp(function, "gemm") || !strcmp(function, "gemm_batched"))
+    if(!strcmp(function, "gemm") || !strcmp(function, "gemm_batched")
+       || !strcmp(function, "gemm3m") || !strcmp(function, "gemm3m_batched")
+       || !strcmp(function, "gemm3m_strided_batched") || !strcmp(function, "xt_gemm")
+       || !strcmp(function, "gemm_out_of_core")
+       || !strcmp(function, "gemm_strided_batched_out_of_core"))
     {
         // adjust dimension for GEMM routines
         int64_t min_lda = arg.transA == 'N' ? arg.M : arg.K;
@@ -1282,7 +1454,11 @@ int run_bench_test(Arguments& arg, int unit_check, int timing)
         }
     }
 
-    if(!strcmp(function, "gemm_ex") || !strcmp(function, "gemm_batched_ex"))
+    if(!strcmp(function, "gemm_ex") || !strcmp(function, "gemm_batched_ex")
+       || !strcmp(function, "gemm_grouped_batched_ex")
+       || !strcmp(function, "gemm_ex_with_epilogue") || !strcmp(function, "gemm_packed_ex")
+       || !strcmp(function, "gemm_scaled_ex") || !strcmp(function, "gemm_batched_scaled_ex")
+       || !strcmp(function, "gemm_strided_batched_scaled_ex"))
     {
         // adjust dimension for GEMM routines
         int64_t min_lda = arg.transA == 'N' ? arg.M : arg.K;
@@ -1310,7 +1486,15 @@ int run_bench_test(Arguments& arg, int unit_check, int timing)
             std::cout << "hipblas-bench INFO: ldd < min_ldd, set ldd = " << min_ldc << std::endl;
             arg.ldd = min_ldd;
         }
-        hipblas_gemm_dispatch<perf_gemm_ex>(arg);
+        if(!strcmp(function, "gemm_ex_with_epilogue"))
+            hipblas_gemm_dispatch<perf_gemm_ex_with_epilogue>(arg);
+        else if(!strcmp(function, "gemm_packed_ex"))
+            hipblas_gemm_dispatch<perf_gemm_packed_ex>(arg);
+        else if(!strcmp(function, "gemm_scaled_ex") || !strcmp(function, "gemm_batched_scaled_ex")
+                || !strcmp(function, "gemm_strided_batched_scaled_ex"))
+            hipblas_gemm_dispatch<perf_gemm_scaled_ex>(arg);
+        else
+            hipblas_gemm_dispatch<perf_gemm_ex>(arg);
     }
     else if(!strcmp(function, "gemm_strided_batched_ex"))
     {
@@ -14306,5 +14306,278 @@ hipblasStatus_t hipblasZgelsStridedBatchedCast(hipblasHandle_t       handle,
                                       batchCount);
 }
 
+// potrf
+hipblasStatus_t hipblasCpotrfCast(hipblasHandle_t         handle,
+                                  const hipblasFillMode_t uplo,
+                                  const int               n,
+                                  hipblasComplex*         A,
+                                  const int               lda,
+                                  int*                    info)
+{
+    return hipblasCpotrf(handle, uplo, n, (hipComplex*)A, lda, info);
+}
+
+hipblasStatus_t hipblasZpotrfCast(hipblasHandle_t         handle,
+                                  const hipblasFillMode_t uplo,
+                                  const int               n,
+                                  hipblasDoubleComplex*   A,
+                                  const int               lda,
+                                  int*                    info)
+{
+    return hipblasZpotrf(handle, uplo, n, (hipDoubleComplex*)A, lda, info);
+}
+
+// potrf_batched
+hipblasStatus_t hipblasCpotrfBatchedCast(hipblasHandle_t         handle,
+                                         const hipblasFillMode_t uplo,
+                                         const int               n,
+                                         hipblasComplex* const   A[],
+                                         const int               lda,
+                                         int*                    info,
+                                         const int               batchCount)
+{
+    return hipblasCpotrfBatched(handle, uplo, n, (hipComplex* const*)A, lda, info, batchCount);
+}
+
+hipblasStatus_t hipblasZpotrfBatchedCast(hipblasHandle_t             handle,
+                                         const hipblasFillMode_t     uplo,
+                                         const int                   n,
+                                         hipblasDoubleComplex* const A[],
+                                         const int                   lda,
+                                         int*                        info,
+                                         const int                   batchCount)
+{
+    return hipblasZpotrfBatched(
+        handle, uplo, n, (hipDoubleComplex* const*)A, lda, info, batchCount);
+}
+
+// potrf_strided_batched
+hipblasStatus_t hipblasCpotrfStridedBatchedCast(hipblasHandle_t         handle,
+                                                const hipblasFillMode_t uplo,
+                                                const int               n,
+                                                hipblasComplex*         A,
+                                                const int               lda,
+                                                const hipblasStride     strideA,
+                                                int*                    info,
+                                                const int               batchCount)
+{
+    return hipblasCpotrfStridedBatched(
+        handle, uplo, n, (hipComplex*)A, lda, strideA, info, batchCount);
+}
+
+hipblasStatus_t hipblasZpotrfStridedBatchedCast(hipblasHandle_t         handle,
+                                                const hipblasFillMode_t uplo,
+                                                const int               n,
+                                                hipblasDoubleComplex*   A,
+                                                const int               lda,
+                                                const hipblasStride     strideA,
+                                                int*                    info,
+                                                const int               batchCount)
+{
+    return hipblasZpotrfStridedBatched(
+        handle, uplo, n, (hipDoubleComplex*)A, lda, strideA, info, batchCount);
+}
+
+// potrs
+hipblasStatus_t hipblasCpotrsCast(hipblasHandle_t         handle,
+                                  const hipblasFillMode_t uplo,
+                                  const int               n,
+                                  const int               nrhs,
+                                  hipblasComplex*         A,
+                                  const int               lda,
+                                  hipblasComplex*         B,
+                                  const int               ldb,
+                                  int*                    info)
+{
+    return hipblasCpotrs(handle, uplo, n, nrhs, (hipComplex*)A, lda, (hipComplex*)B, ldb, info);
+}
+
+hipblasStatus_t hipblasZpotrsCast(hipblasHandle_t         handle,
+                                  const hipblasFillMode_t uplo,
+                                  const int               n,
+                                  const int               nrhs,
+                                  hipblasDoubleComplex*   A,
+                                  const int               lda,
+                                  hipblasDoubleComplex*   B,
+                                  const int               ldb,
+                                  int*                    info)
+{
+    return hipblasZpotrs(
+        handle, uplo, n, nrhs, (hipDoubleComplex*)A, lda, (hipDoubleComplex*)B, ldb, info);
+}
+
+// potrs_batched
+hipblasStatus_t hipblasCpotrsBatchedCast(hipblasHandle_t         handle,
+                                         const hipblasFillMode_t uplo,
+                                         const int               n,
+                                         const int               nrhs,
+                                         hipblasComplex* const   A[],
+                                         const int               lda,
+                                         hipblasComplex* const   B[],
+                                         const int               ldb,
+                                         int*                    info,
+                                         const int               batchCount)
+{
+    return hipblasCpotrsBatched(handle,
+                                uplo,
+                                n,
+                                nrhs,
+                                (hipComplex* const*)A,
+                                lda,
+                                (hipComplex* const*)B,
+                                ldb,
+                                info,
+                                batchCount);
+}
+
+hipblasStatus_t hipblasZpotrsBatchedCast(hipblasHandle_t             handle,
+                                         const hipblasFillMode_t     uplo,
+                                         const int                   n,
+                                         const int                   nrhs,
+                                         hipblasDoubleComplex* const A[],
+                                         const int                   lda,
+                                         hipblasDoubleComplex* const B[],
+                                         const int                   ldb,
+                                         int*                        info,
+                                         const int                   batchCount)
+{
+    return hipblasZpotrsBatched(handle,
+                                uplo,
+                                n,
+                                nrhs,
+                                (hipDoubleComplex* const*)A,
+                                lda,
+                                (hipDoubleComplex* const*)B,
+                                ldb,
+                                info,
+                                batchCount);
+}
+
+// potrs_strided_batched
+hipblasStatus_t hipblasCpotrsStridedBatchedCast(hipblasHandle_t         handle,
+                                                const hipblasFillMode_t uplo,
+                                                const int               n,
+                                                const int               nrhs,
+                                                hipblasComplex*         A,
+                                                const int               lda,
+                                                const hipblasStride     strideA,
+                                                hipblasComplex*         B,
+                                                const int               ldb,
+                                                const hipblasStride     strideB,
+                                                int*                    info,
+                                                const int               batchCount)
+{
+    return hipblasCpotrsStridedBatched(handle,
+                                       uplo,
+                                       n,
+                                       nrhs,
+                                       (hipComplex*)A,
+                                       lda,
+                                       strideA,
+                                       (hipComplex*)B,
+                                       ldb,
+                                       strideB,
+                                       info,
+                                       batchCount);
+}
+
+hipblasStatus_t hipblasZpotrsStridedBatchedCast(hipblasHandle_t         handle,
+                                                const hipblasFillMode_t uplo,
+                                                const int               n,
+                                                const int               nrhs,
+                                                hipblasDoubleComplex*   A,
+                                                const int               lda,
+                                                const hipblasStride     strideA,
+                                                hipblasDoubleComplex*   B,
+                                                const int               ldb,
+                                                const hipblasStride     strideB,
+                                                int*                    info,
+                                                const int               batchCount)
+{
+    return hipblasZpotrsStridedBatched(handle,
+                                       uplo,
+                                       n,
+                                       nrhs,
+                                       (hipDoubleComplex*)A,
+                                       lda,
+                                       strideA,
+                                       (hipDoubleComplex*)B,
+                                       ldb,
+                                       strideB,
+                                       info,
+                                       batchCount);
+}
+
+// potri
+hipblasStatus_t hipblasCpotriCast(hipblasHandle_t         handle,
+                                  const hipblasFillMode_t uplo,
+                                  const int               n,
+                                  hipblasComplex*         A,
+                                  const int               lda,
+                                  int*                    info)
+{
+    return hipblasCpotri(handle, uplo, n, (hipComplex*)A, lda, info);
+}
+
+hipblasStatus_t hipblasZpotriCast(hipblasHandle_t         handle,
+                                  const hipblasFillMode_t uplo,
+                                  const int               n,
+                                  hipblasDoubleComplex*   A,
+                                  const int               lda,
+                                  int*                    info)
+{
+    return hipblasZpotri(handle, uplo, n, (hipDoubleComplex*)A, lda, info);
+}
+
+// potri_batched
+hipblasStatus_t hipblasCpotriBatchedCast(hipblasHandle_t         handle,
+                                         const hipblasFillMode_t uplo,
+                                         const int               n,
+                                         hipblasComplex* const   A[],
+                                         const int               lda,
+                                         int*                    info,
+                                         const int               batchCount)
+{
+    return hipblasCpotriBatched(handle, uplo, n, (hipComplex* const*)A, lda, info, batchCount);
+}
+
+hipblasStatus_t hipblasZpotriBatchedCast(hipblasHandle_t             handle,
+                                         const hipblasFillMode_t     uplo,
+                                         const int                   n,
+                                         hipblasDoubleComplex* const A[],
+                                         const int                   lda,
+                                         int*                        info,
+                                         const int                   batchCount)
+{
+    return hipblasZpotriBatched(
+        handle, uplo, n, (hipDoubleComplex* const*)A, lda, info, batchCount);
+}
+
+// potri_strided_batched
+hipblasStatus_t hipblasCpotriStridedBatchedCast(hipblasHandle_t         handle,
+                                                const hipblasFillMode_t uplo,
+                                                const int               n,
+                                                hipblasComplex*         A,
+                                                const int               lda,
+                                                const hipblasStride     strideA,
+                                                int*                    info,
+                                                const int               batchCount)
+{
+    return hipblasCpotriStridedBatched(
+        handle, uplo, n, (hipComplex*)A, lda, strideA, info, batchCount);
+}
+
+hipblasStatus_t hipblasZpotriStridedBatchedCast(hipblasHandle_t         handle,
+                                                const hipblasFillMode_t uplo,
+                                                const int               n,
+                                                hipblasDoubleComplex*   A,
+                                                const int               lda,
+                                                const hipblasStride     strideA,
+                                                int*                    info,
+                                                const int               batchCount)
+{
+    return hipblasZpotriStridedBatched(
+        handle, uplo, n, (hipDoubleComplex*)A, lda, strideA, info, batchCount);
+}
 #endif // solver
 #endif // HIPBLAS_V2
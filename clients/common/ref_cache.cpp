@@ -0,0 +1,454 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "ref_cache.hpp"
+#include "utility.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+
+#if __has_include(<filesystem>)
+#include <filesystem>
+namespace fs = std::filesystem;
+#elif __has_include(<experimental/filesystem>)
+#include <experimental/filesystem>
+namespace fs = std::experimental::filesystem;
+#else
+#error no filesystem found
+#endif
+
+#ifdef HIPBLAS_REF_CACHE_ZLIB
+#include <zlib.h>
+#endif
+
+//
+// An entry is the file <key hash>.ref in the cache directory, holding
+//
+//   ref_cache_header
+//   the key, key_bytes bytes
+//   the outputs in chunks of at most ref_cache_chunk bytes, none spanning two outputs,
+//   each a uint64_t pair of its raw and stored sizes followed by its stored bytes
+//
+// The chunks are deflated when the clients are built with zlib. payload_hash covers what
+// follows the key, and is checked before an entry is read into the outputs.
+//
+
+namespace
+{
+    constexpr char     ref_cache_magic[8] = {'H', 'B', 'R', 'E', 'F', 'C', '0', '1'};
+    constexpr uint64_t ref_cache_chunk    = uint64_t(64) << 20;
+
+    struct ref_cache_header
+    {
+        char     magic[8];
+        uint64_t key_bytes;
+        uint64_t raw_bytes;
+        uint64_t deflated;
+        uint64_t payload_hash;
+    };
+
+    // FNV-1a over 64-bit words, then over the remaining bytes. Each step is a bijection of
+    // the hash, so any change to one word or byte of the input changes the result.
+    constexpr uint64_t ref_cache_fnv_offset = 14695981039346656037ull;
+    constexpr uint64_t ref_cache_fnv_prime  = 1099511628211ull;
+
+    uint64_t ref_cache_hash(const void* data, size_t bytes, uint64_t hash = ref_cache_fnv_offset)
+    {
+        auto* p = static_cast<const unsigned char*>(data);
+        for(; bytes >= sizeof(uint64_t); bytes -= sizeof(uint64_t), p += sizeof(uint64_t))
+        {
+            uint64_t word;
+            std::memcpy(&word, p, sizeof(word));
+            hash = (hash ^ word) * ref_cache_fnv_prime;
+        }
+        for(; bytes; bytes--, p++)
+            hash = (hash ^ *p) * ref_cache_fnv_prime;
+        return hash;
+    }
+
+    template <typename T>
+    void ref_cache_append(std::string& key, const T& value)
+    {
+        if constexpr(std::is_array_v<T>)
+            key.append(value, strnlen(value, sizeof(value))).push_back('\0');
+        else
+            key.append(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+
+    // The exact description of a reference result: the cache format, the hipBLAS version,
+    // the generator seed, the Arguments, the reference tag and the outputs
+    std::string ref_cache_key(const Arguments&                     arg,
+                              const char*                          tag,
+                              const std::vector<ref_cache_buffer>& outputs)
+    {
+        static const uint64_t seed_hash = [] {
+            std::ostringstream os;
+            os << hipblas_seed;
+            std::string seed = os.str();
+            return ref_cache_hash(seed.data(), seed.size());
+        }();
+
+        std::string key(ref_cache_magic, sizeof(ref_cache_magic));
+        for(int version : {hipblasVersionMajor,
+                           hipblasVersionMinor,
+                           hipblasVersionPatch,
+                           hipblasVersionTweak})
+            ref_cache_append(key, version);
+        ref_cache_append(key, seed_hash);
+
+        // Fields which only select checks, timing or naming do not change the reference
+        auto append_field = [&](const char* name, const auto& value) {
+            for(const char* skip :
+                {"norm_check", "unit_check", "timing", "iters", "cold_iters", "name", "category"})
+                if(!strcmp(name, skip))
+                    return;
+            key.append(name).push_back('=');
+            ref_cache_append(key, value);
+        };
+
+#define APPEND_FIELD(NAME) append_field(#NAME, arg.NAME)
+        FOR_EACH_ARGUMENT(APPEND_FIELD, ;);
+#undef APPEND_FIELD
+
+        key.append(tag).push_back('\0');
+        for(const auto& output : outputs)
+        {
+            key.append(output.type).push_back('\0');
+            ref_cache_append(key, uint64_t(output.bytes));
+        }
+        return key;
+    }
+
+    const char* ref_cache_dir()
+    {
+        static const char* dir = [] {
+            const char* env = getenv("HIPBLAS_CLIENT_REF_CACHE");
+            if(!env || !*env)
+                return (const char*)nullptr;
+
+            std::error_code ec;
+            fs::create_directories(env, ec);
+            if(!fs::is_directory(env, ec))
+            {
+                std::cerr << "hipBLAS reference cache: " << env
+                          << " is not a directory, the cache is disabled" << std::endl;
+                return (const char*)nullptr;
+            }
+            return env;
+        }();
+        return dir;
+    }
+
+    uint64_t ref_cache_limit()
+    {
+        static const uint64_t limit = [] {
+            size_t gb  = 8;
+            auto*  env = getenv("HIPBLAS_CLIENT_REF_CACHE_GB_LIMIT");
+            if(env && sscanf(env, "%zu", &gb) != 1)
+                gb = 8;
+            return uint64_t(gb) << 30; // GB to B
+        }();
+        return limit;
+    }
+
+    fs::path ref_cache_path(const std::string& key)
+    {
+        char name[32];
+        snprintf(name,
+                 sizeof(name),
+                 "%016llx.ref",
+                 (unsigned long long)ref_cache_hash(key.data(), key.size()));
+        return fs::path(ref_cache_dir()) / name;
+    }
+
+    template <typename T>
+    bool ref_cache_read(std::istream& is, T& value)
+    {
+        return bool(is.read(reinterpret_cast<char*>(&value), sizeof(value)));
+    }
+
+    template <typename T>
+    void ref_cache_write(std::ostream& os, const T& value)
+    {
+        os.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+
+    // Checks the chunks that follow the key against the header, without writing the outputs
+    bool ref_cache_verify(std::istream& is, const ref_cache_header& header)
+    {
+        uint64_t          hash = ref_cache_fnv_offset, raw_total = 0;
+        std::vector<char> stored;
+        uint64_t          sizes[2];
+        while(raw_total < header.raw_bytes)
+        {
+            if(!ref_cache_read(is, sizes) || sizes[0] > ref_cache_chunk
+               || sizes[1] > 2 * ref_cache_chunk || (!header.deflated && sizes[1] != sizes[0]))
+                return false;
+
+            stored.resize(sizes[1]);
+            if(!is.read(stored.data(), sizes[1]))
+                return false;
+
+            hash = ref_cache_hash(sizes, sizeof(sizes), hash);
+            hash = ref_cache_hash(stored.data(), stored.size(), hash);
+            raw_total += sizes[0];
+        }
+        return raw_total == header.raw_bytes && is.peek() == EOF && hash == header.payload_hash;
+    }
+
+    // Reads the verified chunks into the outputs
+    bool ref_cache_decode(std::istream&                        is,
+                          const ref_cache_header&              header,
+                          const std::vector<ref_cache_buffer>& outputs)
+    {
+        std::vector<char> stored;
+        uint64_t          sizes[2];
+        for(const auto& output : outputs)
+        {
+            char* data = static_cast<char*>(output.data);
+            for(size_t done = 0; done < output.bytes; done += sizes[0])
+            {
+                if(!ref_cache_read(is, sizes) || sizes[0] > output.bytes - done)
+                    return false;
+
+                if(!header.deflated)
+                {
+                    if(!is.read(data + done, sizes[0]))
+                        return false;
+                    continue;
+                }
+
+#ifdef HIPBLAS_REF_CACHE_ZLIB
+                stored.resize(sizes[1]);
+                uLongf raw = uLongf(sizes[0]);
+                if(!is.read(stored.data(), sizes[1])
+                   || uncompress(reinterpret_cast<Bytef*>(data + done),
+                                 &raw,
+                                 reinterpret_cast<const Bytef*>(stored.data()),
+                                 uLong(sizes[1]))
+                          != Z_OK
+                   || raw != sizes[0])
+                    return false;
+#else
+                return false;
+#endif
+            }
+        }
+        return true;
+    }
+
+    // Removes the least recently used entries until the cache is within its size bound
+    void ref_cache_trim()
+    {
+        using entry = std::tuple<fs::file_time_type, uint64_t, fs::path>;
+
+        std::error_code    ec;
+        std::vector<entry> entries;
+        uint64_t           total = 0;
+
+        for(fs::directory_iterator it(ref_cache_dir(), ec), end; !ec && it != end; it.increment(ec))
+        {
+            const fs::path& path = it->path();
+            if(path.extension() != ".ref")
+                continue;
+
+            std::error_code entry_ec;
+            uint64_t        bytes = fs::file_size(path, entry_ec);
+            auto            time  = fs::last_write_time(path, entry_ec);
+            if(entry_ec)
+                continue;
+
+            entries.emplace_back(time, bytes, path);
+            total += bytes;
+        }
+
+        std::sort(entries.begin(), entries.end());
+        for(const auto& [time, bytes, path] : entries)
+        {
+            if(total <= ref_cache_limit())
+                break;
+            if(fs::remove(path, ec))
+                total -= bytes;
+        }
+    }
+} // namespace
+
+bool ref_cache_enabled()
+{
+    return ref_cache_dir() != nullptr;
+}
+
+bool ref_cache_load(const Arguments&                     arg,
+                    const char*                          tag,
+                    const std::vector<ref_cache_buffer>& outputs)
+{
+    if(!ref_cache_enabled())
+        return false;
+
+    std::string   key  = ref_cache_key(arg, tag, outputs);
+    fs::path      path = ref_cache_path(key);
+    std::ifstream is(path, std::ios::binary);
+    if(!is)
+        return false;
+
+    uint64_t raw_bytes = 0;
+    for(const auto& output : outputs)
+        raw_bytes += output.bytes;
+
+    // A different key under the same hash, or an entry deflated by a build without zlib, is a
+    // miss to be overwritten; any other inconsistency is corruption
+    ref_cache_header header;
+    std::string      entry_key;
+    bool             valid = ref_cache_read(is, header)
+                 && !memcmp(header.magic, ref_cache_magic, sizeof(ref_cache_magic));
+    if(valid && header.key_bytes == key.size())
+    {
+        entry_key.resize(key.size());
+        valid = bool(is.read(&entry_key[0], key.size()));
+    }
+
+    if(valid && entry_key == key)
+    {
+#ifndef HIPBLAS_REF_CACHE_ZLIB
+        if(header.deflated)
+            return false;
+#endif
+        auto payload = is.tellg();
+        valid        = header.raw_bytes == raw_bytes && ref_cache_verify(is, header);
+        if(valid)
+        {
+            is.clear();
+            is.seekg(payload);
+            if(!ref_cache_decode(is, header, outputs))
+                throw std::runtime_error("hipBLAS reference cache: failed to decode "
+                                         + path.string());
+
+            std::error_code ec;
+            fs::last_write_time(path, fs::file_time_type::clock::now(), ec);
+            return true;
+        }
+    }
+    else if(valid)
+        return false;
+
+    std::cerr << "hipBLAS reference cache: removing corrupt entry " << path.string() << std::endl;
+    is.close();
+    std::error_code ec;
+    fs::remove(path, ec);
+    return false;
+}
+
+void ref_cache_store(const Arguments&                     arg,
+                     const char*                          tag,
+                     const std::vector<ref_cache_buffer>& outputs)
+{
+    if(!ref_cache_enabled())
+        return;
+
+    std::string key  = ref_cache_key(arg, tag, outputs);
+    fs::path    path = ref_cache_path(key);
+
+    // Entries are written under a unique name then renamed, so that concurrent test processes
+    // sharing the cache only ever read complete entries
+    fs::path tmp = path;
+    tmp += "." + std::to_string(std::random_device{}()) + ".tmp";
+
+    ref_cache_header header{};
+    std::memcpy(header.magic, ref_cache_magic, sizeof(ref_cache_magic));
+    header.key_bytes = key.size();
+#ifdef HIPBLAS_REF_CACHE_ZLIB
+    header.deflated = 1;
+#endif
+    for(const auto& output : outputs)
+        header.raw_bytes += output.bytes;
+
+    std::ofstream os(tmp, std::ios::binary);
+    ref_cache_write(os, header);
+    os.write(key.data(), key.size());
+
+    uint64_t          hash = ref_cache_fnv_offset;
+    std::vector<char> stored;
+    for(const auto& output : outputs)
+    {
+        const char* data = static_cast<const char*>(output.data);
+        for(size_t done = 0; os && done < output.bytes; done += ref_cache_chunk)
+        {
+            uint64_t    sizes[2] = {std::min<uint64_t>(ref_cache_chunk, output.bytes - done)};
+            const char* chunk    = data + done;
+            sizes[1]             = sizes[0];
+
+#ifdef HIPBLAS_REF_CACHE_ZLIB
+            uLongf deflated = compressBound(uLong(sizes[0]));
+            stored.resize(deflated);
+            if(compress2(reinterpret_cast<Bytef*>(stored.data()),
+                         &deflated,
+                         reinterpret_cast<const Bytef*>(chunk),
+                         uLong(sizes[0]),
+                         Z_BEST_SPEED)
+               != Z_OK)
+                os.setstate(std::ios::failbit);
+            chunk    = stored.data();
+            sizes[1] = deflated;
+#endif
+
+            ref_cache_write(os, sizes);
+            os.write(chunk, sizes[1]);
+            hash = ref_cache_hash(sizes, sizeof(sizes), hash);
+            hash = ref_cache_hash(chunk, sizes[1], hash);
+        }
+    }
+
+    header.payload_hash = hash;
+    os.seekp(0);
+    ref_cache_write(os, header);
+    os.close();
+
+    std::error_code ec;
+    if(os)
+    {
+        fs::rename(tmp, path, ec);
+        if(ec)
+        {
+            // Windows does not replace an existing file on rename
+            fs::remove(path, ec);
+            fs::rename(tmp, path, ec);
+        }
+    }
+    if(!os || ec)
+    {
+        fs::remove(tmp, ec);
+        return;
+    }
+
+    ref_cache_trim();
+}
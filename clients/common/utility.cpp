@@ -36,6 +36,7 @@
 #include <cstring>
 #include <stdexcept>
 #include <stdlib.h>
+#include <vector>
 
 #ifdef WIN32
 #define strcasecmp(A, B) _stricmp(A, B)
@@ -248,6 +249,43 @@ hipblasLocalHandle::~hipblasLocalHandle()
     }
 }
 
+hipblasLocalXtHandle::hipblasLocalXtHandle(int block_dim)
+{
+    auto status = hipblasXtCreate(&m_handle);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        throw std::runtime_error(hipblasStatusToString(status));
+
+    int count = 0;
+    if(hipGetDeviceCount(&count) != hipSuccess)
+        status = HIPBLAS_STATUS_INTERNAL_ERROR;
+    if(status == HIPBLAS_STATUS_SUCCESS)
+    {
+        std::vector<int> devices(count);
+        for(int i = 0; i < count; i++)
+            devices[i] = i;
+        status = hipblasXtDeviceSelect(m_handle, count, devices.data());
+    }
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasXtSetBlockDim(m_handle, block_dim);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblasXtDestroy(m_handle);
+        throw std::runtime_error(hipblasStatusToString(status));
+    }
+}
+
+hipblasLocalXtHandle::~hipblasLocalXtHandle()
+{
+    hipblasStatus_t status = hipblasXtDestroy(m_handle);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        std::cerr << "hipblasXtDestroy error: " << hipblasStatusToString(status) << "\n";
+#ifdef GOOGLE_TEST
+        EXPECT_EQ(status, HIPBLAS_STATUS_SUCCESS);
+#endif
+    }
+}
+
 /*******************************************************************************
  * \brief convert hipError_t to hipblasStatus_t
  * TODO - enumerate library calls to hip runtime, enumerate possible errors from those calls
@@ -23,6 +23,12 @@
 #include "auxil/testing_set_get_atomics_mode.hpp"
 #include "auxil/testing_set_get_math_mode.hpp"
 #include "auxil/testing_set_get_pointer_mode.hpp"
+#include "auxil/testing_capture.hpp"
+#include "auxil/testing_handle_pool.hpp"
+#include "auxil/testing_prefetch.hpp"
+#include "auxil/testing_set_workspace.hpp"
+#include "auxil/testing_stats.hpp"
+#include "auxil/testing_workspace_cache_stats.hpp"
 #include "hipblas_data.hpp"
 #include "hipblas_test.hpp"
 #include "type_dispatch.hpp"
@@ -35,6 +41,12 @@ namespace
         SG_POINTER,
         SG_ATOMICS,
         SG_MATH,
+        WORKSPACE_CACHE,
+        SET_WORKSPACE,
+        CAPTURE,
+        HANDLE_POOL,
+        STATS,
+        PREFETCH,
     };
 
     // aux test template
@@ -72,6 +84,18 @@ namespace
                 return !strcmp(arg.function, "set_get_atomics_mode");
             case SG_MATH:
                 return !strcmp(arg.function, "set_get_math_mode");
+            case WORKSPACE_CACHE:
+                return !strcmp(arg.function, "workspace_cache_stats");
+            case SET_WORKSPACE:
+                return !strcmp(arg.function, "set_workspace");
+            case CAPTURE:
+                return !strcmp(arg.function, "capture");
+            case HANDLE_POOL:
+                return !strcmp(arg.function, "handle_pool");
+            case STATS:
+                return !strcmp(arg.function, "stats");
+            case PREFETCH:
+                return !strcmp(arg.function, "prefetch");
             }
             return false;
         }
@@ -86,6 +110,18 @@ namespace
                 testname_set_get_atomics_mode(arg, name);
             else if constexpr(AUX_TYPE == SG_MATH)
                 testname_set_get_math_mode(arg, name);
+            else if constexpr(AUX_TYPE == WORKSPACE_CACHE)
+                testname_workspace_cache_stats(arg, name);
+            else if constexpr(AUX_TYPE == SET_WORKSPACE)
+                testname_set_workspace(arg, name);
+            else if constexpr(AUX_TYPE == CAPTURE)
+                testname_capture(arg, name);
+            else if constexpr(AUX_TYPE == HANDLE_POOL)
+                testname_handle_pool(arg, name);
+            else if constexpr(AUX_TYPE == STATS)
+                testname_stats(arg, name);
+            else if constexpr(AUX_TYPE == PREFETCH)
+                testname_prefetch(arg, name);
 
             return std::move(name);
         }
@@ -102,6 +138,18 @@ namespace
                 testing_set_get_atomics_mode(arg);
             else if(!strcmp(arg.function, "set_get_math_mode"))
                 testing_set_get_math_mode(arg);
+            else if(!strcmp(arg.function, "workspace_cache_stats"))
+                testing_workspace_cache_stats(arg);
+            else if(!strcmp(arg.function, "set_workspace"))
+                testing_set_workspace(arg);
+            else if(!strcmp(arg.function, "capture"))
+                testing_capture(arg);
+            else if(!strcmp(arg.function, "handle_pool"))
+                testing_handle_pool(arg);
+            else if(!strcmp(arg.function, "stats"))
+                testing_stats(arg);
+            else if(!strcmp(arg.function, "prefetch"))
+                testing_prefetch(arg);
             else
                 FAIL() << "Internal error: Test called with unknown function: " << arg.function;
         }
@@ -128,4 +176,46 @@ namespace
     }
     INSTANTIATE_TEST_CATEGORIES(set_get_math);
 
+    using workspace_cache = aux_mode_template<aux_mode_testing, WORKSPACE_CACHE>;
+    TEST_P(workspace_cache, aux)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(aux_mode_testing<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(workspace_cache);
+
+    using set_workspace = aux_mode_template<aux_mode_testing, SET_WORKSPACE>;
+    TEST_P(set_workspace, aux)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(aux_mode_testing<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(set_workspace);
+
+    using capture = aux_mode_template<aux_mode_testing, CAPTURE>;
+    TEST_P(capture, aux)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(aux_mode_testing<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(capture);
+
+    using handle_pool = aux_mode_template<aux_mode_testing, HANDLE_POOL>;
+    TEST_P(handle_pool, aux)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(aux_mode_testing<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(handle_pool);
+
+    using stats = aux_mode_template<aux_mode_testing, STATS>;
+    TEST_P(stats, aux)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(aux_mode_testing<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(stats);
+
+    using prefetch = aux_mode_template<aux_mode_testing, PREFETCH>;
+    TEST_P(prefetch, aux)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(aux_mode_testing<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(prefetch);
+
 } // namespace
@@ -21,8 +21,11 @@
  * ************************************************************************ */
 
 #include "blas3/testing_gemm.hpp"
+#include "blas3/testing_gemm3m.hpp"
 #include "blas3/testing_gemm_batched.hpp"
+#include "blas3/testing_gemm_out_of_core.hpp"
 #include "blas3/testing_gemm_strided_batched.hpp"
+#include "blas3/testing_gemm_strided_batched_out_of_core.hpp"
 #include "hipblas_data.hpp"
 #include "hipblas_test.hpp"
 #include "type_dispatch.hpp"
@@ -35,6 +38,11 @@ namespace
         GEMM,
         GEMM_BATCHED,
         GEMM_STRIDED_BATCHED,
+        GEMM3M,
+        GEMM3M_BATCHED,
+        GEMM3M_STRIDED_BATCHED,
+        GEMM_OUT_OF_CORE,
+        GEMM_STRIDED_BATCHED_OUT_OF_CORE,
     };
 
     // gemm test template
@@ -74,6 +82,20 @@ namespace
             case GEMM_STRIDED_BATCHED:
                 return !strcmp(arg.function, "gemm_strided_batched")
                        || !strcmp(arg.function, "gemm_strided_batched_bad_arg");
+            case GEMM3M:
+                return !strcmp(arg.function, "gemm3m") || !strcmp(arg.function, "gemm3m_bad_arg");
+            case GEMM3M_BATCHED:
+                return !strcmp(arg.function, "gemm3m_batched")
+                       || !strcmp(arg.function, "gemm3m_batched_bad_arg");
+            case GEMM3M_STRIDED_BATCHED:
+                return !strcmp(arg.function, "gemm3m_strided_batched")
+                       || !strcmp(arg.function, "gemm3m_strided_batched_bad_arg");
+            case GEMM_OUT_OF_CORE:
+                return !strcmp(arg.function, "gemm_out_of_core")
+                       || !strcmp(arg.function, "gemm_out_of_core_bad_arg");
+            case GEMM_STRIDED_BATCHED_OUT_OF_CORE:
+                return !strcmp(arg.function, "gemm_strided_batched_out_of_core")
+                       || !strcmp(arg.function, "gemm_strided_batched_out_of_core_bad_arg");
             }
             return false;
         }
@@ -88,6 +110,12 @@ namespace
                 testname_gemm_batched(arg, name);
             else if constexpr(GEMM_TYPE == GEMM_STRIDED_BATCHED)
                 testname_gemm_strided_batched(arg, name);
+            else if constexpr(GEMM_TYPE == GEMM_OUT_OF_CORE)
+                testname_gemm_out_of_core(arg, name);
+            else if constexpr(GEMM_TYPE == GEMM_STRIDED_BATCHED_OUT_OF_CORE)
+                testname_gemm_strided_batched_out_of_core(arg, name);
+            else
+                testname_gemm3m(arg, name);
             return std::move(name);
         }
     };
@@ -129,6 +157,68 @@ namespace
         }
     };
 
+    // gemm3m is only for the complex types
+    template <typename, typename = void>
+    struct gemm3m_testing : hipblas_test_invalid
+    {
+    };
+
+    template <typename T>
+    struct gemm3m_testing<
+        T,
+        std::enable_if_t<
+            std::is_same_v<T, hipblasComplex> || std::is_same_v<T, hipblasDoubleComplex>>>
+        : hipblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "gemm3m"))
+                testing_gemm3m<T>(arg);
+            else if(!strcmp(arg.function, "gemm3m_bad_arg"))
+                testing_gemm3m_bad_arg<T>(arg);
+            else if(!strcmp(arg.function, "gemm3m_batched"))
+                testing_gemm3m_batched<T>(arg);
+            else if(!strcmp(arg.function, "gemm3m_batched_bad_arg"))
+                testing_gemm3m_batched_bad_arg<T>(arg);
+            else if(!strcmp(arg.function, "gemm3m_strided_batched"))
+                testing_gemm3m_strided_batched<T>(arg);
+            else if(!strcmp(arg.function, "gemm3m_strided_batched_bad_arg"))
+                testing_gemm3m_strided_batched_bad_arg<T>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    // The out-of-core functions are for the single, double and complex types
+    template <typename, typename = void>
+    struct gemm_out_of_core_testing : hipblas_test_invalid
+    {
+    };
+
+    template <typename T>
+    struct gemm_out_of_core_testing<
+        T,
+        std::enable_if_t<
+            std::is_same_v<
+                T,
+                float> || std::is_same_v<T, double> || std::is_same_v<T, hipblasComplex> || std::is_same_v<T, hipblasDoubleComplex>>>
+        : hipblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "gemm_out_of_core"))
+                testing_gemm_out_of_core<T>(arg);
+            else if(!strcmp(arg.function, "gemm_out_of_core_bad_arg"))
+                testing_gemm_out_of_core_bad_arg<T>(arg);
+            else if(!strcmp(arg.function, "gemm_strided_batched_out_of_core"))
+                testing_gemm_strided_batched_out_of_core<T>(arg);
+            else if(!strcmp(arg.function, "gemm_strided_batched_out_of_core_bad_arg"))
+                testing_gemm_strided_batched_out_of_core_bad_arg<T>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
     using gemm = gemm_template<gemm_testing, GEMM>;
     TEST_P(gemm, blas3)
     {
@@ -150,4 +240,45 @@ namespace
     }
     INSTANTIATE_TEST_CATEGORIES(gemm_strided_batched);
 
+    using gemm3m = gemm_template<gemm3m_testing, GEMM3M>;
+    TEST_P(gemm3m, blas3)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_simple_dispatch<gemm3m_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(gemm3m);
+
+    using gemm3m_batched = gemm_template<gemm3m_testing, GEMM3M_BATCHED>;
+    TEST_P(gemm3m_batched, blas3)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_simple_dispatch<gemm3m_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(gemm3m_batched);
+
+    using gemm3m_strided_batched = gemm_template<gemm3m_testing, GEMM3M_STRIDED_BATCHED>;
+    TEST_P(gemm3m_strided_batched, blas3)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_simple_dispatch<gemm3m_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(gemm3m_strided_batched);
+
+    using gemm_out_of_core = gemm_template<gemm_out_of_core_testing, GEMM_OUT_OF_CORE>;
+    TEST_P(gemm_out_of_core, blas3)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_simple_dispatch<gemm_out_of_core_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(gemm_out_of_core);
+
+    using gemm_strided_batched_out_of_core
+        = gemm_template<gemm_out_of_core_testing, GEMM_STRIDED_BATCHED_OUT_OF_CORE>;
+    TEST_P(gemm_strided_batched_out_of_core, blas3)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_simple_dispatch<gemm_out_of_core_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(gemm_strided_batched_out_of_core);
+
 } // namespace
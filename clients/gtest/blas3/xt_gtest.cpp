@@ -0,0 +1,169 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "blas3/testing_xt_gemm.hpp"
+#include "blas3/testing_xt_symm.hpp"
+#include "blas3/testing_xt_syrk.hpp"
+#include "blas3/testing_xt_trsm.hpp"
+#include "hipblas_data.hpp"
+#include "hipblas_test.hpp"
+#include "type_dispatch.hpp"
+
+namespace
+{
+    // possible hipblasXt test cases
+    enum xt_test_type
+    {
+        XT_GEMM,
+        XT_SYRK,
+        XT_TRSM,
+        XT_SYMM,
+    };
+
+    // hipblasXt test template
+    template <template <typename...> class FILTER, xt_test_type XT_TYPE>
+    struct xt_template : HipBLAS_Test<xt_template<FILTER, XT_TYPE>, FILTER>
+    {
+        template <typename... T>
+        struct type_filter_functor
+        {
+            bool operator()(const Arguments& args)
+            {
+                // additional global filters applied first
+                if(!hipblas_client_global_filters(args))
+                    return false;
+
+                // type filters
+                return static_cast<bool>(FILTER<T...>{});
+            }
+        };
+
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments& arg)
+        {
+            return hipblas_simple_dispatch<xt_template::template type_filter_functor>(arg);
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            switch(XT_TYPE)
+            {
+            case XT_GEMM:
+                return !strcmp(arg.function, "xt_gemm") || !strcmp(arg.function, "xt_gemm_bad_arg");
+            case XT_SYRK:
+                return !strcmp(arg.function, "xt_syrk") || !strcmp(arg.function, "xt_syrk_bad_arg");
+            case XT_TRSM:
+                return !strcmp(arg.function, "xt_trsm") || !strcmp(arg.function, "xt_trsm_bad_arg");
+            case XT_SYMM:
+                return !strcmp(arg.function, "xt_symm") || !strcmp(arg.function, "xt_symm_bad_arg");
+            }
+            return false;
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            std::string name;
+            if constexpr(XT_TYPE == XT_GEMM)
+                testname_xt_gemm(arg, name);
+            else if constexpr(XT_TYPE == XT_SYRK)
+                testname_xt_syrk(arg, name);
+            else if constexpr(XT_TYPE == XT_TRSM)
+                testname_xt_trsm(arg, name);
+            else if constexpr(XT_TYPE == XT_SYMM)
+                testname_xt_symm(arg, name);
+            return std::move(name);
+        }
+    };
+
+    // By default, arbitrary type combinations are invalid.
+    // The unnamed second parameter is used for enable_if_t below.
+    template <typename, typename = void>
+    struct xt_testing : hipblas_test_invalid
+    {
+    };
+
+    // When the condition in the second argument is satisfied, the type combination
+    // is valid. When the condition is false, this specialization does not apply.
+    template <typename T>
+    struct xt_testing<
+        T,
+        std::enable_if_t<
+            std::is_same_v<
+                T,
+                float> || std::is_same_v<T, double> || std::is_same_v<T, hipblasComplex> || std::is_same_v<T, hipblasDoubleComplex>>>
+        : hipblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "xt_gemm"))
+                testing_xt_gemm<T>(arg);
+            else if(!strcmp(arg.function, "xt_gemm_bad_arg"))
+                testing_xt_gemm_bad_arg<T>(arg);
+            else if(!strcmp(arg.function, "xt_syrk"))
+                testing_xt_syrk<T>(arg);
+            else if(!strcmp(arg.function, "xt_syrk_bad_arg"))
+                testing_xt_syrk_bad_arg<T>(arg);
+            else if(!strcmp(arg.function, "xt_trsm"))
+                testing_xt_trsm<T>(arg);
+            else if(!strcmp(arg.function, "xt_trsm_bad_arg"))
+                testing_xt_trsm_bad_arg<T>(arg);
+            else if(!strcmp(arg.function, "xt_symm"))
+                testing_xt_symm<T>(arg);
+            else if(!strcmp(arg.function, "xt_symm_bad_arg"))
+                testing_xt_symm_bad_arg<T>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    using xt_gemm = xt_template<xt_testing, XT_GEMM>;
+    TEST_P(xt_gemm, blas3)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(hipblas_simple_dispatch<xt_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(xt_gemm);
+
+    using xt_syrk = xt_template<xt_testing, XT_SYRK>;
+    TEST_P(xt_syrk, blas3)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(hipblas_simple_dispatch<xt_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(xt_syrk);
+
+    using xt_trsm = xt_template<xt_testing, XT_TRSM>;
+    TEST_P(xt_trsm, blas3)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(hipblas_simple_dispatch<xt_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(xt_trsm);
+
+    using xt_symm = xt_template<xt_testing, XT_SYMM>;
+    TEST_P(xt_symm, blas3)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(hipblas_simple_dispatch<xt_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(xt_symm);
+
+} // namespace
@@ -22,6 +22,10 @@
 
 #include "blas_ex/testing_gemm_batched_ex.hpp"
 #include "blas_ex/testing_gemm_ex.hpp"
+#include "blas_ex/testing_gemm_ex_with_epilogue.hpp"
+#include "blas_ex/testing_gemm_grouped_batched_ex.hpp"
+#include "blas_ex/testing_gemm_packed_ex.hpp"
+#include "blas_ex/testing_gemm_scaled_ex.hpp"
 #include "blas_ex/testing_gemm_strided_batched_ex.hpp"
 #include "hipblas_data.hpp"
 #include "hipblas_test.hpp"
@@ -35,6 +39,10 @@ namespace
         GEMM_EX,
         GEMM_BATCHED_EX,
         GEMM_STRIDED_BATCHED_EX,
+        GEMM_GROUPED_BATCHED_EX,
+        GEMM_EX_WITH_EPILOGUE,
+        GEMM_PACKED_EX,
+        GEMM_SCALED_EX,
     };
 
     // gemm test template
@@ -74,6 +82,20 @@ namespace
             case GEMM_STRIDED_BATCHED_EX:
                 return !strcmp(arg.function, "gemm_strided_batched_ex")
                        || !strcmp(arg.function, "gemm_strided_batched_ex_bad_arg");
+            case GEMM_GROUPED_BATCHED_EX:
+                return !strcmp(arg.function, "gemm_grouped_batched_ex")
+                       || !strcmp(arg.function, "gemm_grouped_batched_ex_bad_arg");
+            case GEMM_EX_WITH_EPILOGUE:
+                return !strcmp(arg.function, "gemm_ex_with_epilogue")
+                       || !strcmp(arg.function, "gemm_ex_with_epilogue_bad_arg");
+            case GEMM_PACKED_EX:
+                return !strcmp(arg.function, "gemm_packed_ex")
+                       || !strcmp(arg.function, "gemm_packed_ex_bad_arg");
+            case GEMM_SCALED_EX:
+                return !strcmp(arg.function, "gemm_scaled_ex")
+                       || !strcmp(arg.function, "gemm_batched_scaled_ex")
+                       || !strcmp(arg.function, "gemm_strided_batched_scaled_ex")
+                       || !strcmp(arg.function, "gemm_scaled_ex_bad_arg");
             }
             return false;
         }
@@ -88,6 +110,14 @@ namespace
                 testname_gemm_batched_ex(arg, name);
             else if constexpr(GEMM_EX_TYPE == GEMM_STRIDED_BATCHED_EX)
                 testname_gemm_strided_batched_ex(arg, name);
+            else if constexpr(GEMM_EX_TYPE == GEMM_GROUPED_BATCHED_EX)
+                testname_gemm_grouped_batched_ex(arg, name);
+            else if constexpr(GEMM_EX_TYPE == GEMM_EX_WITH_EPILOGUE)
+                testname_gemm_ex_with_epilogue(arg, name);
+            else if constexpr(GEMM_EX_TYPE == GEMM_PACKED_EX)
+                testname_gemm_packed_ex(arg, name);
+            else if constexpr(GEMM_EX_TYPE == GEMM_SCALED_EX)
+                testname_gemm_scaled_ex(arg, name);
             return std::move(name);
         }
     };
@@ -126,6 +156,58 @@ namespace
                 testing_gemm_strided_batched_ex<Ti, To, Tc>(arg);
             else if(!strcmp(arg.function, "gemm_strided_batched_ex_bad_arg"))
                 testing_gemm_strided_batched_ex_bad_arg<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "gemm_grouped_batched_ex"))
+                testing_gemm_grouped_batched_ex<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "gemm_grouped_batched_ex_bad_arg"))
+                testing_gemm_grouped_batched_ex_bad_arg<Ti, To, Tc>(arg);
+            else if(!strcmp(arg.function, "gemm_ex_with_epilogue")
+                    || !strcmp(arg.function, "gemm_ex_with_epilogue_bad_arg"))
+            {
+                // the epilogue is only tested with real single and double precision
+                if constexpr(std::is_same_v<Ti, To> && std::is_same_v<To, Tc>
+                             && (std::is_same_v<Ti, float> || std::is_same_v<Ti, double>))
+                {
+                    if(!strcmp(arg.function, "gemm_ex_with_epilogue"))
+                        testing_gemm_ex_with_epilogue<Ti, To, Tc>(arg);
+                    else
+                        testing_gemm_ex_with_epilogue_bad_arg<Ti, To, Tc>(arg);
+                }
+            }
+            else if(!strcmp(arg.function, "gemm_packed_ex")
+                    || !strcmp(arg.function, "gemm_packed_ex_bad_arg"))
+            {
+                // packed gemm is tested with one type for A, B, C and the computation
+                if constexpr(std::is_same_v<Ti, To> && std::is_same_v<To, Tc>
+                             && !std::is_same_v<Ti, hipblasHalf>
+                             && !std::is_same_v<Ti, int8_t>)
+                {
+                    if(!strcmp(arg.function, "gemm_packed_ex"))
+                        testing_gemm_packed_ex<Ti, To, Tc>(arg);
+                    else
+                        testing_gemm_packed_ex_bad_arg<Ti, To, Tc>(arg);
+                }
+            }
+            else if(!strcmp(arg.function, "gemm_scaled_ex")
+                    || !strcmp(arg.function, "gemm_batched_scaled_ex")
+                    || !strcmp(arg.function, "gemm_strided_batched_scaled_ex")
+                    || !strcmp(arg.function, "gemm_scaled_ex_bad_arg"))
+            {
+                // A and B are FP8 whatever Ti is; C is float, half or bfloat16 and the
+                // computation is in float
+                if constexpr(std::is_same_v<Tc, float>
+                             && (std::is_same_v<To, float> || std::is_same_v<To, hipblasHalf>
+                                 || std::is_same_v<To, hipblasBfloat16>))
+                {
+                    if(!strcmp(arg.function, "gemm_scaled_ex"))
+                        testing_gemm_scaled_ex<Ti, To, Tc>(arg);
+                    else if(!strcmp(arg.function, "gemm_batched_scaled_ex"))
+                        testing_gemm_batched_scaled_ex<Ti, To, Tc>(arg);
+                    else if(!strcmp(arg.function, "gemm_strided_batched_scaled_ex"))
+                        testing_gemm_strided_batched_scaled_ex<Ti, To, Tc>(arg);
+                    else
+                        testing_gemm_scaled_ex_bad_arg<Ti, To, Tc>(arg);
+                }
+            }
             else
                 FAIL() << "Internal error: Test called with unknown function: " << arg.function;
         }
@@ -155,4 +237,36 @@ namespace
     }
     INSTANTIATE_TEST_CATEGORIES(gemm_strided_batched_ex);
 
+    using gemm_grouped_batched_ex = gemm_ex_template<gemm_ex_testing, GEMM_GROUPED_BATCHED_EX>;
+    TEST_P(gemm_grouped_batched_ex, blas3)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_gemm_dispatch<gemm_ex_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(gemm_grouped_batched_ex);
+
+    using gemm_ex_with_epilogue = gemm_ex_template<gemm_ex_testing, GEMM_EX_WITH_EPILOGUE>;
+    TEST_P(gemm_ex_with_epilogue, blas3)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_gemm_dispatch<gemm_ex_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(gemm_ex_with_epilogue);
+
+    using gemm_packed_ex = gemm_ex_template<gemm_ex_testing, GEMM_PACKED_EX>;
+    TEST_P(gemm_packed_ex, blas3)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_gemm_dispatch<gemm_ex_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(gemm_packed_ex);
+
+    using gemm_scaled_ex = gemm_ex_template<gemm_ex_testing, GEMM_SCALED_EX>;
+    TEST_P(gemm_scaled_ex, blas3)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_gemm_dispatch<gemm_ex_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(gemm_scaled_ex);
+
 } // namespace
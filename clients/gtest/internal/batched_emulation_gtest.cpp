@@ -0,0 +1,169 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+// Tests of the batched emulation used for routines the backend only provides
+// unbatched, with a stub in place of the handle's streams so that they need no device.
+
+#include "batched_emulation.hpp"
+
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+namespace
+{
+    // Records what the emulation asks of the streams, and which stream each problem
+    // was run on
+    struct stub_streams
+    {
+        std::vector<std::string> log;
+        int                      current     = -1;
+        hipblasStatus_t          fork_status = HIPBLAS_STATUS_SUCCESS;
+
+        hipblasStatus_t fork(int count)
+        {
+            log.push_back("fork " + std::to_string(count));
+            return fork_status;
+        }
+
+        hipblasStatus_t select(int index)
+        {
+            current = index;
+            return HIPBLAS_STATUS_SUCCESS;
+        }
+
+        hipblasStatus_t join(int count)
+        {
+            log.push_back("join " + std::to_string(count));
+            return HIPBLAS_STATUS_SUCCESS;
+        }
+    };
+
+    TEST(hipblas_batched_emulation, single_problem_stays_on_callers_stream)
+    {
+        stub_streams     streams;
+        std::vector<int> ran;
+
+        EXPECT_EQ(hipblas_fan_out_batch(streams,
+                                        1,
+                                        [&](int) {
+                                            ran.push_back(streams.current);
+                                            return HIPBLAS_STATUS_SUCCESS;
+                                        }),
+                  HIPBLAS_STATUS_SUCCESS);
+        EXPECT_EQ(ran, std::vector<int>{-1});
+        EXPECT_TRUE(streams.log.empty());
+    }
+
+    TEST(hipblas_batched_emulation, forks_round_robin_and_joins)
+    {
+        stub_streams     streams;
+        std::vector<int> ran;
+
+        EXPECT_EQ(hipblas_fan_out_batch(streams,
+                                        6,
+                                        [&](int) {
+                                            ran.push_back(streams.current);
+                                            return HIPBLAS_STATUS_SUCCESS;
+                                        }),
+                  HIPBLAS_STATUS_SUCCESS);
+
+        std::vector<int> expected;
+        for(int b = 0; b < 6; b++)
+            expected.push_back(b % hipblas_emulation_max_streams);
+        EXPECT_EQ(ran, expected);
+        EXPECT_EQ(streams.current, -1);
+        EXPECT_EQ(streams.log,
+                  (std::vector<std::string>{"fork " + std::to_string(hipblas_emulation_max_streams),
+                                            "join " + std::to_string(hipblas_emulation_max_streams)}));
+
+        // fewer problems than streams only uses as many streams as problems
+        streams.log.clear();
+        EXPECT_EQ(hipblas_fan_out_batch(streams, 2, [](int) { return HIPBLAS_STATUS_SUCCESS; }),
+                  HIPBLAS_STATUS_SUCCESS);
+        EXPECT_EQ(streams.log, (std::vector<std::string>{"fork 2", "join 2"}));
+    }
+
+    TEST(hipblas_batched_emulation, failure_still_restores_and_joins)
+    {
+        stub_streams streams;
+        int          calls = 0;
+
+        EXPECT_EQ(hipblas_fan_out_batch(streams,
+                                        8,
+                                        [&](int b) {
+                                            calls++;
+                                            return b == 2 ? HIPBLAS_STATUS_INVALID_VALUE
+                                                          : HIPBLAS_STATUS_SUCCESS;
+                                        }),
+                  HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_EQ(calls, 3);
+        EXPECT_EQ(streams.current, -1);
+        ASSERT_EQ(streams.log.size(), 2u);
+        EXPECT_EQ(streams.log[1].rfind("join", 0), 0u);
+
+        // nothing runs if the streams cannot be forked
+        streams.log.clear();
+        streams.fork_status = HIPBLAS_STATUS_ALLOC_FAILED;
+        calls               = 0;
+        EXPECT_EQ(hipblas_fan_out_batch(streams,
+                                        8,
+                                        [&](int) {
+                                            calls++;
+                                            return HIPBLAS_STATUS_SUCCESS;
+                                        }),
+                  HIPBLAS_STATUS_ALLOC_FAILED);
+        EXPECT_EQ(calls, 0);
+    }
+
+    TEST(hipblas_batched_emulation, batch_count)
+    {
+        stub_streams streams;
+        int          calls = 0;
+        auto         call  = [&](int) {
+            calls++;
+            return HIPBLAS_STATUS_SUCCESS;
+        };
+
+        EXPECT_EQ(hipblas_fan_out_batch(streams, -1, call), HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_EQ(hipblas_fan_out_batch(streams, 0, call), HIPBLAS_STATUS_SUCCESS);
+        EXPECT_EQ(calls, 0);
+        EXPECT_TRUE(streams.log.empty());
+    }
+
+    TEST(hipblas_batched_emulation, batch_offset)
+    {
+        double data[8];
+        void*  ptr = data;
+
+        EXPECT_EQ(hipblas_batch_offset(ptr, 3, HIP_R_64F), data + 3);
+        EXPECT_EQ(hipblas_batch_offset(ptr, 2, HIP_C_64F), data + 4);
+        EXPECT_EQ(hipblas_batch_offset(static_cast<const void*>(ptr), 4, HIP_R_32F),
+                  static_cast<const void*>(data + 2));
+        EXPECT_EQ(hipblas_batch_offset(static_cast<void*>(nullptr), 4, HIP_R_32F), nullptr);
+
+        void* arrays[4];
+        EXPECT_EQ(hipblas_batch_array_offset(static_cast<void*>(arrays), 3), arrays + 3);
+        EXPECT_EQ(hipblas_batch_array_offset(static_cast<const void*>(nullptr), 3), nullptr);
+    }
+} // namespace
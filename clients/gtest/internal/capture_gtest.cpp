@@ -0,0 +1,192 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+// Tests of the recording of calls for hipblasBeginCapture and hipblasEndCapture, with
+// stand-ins for the entry points so that replays need no device.
+
+#include "capture.hpp"
+
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+namespace
+{
+    // What the stand-ins were called with, in order
+    struct call_log
+    {
+        std::vector<std::string> routines;
+        std::vector<const void*> pointers;
+        std::vector<float>       scalars;
+        std::vector<int>         sizes;
+    };
+
+    call_log log;
+
+    hipblasStatus_t
+        fake_axpy(hipblasHandle_t, int n, const float* alpha, const float* x, int, float* y, int)
+    {
+        log.routines.push_back("axpy");
+        log.sizes.push_back(n);
+        log.scalars.push_back(*alpha);
+        log.pointers.push_back(x);
+        log.pointers.push_back(y);
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    hipblasStatus_t fake_scal(hipblasHandle_t, int n, const float* alpha, float* x, int)
+    {
+        log.routines.push_back("scal");
+        log.sizes.push_back(n);
+        log.scalars.push_back(*alpha);
+        log.pointers.push_back(x);
+        return n < 0 ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS;
+    }
+
+    hipblasHandle_t handle = nullptr;
+
+    hipblas_capture_scalar_arg<float> host(const float& value)
+    {
+        return {&value, false};
+    }
+
+    hipblas_capture_scalar_arg<float> device(const float* value)
+    {
+        return {value, true};
+    }
+
+    // Replays with the scalar block on the host, as a device copy would hold it
+    hipblasStatus_t replay(const hipblas_capture_graph& graph)
+    {
+        log = call_log();
+        return graph.replay(handle, graph.scalars().data());
+    }
+
+    float x[4], y[4], z[4];
+
+    TEST(hipblas_capture, replays_calls_in_order_with_snapshotted_scalars)
+    {
+        hipblas_capture_graph graph;
+        float                 alpha = 2.0f;
+
+        EXPECT_EQ(graph.record("axpy", fake_axpy, handle, 4, host(alpha), x, 1, y, 1),
+                  HIPBLAS_STATUS_SUCCESS);
+        alpha = 3.0f;
+        EXPECT_EQ(graph.record("scal", fake_scal, handle, 3, host(alpha), y, 1),
+                  HIPBLAS_STATUS_SUCCESS);
+        alpha = 5.0f;
+
+        ASSERT_EQ(graph.size(), 2u);
+        EXPECT_STREQ(graph.routine(1), "scal");
+        EXPECT_TRUE(graph.take_scalars_changed());
+        EXPECT_FALSE(graph.take_scalars_changed());
+
+        EXPECT_EQ(replay(graph), HIPBLAS_STATUS_SUCCESS);
+        EXPECT_EQ(log.routines, (std::vector<std::string>{"axpy", "scal"}));
+        EXPECT_EQ(log.sizes, (std::vector<int>{4, 3}));
+        EXPECT_EQ(log.scalars, (std::vector<float>{2.0f, 3.0f}));
+        EXPECT_EQ(log.pointers, (std::vector<const void*>{x, y, y}));
+    }
+
+    TEST(hipblas_capture, device_scalars_are_pointers)
+    {
+        hipblas_capture_graph graph;
+        float                 alpha = 2.0f;
+
+        EXPECT_EQ(graph.record("scal", fake_scal, handle, 4, device(&alpha), x, 1),
+                  HIPBLAS_STATUS_SUCCESS);
+        EXPECT_TRUE(graph.scalars().empty());
+        EXPECT_FALSE(graph.update_scalar(0, 0, &alpha));
+
+        alpha = 7.0f;
+        EXPECT_EQ(replay(graph), HIPBLAS_STATUS_SUCCESS);
+        EXPECT_EQ(log.scalars, (std::vector<float>{7.0f}));
+
+        float beta = 9.0f;
+        EXPECT_EQ(graph.update_pointer(&alpha, &beta), 1u);
+        EXPECT_EQ(replay(graph), HIPBLAS_STATUS_SUCCESS);
+        EXPECT_EQ(log.scalars, (std::vector<float>{9.0f}));
+    }
+
+    TEST(hipblas_capture, null_host_scalar_is_not_recorded)
+    {
+        hipblas_capture_graph graph;
+
+        EXPECT_EQ(graph.record("scal", fake_scal, handle, 4, device(nullptr), x, 1),
+                  HIPBLAS_STATUS_SUCCESS);
+        EXPECT_EQ(graph.record(
+                      "scal", fake_scal, handle, 4, hipblas_capture_scalar_arg<float>{}, x, 1),
+                  HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_EQ(graph.size(), 1u);
+    }
+
+    TEST(hipblas_capture, update_pointer_rebinds_every_use)
+    {
+        hipblas_capture_graph graph;
+        float                 alpha = 1.0f;
+
+        graph.record("axpy", fake_axpy, handle, 4, host(alpha), x, 1, y, 1);
+        graph.record("scal", fake_scal, handle, 4, host(alpha), y, 1);
+
+        EXPECT_EQ(graph.version(), 0u);
+        EXPECT_EQ(graph.update_pointer(z, x), 0u);
+        EXPECT_EQ(graph.version(), 0u);
+        EXPECT_EQ(graph.update_pointer(y, z), 2u);
+        EXPECT_EQ(graph.version(), 1u);
+
+        EXPECT_EQ(replay(graph), HIPBLAS_STATUS_SUCCESS);
+        EXPECT_EQ(log.pointers, (std::vector<const void*>{x, z, z}));
+    }
+
+    TEST(hipblas_capture, update_scalar_by_node_and_index)
+    {
+        hipblas_capture_graph graph;
+        float                 alpha = 1.0f;
+
+        graph.record("axpy", fake_axpy, handle, 4, host(alpha), x, 1, y, 1);
+        graph.record("scal", fake_scal, handle, 4, host(alpha), y, 1);
+        graph.take_scalars_changed();
+
+        float value = 4.0f;
+        EXPECT_TRUE(graph.update_scalar(1, 0, &value));
+        EXPECT_TRUE(graph.take_scalars_changed());
+        EXPECT_FALSE(graph.update_scalar(1, 1, &value));
+        EXPECT_FALSE(graph.update_scalar(2, 0, &value));
+        EXPECT_EQ(graph.version(), 0u);
+
+        EXPECT_EQ(replay(graph), HIPBLAS_STATUS_SUCCESS);
+        EXPECT_EQ(log.scalars, (std::vector<float>{1.0f, 4.0f}));
+    }
+
+    TEST(hipblas_capture, replay_stops_at_first_failure)
+    {
+        hipblas_capture_graph graph;
+        float                 alpha = 1.0f;
+
+        graph.record("scal", fake_scal, handle, -1, host(alpha), x, 1);
+        graph.record("axpy", fake_axpy, handle, 4, host(alpha), x, 1, y, 1);
+
+        EXPECT_EQ(replay(graph), HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_EQ(log.routines, (std::vector<std::string>{"scal"}));
+    }
+}
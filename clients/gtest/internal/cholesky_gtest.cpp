@@ -0,0 +1,320 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+// Tests of the blocked Cholesky drivers behind potrf, potrs and potri on backends
+// without them, run on a CPU device that implements trsm and herk with plain loops.
+
+#include "cholesky.hpp"
+
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+namespace
+{
+    template <typename T>
+    using host_t = typename hipblas_cholesky_host<T>::type;
+
+    template <typename H>
+    using dense = std::vector<H>;
+
+    // Device memory is host memory
+    template <typename T>
+    class cpu_device : public hipblas_cholesky_device<T>
+    {
+        using H    = host_t<T>;
+        using real = typename hipblas_cholesky_device<T>::real;
+
+    public:
+        hipblasStatus_t
+            upload(T* dst, int ld_dst, const T* src, int ld_src, int rows, int cols) override
+        {
+            return copy(dst, ld_dst, src, ld_src, rows, cols);
+        }
+
+        hipblasStatus_t
+            download(T* dst, int ld_dst, const T* src, int ld_src, int rows, int cols) override
+        {
+            return copy(dst, ld_dst, src, ld_src, rows, cols);
+        }
+
+        hipblasStatus_t zero(T* dst, int ld_dst, int rows, int cols) override
+        {
+            for(int j = 0; j < cols; j++)
+                for(int i = 0; i < rows; i++)
+                    ((H*)dst)[i + j * ld_dst] = 0;
+            return HIPBLAS_STATUS_SUCCESS;
+        }
+
+        hipblasStatus_t trsm(hipblasSideMode_t  side,
+                             hipblasFillMode_t  uplo,
+                             hipblasOperation_t trans,
+                             int                m,
+                             int                n,
+                             const T*           A,
+                             int                lda,
+                             T*                 B,
+                             int                ldb) override
+        {
+            trsm_calls++;
+
+            // M = op(A) with the other triangle zero, and X * M = B as M^T * X^T = B^T
+            int      order = side == HIPBLAS_SIDE_LEFT ? m : n;
+            dense<H> M     = op(trans, order, order, triangle(uplo, order, (const H*)A, lda));
+            bool     lower = (uplo == HIPBLAS_FILL_MODE_LOWER) == (trans == HIPBLAS_OP_N);
+            if(side == HIPBLAS_SIDE_RIGHT)
+            {
+                M     = transpose(order, order, M);
+                lower = !lower;
+            }
+
+            H* b = (H*)B;
+            for(int c = 0; c < (side == HIPBLAS_SIDE_LEFT ? n : m); c++)
+                for(int s = 0; s < order; s++)
+                {
+                    int i   = lower ? s : order - 1 - s;
+                    H&  x   = side == HIPBLAS_SIDE_LEFT ? b[i + c * ldb] : b[c + i * ldb];
+                    H   sum = x;
+                    for(int t = 0; t < s; t++)
+                    {
+                        int j = lower ? t : order - 1 - t;
+                        sum -= M[i + j * order]
+                               * (side == HIPBLAS_SIDE_LEFT ? b[j + c * ldb] : b[c + j * ldb]);
+                    }
+                    x = sum / M[i + i * order];
+                }
+            return HIPBLAS_STATUS_SUCCESS;
+        }
+
+        hipblasStatus_t herk(hipblasFillMode_t  uplo,
+                             hipblasOperation_t trans,
+                             int                n,
+                             int                k,
+                             real               alpha,
+                             const T*           A,
+                             int                lda,
+                             real               beta,
+                             T*                 C,
+                             int                ldc) override
+        {
+            herk_calls++;
+
+            // X = op(A) is n x k
+            int      rows = trans == HIPBLAS_OP_N ? n : k;
+            int      cols = trans == HIPBLAS_OP_N ? k : n;
+            dense<H> a(size_t(rows) * cols);
+            for(int j = 0; j < cols; j++)
+                for(int i = 0; i < rows; i++)
+                    a[i + j * rows] = ((const H*)A)[i + j * lda];
+            dense<H> X = op(trans, rows, cols, a);
+
+            H* c = (H*)C;
+            for(int j = 0; j < n; j++)
+                for(int i = 0; i < n; i++)
+                {
+                    if((uplo == HIPBLAS_FILL_MODE_LOWER) ? i < j : i > j)
+                        continue;
+                    H sum = 0;
+                    for(int l = 0; l < k; l++)
+                        sum += X[i + l * n] * hipblas_cholesky_conj(X[j + l * n]);
+                    c[i + j * ldc] = alpha * sum + (beta == 0 ? H(0) : beta * c[i + j * ldc]);
+                }
+            return HIPBLAS_STATUS_SUCCESS;
+        }
+
+        int trsm_calls = 0;
+        int herk_calls = 0;
+
+    private:
+        static hipblasStatus_t
+            copy(T* dst, int ld_dst, const T* src, int ld_src, int rows, int cols)
+        {
+            for(int j = 0; j < cols; j++)
+                for(int i = 0; i < rows; i++)
+                    dst[i + j * ld_dst] = src[i + j * ld_src];
+            return HIPBLAS_STATUS_SUCCESS;
+        }
+
+        static dense<H> triangle(hipblasFillMode_t uplo, int n, const H* A, int lda)
+        {
+            dense<H> M(size_t(n) * n);
+            for(int j = 0; j < n; j++)
+                for(int i = 0; i < n; i++)
+                    if((uplo == HIPBLAS_FILL_MODE_LOWER) ? i >= j : i <= j)
+                        M[i + j * n] = A[i + j * lda];
+            return M;
+        }
+
+        static dense<H> transpose(int rows, int cols, const dense<H>& A)
+        {
+            dense<H> At(A.size());
+            for(int j = 0; j < cols; j++)
+                for(int i = 0; i < rows; i++)
+                    At[j + i * cols] = A[i + j * rows];
+            return At;
+        }
+
+        // op(A) for a rows x cols matrix A
+        static dense<H> op(hipblasOperation_t trans, int rows, int cols, const dense<H>& A)
+        {
+            if(trans == HIPBLAS_OP_N)
+                return A;
+            dense<H> At = transpose(rows, cols, A);
+            if(trans == HIPBLAS_OP_C)
+                for(H& x : At)
+                    x = hipblas_cholesky_conj(x);
+            return At;
+        }
+    };
+
+    // A random Hermitian positive definite matrix with leading dimension lda
+    template <typename H>
+    dense<H> spd_matrix(int n, int lda, int seed)
+    {
+        std::mt19937                     gen(seed);
+        std::uniform_real_distribution<> dist(-1.0, 1.0);
+        dense<H>                         A(size_t(lda) * n);
+        for(int j = 0; j < n; j++)
+            for(int i = j; i < n; i++)
+            {
+                H x;
+                if constexpr(std::is_floating_point<H>::value)
+                    x = dist(gen);
+                else
+                    x = H(dist(gen), i == j ? 0 : dist(gen));
+                A[i + j * lda] = i == j ? x + H(n) : x;
+                A[j + i * lda] = hipblas_cholesky_conj(A[i + j * lda]);
+            }
+        return A;
+    }
+
+    template <typename H>
+    double max_difference(const dense<H>& A, const dense<H>& B)
+    {
+        double difference = 0;
+        for(size_t i = 0; i < A.size(); i++)
+            difference = std::max(difference, double(std::abs(A[i] - B[i])));
+        return difference;
+    }
+
+    template <typename T>
+    void check_factor_solve_invert(hipblasFillMode_t uplo)
+    {
+        using H = host_t<T>;
+
+        cpu_device<T> device;
+        int           n = 300, lda = 302, nrhs = 2, ldb = 301, info = -1;
+        dense<H>      A0 = spd_matrix<H>(n, lda, 7);
+        bool          lower = uplo == HIPBLAS_FILL_MODE_LOWER;
+
+        // The blocked factor matches the unblocked one on the uplo triangle
+        dense<H> A = A0, R = A0;
+        ASSERT_EQ(hipblas_potrf_blocked(device, uplo, n, (T*)A.data(), lda, info),
+                  HIPBLAS_STATUS_SUCCESS);
+        EXPECT_EQ(info, 0);
+        EXPECT_EQ(hipblas_potrf_host(uplo, n, R.data(), lda), 0);
+        EXPECT_LT(max_difference(A, R), 1e-12);
+        EXPECT_EQ(device.trsm_calls, 2);
+        EXPECT_EQ(device.herk_calls, 2);
+
+        // A * X = B for X with known entries
+        dense<H> X(size_t(ldb) * nrhs), B(size_t(ldb) * nrhs);
+        for(int c = 0; c < nrhs; c++)
+            for(int i = 0; i < n; i++)
+                X[i + c * ldb] = H(i % 7 - 3 + c);
+        for(int c = 0; c < nrhs; c++)
+            for(int i = 0; i < n; i++)
+                for(int j = 0; j < n; j++)
+                    B[i + c * ldb] += A0[i + j * lda] * X[j + c * ldb];
+        ASSERT_EQ(hipblas_potrs_blocked(
+                      device, uplo, n, nrhs, (const T*)A.data(), lda, (T*)B.data(), ldb),
+                  HIPBLAS_STATUS_SUCCESS);
+        EXPECT_LT(max_difference(B, X), 1e-10);
+
+        // A0 * inv(A0) = I, with inv(A0) read from the uplo triangle
+        dense<H> W(size_t(n) * n);
+        ASSERT_EQ(hipblas_potri_blocked(device, uplo, n, (T*)A.data(), lda, (T*)W.data(), info),
+                  HIPBLAS_STATUS_SUCCESS);
+        EXPECT_EQ(info, 0);
+        auto inverse = [&](int i, int j) {
+            return (lower ? i >= j : i <= j) ? A[i + j * lda]
+                                             : hipblas_cholesky_conj(A[j + i * lda]);
+        };
+        double error = 0;
+        for(int j = 0; j < n; j++)
+            for(int i = 0; i < n; i++)
+            {
+                H sum = 0;
+                for(int l = 0; l < n; l++)
+                    sum += A0[i + l * lda] * inverse(l, j);
+                error = std::max(error, double(std::abs(sum - H(i == j))));
+            }
+        EXPECT_LT(error, 1e-12);
+
+        // The other triangle keeps the factor
+        EXPECT_EQ(lower ? A[0 + 1 * lda] : A[1 + 0 * lda], lower ? R[0 + 1 * lda] : R[1 + 0 * lda]);
+    }
+
+    TEST(hipblas_cholesky, real_lower)
+    {
+        check_factor_solve_invert<double>(HIPBLAS_FILL_MODE_LOWER);
+    }
+
+    TEST(hipblas_cholesky, real_upper)
+    {
+        check_factor_solve_invert<double>(HIPBLAS_FILL_MODE_UPPER);
+    }
+
+    TEST(hipblas_cholesky, complex_lower)
+    {
+        check_factor_solve_invert<hipDoubleComplex>(HIPBLAS_FILL_MODE_LOWER);
+    }
+
+    TEST(hipblas_cholesky, complex_upper)
+    {
+        check_factor_solve_invert<hipDoubleComplex>(HIPBLAS_FILL_MODE_UPPER);
+    }
+
+    TEST(hipblas_cholesky, reports_leading_minor_that_is_not_positive_definite)
+    {
+        // Diagonal with one negative entry in the second block
+        cpu_device<float> device;
+        int               n = 200, info = 0;
+        dense<float>      A(size_t(n) * n);
+        for(int i = 0; i < n; i++)
+            A[i + i * n] = i == 150 ? -1 : 4;
+
+        ASSERT_EQ(hipblas_potrf_blocked(device, HIPBLAS_FILL_MODE_UPPER, n, A.data(), n, info),
+                  HIPBLAS_STATUS_SUCCESS);
+        EXPECT_EQ(info, 151);
+        EXPECT_EQ(A[149 + 149 * n], 2);
+
+        // A zero diagonal element of the factor
+        A[150 + 150 * n] = 0;
+        dense<float> W(size_t(n) * n);
+        ASSERT_EQ(hipblas_potri_blocked(
+                      device, HIPBLAS_FILL_MODE_UPPER, n, A.data(), n, W.data(), info),
+                  HIPBLAS_STATUS_SUCCESS);
+        EXPECT_EQ(info, 151);
+    }
+}
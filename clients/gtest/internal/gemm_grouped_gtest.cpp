@@ -0,0 +1,164 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+// Tests of the launch planner behind hipblasGemmGroupedBatchedEx, which validates the
+// groups and decides the backend calls on the host.
+
+#include "gemm_grouped.hpp"
+
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace
+{
+    struct groups
+    {
+        std::vector<hipblasOperation_t> transa;
+        std::vector<hipblasOperation_t> transb;
+        std::vector<int>                m, n, k, lda, ldb, ldc, size;
+        std::vector<float>              alpha, beta;
+
+        void add(int m_, int n_, int k_, int size_, float alpha_ = 1, float beta_ = 0)
+        {
+            transa.push_back(HIPBLAS_OP_N);
+            transb.push_back(HIPBLAS_OP_N);
+            m.push_back(m_);
+            n.push_back(n_);
+            k.push_back(k_);
+            lda.push_back(std::max(1, m_));
+            ldb.push_back(std::max(1, k_));
+            ldc.push_back(std::max(1, m_));
+            size.push_back(size_);
+            alpha.push_back(alpha_);
+            beta.push_back(beta_);
+        }
+
+        hipblasStatus_t plan(std::vector<hipblas_gemm_grouped_launch>& launches,
+                             bool                                      host_scalars = true)
+        {
+            return hipblas_plan_gemm_grouped(transa.data(),
+                                             transb.data(),
+                                             m.data(),
+                                             n.data(),
+                                             k.data(),
+                                             alpha.data(),
+                                             lda.data(),
+                                             ldb.data(),
+                                             beta.data(),
+                                             ldc.data(),
+                                             int(m.size()),
+                                             size.data(),
+                                             sizeof(float),
+                                             host_scalars,
+                                             launches);
+        }
+    };
+
+    TEST(hipblas_gemm_grouped, one_launch_per_group)
+    {
+        groups g;
+        g.add(16, 16, 16, 3);
+        g.add(32, 16, 8, 2);
+        g.add(16, 16, 16, 4, 2.0f);
+
+        std::vector<hipblas_gemm_grouped_launch> launches;
+        ASSERT_EQ(g.plan(launches), HIPBLAS_STATUS_SUCCESS);
+        ASSERT_EQ(launches.size(), 3u);
+
+        EXPECT_EQ(launches[0].offset, 0);
+        EXPECT_EQ(launches[0].batch_count, 3);
+        EXPECT_EQ(launches[1].offset, 3);
+        EXPECT_EQ(launches[1].m, 32);
+        EXPECT_EQ(launches[1].k, 8);
+        EXPECT_EQ(launches[2].offset, 5);
+        EXPECT_EQ(launches[2].batch_count, 4);
+        EXPECT_EQ(*static_cast<const float*>(launches[2].alpha), 2.0f);
+    }
+
+    TEST(hipblas_gemm_grouped, merges_adjacent_identical_groups)
+    {
+        groups g;
+        g.add(8, 8, 8, 2);
+        g.add(8, 8, 8, 5);
+        g.add(8, 8, 8, 1, 3.0f);
+
+        std::vector<hipblas_gemm_grouped_launch> launches;
+        ASSERT_EQ(g.plan(launches), HIPBLAS_STATUS_SUCCESS);
+        ASSERT_EQ(launches.size(), 2u);
+        EXPECT_EQ(launches[0].batch_count, 7);
+        EXPECT_EQ(launches[1].offset, 7);
+
+        // device scalars can only be compared by address
+        ASSERT_EQ(g.plan(launches, false), HIPBLAS_STATUS_SUCCESS);
+        EXPECT_EQ(launches.size(), 3u);
+    }
+
+    TEST(hipblas_gemm_grouped, skips_empty_groups)
+    {
+        groups g;
+        g.add(8, 8, 8, 2);
+        g.add(0, 8, 8, 4);
+        g.add(8, 8, 8, 0);
+        g.add(8, 8, 8, 1);
+
+        std::vector<hipblas_gemm_grouped_launch> launches;
+        ASSERT_EQ(g.plan(launches), HIPBLAS_STATUS_SUCCESS);
+
+        // the empty groups still take their place in the pointer arrays
+        ASSERT_EQ(launches.size(), 2u);
+        EXPECT_EQ(launches[1].offset, 6);
+        EXPECT_EQ(launches[1].batch_count, 1);
+    }
+
+    TEST(hipblas_gemm_grouped, rejects_invalid_groups)
+    {
+        std::vector<hipblas_gemm_grouped_launch> launches;
+
+        groups g;
+        g.add(8, 8, 8, 2);
+        g.lda[0] = 4;
+        EXPECT_EQ(g.plan(launches), HIPBLAS_STATUS_INVALID_VALUE);
+
+        groups h;
+        h.add(8, 8, 8, -1);
+        EXPECT_EQ(h.plan(launches), HIPBLAS_STATUS_INVALID_VALUE);
+
+        EXPECT_EQ(hipblas_plan_gemm_grouped(nullptr,
+                                            nullptr,
+                                            nullptr,
+                                            nullptr,
+                                            nullptr,
+                                            nullptr,
+                                            nullptr,
+                                            nullptr,
+                                            nullptr,
+                                            nullptr,
+                                            0,
+                                            nullptr,
+                                            sizeof(float),
+                                            true,
+                                            launches),
+                  HIPBLAS_STATUS_SUCCESS);
+        EXPECT_TRUE(launches.empty());
+    }
+} // namespace
@@ -0,0 +1,194 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+// Tests of the library's host-side GEMM tuning cache against a stub solution provider,
+// so that they need no device.
+
+#include "gemm_tuning_cache.hpp"
+
+#include <cstdio>
+#include <gtest/gtest.h>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    hipblas_gemm_tuning_key make_key(int64_t m, int64_t n, int64_t k)
+    {
+        hipblas_gemm_tuning_key key;
+        key.arch         = "stub";
+        key.trans_a      = 111;
+        key.trans_b      = 112;
+        key.m            = m;
+        key.n            = n;
+        key.k            = k;
+        key.a_type       = 151;
+        key.b_type       = 151;
+        key.c_type       = 151;
+        key.compute_type = 151;
+        return key;
+    }
+
+    // Stub solution provider: each solution index has a fixed time, negative if it
+    // does not apply to the problem
+    struct stub_solutions
+    {
+        std::map<int32_t, double> times;
+        int                       timed = 0;
+
+        hipblas_gemm_tuning_cache::solutions_fn solutions()
+        {
+            return [this]() {
+                std::vector<int32_t> list;
+                for(auto& t : times)
+                    if(t.first)
+                        list.push_back(t.first);
+                return list;
+            };
+        }
+
+        hipblas_gemm_tuning_cache::timer_fn timer()
+        {
+            return [this](int32_t solution) {
+                timed++;
+                auto it = times.find(solution);
+                return it == times.end() ? -1.0 : it->second;
+            };
+        }
+    };
+
+    std::string temp_path(const char* name)
+    {
+        return ::testing::TempDir() + name;
+    }
+
+    TEST(hipblas_gemm_tuning_cache, picks_fastest_solution)
+    {
+        hipblas_gemm_tuning_cache cache;
+        stub_solutions            stub;
+        stub.times = {{0, 3.0}, {7, 2.0}, {11, 1.5}, {13, -1.0}};
+
+        auto    key      = make_key(16, 4096, 4096);
+        int32_t solution = -1;
+        EXPECT_FALSE(cache.lookup(key, solution));
+
+        EXPECT_EQ(cache.tune(key, stub.solutions(), stub.timer()), 11);
+        EXPECT_EQ(stub.timed, 4);
+
+        EXPECT_TRUE(cache.lookup(key, solution));
+        EXPECT_EQ(solution, 11);
+        EXPECT_EQ(cache.tuned(), 1u);
+
+        // other problems are still unknown
+        EXPECT_FALSE(cache.lookup(make_key(16, 4096, 1024), solution));
+    }
+
+    TEST(hipblas_gemm_tuning_cache, keeps_default_when_no_candidate_is_faster)
+    {
+        hipblas_gemm_tuning_cache cache;
+        stub_solutions            stub;
+        stub.times = {{0, 1.0}, {3, 1.0}, {5, 4.0}};
+
+        EXPECT_EQ(cache.tune(make_key(8, 8, 8), stub.solutions(), stub.timer()), 0);
+
+        // no candidates at all
+        stub.times = {{0, 1.0}};
+        EXPECT_EQ(cache.tune(make_key(9, 9, 9), stub.solutions(), stub.timer()), 0);
+    }
+
+    TEST(hipblas_gemm_tuning_cache, save_and_load)
+    {
+        std::string path = temp_path("hipblas_gemm_tuning_cache_test.txt");
+
+        hipblas_gemm_tuning_cache cache("v1");
+        cache.insert(make_key(1, 2, 3), 42);
+        cache.insert(make_key(4, 5, 6), 17);
+        ASSERT_TRUE(cache.save(path));
+
+        hipblas_gemm_tuning_cache loaded("v1");
+        ASSERT_TRUE(loaded.load(path));
+        EXPECT_EQ(loaded.size(), 2u);
+        EXPECT_EQ(loaded.tuned(), 0u);
+
+        int32_t solution = 0;
+        EXPECT_TRUE(loaded.lookup(make_key(1, 2, 3), solution));
+        EXPECT_EQ(solution, 42);
+        EXPECT_TRUE(loaded.lookup(make_key(4, 5, 6), solution));
+        EXPECT_EQ(solution, 17);
+
+        // solution indices from another backend version must not be used
+        hipblas_gemm_tuning_cache other("v2");
+        EXPECT_FALSE(other.load(path));
+        EXPECT_EQ(other.size(), 0u);
+
+        std::remove(path.c_str());
+    }
+
+    TEST(hipblas_gemm_tuning_cache, concurrent_saves)
+    {
+        std::string path = temp_path("hipblas_gemm_tuning_cache_concurrent.txt");
+
+        // each saver writes its own entries; the saved file must hold exactly one saver's
+        hipblas_gemm_tuning_cache caches[2] = {hipblas_gemm_tuning_cache("v1"),
+                                               hipblas_gemm_tuning_cache("v1")};
+        for(int c = 0; c < 2; c++)
+            for(int i = 0; i < 100; i++)
+                caches[c].insert(make_key(c + 1, i, i), c);
+
+        std::vector<std::thread> savers;
+        for(int c = 0; c < 2; c++)
+            savers.emplace_back([&, c] {
+                for(int i = 0; i < 20; i++)
+                    EXPECT_TRUE(caches[c].save(path));
+            });
+        for(auto& saver : savers)
+            saver.join();
+
+        hipblas_gemm_tuning_cache loaded("v1");
+        ASSERT_TRUE(loaded.load(path));
+        EXPECT_EQ(loaded.size(), 100u);
+
+        int32_t first = -1, solution = -1;
+        for(int c = 0; c < 2 && first < 0; c++)
+            if(loaded.lookup(make_key(c + 1, 0, 0), solution))
+                first = solution;
+        ASSERT_GE(first, 0);
+        for(int i = 0; i < 100; i++)
+        {
+            EXPECT_TRUE(loaded.lookup(make_key(first + 1, i, i), solution));
+            EXPECT_EQ(solution, first);
+        }
+
+        std::remove(path.c_str());
+    }
+
+    TEST(hipblas_gemm_tuning_cache, load_missing_file)
+    {
+        hipblas_gemm_tuning_cache cache;
+        EXPECT_FALSE(cache.load(temp_path("hipblas_gemm_tuning_cache_missing.txt")));
+        EXPECT_EQ(cache.size(), 0u);
+    }
+
+} // namespace
@@ -0,0 +1,407 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+// Tests of the mixed precision iterative refinement behind the DSgesv functions, run
+// on a CPU device that implements the device interface with plain loops.
+
+#include "gesv_refinement.hpp"
+
+#include <cmath>
+#include <gtest/gtest.h>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+    template <typename U>
+    void copy_block(U* dst, int ld_dst, const U* src, int ld_src, int rows, int cols)
+    {
+        for(int j = 0; j < cols; j++)
+            for(int i = 0; i < rows; i++)
+                dst[i + j * ld_dst] = src[i + j * ld_src];
+    }
+
+    // LU factorization with partial pivoting, 1-based pivots as getrf
+    template <typename U>
+    void lu(int n, U* A, int lda, int* ipiv, int& info)
+    {
+        info = 0;
+        for(int p = 0; p < n; p++)
+        {
+            int pivot = p;
+            for(int i = p + 1; i < n; i++)
+                if(std::abs(A[i + p * lda]) > std::abs(A[pivot + p * lda]))
+                    pivot = i;
+            ipiv[p] = pivot + 1;
+            if(A[pivot + p * lda] == 0)
+            {
+                if(!info)
+                    info = p + 1;
+                continue;
+            }
+            for(int j = 0; j < n; j++)
+                std::swap(A[p + j * lda], A[pivot + j * lda]);
+            for(int i = p + 1; i < n; i++)
+            {
+                U f = A[i + p * lda] /= A[p + p * lda];
+                for(int j = p + 1; j < n; j++)
+                    A[i + j * lda] -= f * A[p + j * lda];
+            }
+        }
+    }
+
+    template <typename U>
+    void lu_solve(int n, int nrhs, const U* A, int lda, const int* ipiv, U* B, int ldb)
+    {
+        for(int c = 0; c < nrhs; c++)
+        {
+            U* b = B + c * ldb;
+            for(int p = 0; p < n; p++)
+                std::swap(b[p], b[ipiv[p] - 1]);
+            for(int i = 0; i < n; i++)
+                for(int j = 0; j < i; j++)
+                    b[i] -= A[i + j * lda] * b[j];
+            for(int i = n - 1; i >= 0; i--)
+            {
+                for(int j = i + 1; j < n; j++)
+                    b[i] -= A[i + j * lda] * b[j];
+                b[i] /= A[i + i * lda];
+            }
+        }
+    }
+
+    // Device memory is host memory; counts the calls the solver makes
+    class cpu_device : public hipblas_gesv_device<double, float>
+    {
+    public:
+        hipblasStatus_t prepare(int n, int nrhs) override
+        {
+            m_low_matrix.resize(size_t(n) * n);
+            m_low_rhs.resize(size_t(n) * nrhs);
+            m_residual.resize(size_t(n) * nrhs);
+            return HIPBLAS_STATUS_SUCCESS;
+        }
+
+        float* low_matrix() override
+        {
+            return m_low_matrix.data();
+        }
+
+        float* low_rhs() override
+        {
+            return m_low_rhs.data();
+        }
+
+        double* residual() override
+        {
+            return m_residual.data();
+        }
+
+        hipblasStatus_t copy(double*       dst,
+                             int           ld_dst,
+                             const double* src,
+                             int           ld_src,
+                             int           rows,
+                             int           cols) override
+        {
+            copy_block(dst, ld_dst, src, ld_src, rows, cols);
+            return HIPBLAS_STATUS_SUCCESS;
+        }
+
+        hipblasStatus_t demote(float*        dst,
+                               int           ld_dst,
+                               const double* src,
+                               int           ld_src,
+                               int           rows,
+                               int           cols,
+                               bool&         fits) override
+        {
+            fits = true;
+            for(int j = 0; j < cols; j++)
+                for(int i = 0; i < rows; i++)
+                {
+                    double x            = src[i + j * ld_src];
+                    fits                = fits && std::abs(x) <= std::numeric_limits<float>::max();
+                    dst[i + j * ld_dst] = float(x);
+                }
+            return HIPBLAS_STATUS_SUCCESS;
+        }
+
+        hipblasStatus_t norm_inf(int n, const double* A, int lda, double& norm) override
+        {
+            norm = 0;
+            for(int i = 0; i < n; i++)
+            {
+                double sum = 0;
+                for(int j = 0; j < n; j++)
+                    sum += std::abs(A[i + j * lda]);
+                norm = std::max(norm, sum);
+            }
+            return HIPBLAS_STATUS_SUCCESS;
+        }
+
+        hipblasStatus_t update(
+            double* X, int ldx, const float* D, int ldd, int rows, int cols, bool first) override
+        {
+            for(int j = 0; j < cols; j++)
+                for(int i = 0; i < rows; i++)
+                    X[i + j * ldx] = (first ? 0 : X[i + j * ldx]) + D[i + j * ldd];
+            return HIPBLAS_STATUS_SUCCESS;
+        }
+
+        hipblasStatus_t check(int           n,
+                              int           nrhs,
+                              const double* X,
+                              int           ldx,
+                              const double* R,
+                              int           ldr,
+                              double        cte,
+                              float*        low_R,
+                              int           ld_low,
+                              bool&         converged,
+                              bool&         fits) override
+        {
+            checks++;
+            converged = true;
+            for(int j = 0; j < nrhs; j++)
+            {
+                double xnrm = 0, rnrm = 0;
+                for(int i = 0; i < n; i++)
+                {
+                    xnrm = std::max(xnrm, std::abs(X[i + j * ldx]));
+                    rnrm = std::max(rnrm, std::abs(R[i + j * ldr]));
+                }
+                converged = converged && rnrm <= xnrm * cte;
+            }
+            return demote(low_R, ld_low, R, ldr, n, nrhs, fits);
+        }
+
+        hipblasStatus_t getrf(int n, float* A, int lda, int* ipiv, int& info) override
+        {
+            low_factorizations++;
+            lu(n, A, lda, ipiv, info);
+            return HIPBLAS_STATUS_SUCCESS;
+        }
+
+        hipblasStatus_t getrf(int n, double* A, int lda, int* ipiv, int& info) override
+        {
+            high_factorizations++;
+            lu(n, A, lda, ipiv, info);
+            return HIPBLAS_STATUS_SUCCESS;
+        }
+
+        hipblasStatus_t getrs(int          n,
+                              int          nrhs,
+                              const float* A,
+                              int          lda,
+                              const int*   ipiv,
+                              float*       B,
+                              int          ldb) override
+        {
+            lu_solve(n, nrhs, A, lda, ipiv, B, ldb);
+            return HIPBLAS_STATUS_SUCCESS;
+        }
+
+        hipblasStatus_t getrs(int           n,
+                              int           nrhs,
+                              const double* A,
+                              int           lda,
+                              const int*    ipiv,
+                              double*       B,
+                              int           ldb) override
+        {
+            lu_solve(n, nrhs, A, lda, ipiv, B, ldb);
+            return HIPBLAS_STATUS_SUCCESS;
+        }
+
+        hipblasStatus_t residual(int           n,
+                                 int           nrhs,
+                                 const double* A,
+                                 int           lda,
+                                 const double* X,
+                                 int           ldx,
+                                 double*       R,
+                                 int           ldr) override
+        {
+            for(int c = 0; c < nrhs; c++)
+                for(int i = 0; i < n; i++)
+                    for(int j = 0; j < n; j++)
+                        R[i + c * ldr] -= A[i + j * lda] * X[j + c * ldx];
+            return HIPBLAS_STATUS_SUCCESS;
+        }
+
+        int low_factorizations  = 0;
+        int high_factorizations = 0;
+        int checks              = 0;
+
+    private:
+        std::vector<float>  m_low_matrix;
+        std::vector<float>  m_low_rhs;
+        std::vector<double> m_residual;
+    };
+
+    std::vector<double> random_matrix(size_t size, int seed)
+    {
+        std::mt19937                     gen(seed);
+        std::uniform_real_distribution<> dist(-1.0, 1.0);
+        std::vector<double>              X(size);
+        for(double& x : X)
+            x = dist(gen);
+        return X;
+    }
+
+    // Largest |b - A x| over all entries, relative to the largest |b|
+    double relative_residual(int                        n,
+                             int                        nrhs,
+                             const std::vector<double>& A,
+                             int                        lda,
+                             const std::vector<double>& B,
+                             int                        ldb,
+                             const std::vector<double>& X,
+                             int                        ldx)
+    {
+        double r = 0, b = 0;
+        for(int c = 0; c < nrhs; c++)
+            for(int i = 0; i < n; i++)
+            {
+                double s = B[i + c * ldb];
+                for(int j = 0; j < n; j++)
+                    s -= A[i + j * lda] * X[j + c * ldx];
+                r = std::max(r, std::abs(s));
+                b = std::max(b, std::abs(B[i + c * ldb]));
+            }
+        return r / b;
+    }
+
+    // Solves with packed n x n A and n x nrhs B and X
+    hipblasStatus_t solve(cpu_device&          device,
+                          std::vector<double>& A,
+                          std::vector<double>& B,
+                          std::vector<double>& X,
+                          std::vector<int>&    ipiv,
+                          int                  nrhs,
+                          int&                 iter,
+                          int&                 info)
+    {
+        int n = int(ipiv.size());
+        return hipblas_gesv_refine(
+            device, n, nrhs, A.data(), n, ipiv.data(), B.data(), n, X.data(), n, iter, info);
+    }
+
+    TEST(hipblas_gesv_refinement, refines_well_conditioned_system)
+    {
+        cpu_device          device;
+        int                 n = 60, nrhs = 3, lda = n + 2, ldb = n + 1, ldx = n;
+        std::vector<double> A = random_matrix(size_t(lda) * n, 1);
+        std::vector<double> B = random_matrix(size_t(ldb) * nrhs, 2);
+        std::vector<double> X(size_t(ldx) * nrhs);
+        std::vector<int>    ipiv(n);
+        for(int i = 0; i < n; i++)
+            A[i + i * lda] += 4;
+        std::vector<double> A0 = A, B0 = B;
+
+        int iter, info;
+        ASSERT_EQ(hipblas_gesv_refine(device,
+                                      n,
+                                      nrhs,
+                                      A.data(),
+                                      lda,
+                                      ipiv.data(),
+                                      B.data(),
+                                      ldb,
+                                      X.data(),
+                                      ldx,
+                                      iter,
+                                      info),
+                  HIPBLAS_STATUS_SUCCESS);
+
+        EXPECT_GT(iter, 0);
+        EXPECT_LE(iter, 5);
+        EXPECT_EQ(info, 0);
+        EXPECT_EQ(device.low_factorizations, 1);
+        EXPECT_EQ(device.high_factorizations, 0);
+        EXPECT_EQ(device.checks, iter + 1);
+        EXPECT_EQ(A, A0);
+        EXPECT_EQ(B, B0);
+        EXPECT_LT(relative_residual(n, nrhs, A, lda, B, ldb, X, ldx), 1e-14);
+    }
+
+    TEST(hipblas_gesv_refinement, falls_back_when_refinement_does_not_converge)
+    {
+        // The Hilbert matrix of order 10 has a condition number near 1e13, far beyond
+        // what single precision factors can refine
+        cpu_device          device;
+        int                 n = 10, nrhs = 1;
+        std::vector<double> A(n * n), B(n, 1), X(n);
+        std::vector<int>    ipiv(n);
+        for(int j = 0; j < n; j++)
+            for(int i = 0; i < n; i++)
+                A[i + j * n] = 1.0 / (i + j + 1);
+        std::vector<double> A0 = A;
+
+        int iter, info;
+        ASSERT_EQ(solve(device, A, B, X, ipiv, nrhs, iter, info), HIPBLAS_STATUS_SUCCESS);
+
+        EXPECT_TRUE(iter == hipblas_gesv_not_converged || iter == hipblas_gesv_singular_low);
+        EXPECT_EQ(info, 0);
+        EXPECT_EQ(device.high_factorizations, 1);
+        EXPECT_NE(A, A0);
+
+        // X is the double precision solution
+        std::vector<double> LU = A0, Y = B;
+        std::vector<int>    p(n);
+        lu(n, LU.data(), n, p.data(), info);
+        lu_solve(n, 1, LU.data(), n, p.data(), Y.data(), n);
+        EXPECT_EQ(X, Y);
+    }
+
+    TEST(hipblas_gesv_refinement, falls_back_on_overflow_and_low_singularity)
+    {
+        cpu_device          device;
+        int                 n = 2, iter, info;
+        std::vector<int>    ipiv(n);
+        std::vector<double> B{1, 2}, X(n);
+
+        // 1e300 does not fit in single precision
+        std::vector<double> A{1e300, 0, 0, 1};
+        ASSERT_EQ(solve(device, A, B, X, ipiv, 1, iter, info), HIPBLAS_STATUS_SUCCESS);
+        EXPECT_EQ(iter, hipblas_gesv_overflow);
+        EXPECT_EQ(device.low_factorizations, 0);
+        EXPECT_DOUBLE_EQ(X[0], 1e-300);
+        EXPECT_DOUBLE_EQ(X[1], 2);
+
+        // Singular once rounded to single precision only
+        A = {1, 1, 1, 1 + 1e-10};
+        ASSERT_EQ(solve(device, A, B, X, ipiv, 1, iter, info), HIPBLAS_STATUS_SUCCESS);
+        EXPECT_EQ(iter, hipblas_gesv_singular_low);
+        EXPECT_EQ(info, 0);
+        EXPECT_NEAR(X[1], 1e10, 1e4);
+
+        // Singular in double precision too: info reports the zero pivot
+        A = {1, 1, 1, 1};
+        ASSERT_EQ(solve(device, A, B, X, ipiv, 1, iter, info), HIPBLAS_STATUS_SUCCESS);
+        EXPECT_EQ(iter, hipblas_gesv_singular_low);
+        EXPECT_EQ(info, 2);
+    }
+}
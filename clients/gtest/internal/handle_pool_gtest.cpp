@@ -0,0 +1,235 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+// Tests of the pool of handles behind hipblasHandlePoolAcquire, with a stub backend
+// whose handles and workspaces are numbers, so that they need no device.
+
+#include "handle_pool.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    // Hands out handles 1, 2, ... and workspaces 1001, 1002, ..., and records what
+    // the pool binds
+    struct stub_log
+    {
+        std::atomic<int> handles{0};
+        std::atomic<int> workspaces{0};
+        std::atomic<int> destroyed{0};
+        hipblasStatus_t  create_status = HIPBLAS_STATUS_SUCCESS;
+        hipStream_t      bound_stream  = nullptr;
+        void*            bound_memory  = nullptr;
+    };
+
+    class stub_backend : public hipblas_handle_pool_backend
+    {
+    public:
+        explicit stub_backend(stub_log& log)
+            : m_log(log)
+        {
+        }
+
+        hipblasStatus_t create_handle(int, hipblasHandle_t* handle) override
+        {
+            if(m_log.create_status != HIPBLAS_STATUS_SUCCESS)
+                return m_log.create_status;
+            *handle = (hipblasHandle_t)(intptr_t)++m_log.handles;
+            return HIPBLAS_STATUS_SUCCESS;
+        }
+
+        void destroy_handle(int, hipblasHandle_t) override
+        {
+            m_log.destroyed++;
+        }
+
+        hipblasStatus_t create_workspace(int, void** workspace) override
+        {
+            *workspace = (void*)(intptr_t)(1000 + ++m_log.workspaces);
+            return HIPBLAS_STATUS_SUCCESS;
+        }
+
+        void destroy_workspace(int, void*) override
+        {
+            m_log.destroyed++;
+        }
+
+        hipblasStatus_t bind(hipblasHandle_t, hipStream_t stream, void* workspace) override
+        {
+            m_log.bound_stream = stream;
+            m_log.bound_memory = workspace;
+            return HIPBLAS_STATUS_SUCCESS;
+        }
+
+        hipblasStatus_t unbind(hipblasHandle_t, void*) override
+        {
+            return HIPBLAS_STATUS_SUCCESS;
+        }
+
+    private:
+        stub_log& m_log;
+    };
+
+    hipStream_t stream(intptr_t id)
+    {
+        return (hipStream_t)id;
+    }
+
+    TEST(hipblas_handle_pool, same_thread_and_stream_get_same_handle)
+    {
+        stub_log            log;
+        hipblas_handle_pool pool(std::make_unique<stub_backend>(log), 4, false);
+
+        hipblasHandle_t first, second, other;
+        ASSERT_EQ(pool.acquire(0, stream(1), &first), HIPBLAS_STATUS_SUCCESS);
+        ASSERT_EQ(pool.release(first), HIPBLAS_STATUS_SUCCESS);
+        ASSERT_EQ(pool.acquire(0, stream(2), &other), HIPBLAS_STATUS_SUCCESS);
+        ASSERT_EQ(pool.release(other), HIPBLAS_STATUS_SUCCESS);
+        ASSERT_EQ(pool.acquire(0, stream(1), &second), HIPBLAS_STATUS_SUCCESS);
+
+        EXPECT_EQ(first, second);
+        EXPECT_NE(first, other);
+        EXPECT_EQ(log.bound_stream, stream(1));
+        EXPECT_EQ(log.bound_memory, nullptr);
+
+        hipblas_handle_pool::stats stats = pool.get_stats();
+        EXPECT_EQ(stats.handles_created, 2u);
+        EXPECT_EQ(stats.acquires, 3u);
+        EXPECT_EQ(stats.waits, 0u);
+    }
+
+    TEST(hipblas_handle_pool, devices_have_their_own_handles)
+    {
+        stub_log            log;
+        hipblas_handle_pool pool(std::make_unique<stub_backend>(log), 1, false);
+
+        hipblasHandle_t first, second;
+        ASSERT_EQ(pool.acquire(0, stream(1), &first), HIPBLAS_STATUS_SUCCESS);
+        ASSERT_EQ(pool.acquire(1, stream(1), &second), HIPBLAS_STATUS_SUCCESS);
+        EXPECT_NE(first, second);
+        EXPECT_EQ(pool.get_stats().handles_created, 2u);
+    }
+
+    TEST(hipblas_handle_pool, idle_handle_moves_to_new_stream_at_limit)
+    {
+        stub_log            log;
+        hipblas_handle_pool pool(std::make_unique<stub_backend>(log), 2, false);
+
+        hipblasHandle_t a, b, c;
+        ASSERT_EQ(pool.acquire(0, stream(1), &a), HIPBLAS_STATUS_SUCCESS);
+        ASSERT_EQ(pool.acquire(0, stream(2), &b), HIPBLAS_STATUS_SUCCESS);
+        ASSERT_EQ(pool.release(b), HIPBLAS_STATUS_SUCCESS);
+        ASSERT_EQ(pool.release(a), HIPBLAS_STATUS_SUCCESS);
+
+        // b is the least recently used
+        ASSERT_EQ(pool.acquire(0, stream(3), &c), HIPBLAS_STATUS_SUCCESS);
+        EXPECT_EQ(c, b);
+        EXPECT_EQ(log.bound_stream, stream(3));
+        EXPECT_EQ(pool.get_stats().handles_created, 2u);
+    }
+
+    TEST(hipblas_handle_pool, acquire_waits_for_release)
+    {
+        stub_log            log;
+        hipblas_handle_pool pool(std::make_unique<stub_backend>(log), 1, false);
+
+        hipblasHandle_t held;
+        ASSERT_EQ(pool.acquire(0, stream(1), &held), HIPBLAS_STATUS_SUCCESS);
+
+        hipblasHandle_t  taken   = nullptr;
+        std::atomic<int> done{0};
+        std::thread      waiter([&] {
+            EXPECT_EQ(pool.acquire(0, stream(2), &taken), HIPBLAS_STATUS_SUCCESS);
+            done = 1;
+        });
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        EXPECT_EQ(done, 0);
+        ASSERT_EQ(pool.release(held), HIPBLAS_STATUS_SUCCESS);
+        waiter.join();
+
+        EXPECT_EQ(taken, held);
+        hipblas_handle_pool::stats stats = pool.get_stats();
+        EXPECT_EQ(stats.handles_created, 1u);
+        EXPECT_EQ(stats.waits, 1u);
+        EXPECT_GT(stats.wait_seconds, 0.0);
+    }
+
+    TEST(hipblas_handle_pool, workspaces_are_held_while_acquired)
+    {
+        stub_log            log;
+        hipblas_handle_pool pool(std::make_unique<stub_backend>(log), 4, true);
+
+        hipblasHandle_t a, b, c;
+        ASSERT_EQ(pool.acquire(0, stream(1), &a), HIPBLAS_STATUS_SUCCESS);
+        void* first = log.bound_memory;
+        ASSERT_EQ(pool.acquire(0, stream(2), &b), HIPBLAS_STATUS_SUCCESS);
+        EXPECT_NE(log.bound_memory, first);
+        ASSERT_EQ(pool.release(a), HIPBLAS_STATUS_SUCCESS);
+
+        // A third handle never runs with the first, so it takes its workspace
+        ASSERT_EQ(pool.acquire(0, stream(3), &c), HIPBLAS_STATUS_SUCCESS);
+        EXPECT_NE(c, a);
+        EXPECT_EQ(log.bound_memory, first);
+        EXPECT_EQ(pool.workspace_count(), 2u);
+        EXPECT_EQ(pool.get_stats().handles_created, 3u);
+    }
+
+    TEST(hipblas_handle_pool, release_of_unknown_handle_fails)
+    {
+        stub_log            log;
+        hipblas_handle_pool pool(std::make_unique<stub_backend>(log), 1, false);
+
+        hipblasHandle_t handle;
+        EXPECT_EQ(pool.release((hipblasHandle_t)42), HIPBLAS_STATUS_INVALID_VALUE);
+        ASSERT_EQ(pool.acquire(0, stream(1), &handle), HIPBLAS_STATUS_SUCCESS);
+        EXPECT_TRUE(pool.in_use());
+        ASSERT_EQ(pool.release(handle), HIPBLAS_STATUS_SUCCESS);
+        EXPECT_EQ(pool.release(handle), HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_FALSE(pool.in_use());
+    }
+
+    TEST(hipblas_handle_pool, failed_creation_is_not_counted)
+    {
+        stub_log log;
+        {
+            hipblas_handle_pool pool(std::make_unique<stub_backend>(log), 1, true);
+
+            hipblasHandle_t handle;
+            log.create_status = HIPBLAS_STATUS_ALLOC_FAILED;
+            EXPECT_EQ(pool.acquire(0, stream(1), &handle), HIPBLAS_STATUS_ALLOC_FAILED);
+            EXPECT_FALSE(pool.in_use());
+
+            log.create_status = HIPBLAS_STATUS_SUCCESS;
+            ASSERT_EQ(pool.acquire(0, stream(1), &handle), HIPBLAS_STATUS_SUCCESS);
+            ASSERT_EQ(pool.release(handle), HIPBLAS_STATUS_SUCCESS);
+            EXPECT_EQ(pool.get_stats().handles_created, 1u);
+        }
+        // The handle and its workspace
+        EXPECT_EQ(log.destroyed, 2);
+    }
+}
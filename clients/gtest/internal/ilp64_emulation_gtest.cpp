@@ -0,0 +1,253 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+// Tests of how the 64-bit API is split into chunks for backends that only provide
+// the 32-bit routines. Only sizes are involved, so no memory is needed.
+
+#include "ilp64_emulation.hpp"
+
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace
+{
+    constexpr int64_t big = int64_t(1) << 32;
+
+    TEST(hipblas_ilp64_emulation, fits_int32)
+    {
+        EXPECT_TRUE(hipblas_fits_int32(hipblas_int32_max));
+        EXPECT_TRUE(hipblas_fits_int32(-hipblas_int32_max - 1));
+        EXPECT_FALSE(hipblas_fits_int32(hipblas_int32_max + 1));
+        EXPECT_FALSE(hipblas_fits_int32(-hipblas_int32_max - 2));
+        EXPECT_TRUE(hipblas_fits_int32(1, -1, 0));
+        EXPECT_FALSE(hipblas_fits_int32(1, big, 0));
+    }
+
+    TEST(hipblas_ilp64_emulation, chunks)
+    {
+        std::vector<std::pair<int64_t, int>> chunks;
+        auto record = [&](int64_t start, int count) {
+            chunks.emplace_back(start, count);
+            return HIPBLAS_STATUS_SUCCESS;
+        };
+
+        EXPECT_EQ(hipblas_for_each_chunk(7, 3, record), HIPBLAS_STATUS_SUCCESS);
+        EXPECT_EQ(chunks, (std::vector<std::pair<int64_t, int>>{{0, 3}, {3, 3}, {6, 1}}));
+
+        // sizes that need no splitting, including invalid ones, are passed through
+        for(int64_t total : {int64_t(3), int64_t(0), int64_t(-5), -big})
+        {
+            chunks.clear();
+            EXPECT_EQ(hipblas_for_each_chunk(total, 3, record), HIPBLAS_STATUS_SUCCESS);
+            ASSERT_EQ(chunks.size(), 1u);
+            EXPECT_EQ(chunks[0].first, 0);
+            EXPECT_EQ(chunks[0].second < 0, total < 0);
+            if(total >= 0)
+            {
+                EXPECT_EQ(chunks[0].second, total);
+            }
+        }
+
+        // the first failure stops the chunks
+        int calls = 0;
+        EXPECT_EQ(hipblas_for_each_chunk(10,
+                                         3,
+                                         [&](int64_t start, int) {
+                                             calls++;
+                                             return start == 3 ? HIPBLAS_STATUS_INVALID_VALUE
+                                                               : HIPBLAS_STATUS_SUCCESS;
+                                         }),
+                  HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_EQ(calls, 2);
+    }
+
+    TEST(hipblas_ilp64_emulation, vector_chunks)
+    {
+        std::vector<hipblas_vector_chunk> chunks;
+        auto record = [&](const hipblas_vector_chunk& chunk) {
+            chunks.push_back(chunk);
+            return HIPBLAS_STATUS_SUCCESS;
+        };
+
+        // x forwards and y backwards
+        int64_t n = big + 5;
+        EXPECT_EQ(hipblas_for_each_vector_chunk(n, 2, -3, record), HIPBLAS_STATUS_SUCCESS);
+        ASSERT_EQ(chunks.size(), 3u);
+
+        int64_t start = 0;
+        for(const hipblas_vector_chunk& chunk : chunks)
+        {
+            EXPECT_EQ(chunk.start, start);
+            EXPECT_EQ(chunk.incx, 2);
+            EXPECT_EQ(chunk.incy, -3);
+            EXPECT_EQ(chunk.offset_x, start * 2);
+            // element i of y is at (n - 1 - i) * 3, and the chunk starts at its last
+            EXPECT_EQ(chunk.offset_y, (n - 1 - (start + chunk.n - 1)) * 3);
+            start += chunk.n;
+        }
+        EXPECT_EQ(start, n);
+        EXPECT_EQ(chunks[0].n, hipblas_int32_max);
+        EXPECT_EQ(chunks[2].n, 7);
+
+        // an increment that does not fit leaves single element chunks
+        chunks.clear();
+        EXPECT_EQ(hipblas_for_each_vector_chunk(3, big, record), HIPBLAS_STATUS_SUCCESS);
+        ASSERT_EQ(chunks.size(), 3u);
+        for(int i = 0; i < 3; i++)
+        {
+            EXPECT_EQ(chunks[i].n, 1);
+            EXPECT_EQ(chunks[i].incx, 1);
+            EXPECT_EQ(chunks[i].offset_x, i * big);
+        }
+
+        chunks.clear();
+        EXPECT_EQ(hipblas_for_each_vector_chunk(2, -big, record), HIPBLAS_STATUS_SUCCESS);
+        ASSERT_EQ(chunks.size(), 2u);
+        EXPECT_EQ(chunks[0].incx, -1);
+        EXPECT_EQ(chunks[0].offset_x, big);
+        EXPECT_EQ(chunks[1].offset_x, 0);
+    }
+
+    TEST(hipblas_ilp64_emulation, gemm_tiles)
+    {
+        int64_t max_rows, max_cols;
+        EXPECT_TRUE(hipblas_gemm_tile_limits(
+            HIPBLAS_OP_N, HIPBLAS_OP_N, 64, 128, 128, 128, max_rows, max_cols));
+        EXPECT_EQ(max_rows, hipblas_int32_max);
+        EXPECT_EQ(max_cols, hipblas_int32_max);
+
+        // k cannot be split
+        EXPECT_FALSE(hipblas_gemm_tile_limits(
+            HIPBLAS_OP_N, HIPBLAS_OP_N, big, big, big, 128, max_rows, max_cols));
+
+        // a large ldc or ldb of an untransposed B needs tiles of one column
+        EXPECT_TRUE(hipblas_gemm_tile_limits(
+            HIPBLAS_OP_N, HIPBLAS_OP_N, 64, 128, big, 128, max_rows, max_cols));
+        EXPECT_EQ(max_cols, 1);
+        EXPECT_TRUE(hipblas_gemm_tile_limits(
+            HIPBLAS_OP_N, HIPBLAS_OP_T, 64, 128, 128, big, max_rows, max_cols));
+        EXPECT_EQ(max_cols, 1);
+
+        // a large lda of a transposed A needs tiles of one row
+        EXPECT_TRUE(hipblas_gemm_tile_limits(
+            HIPBLAS_OP_T, HIPBLAS_OP_N, 64, big, 128, 128, max_rows, max_cols));
+        EXPECT_EQ(max_rows, 1);
+        EXPECT_EQ(max_cols, hipblas_int32_max);
+
+        // and is unsupported for an untransposed A, unless it has a single column
+        EXPECT_FALSE(hipblas_gemm_tile_limits(
+            HIPBLAS_OP_N, HIPBLAS_OP_N, 64, big, 128, 128, max_rows, max_cols));
+        EXPECT_TRUE(hipblas_gemm_tile_limits(
+            HIPBLAS_OP_N, HIPBLAS_OP_N, 1, big, 128, 128, max_rows, max_cols));
+        EXPECT_EQ(hipblas_tile_ld(big, 10), 10);
+        EXPECT_EQ(hipblas_tile_ld(-big, 10), -1);
+        EXPECT_EQ(hipblas_tile_ld(20, 10), 20);
+
+        std::vector<hipblas_matrix_tile> tiles;
+        EXPECT_EQ(hipblas_for_each_tile(5,
+                                        4,
+                                        3,
+                                        2,
+                                        [&](const hipblas_matrix_tile& tile) {
+                                            tiles.push_back(tile);
+                                            return HIPBLAS_STATUS_SUCCESS;
+                                        }),
+                  HIPBLAS_STATUS_SUCCESS);
+        ASSERT_EQ(tiles.size(), 4u);
+        EXPECT_EQ(tiles[1].row, 3);
+        EXPECT_EQ(tiles[1].col, 0);
+        EXPECT_EQ(tiles[1].m, 2);
+        EXPECT_EQ(tiles[2].col, 2);
+        EXPECT_EQ(tiles[2].n, 2);
+
+        EXPECT_EQ(hipblas_matrix_offset(HIPBLAS_OP_N, 3, 2, 10), 23);
+        EXPECT_EQ(hipblas_matrix_offset(HIPBLAS_OP_T, 3, 2, 10), 32);
+    }
+
+    TEST(hipblas_ilp64_emulation, sum)
+    {
+        hipblas_sum_accumulator<float> sum;
+        sum.add(1.5f);
+        sum.add(-0.5f);
+        EXPECT_EQ(sum.result(), 1.0f);
+
+        hipblas_sum_accumulator<hipblasDoubleComplex> complex_sum;
+        complex_sum.add(hipblasDoubleComplex(1, 2));
+        complex_sum.add(hipblasDoubleComplex(3, -4));
+        EXPECT_EQ(complex_sum.result().real(), 4);
+        EXPECT_EQ(complex_sum.result().imag(), -2);
+    }
+
+    TEST(hipblas_ilp64_emulation, nrm2)
+    {
+        hipblas_nrm2_accumulator<double> norm;
+        EXPECT_EQ(norm.result(), 0);
+        norm.add(3e200);
+        norm.add(0);
+        norm.add(4e200);
+        EXPECT_DOUBLE_EQ(norm.result(), 5e200);
+
+        hipblas_nrm2_accumulator<float> inf;
+        inf.add(std::numeric_limits<float>::infinity());
+        inf.add(std::numeric_limits<float>::infinity());
+        inf.add(1);
+        EXPECT_EQ(inf.result(), std::numeric_limits<float>::infinity());
+
+        hipblas_nrm2_accumulator<float> nan;
+        nan.add(std::numeric_limits<float>::infinity());
+        nan.add(std::numeric_limits<float>::quiet_NaN());
+        EXPECT_TRUE(std::isnan(nan.result()));
+    }
+
+    TEST(hipblas_ilp64_emulation, amax)
+    {
+        hipblas_amax_accumulator amax(true);
+        amax.add(0, 5, 2.0);
+        amax.add(100, 0, 0.0); // empty chunk
+        amax.add(200, 3, 2.0); // ties go to the earlier chunk
+        EXPECT_EQ(amax.result(), 5);
+        amax.add(300, 7, 2.5);
+        EXPECT_EQ(amax.result(), 307);
+
+        hipblas_amax_accumulator amin(false);
+        EXPECT_EQ(amin.result(), 0);
+        amin.add(0, 1, 2.0);
+        amin.add(10, 2, 1.0);
+        amin.add(20, 1, 1.0);
+        EXPECT_EQ(amin.result(), 12);
+
+        EXPECT_EQ(hipblas_amax_magnitude(-3.0f), 3.0);
+        EXPECT_EQ(hipblas_amax_magnitude(hipblasComplex(-3, 4)), 7.0);
+    }
+
+    TEST(hipblas_ilp64_emulation, result_types)
+    {
+        EXPECT_EQ(hipblas_ilp64_result_type_of(HIP_C_32F), hipblas_ilp64_result_type::f32_c);
+        EXPECT_EQ(hipblas_ilp64_result_type_of(HIP_R_64F), hipblas_ilp64_result_type::f64_r);
+        EXPECT_EQ(hipblas_ilp64_result_type_of(HIP_R_16F),
+                  hipblas_ilp64_result_type::unsupported);
+#ifndef HIPBLAS_V2
+        EXPECT_EQ(hipblas_ilp64_result_type_of(HIPBLAS_C_64F), hipblas_ilp64_result_type::f64_c);
+#endif
+    }
+} // namespace
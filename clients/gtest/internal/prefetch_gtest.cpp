@@ -0,0 +1,139 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "prefetch.hpp"
+
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace
+{
+    TEST(hipblas_prefetch_footprint, vectors)
+    {
+        std::vector<float> x(64);
+
+        hipblas_prefetch_range range = hipblas_prefetch_vector(x.data(), 10, 3);
+        EXPECT_EQ(range.ptr, x.data());
+        EXPECT_EQ(range.bytes, (9 * 3 + 1) * sizeof(float));
+
+        EXPECT_EQ(hipblas_prefetch_vector(x.data(), 10, -3).bytes, (9 * 3 + 1) * sizeof(float));
+        EXPECT_EQ(hipblas_prefetch_vector(x.data(), 10, 0).bytes, sizeof(float));
+        EXPECT_EQ(hipblas_prefetch_vector(x.data(), 0, 1).bytes, 0u);
+        EXPECT_EQ(hipblas_prefetch_vector<float>(nullptr, 10, 1).bytes, 0u);
+    }
+
+    TEST(hipblas_prefetch_footprint, matrices)
+    {
+        std::vector<double> A(1000);
+
+        // The last column only spans the rows
+        EXPECT_EQ(hipblas_prefetch_matrix(A.data(), 5, 4, 8).bytes, (3 * 8 + 5) * sizeof(double));
+        EXPECT_EQ(hipblas_prefetch_matrix(HIPBLAS_OP_T, A.data(), 4, 5, 8).bytes,
+                  (3 * 8 + 5) * sizeof(double));
+        EXPECT_EQ(hipblas_prefetch_matrix(A.data(), 5, 4, 8, 40, 3).bytes,
+                  (2 * 40 + 3 * 8 + 5) * sizeof(double));
+
+        // Problems sharing a matrix span one
+        EXPECT_EQ(hipblas_prefetch_matrix(A.data(), 5, 4, 8, 0, 3).bytes,
+                  (3 * 8 + 5) * sizeof(double));
+        EXPECT_EQ(hipblas_prefetch_matrix(A.data(), 5, 0, 8).bytes, 0u);
+
+        EXPECT_EQ(hipblas_prefetch_ex_matrix(HIPBLAS_OP_C, A.data(), HIP_R_16F, 4, 5, 8).bytes,
+                  (3 * 8 + 5) * 2u);
+    }
+
+    TEST(hipblas_allocation_cache, queries_each_allocation_once)
+    {
+        hipblas_allocation_cache cache;
+        int                      queries = 0;
+
+        std::vector<char> managed(4096), device(4096);
+        auto              query = [&](const void* ptr, size_t) {
+            bool in_managed = ptr >= managed.data() && ptr <= &managed.back();
+            queries++;
+            const std::vector<char>& memory = in_managed ? managed : device;
+            return hipblas_allocation{
+                reinterpret_cast<uintptr_t>(memory.data()), memory.size(), in_managed};
+        };
+
+        EXPECT_TRUE(cache.managed(managed.data() + 100, 200, query));
+        EXPECT_TRUE(cache.managed(managed.data(), 4096, query));
+        EXPECT_TRUE(cache.managed(managed.data() + 4000, 96, query));
+        EXPECT_FALSE(cache.managed(device.data() + 8, 8, query));
+        EXPECT_FALSE(cache.managed(device.data(), 16, query));
+        EXPECT_EQ(queries, 2);
+        EXPECT_EQ(cache.size(), 2u);
+        EXPECT_EQ(cache.hits(), 3u);
+        EXPECT_EQ(cache.misses(), 2u);
+
+        // A range past the end of the allocation is asked again
+        EXPECT_TRUE(cache.managed(managed.data() + 4000, 200, query));
+        EXPECT_EQ(queries, 3);
+
+        cache.forget(managed.data() + 10);
+        EXPECT_TRUE(cache.managed(managed.data(), 16, query));
+        EXPECT_EQ(queries, 4);
+    }
+
+    TEST(hipblas_allocation_cache, replaces_overlapping_allocations)
+    {
+        hipblas_allocation_cache cache;
+        std::vector<char>        memory(4096);
+        uintptr_t                base = reinterpret_cast<uintptr_t>(memory.data());
+
+        // Two small allocations, then one which was allocated where both were
+        EXPECT_FALSE(cache.managed(memory.data(), 16, [&](const void*, size_t) {
+            return hipblas_allocation{base, 1024, false};
+        }));
+        EXPECT_FALSE(cache.managed(memory.data() + 1024, 16, [&](const void*, size_t) {
+            return hipblas_allocation{base + 1024, 1024, false};
+        }));
+        EXPECT_EQ(cache.size(), 2u);
+
+        EXPECT_TRUE(cache.managed(memory.data() + 512, 1024, [&](const void*, size_t) {
+            return hipblas_allocation{base, 4096, true};
+        }));
+        EXPECT_EQ(cache.size(), 1u);
+        EXPECT_TRUE(cache.managed(memory.data() + 1024, 16, [&](const void*, size_t) {
+            ADD_FAILURE() << "known allocation queried";
+            return hipblas_allocation{};
+        }));
+    }
+
+    TEST(hipblas_allocation_cache, unknown_memory_is_its_own_range)
+    {
+        hipblas_allocation_cache cache;
+        std::vector<char>        host(256);
+
+        // The runtime does not know pageable host memory
+        auto query = [](const void* ptr, size_t bytes) {
+            return hipblas_allocation{reinterpret_cast<uintptr_t>(ptr), bytes, false};
+        };
+        EXPECT_FALSE(cache.managed(host.data(), 64, query));
+        EXPECT_FALSE(cache.managed(host.data() + 8, 8, query));
+        EXPECT_EQ(cache.misses(), 1u);
+        EXPECT_FALSE(cache.managed(host.data() + 60, 64, query));
+        EXPECT_EQ(cache.misses(), 2u);
+    }
+
+} // namespace
@@ -0,0 +1,107 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+// Tests of the host side of the pinned staging engine: how copies are split into
+// chunks and how strided columns are packed and unpacked.
+
+#include "staging.hpp"
+
+#include <atomic>
+#include <gtest/gtest.h>
+#include <numeric>
+#include <vector>
+
+namespace
+{
+    TEST(hipblas_staging, tile_shape)
+    {
+        int64_t tile_rows, tile_cols;
+
+        // whole columns per chunk
+        hipblas_staging_tile_shape(100, 8, 8000, tile_rows, tile_cols);
+        EXPECT_EQ(tile_rows, 100);
+        EXPECT_EQ(tile_cols, 10);
+
+        // a column larger than a chunk is split
+        hipblas_staging_tile_shape(5000, 8, 8000, tile_rows, tile_cols);
+        EXPECT_EQ(tile_rows, 1000);
+        EXPECT_EQ(tile_cols, 1);
+
+        // vectors are matrices with one row
+        hipblas_staging_tile_shape(1, 4, 4096, tile_rows, tile_cols);
+        EXPECT_EQ(tile_rows, 1);
+        EXPECT_EQ(tile_cols, 1024);
+
+        // elements larger than a chunk still make progress
+        hipblas_staging_tile_shape(3, 16, 8, tile_rows, tile_cols);
+        EXPECT_EQ(tile_rows, 1);
+        EXPECT_EQ(tile_cols, 1);
+    }
+
+    TEST(hipblas_staging, parallel_chunks_cover_range)
+    {
+        for(int64_t workers : {1, 3, 4, 16})
+        {
+            std::vector<std::atomic<int>> seen(10);
+            hipblas_parallel_chunks(10, workers, [&](int64_t first, int64_t count) {
+                for(int64_t i = first; i < first + count; i++)
+                    seen[i]++;
+            });
+            for(auto& count : seen)
+                EXPECT_EQ(count, 1);
+        }
+    }
+
+    // Packs a strided matrix into a dense buffer and unpacks it into another strided
+    // matrix, leaving the padding rows untouched
+    void check_round_trip(int64_t rows, int64_t cols, int64_t lda, int64_t ldb, int threads)
+    {
+        std::vector<float> A(lda * cols), packed(rows * cols, -1), B(ldb * cols, -2);
+        std::iota(A.begin(), A.end(), 0.0f);
+
+        hipblas_copy_columns(packed.data(), rows, A.data(), lda, rows, cols, 4, threads, 64);
+        hipblas_copy_columns(B.data(), ldb, packed.data(), rows, rows, cols, 4, threads, 64);
+
+        for(int64_t j = 0; j < cols; j++)
+        {
+            for(int64_t i = 0; i < rows; i++)
+            {
+                ASSERT_EQ(packed[i + j * rows], A[i + j * lda]);
+                ASSERT_EQ(B[i + j * ldb], A[i + j * lda]);
+            }
+            for(int64_t i = rows; i < ldb; i++)
+                ASSERT_EQ(B[i + j * ldb], -2);
+        }
+    }
+
+    TEST(hipblas_staging, copy_columns)
+    {
+        for(int threads : {1, 4})
+        {
+            check_round_trip(37, 29, 41, 53, threads);
+            check_round_trip(64, 16, 64, 64, threads);     // contiguous
+            check_round_trip(1000, 1, 1003, 1001, threads); // one long column
+            check_round_trip(1, 500, 3, 2, threads);        // vector, increments 3 and 2
+        }
+    }
+}
@@ -0,0 +1,128 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "stats.hpp"
+
+#include <cstring>
+#include <gtest/gtest.h>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    TEST(hipblas_stats_family, strips_variants)
+    {
+        EXPECT_EQ(hipblas_stats_family_of("gemm"), hipblas_stats_gemm);
+        EXPECT_EQ(hipblas_stats_family_of("gemm_strided_batched_ex"), hipblas_stats_gemm);
+        EXPECT_EQ(hipblas_stats_family_of("gemm3m_batched"), hipblas_stats_gemm3m);
+        EXPECT_EQ(hipblas_stats_family_of("gemm_grouped_batched_ex"), hipblas_stats_gemm_grouped);
+        EXPECT_EQ(hipblas_stats_family_of("dotc_ex"), hipblas_stats_dotc);
+        EXPECT_EQ(hipblas_stats_family_of("rotmg_strided_batched"), hipblas_stats_rotmg);
+        EXPECT_EQ(hipblas_stats_family_of("gem"), -1);
+        EXPECT_EQ(hipblas_stats_family_of("gemm_epilogue"), -1);
+        EXPECT_EQ(hipblas_stats_family_of(nullptr), -1);
+    }
+
+    TEST(hipblas_stats_family, names_are_sorted)
+    {
+        for(int family = 1; family < hipblas_stats_family_count; family++)
+            EXPECT_LT(std::strcmp(hipblas_stats_family_name(family - 1),
+                                  hipblas_stats_family_name(family)),
+                      0);
+    }
+
+    TEST(hipblas_stats_count, gemm_counts_every_problem)
+    {
+        hipblas_trace_record record;
+        record.function  = "gemm_strided_batched";
+        record.precision = "f32_r";
+        record.m(128).n(64).k(32).batch_count(4);
+
+        hipblas_stats_count count = hipblas_stats_count_of(hipblas_stats_gemm, record);
+        EXPECT_DOUBLE_EQ(count.flops, 2.0 * 128 * 64 * 32 * 4);
+        EXPECT_DOUBLE_EQ(count.bytes, 4.0 * (128 * 32 + 64 * 32 + 128 * 64) * 4);
+    }
+
+    TEST(hipblas_stats_count, real_scalars_of_complex_routines)
+    {
+        hipblas_trace_record record;
+        record.routine   = "hipblasCsscal_v2";
+        record.function  = "scal";
+        record.precision = "f32_c";
+        record.n(10);
+        EXPECT_DOUBLE_EQ(hipblas_stats_count_of(hipblas_stats_scal, record).flops, 20.0);
+
+        record.routine = "hipblasCscal_v2";
+        EXPECT_DOUBLE_EQ(hipblas_stats_count_of(hipblas_stats_scal, record).flops, 60.0);
+
+        // scal_ex gives the type of alpha first and the type of x second
+        hipblas_trace_record ex;
+        ex.routine  = "hipblasScalEx_v2";
+        ex.function = "scal_ex";
+        ex.types("f32_r", "f32_c", nullptr, "f32_c").n(10);
+        EXPECT_DOUBLE_EQ(hipblas_stats_count_of(hipblas_stats_scal, ex).flops, 20.0);
+        EXPECT_DOUBLE_EQ(hipblas_stats_count_of(hipblas_stats_scal, ex).bytes, 8.0 * 2 * 10);
+    }
+
+    TEST(hipblas_stats_count, routines_without_sizes_count_nothing)
+    {
+        hipblas_trace_record record;
+        record.function  = "rotg";
+        record.precision = "f64_r";
+
+        hipblas_stats_count count = hipblas_stats_count_of(hipblas_stats_rotg, record);
+        EXPECT_EQ(count.flops, 0.0);
+        EXPECT_EQ(count.bytes, 0.0);
+    }
+
+    TEST(hipblas_stats_table, adds_from_several_threads)
+    {
+        auto table = std::make_unique<hipblas_stats_table>();
+
+        constexpr int            threads = 16, calls = 1000;
+        std::vector<std::thread> workers;
+        for(int t = 0; t < threads; t++)
+            workers.emplace_back([&] {
+                for(int i = 0; i < calls; i++)
+                {
+                    table->add(hipblas_stats_axpy, {2.0, 12.0});
+                    table->add_device_time(hipblas_stats_axpy, 1000);
+                }
+            });
+        for(std::thread& worker : workers)
+            worker.join();
+
+        hipblasRoutineStats_t stats = table->read(hipblas_stats_axpy);
+        EXPECT_STREQ(stats.routine, "axpy");
+        EXPECT_EQ(stats.calls, uint64_t(threads * calls));
+        EXPECT_DOUBLE_EQ(stats.flops, 2.0 * threads * calls);
+        EXPECT_DOUBLE_EQ(stats.bytes, 12.0 * threads * calls);
+        EXPECT_DOUBLE_EQ(stats.deviceSeconds, 1e-6 * threads * calls);
+        EXPECT_EQ(table->read(hipblas_stats_gemm).calls, 0u);
+
+        table->reset();
+        EXPECT_EQ(table->read(hipblas_stats_axpy).calls, 0u);
+    }
+
+} // namespace
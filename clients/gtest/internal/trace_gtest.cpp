@@ -0,0 +1,168 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "trace.hpp"
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <string>
+
+namespace
+{
+    hipblas_trace_record make_gemm_record()
+    {
+        hipblas_trace_record record;
+        record.routine      = "hipblasSgemm";
+        record.function     = "gemm";
+        record.precision    = "f32_r";
+        record.pointer_mode = HIPBLAS_POINTER_MODE_HOST;
+
+        float alpha = 2.0f, beta = 0.5f;
+        record.trans_a(HIPBLAS_OP_N)
+            .trans_b(HIPBLAS_OP_T)
+            .m(128)
+            .n(64)
+            .k(32)
+            .lda(128)
+            .ldb(64)
+            .ldc(128)
+            .alpha(&alpha, "f32_r")
+            .beta(&beta, "f32_r");
+        return record;
+    }
+
+    TEST(hipblas_trace_ring, publishes_committed_records)
+    {
+        hipblas_trace_ring ring(3, 4);
+
+        hipblas_trace_record* record = ring.reserve();
+        ASSERT_NE(record, nullptr);
+        record->function = "gemv";
+        record->m(10);
+
+        // nothing is visible until the record is committed
+        EXPECT_EQ(ring.drain([](const hipblas_trace_record&) {}), 0u);
+
+        ring.commit();
+        std::string function;
+        int64_t     m      = 0;
+        uint32_t    thread = 0;
+        EXPECT_EQ(ring.drain([&](const hipblas_trace_record& r) {
+                      function = r.function;
+                      m        = r.m_;
+                      thread   = r.thread;
+                  }),
+                  1u);
+        EXPECT_EQ(function, "gemv");
+        EXPECT_EQ(m, 10);
+        EXPECT_EQ(thread, 3u);
+    }
+
+    TEST(hipblas_trace_ring, drops_records_when_full)
+    {
+        hipblas_trace_ring ring(0, 2);
+
+        for(int i = 0; i < 2; i++)
+        {
+            ASSERT_NE(ring.reserve(), nullptr);
+            ring.commit();
+        }
+        EXPECT_EQ(ring.reserve(), nullptr);
+        EXPECT_EQ(ring.dropped(), 1u);
+
+        // draining frees the slots again
+        EXPECT_EQ(ring.drain([](const hipblas_trace_record&) {}), 2u);
+        EXPECT_NE(ring.reserve(), nullptr);
+    }
+
+    TEST(hipblas_trace_ring, records_only_outermost_call)
+    {
+        hipblas_trace_ring ring(0, 4);
+
+        ASSERT_NE(ring.reserve(), nullptr);
+        EXPECT_EQ(ring.reserve(), nullptr);
+        EXPECT_EQ(ring.dropped(), 0u);
+        ring.commit();
+
+        EXPECT_EQ(ring.drain([](const hipblas_trace_record&) {}), 1u);
+    }
+
+    TEST(hipblas_trace_record, scalars_only_read_in_host_mode)
+    {
+        double alpha[2] = {1.5, -2.0};
+
+        hipblas_trace_record record;
+        record.pointer_mode = HIPBLAS_POINTER_MODE_DEVICE;
+        record.alpha(alpha, "f64_c");
+        EXPECT_FALSE(record.has_alpha);
+
+        record.pointer_mode = HIPBLAS_POINTER_MODE_HOST;
+        record.alpha(alpha, "f64_c");
+        EXPECT_TRUE(record.has_alpha);
+        EXPECT_EQ(record.alpha_[0], 1.5);
+        EXPECT_EQ(record.alpha_[1], -2.0);
+
+        uint16_t half_one = 0x3c00;
+        record.beta(&half_one, "f16_r");
+        EXPECT_EQ(record.beta_[0], 1.0);
+    }
+
+    TEST(hipblas_trace_format, bench_command)
+    {
+        EXPECT_EQ(hipblas_trace_bench_command(make_gemm_record()),
+                  "hipblas-bench -f gemm -r f32_r --transposeA N --transposeB T -m 128 -n 64 -k 32 "
+                  "--lda 128 --ldb 64 --ldc 128 --alpha 2 --alphai 0 --beta 0.5 --betai 0");
+
+        hipblas_trace_record record;
+        record.routine  = "hipblasGemmStridedBatchedEx_v2_64";
+        record.function = "gemm_strided_batched_ex";
+        record.types("f16_r", "f16_r", "f32_r", "c32f").m(8).batch_count(4);
+        EXPECT_EQ(hipblas_trace_bench_command(record),
+                  "hipblas_v2-bench -f gemm_strided_batched_ex --a_type f16_r --b_type f16_r "
+                  "--c_type f32_r --compute_type_gemm c32f -m 8 --batch_count 4 --api 1");
+    }
+
+    TEST(hipblas_trace_format, csv_row_matches_header)
+    {
+        std::string header = hipblas_trace_csv_header();
+        std::string row    = hipblas_trace_format(make_gemm_record(), false);
+
+        EXPECT_EQ(std::count(row.begin(), row.end(), ','),
+                  std::count(header.begin(), header.end(), ','));
+        EXPECT_EQ(row.find("0,0,hipblasSgemm,gemm,f32_r,,,,,N,T,,,,128,64,32,,,128,64,128,"), 0u);
+    }
+
+    TEST(hipblas_trace_format, json_omits_unset_fields)
+    {
+        std::string json = hipblas_trace_format(make_gemm_record(), true);
+
+        EXPECT_EQ(json.front(), '{');
+        EXPECT_EQ(json.back(), '}');
+        EXPECT_NE(json.find("\"routine\": \"hipblasSgemm\""), std::string::npos);
+        EXPECT_NE(json.find("\"m\": 128"), std::string::npos);
+        EXPECT_NE(json.find("\"pointer_mode\": \"host\""), std::string::npos);
+        EXPECT_EQ(json.find("incx"), std::string::npos);
+        EXPECT_EQ(json.find("latency_us"), std::string::npos);
+    }
+
+} // namespace
@@ -0,0 +1,739 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+// Tests of the tiled multi-device Level-3 engine behind the hipblasXt functions,
+// run on CPU devices that implement the device interface with plain loops.
+
+#include "xt_engine.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+namespace
+{
+    // Dense op(X) of a column major matrix X
+    std::vector<double> op_matrix(
+        const double* X, int64_t ld, hipblasOperation_t trans, int64_t rows, int64_t cols)
+    {
+        std::vector<double> Y(rows * cols);
+        for(int64_t j = 0; j < cols; j++)
+            for(int64_t i = 0; i < rows; i++)
+                Y[i + j * rows] = trans == HIPBLAS_OP_N ? X[i + j * ld] : X[j + i * ld];
+        return Y;
+    }
+
+    // Solves M * X = R in place for a square triangular M without pivoting
+    void solve(std::vector<double> M, int64_t n, double* R, int64_t ldr, int64_t cols)
+    {
+        for(int64_t p = 0; p < n; p++)
+            for(int64_t i = 0; i < n; i++)
+            {
+                if(i == p)
+                    continue;
+                double f = M[i + p * n] / M[p + p * n];
+                for(int64_t j = 0; j < n; j++)
+                    M[i + j * n] -= f * M[p + j * n];
+                for(int64_t j = 0; j < cols; j++)
+                    R[i + j * ldr] -= f * R[p + j * ldr];
+            }
+        for(int64_t p = 0; p < n; p++)
+            for(int64_t j = 0; j < cols; j++)
+                R[p + j * ldr] /= M[p + p * n];
+    }
+
+    // op(A) of a triangular A as a dense matrix
+    std::vector<double> triangle(const double*      A,
+                                 int64_t            lda,
+                                 int64_t            n,
+                                 hipblasFillMode_t  uplo,
+                                 hipblasOperation_t trans,
+                                 hipblasDiagType_t  diag)
+    {
+        std::vector<double> T(n * n, 0.0);
+        for(int64_t j = 0; j < n; j++)
+            for(int64_t i = 0; i < n; i++)
+                if(uplo == HIPBLAS_FILL_MODE_LOWER ? i >= j : i <= j)
+                    T[i + j * n] = i == j && diag == HIPBLAS_DIAG_UNIT ? 1.0 : A[i + j * lda];
+        return op_matrix(T.data(), n, trans, n, n);
+    }
+
+    void reference_gemm(hipblasOperation_t trans_a,
+                        hipblasOperation_t trans_b,
+                        int64_t            m,
+                        int64_t            n,
+                        int64_t            k,
+                        double             alpha,
+                        const double*      A,
+                        int64_t            lda,
+                        const double*      B,
+                        int64_t            ldb,
+                        double             beta,
+                        double*            C,
+                        int64_t            ldc)
+    {
+        std::vector<double> a = op_matrix(A, lda, trans_a, m, k);
+        std::vector<double> b = op_matrix(B, ldb, trans_b, k, n);
+        for(int64_t j = 0; j < n; j++)
+            for(int64_t i = 0; i < m; i++)
+            {
+                double sum = 0;
+                for(int64_t l = 0; l < k; l++)
+                    sum += a[i + l * m] * b[l + j * k];
+                double c       = beta == 0 ? 0.0 : beta * C[i + j * ldc];
+                C[i + j * ldc] = alpha * sum + c;
+            }
+    }
+
+    // A device whose memory is host memory and whose work runs when it is queued
+    class cpu_device : public hipblas_xt_device<double>
+    {
+    public:
+        explicit cpu_device(std::chrono::microseconds delay = {})
+            : m_delay(delay)
+        {
+        }
+
+        int tasks = 0;
+
+        hipblasStatus_t prepare(size_t elements) override
+        {
+            m_elements = elements;
+            m_memory.assign(2 * elements, std::nan(""));
+            return HIPBLAS_STATUS_SUCCESS;
+        }
+
+        double* memory(int slot) override
+        {
+            return m_memory.data() + slot * m_elements;
+        }
+
+        hipblasStatus_t upload(int           slot,
+                               double*       dst,
+                               int64_t       ld_dst,
+                               const double* src,
+                               int64_t       ld_src,
+                               int64_t       rows,
+                               int64_t       cols) override
+        {
+            EXPECT_TRUE(owns(slot, dst, ld_dst, rows, cols));
+            copy(dst, ld_dst, src, ld_src, rows, cols);
+            return HIPBLAS_STATUS_SUCCESS;
+        }
+
+        hipblasStatus_t download(int           slot,
+                                 double*       dst,
+                                 int64_t       ld_dst,
+                                 const double* src,
+                                 int64_t       ld_src,
+                                 int64_t       rows,
+                                 int64_t       cols) override
+        {
+            EXPECT_TRUE(owns(slot, src, ld_src, rows, cols));
+            copy(dst, ld_dst, src, ld_src, rows, cols);
+            tasks++;
+            std::this_thread::sleep_for(m_delay);
+            return HIPBLAS_STATUS_SUCCESS;
+        }
+
+        hipblasStatus_t gemm(int                slot,
+                             hipblasOperation_t trans_a,
+                             hipblasOperation_t trans_b,
+                             int64_t            m,
+                             int64_t            n,
+                             int64_t            k,
+                             double             alpha,
+                             const double*      A,
+                             int64_t            lda,
+                             const double*      B,
+                             int64_t            ldb,
+                             double             beta,
+                             double*            C,
+                             int64_t            ldc) override
+        {
+            EXPECT_TRUE(owns(slot, C, ldc, m, n));
+            reference_gemm(trans_a, trans_b, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+            return HIPBLAS_STATUS_SUCCESS;
+        }
+
+        hipblasStatus_t trsm(int                slot,
+                             hipblasSideMode_t  side,
+                             hipblasFillMode_t  uplo,
+                             hipblasOperation_t trans,
+                             hipblasDiagType_t  diag,
+                             int64_t            m,
+                             int64_t            n,
+                             double             alpha,
+                             const double*      A,
+                             int64_t            lda,
+                             double*            B,
+                             int64_t            ldb) override
+        {
+            EXPECT_TRUE(owns(slot, B, ldb, m, n));
+            for(int64_t j = 0; j < n; j++)
+                for(int64_t i = 0; i < m; i++)
+                    B[i + j * ldb] *= alpha;
+
+            bool                left = side == HIPBLAS_SIDE_LEFT;
+            std::vector<double> M    = triangle(A, lda, left ? m : n, uplo, trans, diag);
+            if(left)
+                solve(M, m, B, ldb, n);
+            else
+            {
+                // X * M = B is M^T * X^T = B^T
+                std::vector<double> Bt = op_matrix(B, ldb, HIPBLAS_OP_T, n, m);
+                solve(op_matrix(M.data(), n, HIPBLAS_OP_T, n, n), n, Bt.data(), n, m);
+                copy(B, ldb, op_matrix(Bt.data(), n, HIPBLAS_OP_T, m, n).data(), m, m, n);
+            }
+            return HIPBLAS_STATUS_SUCCESS;
+        }
+
+        hipblasStatus_t synchronize(int) override
+        {
+            return HIPBLAS_STATUS_SUCCESS;
+        }
+
+    private:
+        static void copy(double*       dst,
+                         int64_t       ld_dst,
+                         const double* src,
+                         int64_t       ld_src,
+                         int64_t       rows,
+                         int64_t       cols)
+        {
+            for(int64_t j = 0; j < cols; j++)
+                for(int64_t i = 0; i < rows; i++)
+                    dst[i + j * ld_dst] = src[i + j * ld_src];
+        }
+
+        // Whether a matrix lies in the memory of the slot
+        bool owns(int slot, const double* X, int64_t ld, int64_t rows, int64_t cols)
+        {
+            const double* first = m_memory.data() + slot * m_elements;
+            return X >= first && (cols == 0 || X + (cols - 1) * ld + rows <= first + m_elements);
+        }
+
+        std::chrono::microseconds m_delay;
+        size_t                    m_elements = 0;
+        std::vector<double>       m_memory;
+    };
+
+    std::vector<double> random_matrix(int64_t size, int seed)
+    {
+        std::mt19937                     gen(seed);
+        std::uniform_real_distribution<> dist(-1.0, 1.0);
+        std::vector<double>              X(size);
+        for(double& x : X)
+            x = dist(gen);
+        return X;
+    }
+
+    struct cpu_devices
+    {
+        explicit cpu_devices(int count)
+        {
+            for(int d = 0; d < count; d++)
+                storage.emplace_back(new cpu_device);
+            for(auto& device : storage)
+                devices.push_back(device.get());
+        }
+
+        std::vector<std::unique_ptr<cpu_device>> storage;
+        std::vector<hipblas_xt_device<double>*>  devices;
+    };
+
+    void expect_near(const std::vector<double>& actual, const std::vector<double>& expected)
+    {
+        ASSERT_EQ(actual.size(), expected.size());
+        for(size_t i = 0; i < actual.size(); i++)
+            ASSERT_NEAR(actual[i], expected[i], 1e-9) << "at " << i;
+    }
+
+    TEST(hipblas_xt_engine, tiles)
+    {
+        EXPECT_EQ(hipblas_xt_tiles(10, 7, 4, HIPBLAS_FILL_MODE_FULL).size(), 6u);
+
+        auto lower = hipblas_xt_tiles(10, 10, 4, HIPBLAS_FILL_MODE_LOWER);
+        EXPECT_EQ(lower.size(), 6u);
+        for(auto& tile : lower)
+            EXPECT_GE(tile.row, tile.col);
+
+        auto last = hipblas_xt_tiles(10, 7, 4, HIPBLAS_FILL_MODE_FULL).back();
+        EXPECT_EQ(last.row, 8);
+        EXPECT_EQ(last.col, 4);
+        EXPECT_EQ(last.rows, 2);
+        EXPECT_EQ(last.cols, 3);
+    }
+
+    TEST(hipblas_xt_engine, scheduler_steals)
+    {
+        std::vector<hipblas_xt_task> tasks;
+        for(int i = 0; i < 10; i++)
+            tasks.push_back({i, 0, 1, 1});
+
+        // worker 1 takes its own tasks in order, then the others from the back
+        hipblas_xt_scheduler scheduler(tasks, 2);
+        std::vector<int64_t> order;
+        hipblas_xt_task      task;
+        while(scheduler.next(1, task))
+            order.push_back(task.row);
+
+        EXPECT_EQ(order, (std::vector<int64_t>{5, 6, 7, 8, 9, 4, 3, 2, 1, 0}));
+        EXPECT_EQ(scheduler.stolen(), 5u);
+        EXPECT_FALSE(scheduler.next(0, task));
+    }
+
+    TEST(hipblas_xt_engine, slow_device_is_relieved)
+    {
+        cpu_device fast;
+        cpu_device slow(std::chrono::milliseconds(20));
+
+        int64_t             n = 64, nb = 8;
+        std::vector<double> A = random_matrix(n * n, 1), B = random_matrix(n * n, 2);
+        std::vector<double> C(n * n), expected(n * n);
+        double              alpha = 1, beta = 0;
+
+        std::vector<hipblas_xt_device<double>*> devices{&fast, &slow};
+        ASSERT_EQ(hipblas_xt_gemm(devices,
+                                  nb,
+                                  HIPBLAS_OP_N,
+                                  HIPBLAS_OP_N,
+                                  n,
+                                  n,
+                                  n,
+                                  &alpha,
+                                  A.data(),
+                                  n,
+                                  B.data(),
+                                  n,
+                                  &beta,
+                                  C.data(),
+                                  n),
+                  HIPBLAS_STATUS_SUCCESS);
+
+        reference_gemm(HIPBLAS_OP_N,
+                       HIPBLAS_OP_N,
+                       n,
+                       n,
+                       n,
+                       alpha,
+                       A.data(),
+                       n,
+                       B.data(),
+                       n,
+                       beta,
+                       expected.data(),
+                       n);
+        expect_near(C, expected);
+        EXPECT_EQ(fast.tasks + slow.tasks, 64);
+        EXPECT_GT(fast.tasks, 32);
+    }
+
+    TEST(hipblas_xt_engine, gemm)
+    {
+        cpu_devices cpus(3);
+        int64_t     m = 37, n = 29, k = 23, nb = 8;
+        for(auto trans_a : {HIPBLAS_OP_N, HIPBLAS_OP_T})
+            for(auto trans_b : {HIPBLAS_OP_N, HIPBLAS_OP_C})
+            {
+                int64_t lda = (trans_a == HIPBLAS_OP_N ? m : k) + 3;
+                int64_t ldb = (trans_b == HIPBLAS_OP_N ? k : n) + 1;
+                int64_t ldc = m + 2;
+
+                std::vector<double> A = random_matrix(lda * (trans_a == HIPBLAS_OP_N ? k : m), 1);
+                std::vector<double> B = random_matrix(ldb * (trans_b == HIPBLAS_OP_N ? n : k), 2);
+                std::vector<double> C = random_matrix(ldc * n, 3), expected = C;
+                double              alpha = 0.5, beta = -2;
+
+                ASSERT_EQ(hipblas_xt_gemm(cpus.devices,
+                                          nb,
+                                          trans_a,
+                                          trans_b,
+                                          m,
+                                          n,
+                                          k,
+                                          &alpha,
+                                          A.data(),
+                                          lda,
+                                          B.data(),
+                                          ldb,
+                                          &beta,
+                                          C.data(),
+                                          ldc),
+                          HIPBLAS_STATUS_SUCCESS);
+                reference_gemm(trans_a,
+                               trans_b,
+                               m,
+                               n,
+                               k,
+                               alpha,
+                               A.data(),
+                               lda,
+                               B.data(),
+                               ldb,
+                               beta,
+                               expected.data(),
+                               ldc);
+                expect_near(C, expected);
+            }
+    }
+
+    TEST(hipblas_xt_engine, product_block_fits_budget)
+    {
+        // two slots of three nb x nb tiles
+        EXPECT_EQ(hipblas_xt_product_block(6 * 8 * 100, 8, 1000, 1000, 1000), 10);
+        EXPECT_EQ(hipblas_xt_product_block(6 * 8 * 100 - 1, 8, 1000, 1000, 1000), 9);
+        EXPECT_EQ(hipblas_xt_product_block(6 * 8 - 1, 8, 1000, 1000, 1000), 0);
+
+        // multiples of 64 once large, and no larger than the problem
+        EXPECT_EQ(hipblas_xt_product_block(size_t(1) << 30, 8, 1 << 20, 1 << 20, 1), 4672);
+        EXPECT_EQ(hipblas_xt_product_block(size_t(1) << 30, 8, 100, 50, 70), 100);
+    }
+
+    TEST(hipblas_xt_engine, gemm_strided_batched_reports_progress)
+    {
+        cpu_devices cpus(1);
+        int64_t     m = 21, n = 17, k = 30, nb = 8, batch_count = 3;
+        int64_t     lda = k, ldb = k, ldc = m + 1;
+        int64_t     stride_a = lda * m + 5, stride_b = ldb * n, stride_c = ldc * n + 2;
+
+        std::vector<double> A = random_matrix(stride_a * batch_count, 1);
+        std::vector<double> B = random_matrix(stride_b * batch_count, 2);
+        std::vector<double> C = random_matrix(stride_c * batch_count, 3), expected = C;
+        double              alpha = 2, beta = 0.5;
+
+        std::vector<int64_t> done;
+        int64_t              total = 0;
+        auto                 progress = [&](int64_t tiles_done, int64_t tiles_total) {
+            done.push_back(tiles_done);
+            total = tiles_total;
+        };
+
+        ASSERT_EQ(hipblas_xt_gemm_strided_batched(cpus.devices,
+                                                  nb,
+                                                  HIPBLAS_OP_T,
+                                                  HIPBLAS_OP_N,
+                                                  m,
+                                                  n,
+                                                  k,
+                                                  &alpha,
+                                                  A.data(),
+                                                  lda,
+                                                  stride_a,
+                                                  B.data(),
+                                                  ldb,
+                                                  stride_b,
+                                                  &beta,
+                                                  C.data(),
+                                                  ldc,
+                                                  stride_c,
+                                                  batch_count,
+                                                  progress),
+                  HIPBLAS_STATUS_SUCCESS);
+
+        for(int64_t b = 0; b < batch_count; b++)
+            reference_gemm(HIPBLAS_OP_T,
+                           HIPBLAS_OP_N,
+                           m,
+                           n,
+                           k,
+                           alpha,
+                           A.data() + b * stride_a,
+                           lda,
+                           B.data() + b * stride_b,
+                           ldb,
+                           beta,
+                           expected.data() + b * stride_c,
+                           ldc);
+        expect_near(C, expected);
+
+        // 3 x 3 tiles per problem, each reported once
+        EXPECT_EQ(total, 27);
+        ASSERT_EQ(done.size(), 27u);
+        for(size_t i = 0; i < done.size(); i++)
+            EXPECT_EQ(done[i], int64_t(i + 1));
+
+        // no tile fits
+        EXPECT_EQ(hipblas_xt_gemm_strided_batched(cpus.devices,
+                                                  0,
+                                                  HIPBLAS_OP_T,
+                                                  HIPBLAS_OP_N,
+                                                  m,
+                                                  n,
+                                                  k,
+                                                  &alpha,
+                                                  A.data(),
+                                                  lda,
+                                                  stride_a,
+                                                  B.data(),
+                                                  ldb,
+                                                  stride_b,
+                                                  &beta,
+                                                  C.data(),
+                                                  ldc,
+                                                  stride_c,
+                                                  batch_count),
+                  HIPBLAS_STATUS_ALLOC_FAILED);
+    }
+
+    TEST(hipblas_xt_engine, syrk_writes_one_triangle)
+    {
+        cpu_devices cpus(2);
+        int64_t     n = 30, k = 19, nb = 8, ldc = n + 1;
+        for(auto uplo : {HIPBLAS_FILL_MODE_LOWER, HIPBLAS_FILL_MODE_UPPER})
+            for(auto trans : {HIPBLAS_OP_N, HIPBLAS_OP_T})
+            {
+                int64_t             lda = trans == HIPBLAS_OP_N ? n : k;
+                std::vector<double> A   = random_matrix(lda * (trans == HIPBLAS_OP_N ? k : n), 4);
+                std::vector<double> C   = random_matrix(ldc * n, 5), full = C;
+                double              alpha = 2, beta = 0.25;
+
+                ASSERT_EQ(hipblas_xt_syrk(cpus.devices,
+                                          nb,
+                                          uplo,
+                                          trans,
+                                          n,
+                                          k,
+                                          &alpha,
+                                          A.data(),
+                                          lda,
+                                          &beta,
+                                          C.data(),
+                                          ldc),
+                          HIPBLAS_STATUS_SUCCESS);
+
+                hipblasOperation_t trans_t = trans == HIPBLAS_OP_N ? HIPBLAS_OP_T : HIPBLAS_OP_N;
+                std::vector<double> expected = full;
+                reference_gemm(trans,
+                               trans_t,
+                               n,
+                               n,
+                               k,
+                               alpha,
+                               A.data(),
+                               lda,
+                               A.data(),
+                               lda,
+                               beta,
+                               expected.data(),
+                               ldc);
+                for(int64_t j = 0; j < n; j++)
+                    for(int64_t i = 0; i < ldc; i++)
+                    {
+                        bool   lower = uplo == HIPBLAS_FILL_MODE_LOWER;
+                        bool   in    = i < n && (lower ? i >= j : i <= j);
+                        double want  = in ? expected[i + j * ldc] : full[i + j * ldc];
+                        ASSERT_NEAR(C[i + j * ldc], want, 1e-9) << i << ", " << j;
+                    }
+            }
+    }
+
+    TEST(hipblas_xt_engine, symm)
+    {
+        cpu_devices cpus(2);
+        int64_t     m = 27, n = 18, nb = 8, ldb = m, ldc = m + 1;
+        for(auto side : {HIPBLAS_SIDE_LEFT, HIPBLAS_SIDE_RIGHT})
+            for(auto uplo : {HIPBLAS_FILL_MODE_LOWER, HIPBLAS_FILL_MODE_UPPER})
+            {
+                int64_t             ka  = side == HIPBLAS_SIDE_LEFT ? m : n;
+                int64_t             lda = ka + 2;
+                std::vector<double> A   = random_matrix(lda * ka, 6);
+                std::vector<double> B   = random_matrix(ldb * n, 7);
+                std::vector<double> C   = random_matrix(ldc * n, 8), expected = C;
+                double              alpha = -1, beta = 3;
+
+                // The full symmetric matrix the stored triangle stands for
+                std::vector<double> S(ka * ka);
+                for(int64_t j = 0; j < ka; j++)
+                    for(int64_t i = 0; i < ka; i++)
+                    {
+                        bool stored   = uplo == HIPBLAS_FILL_MODE_LOWER ? i >= j : i <= j;
+                        S[i + j * ka] = stored ? A[i + j * lda] : A[j + i * lda];
+                    }
+
+                ASSERT_EQ(hipblas_xt_symm(cpus.devices,
+                                          nb,
+                                          side,
+                                          uplo,
+                                          m,
+                                          n,
+                                          &alpha,
+                                          A.data(),
+                                          lda,
+                                          B.data(),
+                                          ldb,
+                                          &beta,
+                                          C.data(),
+                                          ldc),
+                          HIPBLAS_STATUS_SUCCESS);
+                if(side == HIPBLAS_SIDE_LEFT)
+                    reference_gemm(HIPBLAS_OP_N,
+                                   HIPBLAS_OP_N,
+                                   m,
+                                   n,
+                                   m,
+                                   alpha,
+                                   S.data(),
+                                   m,
+                                   B.data(),
+                                   ldb,
+                                   beta,
+                                   expected.data(),
+                                   ldc);
+                else
+                    reference_gemm(HIPBLAS_OP_N,
+                                   HIPBLAS_OP_N,
+                                   m,
+                                   n,
+                                   n,
+                                   alpha,
+                                   B.data(),
+                                   ldb,
+                                   S.data(),
+                                   n,
+                                   beta,
+                                   expected.data(),
+                                   ldc);
+                expect_near(C, expected);
+            }
+    }
+
+    TEST(hipblas_xt_engine, trsm)
+    {
+        cpu_devices cpus(3);
+        int64_t     m = 29, n = 21, nb = 8, ldb = m + 3;
+        for(auto side : {HIPBLAS_SIDE_LEFT, HIPBLAS_SIDE_RIGHT})
+            for(auto uplo : {HIPBLAS_FILL_MODE_LOWER, HIPBLAS_FILL_MODE_UPPER})
+                for(auto trans : {HIPBLAS_OP_N, HIPBLAS_OP_T})
+                    for(auto diag : {HIPBLAS_DIAG_NON_UNIT, HIPBLAS_DIAG_UNIT})
+                    {
+                        int64_t             ka  = side == HIPBLAS_SIDE_LEFT ? m : n;
+                        int64_t             lda = ka + 1;
+                        std::vector<double> A   = random_matrix(lda * ka, 9);
+                        for(int64_t i = 0; i < ka; i++)
+                            A[i + i * lda] += ka; // well conditioned
+                        std::vector<double> B = random_matrix(ldb * n, 10), X = B;
+                        double              alpha = 1.5;
+
+                        ASSERT_EQ(hipblas_xt_trsm(cpus.devices,
+                                                  nb,
+                                                  side,
+                                                  uplo,
+                                                  trans,
+                                                  diag,
+                                                  m,
+                                                  n,
+                                                  &alpha,
+                                                  A.data(),
+                                                  lda,
+                                                  X.data(),
+                                                  ldb),
+                                  HIPBLAS_STATUS_SUCCESS);
+
+                        // op(A) * X or X * op(A) gives back alpha * B
+                        std::vector<double> M = triangle(A.data(), lda, ka, uplo, trans, diag);
+                        std::vector<double> R(ldb * n, 0.0);
+                        if(side == HIPBLAS_SIDE_LEFT)
+                            reference_gemm(HIPBLAS_OP_N,
+                                           HIPBLAS_OP_N,
+                                           m,
+                                           n,
+                                           m,
+                                           1.0,
+                                           M.data(),
+                                           m,
+                                           X.data(),
+                                           ldb,
+                                           0.0,
+                                           R.data(),
+                                           ldb);
+                        else
+                            reference_gemm(HIPBLAS_OP_N,
+                                           HIPBLAS_OP_N,
+                                           m,
+                                           n,
+                                           n,
+                                           1.0,
+                                           X.data(),
+                                           ldb,
+                                           M.data(),
+                                           n,
+                                           0.0,
+                                           R.data(),
+                                           ldb);
+                        for(int64_t j = 0; j < n; j++)
+                            for(int64_t i = 0; i < m; i++)
+                                ASSERT_NEAR(R[i + j * ldb], alpha * B[i + j * ldb], 1e-9);
+                    }
+    }
+
+    TEST(hipblas_xt_engine, arguments)
+    {
+        cpu_devices cpus(1);
+        double      one = 1, x = 0;
+
+        // lda < m
+        hipblasStatus_t status = hipblas_xt_gemm(
+            cpus.devices, 8, HIPBLAS_OP_N, HIPBLAS_OP_N, 4, 4, 4, &one, &x, 3, &x, 4, &one, &x, 4);
+        EXPECT_EQ(status, HIPBLAS_STATUS_INVALID_VALUE);
+
+        status = hipblas_xt_gemm(cpus.devices,
+                                 8,
+                                 hipblasOperation_t(0),
+                                 HIPBLAS_OP_N,
+                                 4,
+                                 4,
+                                 4,
+                                 &one,
+                                 &x,
+                                 4,
+                                 &x,
+                                 4,
+                                 &one,
+                                 &x,
+                                 4);
+        EXPECT_EQ(status, HIPBLAS_STATUS_INVALID_ENUM);
+
+        status = hipblas_xt_syrk(
+            cpus.devices, 8, HIPBLAS_FILL_MODE_FULL, HIPBLAS_OP_N, 4, 4, &one, &x, 4, &one, &x, 4);
+        EXPECT_EQ(status, HIPBLAS_STATUS_INVALID_ENUM);
+
+        // empty problems return before the pointers are checked
+        status = hipblas_xt_trsm<double>(cpus.devices,
+                                         8,
+                                         HIPBLAS_SIDE_LEFT,
+                                         HIPBLAS_FILL_MODE_LOWER,
+                                         HIPBLAS_OP_N,
+                                         HIPBLAS_DIAG_UNIT,
+                                         0,
+                                         4,
+                                         nullptr,
+                                         nullptr,
+                                         1,
+                                         nullptr,
+                                         1);
+        EXPECT_EQ(status, HIPBLAS_STATUS_SUCCESS);
+    }
+}
@@ -0,0 +1,149 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+inline void testname_capture(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<e_N>{}.test_name(arg, name);
+}
+
+void testing_capture(const Arguments& arg)
+{
+    using T = float;
+
+    int N     = arg.N;
+    T   two   = 2;
+    T   three = 3;
+    T   half  = 0.5;
+
+    hipblasLocalHandle handle(arg);
+    hipblasGraph_t     graph = nullptr;
+    int                count = 0;
+
+    EXPECT_HIPBLAS_STATUS(hipblasBeginCapture(nullptr), HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasEndCapture(handle, &graph), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasGraphGetNodeCount(nullptr, &count), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasGraphDestroy(nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+
+    host_vector<T> hx(N, 1);
+    host_vector<T> hy(N, 1);
+    host_vector<T> hz(N, 1);
+    host_vector<T> hx_gold(N, 1);
+    host_vector<T> hy_gold(N, 1);
+
+    device_vector<T> dx(N, 1);
+    device_vector<T> dy(N, 1);
+    device_vector<T> dz(N, 1);
+
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_DEVICE_ALLOCATION(dz.memcheck());
+
+    hipblas_init_vector(hx, arg, hipblas_client_never_set_nan, true);
+    hipblas_init_vector(hy, arg, hipblas_client_never_set_nan, false);
+    hz = hy;
+
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(dy.transfer_from(hy));
+    CHECK_HIP_ERROR(dz.transfer_from(hz));
+
+    // Replays run on the stream of the handle, which can be captured into a HIP graph
+    hipStream_t stream;
+    CHECK_HIP_ERROR(hipStreamCreate(&stream));
+    CHECK_HIPBLAS_ERROR(hipblasSetStream(handle, stream));
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    // x = 2 x, y = 3 x + y, recorded and not run
+    CHECK_HIPBLAS_ERROR(hipblasBeginCapture(handle));
+    EXPECT_HIPBLAS_STATUS(hipblasBeginCapture(handle), HIPBLAS_STATUS_INVALID_VALUE);
+    CHECK_HIPBLAS_ERROR(hipblasSscal(handle, N, &two, dx, 1));
+    CHECK_HIPBLAS_ERROR(hipblasSaxpy(handle, N, &three, dx, 1, dy, 1));
+    three = 0;
+    CHECK_HIPBLAS_ERROR(hipblasEndCapture(handle, &graph));
+
+    CHECK_HIPBLAS_ERROR(hipblasGraphGetNodeCount(graph, &count));
+    EXPECT_EQ(count, 2);
+
+    CHECK_HIP_ERROR(hx_gold.transfer_from(dx));
+    unit_check_general<T>(1, N, 1, hx.data(), hx_gold.data());
+
+    hx_gold = hx;
+    hy_gold = hy;
+    for(int i = 0; i < N; i++)
+    {
+        hx_gold[i] *= 2;
+        hy_gold[i] += 3 * hx_gold[i];
+    }
+
+    CHECK_HIPBLAS_ERROR(hipblasGraphLaunch(graph, handle));
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+    CHECK_HIP_ERROR(hx.transfer_from(dx));
+    CHECK_HIP_ERROR(hy.transfer_from(dy));
+    unit_check_general<T>(1, N, 1, hx_gold.data(), hx.data());
+    unit_check_general<T>(1, N, 1, hy_gold.data(), hy.data());
+
+    // x = x / 2, z = 3 x + z; the pointer mode of the handle is unchanged by launches
+    hipblasPointerMode_t mode;
+    CHECK_HIPBLAS_ERROR(hipblasGetPointerMode(handle, &mode));
+    EXPECT_EQ(mode, HIPBLAS_POINTER_MODE_HOST);
+
+    CHECK_HIPBLAS_ERROR(hipblasGraphUpdateScalar(graph, 0, 0, &half));
+    CHECK_HIPBLAS_ERROR(hipblasGraphUpdatePointer(graph, dy, dz));
+    EXPECT_HIPBLAS_STATUS(hipblasGraphUpdateScalar(graph, 0, 1, &half),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasGraphUpdateScalar(graph, 2, 0, &half),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasGraphUpdatePointer(graph, dy, dz), HIPBLAS_STATUS_INVALID_VALUE);
+
+    hx_gold = hx;
+    for(int i = 0; i < N; i++)
+    {
+        hx_gold[i] *= half;
+        hz[i] += 3 * hx_gold[i];
+    }
+
+    CHECK_HIPBLAS_ERROR(hipblasGraphLaunch(graph, handle));
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+    CHECK_HIP_ERROR(hx.transfer_from(dx));
+    CHECK_HIP_ERROR(hy.transfer_from(dz));
+    unit_check_general<T>(1, N, 1, hx_gold.data(), hx.data());
+    unit_check_general<T>(1, N, 1, hz.data(), hy.data());
+
+    CHECK_HIPBLAS_ERROR(hipblasGraphDestroy(graph));
+
+    // Routines which are not recorded make the capture fail
+    T result;
+    CHECK_HIPBLAS_ERROR(hipblasBeginCapture(handle));
+    hipblasSdot(handle, N, dx, 1, dy, 1, &result);
+    EXPECT_HIPBLAS_STATUS(hipblasEndCapture(handle, &graph), HIPBLAS_STATUS_NOT_SUPPORTED);
+
+    hipStream_t current;
+    CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &current));
+    EXPECT_EQ(current, stream);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetStream(handle, nullptr));
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+}
@@ -0,0 +1,117 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_common.hpp"
+#include <thread>
+
+/* ============================================================================================ */
+
+inline void testname_handle_pool(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<e_N>{}.test_name(arg, name);
+}
+
+void testing_handle_pool(const Arguments& arg)
+{
+    using T = float;
+
+    int                 N       = arg.N;
+    const int           threads = 4;
+    const int           calls   = 8;
+    hipblasHandlePool_t pool    = nullptr;
+    hipblasHandle_t     handle  = nullptr;
+    uint64_t            created, acquires, waits;
+    double              seconds;
+
+    EXPECT_HIPBLAS_STATUS(hipblasHandlePoolCreate(nullptr, 1, 0), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasHandlePoolCreate(&pool, 0, 0), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasHandlePoolAcquire(nullptr, nullptr, &handle),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasHandlePoolDestroy(nullptr), HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    // Fewer handles than threads, so that some acquires wait
+    CHECK_HIPBLAS_ERROR(hipblasHandlePoolCreate(&pool, 2, 1 << 20));
+
+    // Each thread scales its own N elements
+    host_vector<T>   hx(size_t(N) * threads, 1);
+    host_vector<T>   hx_gold(size_t(N) * threads, 1);
+    device_vector<T> dx(size_t(N) * threads, 1);
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+
+    hipblas_init_vector(hx, arg, hipblas_client_never_set_nan, true);
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    hx_gold = hx;
+
+    std::vector<hipStream_t> streams(threads);
+    for(auto& stream : streams)
+        CHECK_HIP_ERROR(hipStreamCreate(&stream));
+
+    int device;
+    CHECK_HIP_ERROR(hipGetDevice(&device));
+
+    // Each thread doubles its vector calls times, with a handle acquired for each call
+    std::vector<std::thread>     workers;
+    std::vector<hipblasStatus_t> status(threads, HIPBLAS_STATUS_SUCCESS);
+    for(int t = 0; t < threads; t++)
+        workers.emplace_back([&, t] {
+            (void)hipSetDevice(device);
+            T two = 2;
+            for(int c = 0; c < calls && status[t] == HIPBLAS_STATUS_SUCCESS; c++)
+            {
+                hipblasHandle_t lent;
+                status[t] = hipblasHandlePoolAcquire(pool, streams[t], &lent);
+                if(status[t] == HIPBLAS_STATUS_SUCCESS)
+                    status[t] = hipblasSscal(lent, N, &two, (T*)dx + size_t(t) * N, 1);
+                if(status[t] == HIPBLAS_STATUS_SUCCESS)
+                    status[t] = hipblasHandlePoolRelease(pool, lent);
+            }
+        });
+    for(auto& worker : workers)
+        worker.join();
+
+    for(int t = 0; t < threads; t++)
+    {
+        EXPECT_HIPBLAS_STATUS(status[t], HIPBLAS_STATUS_SUCCESS);
+        CHECK_HIP_ERROR(hipStreamSynchronize(streams[t]));
+    }
+
+    for(size_t i = 0; i < size_t(N) * threads; i++)
+        hx_gold[i] *= T(1 << calls);
+    CHECK_HIP_ERROR(hx.transfer_from(dx));
+    unit_check_general<T>(1, N * threads, 1, hx_gold.data(), hx.data());
+
+    CHECK_HIPBLAS_ERROR(hipblasHandlePoolGetStats(pool, &created, &acquires, &waits, &seconds));
+    EXPECT_LE(created, 2u);
+    EXPECT_EQ(acquires, uint64_t(threads * calls));
+    EXPECT_GE(seconds, 0.0);
+
+    // A pool with a handle acquired is kept
+    CHECK_HIPBLAS_ERROR(hipblasHandlePoolAcquire(pool, streams[0], &handle));
+    EXPECT_HIPBLAS_STATUS(hipblasHandlePoolDestroy(pool), HIPBLAS_STATUS_INVALID_VALUE);
+    CHECK_HIPBLAS_ERROR(hipblasHandlePoolRelease(pool, handle));
+    EXPECT_HIPBLAS_STATUS(hipblasHandlePoolRelease(pool, handle), HIPBLAS_STATUS_INVALID_VALUE);
+    CHECK_HIPBLAS_ERROR(hipblasHandlePoolDestroy(pool));
+
+    for(hipStream_t stream : streams)
+        CHECK_HIP_ERROR(hipStreamDestroy(stream));
+}
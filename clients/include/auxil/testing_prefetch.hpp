@@ -0,0 +1,120 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+inline void testname_prefetch(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<e_N>{}.test_name(arg, name);
+}
+
+void testing_prefetch(const Arguments& arg)
+{
+    using T = float;
+
+    int N   = arg.N;
+    int lda = N;
+
+    hipblasLocalHandle handle(arg);
+
+    hipblasPrefetchMode_t mode;
+    uint64_t              prefetches, bytes;
+
+    EXPECT_HIPBLAS_STATUS(hipblasSetPrefetchMode(nullptr, HIPBLAS_PREFETCH_MODE_MANAGED),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasSetPrefetchMode(handle, hipblasPrefetchMode_t(2)),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_HIPBLAS_STATUS(hipblasGetPrefetchMode(handle, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasGetPrefetchStats(handle, nullptr, &bytes),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    CHECK_HIPBLAS_ERROR(hipblasGetPrefetchMode(handle, &mode));
+    EXPECT_EQ(mode, HIPBLAS_PREFETCH_MODE_OFF);
+
+    host_matrix<T> hA(N, N, lda);
+    host_matrix<T> hC_device(N, N, lda);
+    host_matrix<T> hC_managed(N, N, lda);
+
+    device_matrix<T> dA(N, N, lda);
+    device_matrix<T> dC(N, N, lda);
+    device_matrix<T> mA(N, N, lda, true);
+    device_matrix<T> mC(N, N, lda, true);
+
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+    CHECK_DEVICE_ALLOCATION(mA.memcheck());
+    CHECK_DEVICE_ALLOCATION(mC.memcheck());
+
+    hipblas_init_matrix(hA, arg, hipblas_client_never_set_nan, hipblas_general_matrix, true);
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(mA.transfer_from(hA));
+
+    T alpha = 1, beta = 0;
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    auto sgemm = [&](const T* A, T* C) {
+        return hipblasSgemm(
+            handle, HIPBLAS_OP_N, HIPBLAS_OP_T, N, N, N, &alpha, A, lda, A, lda, &beta, C, lda);
+    };
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPrefetchMode(handle, HIPBLAS_PREFETCH_MODE_MANAGED));
+    CHECK_HIPBLAS_ERROR(hipblasGetPrefetchMode(handle, &mode));
+    EXPECT_EQ(mode, HIPBLAS_PREFETCH_MODE_MANAGED);
+
+    // Operands in device memory are not prefetched
+    CHECK_HIPBLAS_ERROR(sgemm(dA, dC));
+    CHECK_HIPBLAS_ERROR(hipblasGetPrefetchStats(handle, &prefetches, &bytes));
+    EXPECT_EQ(prefetches, 0u);
+    EXPECT_EQ(bytes, 0u);
+
+    CHECK_HIPBLAS_ERROR(sgemm(mA, mC));
+    CHECK_HIPBLAS_ERROR(sgemm(mA, mC));
+    CHECK_HIP_ERROR(hipDeviceSynchronize());
+    CHECK_HIP_ERROR(hC_device.transfer_from(dC));
+    CHECK_HIP_ERROR(hipMemcpy(hC_managed, mC, sizeof(T) * lda * N, hipMemcpyDefault));
+    unit_check_general<T>(N, N, lda, hC_device, hC_managed);
+
+    // Prefetching needs a device which can access managed memory concurrently with the host
+    int device, concurrent = 0;
+    CHECK_HIP_ERROR(hipGetDevice(&device));
+    CHECK_HIP_ERROR(
+        hipDeviceGetAttribute(&concurrent, hipDeviceAttributeConcurrentManagedAccess, device));
+
+    CHECK_HIPBLAS_ERROR(hipblasGetPrefetchStats(handle, &prefetches, &bytes));
+    if(concurrent)
+    {
+        // A, B and C of each call, A and B being the same memory
+        EXPECT_EQ(prefetches, 6u);
+        EXPECT_EQ(bytes, 6u * sizeof(T) * lda * N);
+    }
+
+    // Turning prefetching off keeps the counts
+    uint64_t prefetches_on = prefetches;
+    CHECK_HIPBLAS_ERROR(hipblasSetPrefetchMode(handle, HIPBLAS_PREFETCH_MODE_OFF));
+    CHECK_HIPBLAS_ERROR(sgemm(mA, mC));
+    CHECK_HIPBLAS_ERROR(hipblasGetPrefetchStats(handle, &prefetches, &bytes));
+    EXPECT_EQ(prefetches, prefetches_on);
+    CHECK_HIP_ERROR(hipDeviceSynchronize());
+}
@@ -0,0 +1,154 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipblas_unique_ptr.hpp"
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+inline void testname_set_workspace(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<e_M, e_N>{}.test_name(arg, name);
+}
+
+void testing_set_workspace(const Arguments& arg)
+{
+    using T = float;
+
+    hipblasSideMode_t  side   = HIPBLAS_SIDE_LEFT;
+    hipblasFillMode_t  uplo   = HIPBLAS_FILL_MODE_UPPER;
+    hipblasOperation_t transA = HIPBLAS_OP_N;
+    hipblasDiagType_t  diag   = HIPBLAS_DIAG_NON_UNIT;
+    int                M      = arg.M;
+    int                N      = arg.N;
+    int                lda    = M;
+    int                ldb    = M;
+    T                  alpha  = 1;
+    size_t             bytes  = 0;
+
+    hipblasLocalHandle handle(arg);
+
+    EXPECT_HIPBLAS_STATUS(hipblasSetWorkspace(nullptr, nullptr, 0),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasSetWorkspace(handle, nullptr, 256), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasGetWorkspaceSizeForTrsm(
+                              nullptr, side, uplo, transA, diag, M, N, HIP_R_32F, lda, ldb, &bytes),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasGetWorkspaceSizeForTrsm(
+                              handle, side, uplo, transA, diag, M, N, HIP_R_32F, lda, ldb, nullptr),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    // The workspace holds the largest size of the calls made
+    size_t trsm_bytes, gemm_bytes;
+    CHECK_HIPBLAS_ERROR(hipblasGetWorkspaceSizeForTrsm(
+        handle, side, uplo, transA, diag, M, N, HIP_R_32F, lda, ldb, &trsm_bytes));
+    CHECK_HIPBLAS_ERROR(hipblasGetWorkspaceSizeForGemmEx(handle,
+                                                         transA,
+                                                         transA,
+                                                         M,
+                                                         N,
+                                                         M,
+                                                         HIP_R_32F,
+                                                         lda,
+                                                         HIP_R_32F,
+                                                         ldb,
+                                                         HIP_R_32F,
+                                                         ldb,
+                                                         HIPBLAS_COMPUTE_32F,
+                                                         HIPBLAS_GEMM_DEFAULT,
+                                                         &gemm_bytes));
+    bytes = std::max<size_t>({trsm_bytes, gemm_bytes, 256});
+
+    hipblas_unique_ptr workspace(hipblas::device_malloc(bytes), hipblas::device_free);
+    CHECK_DEVICE_ALLOCATION(workspace ? hipSuccess : hipErrorOutOfMemory);
+
+    // Workspaces are aligned to 256 bytes
+    EXPECT_HIPBLAS_STATUS(hipblasSetWorkspace(handle, (char*)workspace.get() + 1, 0),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    host_matrix<T> hA(M, M, lda);
+    host_matrix<T> hB(M, N, ldb);
+    host_matrix<T> hB_gold(M, N, ldb);
+    host_matrix<T> hB_init(M, N, ldb);
+
+    device_matrix<T> dA(M, M, lda);
+    device_matrix<T> dB(M, N, ldb);
+
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+
+    hipblas_init_matrix(
+        hA, arg, hipblas_client_never_set_nan, hipblas_diagonally_dominant_triangular_matrix, true);
+    hipblas_init_matrix(hB, arg, hipblas_client_never_set_nan, hipblas_general_matrix, false, true);
+    hB_gold = hB;
+    hB_init = hB;
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+    CHECK_HIPBLAS_ERROR(hipblasSetWorkspace(handle, workspace.get(), bytes));
+    CHECK_HIPBLAS_ERROR(
+        hipblasStrsm(handle, side, uplo, transA, diag, M, N, &alpha, dA, lda, dB, ldb));
+    CHECK_HIP_ERROR(hB.transfer_from(dB));
+
+    ref_trsm<T>(side, uplo, transA, diag, M, N, alpha, (const T*)hA, lda, hB_gold, ldb);
+
+    double tolerance = std::numeric_limits<T>::epsilon() * 40 * M;
+    unit_check_error(norm_check_general<T>('F', M, N, ldb, hB_gold, hB), tolerance);
+
+    // The workspace stays in effect when the stream of the handle changes
+    hipStream_t stream = nullptr;
+    CHECK_HIP_ERROR(hipStreamCreate(&stream));
+    CHECK_HIPBLAS_ERROR(hipblasSetStream(handle, stream));
+    CHECK_HIP_ERROR(dB.transfer_from(hB_init));
+    CHECK_HIPBLAS_ERROR(
+        hipblasStrsm(handle, side, uplo, transA, diag, M, N, &alpha, dA, lda, dB, ldb));
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+    CHECK_HIP_ERROR(hB.transfer_from(dB));
+    unit_check_error(norm_check_general<T>('F', M, N, ldb, hB_gold, hB), tolerance);
+
+#ifndef __HIP_PLATFORM_NVCC__
+    // A workspace too small is not grown: the call fails instead of allocating, also
+    // after the stream changes
+    if(trsm_bytes)
+    {
+        CHECK_HIPBLAS_ERROR(hipblasSetWorkspace(handle, workspace.get(), 0));
+        EXPECT_HIPBLAS_STATUS(
+            hipblasStrsm(handle, side, uplo, transA, diag, M, N, &alpha, dA, lda, dB, ldb),
+            HIPBLAS_STATUS_ALLOC_FAILED);
+        CHECK_HIPBLAS_ERROR(hipblasSetStream(handle, nullptr));
+        EXPECT_HIPBLAS_STATUS(
+            hipblasStrsm(handle, side, uplo, transA, diag, M, N, &alpha, dA, lda, dB, ldb),
+            HIPBLAS_STATUS_ALLOC_FAILED);
+    }
+#endif
+    CHECK_HIPBLAS_ERROR(hipblasSetStream(handle, nullptr));
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+
+    // Back to the memory managed by the backend
+    CHECK_HIPBLAS_ERROR(hipblasSetWorkspace(handle, nullptr, 0));
+    CHECK_HIP_ERROR(dB.transfer_from(hB_gold));
+    CHECK_HIPBLAS_ERROR(
+        hipblasStrsm(handle, side, uplo, transA, diag, M, N, &alpha, dA, lda, dB, ldb));
+}
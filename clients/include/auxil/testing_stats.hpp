@@ -0,0 +1,132 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+inline void testname_stats(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<e_N>{}.test_name(arg, name);
+}
+
+void testing_stats(const Arguments& arg)
+{
+    using T = float;
+
+    int N   = arg.N;
+    int lda = N;
+
+    hipblasLocalHandle handle(arg);
+
+    hipblasStatsMode_t    mode;
+    hipblasRoutineStats_t stats[4];
+    int                   count = 4;
+
+    EXPECT_HIPBLAS_STATUS(hipblasSetStatsMode(nullptr, HIPBLAS_STATS_MODE_COUNT),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasSetStatsMode(handle, hipblasStatsMode_t(3)),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_HIPBLAS_STATUS(hipblasGetStatsMode(handle, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasGetStats(handle, stats, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+
+    // Statistics are off until they are turned on
+    CHECK_HIPBLAS_ERROR(hipblasGetStatsMode(handle, &mode));
+    EXPECT_EQ(mode, HIPBLAS_STATS_MODE_OFF);
+    CHECK_HIPBLAS_ERROR(hipblasGetStats(handle, stats, &count));
+    EXPECT_EQ(count, 0);
+
+    host_matrix<T> hA(N, N, lda);
+
+    device_matrix<T> dA(N, N, lda);
+    device_matrix<T> dC(N, N, lda);
+
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+
+    hipblas_init_matrix(hA, arg, hipblas_client_never_set_nan, hipblas_general_matrix, true);
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+
+    T alpha = 1, beta = 0;
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    auto sgemm = [&]() {
+        return hipblasSgemm(
+            handle, HIPBLAS_OP_N, HIPBLAS_OP_N, N, N, N, &alpha, dA, lda, dA, lda, &beta, dC, lda);
+    };
+
+    // Calls made while statistics are off are not counted
+    CHECK_HIPBLAS_ERROR(sgemm());
+
+    const int iters = 3;
+    CHECK_HIPBLAS_ERROR(hipblasSetStatsMode(handle, HIPBLAS_STATS_MODE_COUNT));
+    CHECK_HIPBLAS_ERROR(hipblasGetStatsMode(handle, &mode));
+    EXPECT_EQ(mode, HIPBLAS_STATS_MODE_COUNT);
+    for(int i = 0; i < iters; i++)
+        CHECK_HIPBLAS_ERROR(sgemm());
+
+    count = 0;
+    CHECK_HIPBLAS_ERROR(hipblasGetStats(handle, nullptr, &count));
+    EXPECT_EQ(count, 1);
+    count = 0;
+    EXPECT_HIPBLAS_STATUS(hipblasGetStats(handle, stats, &count), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(count, 1);
+
+    count = 4;
+    CHECK_HIPBLAS_ERROR(hipblasGetStats(handle, stats, &count));
+    ASSERT_EQ(count, 1);
+    EXPECT_STREQ(stats[0].routine, "gemm");
+    EXPECT_EQ(stats[0].calls, uint64_t(iters));
+    EXPECT_DOUBLE_EQ(stats[0].flops, iters * gemm_gflop_count<T>(N, N, N) * 1e9);
+    EXPECT_DOUBLE_EQ(stats[0].bytes, iters * gemm_gbyte_count<T>(N, N, N) * 1e9);
+    EXPECT_EQ(stats[0].deviceSeconds, 0.0);
+
+    // The process statistics include those of the handle
+    count = 4;
+    CHECK_HIPBLAS_ERROR(hipblasGetStats(nullptr, nullptr, &count));
+    EXPECT_GE(count, 1);
+
+    // Timed calls add their device time
+    CHECK_HIPBLAS_ERROR(hipblasSetStatsMode(handle, HIPBLAS_STATS_MODE_TIMED));
+    for(int i = 0; i < iters; i++)
+        CHECK_HIPBLAS_ERROR(sgemm());
+
+    count = 4;
+    CHECK_HIPBLAS_ERROR(hipblasGetStats(handle, stats, &count));
+    ASSERT_EQ(count, 1);
+    EXPECT_EQ(stats[0].calls, uint64_t(2 * iters));
+    EXPECT_GT(stats[0].deviceSeconds, 0.0);
+
+    // Turning statistics off keeps the counts, and a reset clears them
+    CHECK_HIPBLAS_ERROR(hipblasSetStatsMode(handle, HIPBLAS_STATS_MODE_OFF));
+    CHECK_HIPBLAS_ERROR(sgemm());
+    count = 4;
+    CHECK_HIPBLAS_ERROR(hipblasGetStats(handle, stats, &count));
+    ASSERT_EQ(count, 1);
+    EXPECT_EQ(stats[0].calls, uint64_t(2 * iters));
+
+    CHECK_HIPBLAS_ERROR(hipblasResetStats(handle));
+    count = 4;
+    CHECK_HIPBLAS_ERROR(hipblasGetStats(handle, stats, &count));
+    EXPECT_EQ(count, 0);
+}
@@ -0,0 +1,96 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+inline void testname_workspace_cache_stats(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<e_N>{}.test_name(arg, name);
+}
+
+void testing_workspace_cache_stats(const Arguments& arg)
+{
+    using T = float;
+
+    hipblasFillMode_t  uplo   = HIPBLAS_FILL_MODE_UPPER;
+    hipblasOperation_t transA = HIPBLAS_OP_N;
+    hipblasDiagType_t  diag   = HIPBLAS_DIAG_NON_UNIT;
+    int                N      = arg.N;
+    int                lda    = N;
+    int                incx   = 1;
+    uint64_t           hits   = 0;
+    uint64_t           misses = 0;
+
+    hipblasLocalHandle handle(arg);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGetWorkspaceCacheStats(nullptr, &hits, &misses),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasGetWorkspaceCacheStats(handle, nullptr, &misses),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasGetWorkspaceCacheStats(handle, &hits, nullptr),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    // A new handle has not seen any shapes
+    CHECK_HIPBLAS_ERROR(hipblasGetWorkspaceCacheStats(handle, &hits, &misses));
+    EXPECT_EQ(hits, 0u);
+    EXPECT_EQ(misses, 0u);
+
+    host_matrix<T> hA(N, N, lda);
+    host_vector<T> hx(N, incx);
+
+    device_matrix<T> dA(N, N, lda);
+    device_vector<T> dx(N, incx);
+
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+
+    hipblas_init_matrix(hA,
+                        arg,
+                        hipblas_client_never_set_nan,
+                        hipblas_diagonally_dominant_triangular_matrix,
+                        true,
+                        false);
+    hipblas_init_vector(hx, arg, hipblas_client_never_set_nan, false, true);
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    // The same shape repeated is a miss followed by hits
+    const int iters = 3;
+    for(int i = 0; i < iters; i++)
+        CHECK_HIPBLAS_ERROR(hipblasStrsv(handle, uplo, transA, diag, N, dA, lda, dx, incx));
+
+    CHECK_HIPBLAS_ERROR(hipblasGetWorkspaceCacheStats(handle, &hits, &misses));
+
+#ifdef __HIP_PLATFORM_NVCC__
+    EXPECT_EQ(hits, 0u);
+    EXPECT_EQ(misses, 0u);
+#else
+    EXPECT_EQ(hits, uint64_t(iters - 1));
+    EXPECT_EQ(misses, 1u);
+#endif
+}
@@ -157,10 +157,9 @@ void testing_asum_batched(const Arguments& arg)
         /* =====================================================================
                     CPU BLAS
         =================================================================== */
-        for(int64_t b = 0; b < batch_count; b++)
-        {
+        ref_batched(batch_count, [&](int64_t b) {
             ref_asum<T>(N, hx[b], incx, &(h_cpu_result[b]));
-        }
+        });
 
         bool near_check = arg.initialization == hipblas_initialization::hpl;
 
@@ -176,10 +176,9 @@ void testing_axpy_batched(const Arguments& arg)
         /* =====================================================================
                     CPU BLAS
         =================================================================== */
-        for(int64_t b = 0; b < batch_count; b++)
-        {
+        ref_batched(batch_count, [&](int64_t b) {
             ref_axpy<T>(N, alpha, hx_cpu[b], incx, hy_cpu[b], incy);
-        }
+        });
 
         // enable unit check, notice unit check is not invasive, but norm check is,
         // unit check and norm check can not be interchanged their order
@@ -191,10 +191,9 @@ void testing_dot_batched(const Arguments& arg)
         /* =====================================================================
                     CPU BLAS
         =================================================================== */
-        for(int64_t b = 0; b < batch_count; b++)
-        {
+        ref_batched(batch_count, [&](int64_t b) {
             (CONJ ? ref_dotc<T> : ref_dot<T>)(N, hx[b], incx, hy[b], incy, &(h_cpu_result[b]));
-        }
+        });
 
         bool   near_check = arg.initialization == hipblas_initialization::hpl;
         double abs_error  = hipblas_type_epsilon<T> * N;
@@ -154,10 +154,9 @@ void testing_nrm2_batched(const Arguments& arg)
         /* =====================================================================
                     CPU BLAS
         =================================================================== */
-        for(int64_t b = 0; b < batch_count; b++)
-        {
+        ref_batched(batch_count, [&](int64_t b) {
             ref_nrm2<T, Tr>(N, hx[b], incx, &(h_cpu_result[b]));
-        }
+        });
 
         if(arg.unit_check)
         {
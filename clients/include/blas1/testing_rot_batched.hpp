@@ -142,10 +142,9 @@ void testing_rot_batched(const Arguments& arg)
     // ref_rotg<T, U>(cx, cy, hc, hs);
     // cx[0] = hx[0];
     // cy[0] = hy[0];
-    for(int64_t b = 0; b < batch_count; b++)
-    {
+    ref_batched(batch_count, [&](int64_t b) {
         ref_rot<T, U, V>(N, cx[b], incx, cy[b], incy, *hc, *hs);
-    }
+    });
 
     if(arg.unit_check || arg.norm_check)
     {
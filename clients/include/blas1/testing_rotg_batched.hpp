@@ -165,10 +165,7 @@ void testing_rotg_batched(const Arguments& arg)
         CHECK_HIP_ERROR(rs.transfer_from(ds));
 
         // CBLAS
-        for(int64_t b = 0; b < batch_count; b++)
-        {
-            ref_rotg<T, U>(ca[b], cb[b], cc[b], cs[b]);
-        }
+        ref_batched(batch_count, [&](int64_t b) { ref_rotg<T, U>(ca[b], cb[b], cc[b], cs[b]); });
 
         if(arg.unit_check)
         {
@@ -167,13 +167,12 @@ void testing_rotg_strided_batched(const Arguments& arg)
         CHECK_HIP_ERROR(rc.transfer_from(dc));
         CHECK_HIP_ERROR(rs.transfer_from(ds));
 
-        for(int64_t b = 0; b < batch_count; b++)
-        {
+        ref_batched(batch_count, [&](int64_t b) {
             ref_rotg<T, U>(ca.data() + b * stride_a,
                            cb.data() + b * stride_b,
                            cc.data() + b * stride_c,
                            cs.data() + b * stride_s);
-        }
+        });
 
         if(arg.unit_check)
         {
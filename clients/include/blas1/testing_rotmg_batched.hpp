@@ -171,10 +171,9 @@ void testing_rotmg_batched(const Arguments& arg)
         CHECK_HIP_ERROR(hparams_d.transfer_from(dparams));
 
         // CBLAS
-        for(int64_t b = 0; b < batch_count; b++)
-        {
+        ref_batched(batch_count, [&](int64_t b) {
             ref_rotmg<T>(cd1[b], cd2[b], cx1[b], cy1[b], cparams[b]);
-        }
+        });
 
         if(arg.unit_check)
         {
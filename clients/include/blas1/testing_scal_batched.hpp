@@ -133,10 +133,7 @@ void testing_scal_batched(const Arguments& arg)
         /* =====================================================================
                     CPU BLAS
         =================================================================== */
-        for(int64_t b = 0; b < batch_count; b++)
-        {
-            ref_scal<T, U>(N, alpha, hz[b], incx);
-        }
+        ref_batched(batch_count, [&](int64_t b) { ref_scal<T, U>(N, alpha, hz[b], incx); });
 
         // enable unit check, notice unit check is not invasive, but norm check is,
         // unit check and norm check can not be interchanged their order
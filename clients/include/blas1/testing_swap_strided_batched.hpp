@@ -146,10 +146,9 @@ void testing_swap_strided_batched(const Arguments& arg)
         /* =====================================================================
                     CPU BLAS
         =================================================================== */
-        for(int64_t b = 0; b < batch_count; b++)
-        {
+        ref_batched(batch_count, [&](int64_t b) {
             ref_swap<T>(N, hx_cpu[b], incx, hy_cpu[b], incy);
-        }
+        });
 
         if(unit_check)
         {
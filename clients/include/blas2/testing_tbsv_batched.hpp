@@ -253,11 +253,10 @@ void testing_tbsv_batched(const Arguments& arg)
 
     regular_to_banded(uplo == HIPBLAS_FILL_MODE_UPPER, hA, hAb, K);
 
-    for(size_t b = 0; b < batch_count; b++)
-    {
+    ref_batched(batch_count, [&](int64_t b) {
         // Calculate hb = hA*hx;
         ref_tbmv<T>(uplo, transA, diag, N, K, hAb[b], lda, hb[b], incx);
-    }
+    });
 
     hx_or_b.copy_from(hb);
 
@@ -219,11 +219,10 @@ void testing_tpsv_batched(const Arguments& arg)
         make_unit_diagonal(uplo, hA);
     }
 
-    for(size_t b = 0; b < batch_count; b++)
-    {
+    ref_batched(batch_count, [&](int64_t b) {
         // Calculate hb = hA*hx;
         ref_trmv<T>(uplo, transA, diag, N, hA[b], N, hb[b], incx);
-    }
+    });
 
     // helper function to convert Regular matrix `hA` to packed matrix `hAp`
     regular_to_packed(uplo == HIPBLAS_FILL_MODE_UPPER, hA, hAp, N);
@@ -279,11 +279,10 @@ void testing_trsv_strided_batched(const Arguments& arg)
         make_unit_diagonal(uplo, hA);
     }
 
-    for(size_t b = 0; b < batch_count; b++)
-    {
+    ref_batched(batch_count, [&](int64_t b) {
         // Calculate hb = hA*hx;
         ref_trmv<T>(uplo, transA, diag, N, hA[b], lda, hb[b], incx);
-    }
+    });
 
     hx_or_b.copy_from(hb);
 
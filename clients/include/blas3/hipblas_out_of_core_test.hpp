@@ -0,0 +1,61 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// The tests set a memory budget that fits two slots of 64 x 64 tiles of A, B and C, so
+// the test sizes are split into several tiles
+constexpr int64_t hipblas_out_of_core_test_block = 64;
+
+template <typename T>
+size_t hipblas_out_of_core_test_budget()
+{
+    return 2 * 3 * size_t(hipblas_out_of_core_test_block * hipblas_out_of_core_test_block)
+           * sizeof(T);
+}
+
+// Number of tiles of an m x n matrix C written by the out-of-core functions
+inline int64_t hipblas_out_of_core_test_tiles(int64_t m, int64_t n)
+{
+    int64_t nb = hipblas_out_of_core_test_block;
+    return ((m + nb - 1) / nb) * ((n + nb - 1) / nb);
+}
+
+// Records the calls of the out-of-core progress callback
+struct hipblas_out_of_core_progress
+{
+    int64_t calls = 0;
+    int64_t done  = 0;
+    int64_t total = 0;
+
+    static void callback(int64_t tilesDone, int64_t tilesTotal, void* userData)
+    {
+        auto& progress = *static_cast<hipblas_out_of_core_progress*>(userData);
+        progress.calls++;
+        progress.done  = tilesDone;
+        progress.total = tilesTotal;
+    }
+};
@@ -364,8 +364,7 @@ void testing_dgmm_strided_batched(const Arguments& arg)
 
         // reference calculation
         ptrdiff_t shift_x = incx < 0 ? -ptrdiff_t(incx) * (N - 1) : 0;
-        for(int64_t b = 0; b < batch_count; b++)
-        {
+        ref_batched(batch_count, [&](int64_t b) {
             ref_dgmm<T>(side,
                         M,
                         N,
@@ -375,7 +374,7 @@ void testing_dgmm_strided_batched(const Arguments& arg)
                         incx,
                         hC_gold + b * stride_C,
                         ldc);
-        }
+        });
 
         // enable unit check, notice unit check is not invasive, but norm check is,
         // unit check and norm check can not be interchanged their order
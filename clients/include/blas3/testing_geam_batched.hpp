@@ -543,8 +543,7 @@ void testing_geam_batched(const Arguments& arg)
                 CPU BLAS
         =================================================================== */
         // reference calculation
-        for(int64_t b = 0; b < batch_count; b++)
-        {
+        ref_batched(batch_count, [&](int64_t b) {
             ref_geam(transA,
                      transB,
                      M,
@@ -557,7 +556,7 @@ void testing_geam_batched(const Arguments& arg)
                      ldb,
                      (T*)hC_cpu[b],
                      ldc);
-        }
+        });
 
         // enable unit check, notice unit check is not invasive, but norm check is,
         // unit check and norm check can not be interchanged their order
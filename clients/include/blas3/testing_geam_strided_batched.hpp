@@ -614,11 +614,10 @@ void testing_geam_strided_batched(const Arguments& arg)
                 CPU BLAS
         =================================================================== */
         // reference calculation
-        for(int64_t b = 0; b < batch_count; b++)
-        {
+        ref_batched(batch_count, [&](int64_t b) {
             ref_geam(
                 transA, transB, M, N, &h_alpha, hA[b], lda, &h_beta, hB[b], ldb, hC_cpu[b], ldc);
-        }
+        });
 
         // enable unit check, notice unit check is not invasive, but norm check is,
         // unit check and norm check can not be interchanged their order
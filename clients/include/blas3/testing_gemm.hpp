@@ -380,19 +380,21 @@ void testing_gemm(const Arguments& arg)
         /* =====================================================================
                     CPU BLAS
         =================================================================== */
-        ref_gemm<T>(transA,
-                    transB,
-                    M,
-                    N,
-                    K,
-                    h_alpha,
-                    hA.data(),
-                    lda,
-                    hB.data(),
-                    ldb,
-                    h_beta,
-                    hC_cpu.data(),
-                    ldc);
+        ref_cached(arg, "gemm", {ref_cache_output(hC_cpu)}, [&] {
+            ref_gemm<T>(transA,
+                        transB,
+                        M,
+                        N,
+                        K,
+                        h_alpha,
+                        hA.data(),
+                        lda,
+                        hB.data(),
+                        ldb,
+                        h_beta,
+                        hC_cpu.data(),
+                        ldc);
+        });
 
         // enable unit check, notice unit check is not invasive, but norm check is,
         // unit check and norm check can not be interchanged their order
@@ -0,0 +1,475 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGemm3mModel = ArgumentModel<e_a_type,
+                                         e_transA,
+                                         e_transB,
+                                         e_M,
+                                         e_N,
+                                         e_K,
+                                         e_alpha,
+                                         e_lda,
+                                         e_ldb,
+                                         e_beta,
+                                         e_ldc,
+                                         e_batch_count>;
+
+inline void testname_gemm3m(const Arguments& arg, std::string& name)
+{
+    hipblasGemm3mModel{}.test_name(arg, name);
+}
+
+enum class hipblas_gemm3m_api
+{
+    single,
+    batched,
+    strided_batched
+};
+
+// There are no Fortran or 64-bit gemm3m functions, so the tests call the hipComplex API
+// directly; hipblasComplex and hipComplex have the same layout.
+template <typename T>
+hipblasStatus_t hipblas_gemm3m_call(hipblas_gemm3m_api api,
+                                    hipblasHandle_t    handle,
+                                    hipblasOperation_t transA,
+                                    hipblasOperation_t transB,
+                                    int                M,
+                                    int                N,
+                                    int                K,
+                                    const T*           alpha,
+                                    const T*           A,
+                                    const T* const*    A_array,
+                                    int                lda,
+                                    hipblasStride      strideA,
+                                    const T*           B,
+                                    const T* const*    B_array,
+                                    int                ldb,
+                                    hipblasStride      strideB,
+                                    const T*           beta,
+                                    T*                 C,
+                                    T* const*          C_array,
+                                    int                ldc,
+                                    hipblasStride      strideC,
+                                    int                batch_count)
+{
+    // clang-format off
+    if constexpr(std::is_same_v<T, hipblasComplex>)
+    {
+        using Tc = hipComplex;
+        if(api == hipblas_gemm3m_api::single)
+            return hipblasCgemm3m_v2(handle, transA, transB, M, N, K, (const Tc*)alpha,
+                                     (const Tc*)A, lda, (const Tc*)B, ldb,
+                                     (const Tc*)beta, (Tc*)C, ldc);
+        else if(api == hipblas_gemm3m_api::batched)
+            return hipblasCgemm3mBatched_v2(handle, transA, transB, M, N, K, (const Tc*)alpha,
+                                            (const Tc* const*)A_array, lda,
+                                            (const Tc* const*)B_array, ldb,
+                                            (const Tc*)beta, (Tc* const*)C_array, ldc,
+                                            batch_count);
+        else
+            return hipblasCgemm3mStridedBatched_v2(handle, transA, transB, M, N, K,
+                                                   (const Tc*)alpha,
+                                                   (const Tc*)A, lda, strideA,
+                                                   (const Tc*)B, ldb, strideB,
+                                                   (const Tc*)beta, (Tc*)C, ldc, strideC,
+                                                   batch_count);
+    }
+    else
+    {
+        using Tc = hipDoubleComplex;
+        if(api == hipblas_gemm3m_api::single)
+            return hipblasZgemm3m_v2(handle, transA, transB, M, N, K, (const Tc*)alpha,
+                                     (const Tc*)A, lda, (const Tc*)B, ldb,
+                                     (const Tc*)beta, (Tc*)C, ldc);
+        else if(api == hipblas_gemm3m_api::batched)
+            return hipblasZgemm3mBatched_v2(handle, transA, transB, M, N, K, (const Tc*)alpha,
+                                            (const Tc* const*)A_array, lda,
+                                            (const Tc* const*)B_array, ldb,
+                                            (const Tc*)beta, (Tc* const*)C_array, ldc,
+                                            batch_count);
+        else
+            return hipblasZgemm3mStridedBatched_v2(handle, transA, transB, M, N, K,
+                                                   (const Tc*)alpha,
+                                                   (const Tc*)A, lda, strideA,
+                                                   (const Tc*)B, ldb, strideB,
+                                                   (const Tc*)beta, (Tc*)C, ldc, strideC,
+                                                   batch_count);
+    }
+    // clang-format on
+}
+
+template <typename T>
+void testing_gemm3m_bad_arg_template(const Arguments& arg, hipblas_gemm3m_api api)
+{
+    hipblasLocalHandle handle(arg);
+
+    int           M           = 101;
+    int           N           = 100;
+    int           K           = 102;
+    int           lda         = 103;
+    int           ldb         = 104;
+    int           ldc         = 105;
+    int           batch_count = api == hipblas_gemm3m_api::single ? 1 : 2;
+    hipblasStride strideA     = hipblasStride(lda) * K;
+    hipblasStride strideB     = hipblasStride(ldb) * N;
+    hipblasStride strideC     = hipblasStride(ldc) * N;
+
+    hipblasOperation_t transA = HIPBLAS_OP_N;
+    hipblasOperation_t transB = HIPBLAS_OP_N;
+
+    device_vector<T>  dA(strideA * batch_count);
+    device_vector<T>  dB(strideB * batch_count);
+    device_vector<T>  dC(strideC * batch_count);
+    device_vector<T*> dA_array(batch_count);
+    device_vector<T*> dB_array(batch_count);
+    device_vector<T*> dC_array(batch_count);
+
+    T alpha(1), beta(2);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    // clang-format off
+
+    auto call = [&](hipblasHandle_t h, hipblasOperation_t opA, hipblasOperation_t opB,
+                    int m, int n, int k, const T* a, const T* A, const T* const* A_array, int ld,
+                    const T* b, T* C, T* const* C_array, int count) {
+        return hipblas_gemm3m_call<T>(api, h, opA, opB, m, n, k, a, A, A_array, ld, strideA,
+                                      dB, dB_array, ldb, strideB, b, C, C_array, ldc, strideC,
+                                      count);
+    };
+
+    EXPECT_HIPBLAS_STATUS(call(nullptr, transA, transB, M, N, K, &alpha, dA, dA_array, lda,
+                               &beta, dC, dC_array, batch_count),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(call(handle, (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL, transB, M, N, K,
+                               &alpha, dA, dA_array, lda, &beta, dC, dC_array, batch_count),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_HIPBLAS_STATUS(call(handle, transA, (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL, M, N, K,
+                               &alpha, dA, dA_array, lda, &beta, dC, dC_array, batch_count),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_HIPBLAS_STATUS(call(handle, transA, transB, -1, N, K, &alpha, dA, dA_array, lda,
+                               &beta, dC, dC_array, batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(call(handle, transA, transB, M, N, K, &alpha, dA, dA_array, M - 1,
+                               &beta, dC, dC_array, batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    if(api != hipblas_gemm3m_api::single)
+        EXPECT_HIPBLAS_STATUS(call(handle, transA, transB, M, N, K, &alpha, dA, dA_array, lda,
+                                   &beta, dC, dC_array, -1),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+
+    if(arg.bad_arg_all)
+    {
+        EXPECT_HIPBLAS_STATUS(call(handle, transA, transB, M, N, K, nullptr, dA, dA_array, lda,
+                                   &beta, dC, dC_array, batch_count),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(call(handle, transA, transB, M, N, K, &alpha, dA, dA_array, lda,
+                                   nullptr, dC, dC_array, batch_count),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(call(handle, transA, transB, M, N, K, &alpha, nullptr, nullptr, lda,
+                                   &beta, dC, dC_array, batch_count),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(call(handle, transA, transB, M, N, K, &alpha, dA, dA_array, lda,
+                                   &beta, nullptr, nullptr, batch_count),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+    }
+
+    // If M == 0 || N == 0 || batch_count == 0, can have nullptrs
+    CHECK_HIPBLAS_ERROR(call(handle, transA, transB, 0, N, K, nullptr, nullptr, nullptr, lda,
+                             nullptr, nullptr, nullptr, batch_count));
+    CHECK_HIPBLAS_ERROR(call(handle, transA, transB, M, 0, K, nullptr, nullptr, nullptr, lda,
+                             nullptr, nullptr, nullptr, batch_count));
+    if(api != hipblas_gemm3m_api::single)
+        CHECK_HIPBLAS_ERROR(call(handle, transA, transB, M, N, K, nullptr, nullptr, nullptr, lda,
+                                 nullptr, nullptr, nullptr, 0));
+
+    // clang-format on
+}
+
+template <typename T>
+void testing_gemm3m_template(const Arguments& arg, hipblas_gemm3m_api api)
+{
+    using Tr = real_t<T>;
+
+    hipblasOperation_t transA = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB = char2hipblas_operation(arg.transB);
+
+    int M           = arg.M;
+    int N           = arg.N;
+    int K           = arg.K;
+    int lda         = arg.lda;
+    int ldb         = arg.ldb;
+    int ldc         = arg.ldc;
+    int batch_count = api == hipblas_gemm3m_api::single ? 1 : arg.batch_count;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    int A_row = transA == HIPBLAS_OP_N ? M : std::max(K, 1);
+    int A_col = transA == HIPBLAS_OP_N ? std::max(K, 1) : M;
+    int B_row = transB == HIPBLAS_OP_N ? std::max(K, 1) : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : std::max(K, 1);
+
+    hipblasLocalHandle handle(arg);
+
+    // check here to prevent undefined memory allocation error
+    bool invalid_size
+        = M < 0 || N < 0 || K < 0 || batch_count < 0 || lda < A_row || ldb < B_row || ldc < M;
+    if(invalid_size || !M || !N || !batch_count)
+    {
+        EXPECT_HIPBLAS_STATUS(hipblas_gemm3m_call<T>(api,
+                                                     handle,
+                                                     transA,
+                                                     transB,
+                                                     M,
+                                                     N,
+                                                     K,
+                                                     nullptr,
+                                                     nullptr,
+                                                     nullptr,
+                                                     lda,
+                                                     0,
+                                                     nullptr,
+                                                     nullptr,
+                                                     ldb,
+                                                     0,
+                                                     nullptr,
+                                                     nullptr,
+                                                     nullptr,
+                                                     ldc,
+                                                     0,
+                                                     batch_count),
+                              invalid_size ? HIPBLAS_STATUS_INVALID_VALUE
+                                           : HIPBLAS_STATUS_SUCCESS);
+        return;
+    }
+
+    // Each batch is stored strided; the batched function gets pointers into the strided batch
+    hipblasStride strideA = hipblasStride(lda) * A_col;
+    hipblasStride strideB = hipblasStride(ldb) * B_col;
+    hipblasStride strideC = hipblasStride(ldc) * N;
+
+    host_strided_batch_matrix<T> hA(A_row, A_col, lda, strideA, batch_count);
+    host_strided_batch_matrix<T> hB(B_row, B_col, ldb, strideB, batch_count);
+    host_strided_batch_matrix<T> hC(M, N, ldc, strideC, batch_count);
+    host_strided_batch_matrix<T> hC_host(M, N, ldc, strideC, batch_count);
+    host_strided_batch_matrix<T> hC_device(M, N, ldc, strideC, batch_count);
+    host_strided_batch_matrix<T> hC_cpu(M, N, ldc, strideC, batch_count);
+
+    CHECK_HIP_ERROR(hA.memcheck());
+    CHECK_HIP_ERROR(hB.memcheck());
+    CHECK_HIP_ERROR(hC.memcheck());
+    CHECK_HIP_ERROR(hC_host.memcheck());
+    CHECK_HIP_ERROR(hC_device.memcheck());
+    CHECK_HIP_ERROR(hC_cpu.memcheck());
+
+    device_strided_batch_matrix<T> dA(A_row, A_col, lda, strideA, batch_count);
+    device_strided_batch_matrix<T> dB(B_row, B_col, ldb, strideB, batch_count);
+    device_strided_batch_matrix<T> dC(M, N, ldc, strideC, batch_count);
+    device_vector<T*>              dA_array(batch_count);
+    device_vector<T*>              dB_array(batch_count);
+    device_vector<T*>              dC_array(batch_count);
+    device_vector<T>               d_alpha(1);
+    device_vector<T>               d_beta(1);
+
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+    CHECK_DEVICE_ALLOCATION(dA_array.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB_array.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC_array.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+
+    hipblas_init_matrix(hA, arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix, true);
+    hipblas_init_matrix(
+        hB, arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix, false, true);
+    hipblas_init_matrix(hC, arg, hipblas_client_beta_sets_nan, hipblas_general_matrix);
+    hC_cpu.copy_from(hC);
+
+    std::vector<T*> hA_array(batch_count), hB_array(batch_count), hC_array(batch_count);
+    for(int b = 0; b < batch_count; b++)
+    {
+        hA_array[b] = (T*)dA + b * strideA;
+        hB_array[b] = (T*)dB + b * strideB;
+        hC_array[b] = (T*)dC + b * strideC;
+    }
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dA_array, hA_array.data(), sizeof(T*) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dB_array, hB_array.data(), sizeof(T*) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dC_array, hC_array.data(), sizeof(T*) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+    auto run = [&](const T* alpha, const T* beta) {
+        return hipblas_gemm3m_call<T>(api,
+                                      handle,
+                                      transA,
+                                      transB,
+                                      M,
+                                      N,
+                                      K,
+                                      alpha,
+                                      dA,
+                                      dA_array,
+                                      lda,
+                                      strideA,
+                                      dB,
+                                      dB_array,
+                                      ldb,
+                                      strideB,
+                                      beta,
+                                      dC,
+                                      dC_array,
+                                      ldc,
+                                      strideC,
+                                      batch_count);
+    };
+
+    double gpu_time_used, hipblas_error_host = 0, hipblas_error_device = 0;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        CHECK_HIP_ERROR(dC.transfer_from(hC));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        CHECK_HIPBLAS_ERROR(run(&h_alpha, &h_beta));
+        CHECK_HIP_ERROR(hC_host.transfer_from(dC));
+
+        CHECK_HIP_ERROR(dC.transfer_from(hC));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        CHECK_HIPBLAS_ERROR(run(d_alpha, d_beta));
+        CHECK_HIP_ERROR(hC_device.transfer_from(dC));
+
+        /* =====================================================================
+                    CPU BLAS
+        =================================================================== */
+        ref_batched(batch_count, [&](int64_t b) {
+            ref_gemm<T>(
+                transA, transB, M, N, K, h_alpha, hA[b], lda, hB[b], ldb, h_beta, hC_cpu[b], ldc);
+        });
+
+        // The 3M imaginary part is T3 - T1 - T2, which cancels, so the results are only
+        // close to the conventional product: allow K roundings relative to the largest entry
+        if(arg.unit_check)
+        {
+            double max_abs = 1;
+            for(int b = 0; b < batch_count; b++)
+                for(int j = 0; j < N; j++)
+                    for(int i = 0; i < M; i++)
+                    {
+                        T c     = hC_cpu[b][i + size_t(j) * ldc];
+                        max_abs = std::max({max_abs,
+                                            double(std::abs(std::real(c))),
+                                            double(std::abs(std::imag(c)))});
+                    }
+            const double tol = 4 * (K + 2) * max_abs * std::numeric_limits<Tr>::epsilon();
+
+            near_check_general<T>(M, N, batch_count, ldc, strideC, hC_cpu, hC_host, tol);
+            near_check_general<T>(M, N, batch_count, ldc, strideC, hC_cpu, hC_device, tol);
+        }
+        if(arg.norm_check)
+        {
+            hipblas_error_host
+                = norm_check_general<T>('F', M, N, ldc, strideC, hC_cpu, hC_host, batch_count);
+            hipblas_error_device
+                = norm_check_general<T>('F', M, N, ldc, strideC, hC_cpu, hC_device, batch_count);
+        }
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+
+            CHECK_HIPBLAS_ERROR(run(&h_alpha, &h_beta));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        // Reported against the conventional flop count, so that the speedup shows as flops
+        hipblasGemm3mModel{}.log_args<T>(std::cout,
+                                         arg,
+                                         gpu_time_used,
+                                         gemm_gflop_count<T>(M, N, K) * batch_count,
+                                         gemm_gbyte_count<T>(M, N, K) * batch_count,
+                                         hipblas_error_host,
+                                         hipblas_error_device);
+    }
+}
+
+template <typename T>
+void testing_gemm3m_bad_arg(const Arguments& arg)
+{
+    testing_gemm3m_bad_arg_template<T>(arg, hipblas_gemm3m_api::single);
+}
+
+template <typename T>
+void testing_gemm3m_batched_bad_arg(const Arguments& arg)
+{
+    testing_gemm3m_bad_arg_template<T>(arg, hipblas_gemm3m_api::batched);
+}
+
+template <typename T>
+void testing_gemm3m_strided_batched_bad_arg(const Arguments& arg)
+{
+    testing_gemm3m_bad_arg_template<T>(arg, hipblas_gemm3m_api::strided_batched);
+}
+
+template <typename T>
+void testing_gemm3m(const Arguments& arg)
+{
+    testing_gemm3m_template<T>(arg, hipblas_gemm3m_api::single);
+}
+
+template <typename T>
+void testing_gemm3m_batched(const Arguments& arg)
+{
+    testing_gemm3m_template<T>(arg, hipblas_gemm3m_api::batched);
+}
+
+template <typename T>
+void testing_gemm3m_strided_batched(const Arguments& arg)
+{
+    testing_gemm3m_template<T>(arg, hipblas_gemm3m_api::strided_batched);
+}
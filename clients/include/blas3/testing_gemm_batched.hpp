@@ -487,22 +487,23 @@ void testing_gemm_batched(const Arguments& arg)
     if(arg.unit_check || arg.norm_check)
     {
         // calculate "golden" result on CPU
-        for(int64_t i = 0; i < batch_count; i++)
-        {
-            ref_gemm<T>(transA,
-                        transB,
-                        M,
-                        N,
-                        K,
-                        h_alpha,
-                        (T*)hA[i],
-                        lda,
-                        (T*)hB[i],
-                        ldb,
-                        h_beta,
-                        (T*)hC_cpu[i],
-                        ldc);
-        }
+        ref_cached(arg, "gemm", {ref_cache_output(hC_cpu)}, [&] {
+            ref_batched(batch_count, [&](int64_t i) {
+                ref_gemm<T>(transA,
+                            transB,
+                            M,
+                            N,
+                            K,
+                            h_alpha,
+                            (T*)hA[i],
+                            lda,
+                            (T*)hB[i],
+                            ldb,
+                            h_beta,
+                            (T*)hC_cpu[i],
+                            ldc);
+            });
+        });
 
         // test hipBLAS batched gemm with alpha and beta pointers on device
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
@@ -0,0 +1,340 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "hipblas_out_of_core_test.hpp"
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGemmOutOfCoreModel = ArgumentModel<e_a_type,
+                                                e_transA,
+                                                e_transB,
+                                                e_M,
+                                                e_N,
+                                                e_K,
+                                                e_alpha,
+                                                e_lda,
+                                                e_ldb,
+                                                e_beta,
+                                                e_ldc>;
+
+inline void testname_gemm_out_of_core(const Arguments& arg, std::string& name)
+{
+    hipblasGemmOutOfCoreModel{}.test_name(arg, name);
+}
+
+// The out-of-core functions have no Fortran variants and take the hipComplex types,
+// which have the same layout as hipblasComplex.
+template <typename T>
+hipblasStatus_t hipblas_gemm_out_of_core_call(hipblasHandle_t    handle,
+                                              hipblasOperation_t transA,
+                                              hipblasOperation_t transB,
+                                              int64_t            M,
+                                              int64_t            N,
+                                              int64_t            K,
+                                              const T*           alpha,
+                                              const T*           A,
+                                              int64_t            lda,
+                                              const T*           B,
+                                              int64_t            ldb,
+                                              const T*           beta,
+                                              T*                 C,
+                                              int64_t            ldc)
+{
+    // clang-format off
+    if constexpr(std::is_same_v<T, float>)
+        return hipblasSgemmOutOfCore(handle, transA, transB, M, N, K, alpha, A, lda, B, ldb,
+                                     beta, C, ldc);
+    else if constexpr(std::is_same_v<T, double>)
+        return hipblasDgemmOutOfCore(handle, transA, transB, M, N, K, alpha, A, lda, B, ldb,
+                                     beta, C, ldc);
+    else if constexpr(std::is_same_v<T, hipblasComplex>)
+        return hipblasCgemmOutOfCore(handle, transA, transB, M, N, K, (const hipComplex*)alpha,
+                                     (const hipComplex*)A, lda, (const hipComplex*)B, ldb,
+                                     (const hipComplex*)beta, (hipComplex*)C, ldc);
+    else if constexpr(std::is_same_v<T, hipblasDoubleComplex>)
+        return hipblasZgemmOutOfCore(handle, transA, transB, M, N, K,
+                                     (const hipDoubleComplex*)alpha, (const hipDoubleComplex*)A,
+                                     lda, (const hipDoubleComplex*)B, ldb,
+                                     (const hipDoubleComplex*)beta, (hipDoubleComplex*)C, ldc);
+    else
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    // clang-format on
+}
+
+template <typename T>
+void testing_gemm_out_of_core_bad_arg(const Arguments& arg)
+{
+    hipblasLocalHandle handle(arg);
+
+    int64_t M   = 101;
+    int64_t N   = 100;
+    int64_t K   = 102;
+    int64_t lda = 103;
+    int64_t ldb = 104;
+    int64_t ldc = 105;
+
+    hipblasOperation_t transA = HIPBLAS_OP_N;
+    hipblasOperation_t transB = HIPBLAS_OP_N;
+    hipblasOperation_t bad_op = (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL;
+
+    // The operands are in host memory
+    host_matrix<T> hA(M, K, lda);
+    host_matrix<T> hB(K, N, ldb);
+    host_matrix<T> hC(M, N, ldc);
+
+    T        h_alpha(1), h_beta(2), h_zero(0);
+    const T* alpha = &h_alpha;
+    const T* beta  = &h_beta;
+    const T* zero  = &h_zero;
+
+    size_t budget = 0;
+    EXPECT_HIPBLAS_STATUS(hipblasSetOutOfCoreMemoryBudget(nullptr, 0),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasGetOutOfCoreMemoryBudget(nullptr, &budget),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasGetOutOfCoreMemoryBudget(handle, nullptr),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasSetOutOfCoreProgressCallback(nullptr, nullptr, nullptr),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    // clang-format off
+    EXPECT_HIPBLAS_STATUS(hipblas_gemm_out_of_core_call<T>(nullptr, transA, transB, M, N, K,
+                                                           alpha, hA, lda, hB, ldb, beta, hC,
+                                                           ldc),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblas_gemm_out_of_core_call<T>(handle, bad_op, transB, M, N, K,
+                                                           alpha, hA, lda, hB, ldb, beta, hC,
+                                                           ldc),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_HIPBLAS_STATUS(hipblas_gemm_out_of_core_call<T>(handle, transA, bad_op, M, N, K,
+                                                           alpha, hA, lda, hB, ldb, beta, hC,
+                                                           ldc),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_HIPBLAS_STATUS(hipblas_gemm_out_of_core_call<T>(handle, transA, transB, -1, N, K,
+                                                           alpha, hA, lda, hB, ldb, beta, hC,
+                                                           ldc),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblas_gemm_out_of_core_call<T>(handle, transA, transB, M, N, K,
+                                                           alpha, hA, M - 1, hB, ldb, beta, hC,
+                                                           ldc),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblas_gemm_out_of_core_call<T>(handle, transA, transB, M, N, K,
+                                                           alpha, hA, lda, hB, K - 1, beta, hC,
+                                                           ldc),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblas_gemm_out_of_core_call<T>(handle, transA, transB, M, N, K,
+                                                           alpha, hA, lda, hB, ldb, beta, hC,
+                                                           M - 1),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    if(arg.bad_arg_all)
+    {
+        EXPECT_HIPBLAS_STATUS(hipblas_gemm_out_of_core_call<T>(handle, transA, transB, M, N, K,
+                                                               nullptr, hA, lda, hB, ldb, beta,
+                                                               hC, ldc),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(hipblas_gemm_out_of_core_call<T>(handle, transA, transB, M, N, K,
+                                                               alpha, hA, lda, hB, ldb, nullptr,
+                                                               hC, ldc),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(hipblas_gemm_out_of_core_call<T>(handle, transA, transB, M, N, K,
+                                                               alpha, nullptr, lda, hB, ldb, beta,
+                                                               hC, ldc),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(hipblas_gemm_out_of_core_call<T>(handle, transA, transB, M, N, K,
+                                                               alpha, hA, lda, nullptr, ldb, beta,
+                                                               hC, ldc),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(hipblas_gemm_out_of_core_call<T>(handle, transA, transB, M, N, K,
+                                                               alpha, hA, lda, hB, ldb, beta,
+                                                               nullptr, ldc),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+
+        // If alpha == 0, A and B can be nullptr
+        CHECK_HIPBLAS_ERROR(hipblas_gemm_out_of_core_call<T>(handle, transA, transB, M, N, K, zero,
+                                                             nullptr, lda, nullptr, ldb, beta, hC,
+                                                             ldc));
+    }
+
+    // If M == 0 || N == 0, can have nullptrs
+    CHECK_HIPBLAS_ERROR(hipblas_gemm_out_of_core_call<T>(handle, transA, transB, 0, N, K, nullptr,
+                                                         nullptr, lda, nullptr, ldb, nullptr,
+                                                         nullptr, ldc));
+    CHECK_HIPBLAS_ERROR(hipblas_gemm_out_of_core_call<T>(handle, transA, transB, M, 0, K, nullptr,
+                                                         nullptr, lda, nullptr, ldb, nullptr,
+                                                         nullptr, ldc));
+    // clang-format on
+}
+
+template <typename T>
+void testing_gemm_out_of_core(const Arguments& arg)
+{
+    hipblasOperation_t transA = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB = char2hipblas_operation(arg.transB);
+    int64_t            M      = arg.M;
+    int64_t            N      = arg.N;
+    int64_t            K      = arg.K;
+    int64_t            lda    = arg.lda;
+    int64_t            ldb    = arg.ldb;
+    int64_t            ldc    = arg.ldc;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    hipblasLocalHandle handle(arg);
+
+    int64_t A_row = transA == HIPBLAS_OP_N ? M : std::max(K, int64_t(1));
+    int64_t A_col = transA == HIPBLAS_OP_N ? std::max(K, int64_t(1)) : M;
+    int64_t B_row = transB == HIPBLAS_OP_N ? std::max(K, int64_t(1)) : N;
+    int64_t B_col = transB == HIPBLAS_OP_N ? N : std::max(K, int64_t(1));
+
+    // check here to prevent undefined memory allocation error
+    bool invalid_size = M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M;
+    if(invalid_size || !M || !N)
+    {
+        EXPECT_HIPBLAS_STATUS(hipblas_gemm_out_of_core_call<T>(handle,
+                                                               transA,
+                                                               transB,
+                                                               M,
+                                                               N,
+                                                               K,
+                                                               nullptr,
+                                                               nullptr,
+                                                               lda,
+                                                               nullptr,
+                                                               ldb,
+                                                               nullptr,
+                                                               nullptr,
+                                                               ldc),
+                              invalid_size ? HIPBLAS_STATUS_INVALID_VALUE
+                                           : HIPBLAS_STATUS_SUCCESS);
+        return;
+    }
+
+    double gpu_time_used, hipblas_error;
+
+    // Naming: `h` is in CPU (host) memory(eg hA). The out-of-core functions take host operands.
+    host_matrix<T> hA(A_row, A_col, lda);
+    host_matrix<T> hB(B_row, B_col, ldb);
+    host_matrix<T> hC(M, N, ldc);
+    host_matrix<T> hC_cpu(M, N, ldc);
+
+    // Initial Data on CPU
+    hipblas_init_matrix(hA, arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix, true);
+    hipblas_init_matrix(
+        hB, arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix, false, true);
+    hipblas_init_matrix(hC, arg, hipblas_client_beta_sets_nan, hipblas_general_matrix);
+
+    hC_cpu = hC;
+
+    size_t budget = hipblas_out_of_core_test_budget<T>();
+    size_t set_budget;
+    CHECK_HIPBLAS_ERROR(hipblasSetOutOfCoreMemoryBudget(handle, budget));
+    CHECK_HIPBLAS_ERROR(hipblasGetOutOfCoreMemoryBudget(handle, &set_budget));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        hipblas_out_of_core_progress progress;
+        CHECK_HIPBLAS_ERROR(hipblasSetOutOfCoreProgressCallback(
+            handle, hipblas_out_of_core_progress::callback, &progress));
+
+        // The pointer mode of the handle must be left as it was
+        hipblasPointerMode_t mode = HIPBLAS_POINTER_MODE_HOST;
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        CHECK_HIPBLAS_ERROR(hipblas_gemm_out_of_core_call<T>(
+            handle, transA, transB, M, N, K, &h_alpha, hA, lda, hB, ldb, &h_beta, hC, ldc));
+        CHECK_HIPBLAS_ERROR(hipblasGetPointerMode(handle, &mode));
+        CHECK_HIPBLAS_ERROR(hipblasSetOutOfCoreProgressCallback(handle, nullptr, nullptr));
+
+        /* =====================================================================
+                    CPU BLAS
+        =================================================================== */
+        ref_cached(arg, "gemm", {ref_cache_output(hC_cpu)}, [&] {
+            ref_gemm<T>(transA,
+                        transB,
+                        M,
+                        N,
+                        K,
+                        h_alpha,
+                        hA.data(),
+                        lda,
+                        hB.data(),
+                        ldb,
+                        h_beta,
+                        hC_cpu.data(),
+                        ldc);
+        });
+
+        // The tiles accumulate the k panels in a different order from the reference, which
+        // is exact for the integer test data
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(M, N, ldc, hC_cpu, hC);
+
+            // Every tile of C is reported once, in order
+            int64_t tiles           = hipblas_out_of_core_test_tiles(M, N);
+            int     expected_mode   = HIPBLAS_POINTER_MODE_DEVICE;
+            int     restored_mode   = mode;
+            int64_t expected_budget = budget;
+            int64_t reported_budget = set_budget;
+            int64_t expected[3]     = {tiles, tiles, tiles};
+            int64_t reported[3]     = {progress.calls, progress.done, progress.total};
+            unit_check_general(1, 1, 1, &expected_mode, &restored_mode);
+            unit_check_general(1, 1, 1, &expected_budget, &reported_budget);
+            unit_check_general(3, 1, 3, expected, reported);
+        }
+        if(arg.norm_check)
+            hipblas_error = hipblas_abs(norm_check_general<T>('F', M, N, ldc, hC_cpu, hC));
+    }
+
+    if(arg.timing)
+    {
+        // The out-of-core functions return when C is back in host memory
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us();
+
+            CHECK_HIPBLAS_ERROR(hipblas_gemm_out_of_core_call<T>(
+                handle, transA, transB, M, N, K, &h_alpha, hA, lda, hB, ldb, &h_beta, hC, ldc));
+        }
+        gpu_time_used = get_time_us() - gpu_time_used;
+
+        hipblasGemmOutOfCoreModel{}.log_args<T>(std::cout,
+                                                arg,
+                                                gpu_time_used,
+                                                gemm_gflop_count<T>(M, N, K),
+                                                gemm_gbyte_count<T>(M, N, K),
+                                                hipblas_error);
+    }
+}
@@ -603,11 +603,23 @@ void testing_gemm_strided_batched(const Arguments& arg)
         /* =====================================================================
                     CPU BLAS
         =================================================================== */
-        for(int64_t b = 0; b < batch_count; b++)
-        {
-            ref_gemm<T>(
-                transA, transB, M, N, K, h_alpha, hA[b], lda, hB[b], ldb, h_beta, hC_cpu[b], ldc);
-        }
+        ref_cached(arg, "gemm", {ref_cache_output(hC_cpu)}, [&] {
+            ref_batched(batch_count, [&](int64_t b) {
+                ref_gemm<T>(transA,
+                            transB,
+                            M,
+                            N,
+                            K,
+                            h_alpha,
+                            hA[b],
+                            lda,
+                            hB[b],
+                            ldb,
+                            h_beta,
+                            hC_cpu[b],
+                            ldc);
+            });
+        });
 
         // enable unit check, notice unit check is not invasive, but norm check is,
         // unit check and norm check can not be interchanged their order
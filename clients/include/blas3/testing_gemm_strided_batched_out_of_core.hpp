@@ -0,0 +1,378 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "hipblas_out_of_core_test.hpp"
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGemmStridedBatchedOutOfCoreModel = ArgumentModel<e_a_type,
+                                                              e_transA,
+                                                              e_transB,
+                                                              e_M,
+                                                              e_N,
+                                                              e_K,
+                                                              e_alpha,
+                                                              e_lda,
+                                                              e_ldb,
+                                                              e_beta,
+                                                              e_ldc,
+                                                              e_stride_scale,
+                                                              e_batch_count>;
+
+inline void testname_gemm_strided_batched_out_of_core(const Arguments& arg, std::string& name)
+{
+    hipblasGemmStridedBatchedOutOfCoreModel{}.test_name(arg, name);
+}
+
+template <typename T>
+hipblasStatus_t hipblas_gemm_strided_batched_out_of_core_call(hipblasHandle_t    handle,
+                                                              hipblasOperation_t transA,
+                                                              hipblasOperation_t transB,
+                                                              int64_t            M,
+                                                              int64_t            N,
+                                                              int64_t            K,
+                                                              const T*           alpha,
+                                                              const T*           A,
+                                                              int64_t            lda,
+                                                              hipblasStride      stride_A,
+                                                              const T*           B,
+                                                              int64_t            ldb,
+                                                              hipblasStride      stride_B,
+                                                              const T*           beta,
+                                                              T*                 C,
+                                                              int64_t            ldc,
+                                                              hipblasStride      stride_C,
+                                                              int64_t            batch_count)
+{
+    // clang-format off
+    if constexpr(std::is_same_v<T, float>)
+        return hipblasSgemmStridedBatchedOutOfCore(handle, transA, transB, M, N, K, alpha,
+                                                   A, lda, stride_A, B, ldb, stride_B, beta,
+                                                   C, ldc, stride_C, batch_count);
+    else if constexpr(std::is_same_v<T, double>)
+        return hipblasDgemmStridedBatchedOutOfCore(handle, transA, transB, M, N, K, alpha,
+                                                   A, lda, stride_A, B, ldb, stride_B, beta,
+                                                   C, ldc, stride_C, batch_count);
+    else if constexpr(std::is_same_v<T, hipblasComplex>)
+        return hipblasCgemmStridedBatchedOutOfCore(handle, transA, transB, M, N, K,
+                                                   (const hipComplex*)alpha,
+                                                   (const hipComplex*)A, lda, stride_A,
+                                                   (const hipComplex*)B, ldb, stride_B,
+                                                   (const hipComplex*)beta,
+                                                   (hipComplex*)C, ldc, stride_C, batch_count);
+    else if constexpr(std::is_same_v<T, hipblasDoubleComplex>)
+        return hipblasZgemmStridedBatchedOutOfCore(handle, transA, transB, M, N, K,
+                                                   (const hipDoubleComplex*)alpha,
+                                                   (const hipDoubleComplex*)A, lda, stride_A,
+                                                   (const hipDoubleComplex*)B, ldb, stride_B,
+                                                   (const hipDoubleComplex*)beta,
+                                                   (hipDoubleComplex*)C, ldc, stride_C,
+                                                   batch_count);
+    else
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    // clang-format on
+}
+
+template <typename T>
+void testing_gemm_strided_batched_out_of_core_bad_arg(const Arguments& arg)
+{
+    hipblasLocalHandle handle(arg);
+
+    int64_t       M           = 101;
+    int64_t       N           = 100;
+    int64_t       K           = 102;
+    int64_t       lda         = 103;
+    int64_t       ldb         = 104;
+    int64_t       ldc         = 105;
+    int64_t       batch_count = 2;
+    hipblasStride stride_A    = lda * K;
+    hipblasStride stride_B    = ldb * N;
+    hipblasStride stride_C    = ldc * N;
+
+    hipblasOperation_t transA = HIPBLAS_OP_N;
+    hipblasOperation_t transB = HIPBLAS_OP_N;
+    hipblasOperation_t bad_op = (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL;
+
+    // The operands are in host memory
+    host_strided_batch_matrix<T> hA(M, K, lda, stride_A, batch_count);
+    host_strided_batch_matrix<T> hB(K, N, ldb, stride_B, batch_count);
+    host_strided_batch_matrix<T> hC(M, N, ldc, stride_C, batch_count);
+
+    T        h_alpha(1), h_beta(2), h_zero(0);
+    const T* alpha = &h_alpha;
+    const T* beta  = &h_beta;
+    const T* zero  = &h_zero;
+
+    // clang-format off
+    auto call = [&](hipblasHandle_t h, hipblasOperation_t opA, hipblasOperation_t opB,
+                    int64_t m, const T* a, const T* A, int64_t ld_a, const T* B, int64_t ld_b,
+                    const T* b, T* C, int64_t ld_c, int64_t count) {
+        return hipblas_gemm_strided_batched_out_of_core_call<T>(h, opA, opB, m, N, K, a, A, ld_a,
+                                                                stride_A, B, ld_b, stride_B, b,
+                                                                C, ld_c, stride_C, count);
+    };
+
+    EXPECT_HIPBLAS_STATUS(call(nullptr, transA, transB, M, alpha, hA, lda, hB, ldb, beta, hC,
+                               ldc, batch_count),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(call(handle, bad_op, transB, M, alpha, hA, lda, hB, ldb, beta, hC, ldc,
+                               batch_count),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_HIPBLAS_STATUS(call(handle, transA, bad_op, M, alpha, hA, lda, hB, ldb, beta, hC, ldc,
+                               batch_count),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_HIPBLAS_STATUS(call(handle, transA, transB, -1, alpha, hA, lda, hB, ldb, beta, hC,
+                               ldc, batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(call(handle, transA, transB, M, alpha, hA, M - 1, hB, ldb, beta, hC,
+                               ldc, batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(call(handle, transA, transB, M, alpha, hA, lda, hB, K - 1, beta, hC,
+                               ldc, batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(call(handle, transA, transB, M, alpha, hA, lda, hB, ldb, beta, hC,
+                               M - 1, batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(call(handle, transA, transB, M, alpha, hA, lda, hB, ldb, beta, hC,
+                               ldc, -1),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    if(arg.bad_arg_all)
+    {
+        EXPECT_HIPBLAS_STATUS(call(handle, transA, transB, M, nullptr, hA, lda, hB, ldb, beta, hC,
+                                   ldc, batch_count),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(call(handle, transA, transB, M, alpha, hA, lda, hB, ldb, nullptr,
+                                   hC, ldc, batch_count),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(call(handle, transA, transB, M, alpha, nullptr, lda, hB, ldb, beta,
+                                   hC, ldc, batch_count),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(call(handle, transA, transB, M, alpha, hA, lda, nullptr, ldb, beta,
+                                   hC, ldc, batch_count),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(call(handle, transA, transB, M, alpha, hA, lda, hB, ldb, beta,
+                                   nullptr, ldc, batch_count),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+
+        // If alpha == 0, A and B can be nullptr
+        CHECK_HIPBLAS_ERROR(call(handle, transA, transB, M, zero, nullptr, lda, nullptr, ldb,
+                                 beta, hC, ldc, batch_count));
+    }
+
+    // If M == 0 || batch_count == 0, can have nullptrs
+    CHECK_HIPBLAS_ERROR(call(handle, transA, transB, 0, nullptr, nullptr, lda, nullptr, ldb,
+                             nullptr, nullptr, ldc, batch_count));
+    CHECK_HIPBLAS_ERROR(call(handle, transA, transB, M, nullptr, nullptr, lda, nullptr, ldb,
+                             nullptr, nullptr, ldc, 0));
+    // clang-format on
+}
+
+template <typename T>
+void testing_gemm_strided_batched_out_of_core(const Arguments& arg)
+{
+    hipblasOperation_t transA       = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB       = char2hipblas_operation(arg.transB);
+    int64_t            M            = arg.M;
+    int64_t            N            = arg.N;
+    int64_t            K            = arg.K;
+    int64_t            lda          = arg.lda;
+    int64_t            ldb          = arg.ldb;
+    int64_t            ldc          = arg.ldc;
+    double             stride_scale = arg.stride_scale;
+    int64_t            batch_count  = arg.batch_count;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    hipblasLocalHandle handle(arg);
+
+    int64_t A_row = transA == HIPBLAS_OP_N ? M : std::max(K, int64_t(1));
+    int64_t A_col = transA == HIPBLAS_OP_N ? std::max(K, int64_t(1)) : M;
+    int64_t B_row = transB == HIPBLAS_OP_N ? std::max(K, int64_t(1)) : N;
+    int64_t B_col = transB == HIPBLAS_OP_N ? N : std::max(K, int64_t(1));
+
+    hipblasStride stride_A = lda * A_col * stride_scale;
+    hipblasStride stride_B = ldb * B_col * stride_scale;
+    hipblasStride stride_C = ldc * N * stride_scale;
+
+    // check here to prevent undefined memory allocation error
+    bool invalid_size
+        = M < 0 || N < 0 || K < 0 || batch_count < 0 || lda < A_row || ldb < B_row || ldc < M;
+    if(invalid_size || !M || !N || !batch_count)
+    {
+        EXPECT_HIPBLAS_STATUS(hipblas_gemm_strided_batched_out_of_core_call<T>(handle,
+                                                                               transA,
+                                                                               transB,
+                                                                               M,
+                                                                               N,
+                                                                               K,
+                                                                               nullptr,
+                                                                               nullptr,
+                                                                               lda,
+                                                                               stride_A,
+                                                                               nullptr,
+                                                                               ldb,
+                                                                               stride_B,
+                                                                               nullptr,
+                                                                               nullptr,
+                                                                               ldc,
+                                                                               stride_C,
+                                                                               batch_count),
+                              invalid_size ? HIPBLAS_STATUS_INVALID_VALUE
+                                           : HIPBLAS_STATUS_SUCCESS);
+        return;
+    }
+
+    double gpu_time_used, hipblas_error;
+
+    // Naming: `h` is in CPU (host) memory(eg hA). The out-of-core functions take host operands.
+    host_strided_batch_matrix<T> hA(A_row, A_col, lda, stride_A, batch_count);
+    host_strided_batch_matrix<T> hB(B_row, B_col, ldb, stride_B, batch_count);
+    host_strided_batch_matrix<T> hC(M, N, ldc, stride_C, batch_count);
+    host_strided_batch_matrix<T> hC_cpu(M, N, ldc, stride_C, batch_count);
+
+    // Check host memory allocation
+    CHECK_HIP_ERROR(hA.memcheck());
+    CHECK_HIP_ERROR(hB.memcheck());
+    CHECK_HIP_ERROR(hC.memcheck());
+    CHECK_HIP_ERROR(hC_cpu.memcheck());
+
+    // Initial Data on CPU
+    hipblas_init_matrix(hA, arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix, true);
+    hipblas_init_matrix(
+        hB, arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix, false, true);
+    hipblas_init_matrix(hC, arg, hipblas_client_beta_sets_nan, hipblas_general_matrix);
+
+    hC_cpu.copy_from(hC);
+
+    CHECK_HIPBLAS_ERROR(
+        hipblasSetOutOfCoreMemoryBudget(handle, hipblas_out_of_core_test_budget<T>()));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        hipblas_out_of_core_progress progress;
+        CHECK_HIPBLAS_ERROR(hipblasSetOutOfCoreProgressCallback(
+            handle, hipblas_out_of_core_progress::callback, &progress));
+        CHECK_HIPBLAS_ERROR(hipblas_gemm_strided_batched_out_of_core_call<T>(handle,
+                                                                             transA,
+                                                                             transB,
+                                                                             M,
+                                                                             N,
+                                                                             K,
+                                                                             &h_alpha,
+                                                                             hA,
+                                                                             lda,
+                                                                             stride_A,
+                                                                             hB,
+                                                                             ldb,
+                                                                             stride_B,
+                                                                             &h_beta,
+                                                                             hC,
+                                                                             ldc,
+                                                                             stride_C,
+                                                                             batch_count));
+        CHECK_HIPBLAS_ERROR(hipblasSetOutOfCoreProgressCallback(handle, nullptr, nullptr));
+
+        /* =====================================================================
+                    CPU BLAS
+        =================================================================== */
+        ref_cached(arg, "gemm", {ref_cache_output(hC_cpu)}, [&] {
+            ref_batched(batch_count, [&](int64_t b) {
+                ref_gemm<T>(transA,
+                            transB,
+                            M,
+                            N,
+                            K,
+                            h_alpha,
+                            hA[b],
+                            lda,
+                            hB[b],
+                            ldb,
+                            h_beta,
+                            hC_cpu[b],
+                            ldc);
+            });
+        });
+
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(M, N, batch_count, ldc, stride_C, hC_cpu, hC);
+
+            // The tiles of all the problems are reported once, in order
+            int64_t tiles       = hipblas_out_of_core_test_tiles(M, N) * batch_count;
+            int64_t expected[3] = {tiles, tiles, tiles};
+            int64_t reported[3] = {progress.calls, progress.done, progress.total};
+            unit_check_general(3, 1, 3, expected, reported);
+        }
+        if(arg.norm_check)
+            hipblas_error = hipblas_abs(
+                norm_check_general<T>('F', M, N, ldc, stride_C, hC_cpu, hC, batch_count));
+    }
+
+    if(arg.timing)
+    {
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us();
+
+            CHECK_HIPBLAS_ERROR(hipblas_gemm_strided_batched_out_of_core_call<T>(handle,
+                                                                                 transA,
+                                                                                 transB,
+                                                                                 M,
+                                                                                 N,
+                                                                                 K,
+                                                                                 &h_alpha,
+                                                                                 hA,
+                                                                                 lda,
+                                                                                 stride_A,
+                                                                                 hB,
+                                                                                 ldb,
+                                                                                 stride_B,
+                                                                                 &h_beta,
+                                                                                 hC,
+                                                                                 ldc,
+                                                                                 stride_C,
+                                                                                 batch_count));
+        }
+        gpu_time_used = get_time_us() - gpu_time_used;
+
+        hipblasGemmStridedBatchedOutOfCoreModel{}.log_args<T>(std::cout,
+                                                              arg,
+                                                              gpu_time_used,
+                                                              gemm_gflop_count<T>(M, N, K),
+                                                              gemm_gbyte_count<T>(M, N, K),
+                                                              hipblas_error);
+    }
+}
@@ -562,10 +562,9 @@ void testing_trmm_batched(const Arguments& arg)
         /* =====================================================================
            CPU BLAS
         =================================================================== */
-        for(int64_t b = 0; b < batch_count; b++)
-        {
+        ref_batched(batch_count, [&](int64_t b) {
             ref_trmm<T>(side, uplo, transA, diag, M, N, h_alpha, hA[b], lda, hB[b], ldb);
-        }
+        });
 
         copy_matrix_with_different_leading_dimensions_batched(hB, hOut_cpu, M, N, ldb, ldOut);
 
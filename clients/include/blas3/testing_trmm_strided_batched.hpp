@@ -632,10 +632,9 @@ void testing_trmm_strided_batched(const Arguments& arg)
         /* =====================================================================
            CPU BLAS
         =================================================================== */
-        for(int64_t b = 0; b < batch_count; b++)
-        {
+        ref_batched(batch_count, [&](int64_t b) {
             ref_trmm<T>(side, uplo, transA, diag, M, N, h_alpha, hA[b], lda, hB[b], ldb);
-        }
+        });
 
         copy_matrix_with_different_leading_dimensions(
             hB, hOut_cpu, M, N, ldb, ldOut, stride_B, stride_Out, batch_count);
@@ -449,8 +449,7 @@ void testing_trsm_strided_batched(const Arguments& arg)
         make_unit_diagonal(uplo, hA);
     }
 
-    for(int64_t b = 0; b < batch_count; b++)
-    {
+    ref_batched(batch_count, [&](int64_t b) {
         // Calculate hB = hA*hX;
         ref_trmm<T>(side,
                     uplo,
@@ -463,7 +462,7 @@ void testing_trsm_strided_batched(const Arguments& arg)
                     lda,
                     hB_host[b],
                     ldb);
-    }
+    });
 
     hB_cpu.copy_from(hB_host);
     hB_device.copy_from(hB_host);
@@ -522,11 +521,10 @@ void testing_trsm_strided_batched(const Arguments& arg)
         /* =====================================================================
            CPU BLAS
         =================================================================== */
-        for(int64_t b = 0; b < batch_count; b++)
-        {
+        ref_batched(batch_count, [&](int64_t b) {
             ref_trsm<T>(
                 side, uplo, transA, diag, M, N, h_alpha, (const T*)hA[b], lda, hB_cpu[b], ldb);
-        }
+        });
 
         // if enable norm check, norm check is invasive
         real_t<T> eps       = std::numeric_limits<real_t<T>>::epsilon();
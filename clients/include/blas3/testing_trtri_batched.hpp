@@ -219,10 +219,9 @@ void testing_trtri_batched(const Arguments& arg)
         /* =====================================================================
            CPU BLAS
         =================================================================== */
-        for(int b = 0; b < batch_count; b++)
-        {
+        ref_batched(batch_count, [&](int64_t b) {
             ref_trtri<T>(arg.uplo, arg.diag, N, hB[b], lda);
-        }
+        });
 
         if(arg.unit_check)
         {
@@ -0,0 +1,287 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasXtGemmModel = ArgumentModel<e_a_type,
+                                         e_transA,
+                                         e_transB,
+                                         e_M,
+                                         e_N,
+                                         e_K,
+                                         e_alpha,
+                                         e_lda,
+                                         e_ldb,
+                                         e_beta,
+                                         e_ldc>;
+
+inline void testname_xt_gemm(const Arguments& arg, std::string& name)
+{
+    hipblasXtGemmModel{}.test_name(arg, name);
+}
+
+// The hipblasXt functions have no Fortran or 64-bit variants and take the hipComplex
+// types, which have the same layout as hipblasComplex.
+template <typename T>
+hipblasStatus_t hipblas_xt_gemm_call(hipblasXtHandle_t  handle,
+                                     hipblasOperation_t transA,
+                                     hipblasOperation_t transB,
+                                     size_t             M,
+                                     size_t             N,
+                                     size_t             K,
+                                     const T*           alpha,
+                                     const T*           A,
+                                     size_t             lda,
+                                     const T*           B,
+                                     size_t             ldb,
+                                     const T*           beta,
+                                     T*                 C,
+                                     size_t             ldc)
+{
+    // clang-format off
+    if constexpr(std::is_same_v<T, float>)
+        return hipblasXtSgemm(handle, transA, transB, M, N, K, alpha, A, lda, B, ldb, beta, C,
+                              ldc);
+    else if constexpr(std::is_same_v<T, double>)
+        return hipblasXtDgemm(handle, transA, transB, M, N, K, alpha, A, lda, B, ldb, beta, C,
+                              ldc);
+    else if constexpr(std::is_same_v<T, hipblasComplex>)
+        return hipblasXtCgemm(handle, transA, transB, M, N, K, (const hipComplex*)alpha,
+                              (const hipComplex*)A, lda, (const hipComplex*)B, ldb,
+                              (const hipComplex*)beta, (hipComplex*)C, ldc);
+    else if constexpr(std::is_same_v<T, hipblasDoubleComplex>)
+        return hipblasXtZgemm(handle, transA, transB, M, N, K, (const hipDoubleComplex*)alpha,
+                              (const hipDoubleComplex*)A, lda, (const hipDoubleComplex*)B, ldb,
+                              (const hipDoubleComplex*)beta, (hipDoubleComplex*)C, ldc);
+    else
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    // clang-format on
+}
+
+template <typename T>
+void testing_xt_gemm_bad_arg(const Arguments& arg)
+{
+    hipblasLocalXtHandle handle;
+
+    size_t M   = 101;
+    size_t N   = 100;
+    size_t K   = 102;
+    size_t lda = 103;
+    size_t ldb = 104;
+    size_t ldc = 105;
+
+    hipblasOperation_t transA = HIPBLAS_OP_N;
+    hipblasOperation_t transB = HIPBLAS_OP_N;
+
+    // The operands are in host memory
+    host_matrix<T> hA(M, K, lda);
+    host_matrix<T> hB(K, N, ldb);
+    host_matrix<T> hC(M, N, ldc);
+
+    T        h_alpha(1), h_beta(2), h_zero(0);
+    const T* alpha = &h_alpha;
+    const T* beta  = &h_beta;
+    const T* zero  = &h_zero;
+
+    // clang-format off
+    EXPECT_HIPBLAS_STATUS(hipblas_xt_gemm_call<T>(nullptr, transA, transB, M, N, K, alpha, hA,
+                                                  lda, hB, ldb, beta, hC, ldc),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblas_xt_gemm_call<T>(handle,
+                                                  (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
+                                                  transB, M, N, K, alpha, hA, lda, hB, ldb, beta,
+                                                  hC, ldc),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_HIPBLAS_STATUS(hipblas_xt_gemm_call<T>(handle, transA,
+                                                  (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
+                                                  M, N, K, alpha, hA, lda, hB, ldb, beta, hC,
+                                                  ldc),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_HIPBLAS_STATUS(hipblas_xt_gemm_call<T>(handle, transA, transB, M, N, K, alpha, hA,
+                                                  M - 1, hB, ldb, beta, hC, ldc),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblas_xt_gemm_call<T>(handle, transA, transB, M, N, K, alpha, hA,
+                                                  lda, hB, K - 1, beta, hC, ldc),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblas_xt_gemm_call<T>(handle, transA, transB, M, N, K, alpha, hA,
+                                                  lda, hB, ldb, beta, hC, M - 1),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    if(arg.bad_arg_all)
+    {
+        EXPECT_HIPBLAS_STATUS(hipblas_xt_gemm_call<T>(handle, transA, transB, M, N, K, nullptr,
+                                                      hA, lda, hB, ldb, beta, hC, ldc),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(hipblas_xt_gemm_call<T>(handle, transA, transB, M, N, K, alpha, hA,
+                                                      lda, hB, ldb, nullptr, hC, ldc),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(hipblas_xt_gemm_call<T>(handle, transA, transB, M, N, K, alpha,
+                                                      nullptr, lda, hB, ldb, beta, hC, ldc),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(hipblas_xt_gemm_call<T>(handle, transA, transB, M, N, K, alpha, hA,
+                                                      lda, nullptr, ldb, beta, hC, ldc),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(hipblas_xt_gemm_call<T>(handle, transA, transB, M, N, K, alpha, hA,
+                                                      lda, hB, ldb, beta, nullptr, ldc),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+
+        // If alpha == 0, A and B can be nullptr
+        CHECK_HIPBLAS_ERROR(hipblas_xt_gemm_call<T>(handle, transA, transB, M, N, K, zero,
+                                                    nullptr, lda, nullptr, ldb, beta, hC, ldc));
+    }
+
+    // If M == 0 || N == 0, can have nullptrs
+    CHECK_HIPBLAS_ERROR(hipblas_xt_gemm_call<T>(handle, transA, transB, 0, N, K, nullptr,
+                                                nullptr, lda, nullptr, ldb, nullptr, nullptr,
+                                                ldc));
+    CHECK_HIPBLAS_ERROR(hipblas_xt_gemm_call<T>(handle, transA, transB, M, 0, K, nullptr,
+                                                nullptr, lda, nullptr, ldb, nullptr, nullptr,
+                                                ldc));
+    // clang-format on
+}
+
+template <typename T>
+void testing_xt_gemm(const Arguments& arg)
+{
+    hipblasOperation_t transA = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB = char2hipblas_operation(arg.transB);
+    int64_t            M      = arg.M;
+    int64_t            N      = arg.N;
+    int64_t            K      = arg.K;
+    int64_t            lda    = arg.lda;
+    int64_t            ldb    = arg.ldb;
+    int64_t            ldc    = arg.ldc;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    hipblasLocalXtHandle handle;
+
+    int64_t A_row = transA == HIPBLAS_OP_N ? M : std::max(K, int64_t(1));
+    int64_t A_col = transA == HIPBLAS_OP_N ? std::max(K, int64_t(1)) : M;
+    int64_t B_row = transB == HIPBLAS_OP_N ? std::max(K, int64_t(1)) : N;
+    int64_t B_col = transB == HIPBLAS_OP_N ? N : std::max(K, int64_t(1));
+
+    // The sizes are unsigned in the Xt API, so only the leading dimensions can be invalid
+    bool invalid_size = M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M;
+    if(invalid_size || !M || !N)
+    {
+        EXPECT_HIPBLAS_STATUS(hipblas_xt_gemm_call<T>(handle,
+                                                      transA,
+                                                      transB,
+                                                      std::max(M, int64_t(0)),
+                                                      std::max(N, int64_t(0)),
+                                                      std::max(K, int64_t(0)),
+                                                      nullptr,
+                                                      nullptr,
+                                                      std::max(lda, int64_t(0)),
+                                                      nullptr,
+                                                      std::max(ldb, int64_t(0)),
+                                                      nullptr,
+                                                      nullptr,
+                                                      std::max(ldc, int64_t(0))),
+                              invalid_size ? HIPBLAS_STATUS_INVALID_VALUE
+                                           : HIPBLAS_STATUS_SUCCESS);
+        return;
+    }
+
+    double gpu_time_used, hipblas_error;
+
+    // Naming: `h` is in CPU (host) memory(eg hA). The Xt functions take host operands.
+    host_matrix<T> hA(A_row, A_col, lda);
+    host_matrix<T> hB(B_row, B_col, ldb);
+    host_matrix<T> hC(M, N, ldc);
+    host_matrix<T> hC_cpu(M, N, ldc);
+
+    // Initial Data on CPU
+    hipblas_init_matrix(hA, arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix, true);
+    hipblas_init_matrix(
+        hB, arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix, false, true);
+    hipblas_init_matrix(hC, arg, hipblas_client_beta_sets_nan, hipblas_general_matrix);
+
+    hC_cpu = hC;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        CHECK_HIPBLAS_ERROR(hipblas_xt_gemm_call<T>(
+            handle, transA, transB, M, N, K, &h_alpha, hA, lda, hB, ldb, &h_beta, hC, ldc));
+
+        /* =====================================================================
+                    CPU BLAS
+        =================================================================== */
+        ref_cached(arg, "gemm", {ref_cache_output(hC_cpu)}, [&] {
+            ref_gemm<T>(transA,
+                        transB,
+                        M,
+                        N,
+                        K,
+                        h_alpha,
+                        hA.data(),
+                        lda,
+                        hB.data(),
+                        ldb,
+                        h_beta,
+                        hC_cpu.data(),
+                        ldc);
+        });
+
+        // The tiles accumulate the k blocks in a different order from the reference, which
+        // is exact for the integer test data
+        if(arg.unit_check)
+            unit_check_general<T>(M, N, ldc, hC_cpu, hC);
+        if(arg.norm_check)
+            hipblas_error = hipblas_abs(norm_check_general<T>('F', M, N, ldc, hC_cpu, hC));
+    }
+
+    if(arg.timing)
+    {
+        // The Xt functions return when the result is back in host memory
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us();
+
+            CHECK_HIPBLAS_ERROR(hipblas_xt_gemm_call<T>(
+                handle, transA, transB, M, N, K, &h_alpha, hA, lda, hB, ldb, &h_beta, hC, ldc));
+        }
+        gpu_time_used = get_time_us() - gpu_time_used;
+
+        hipblasXtGemmModel{}.log_args<T>(std::cout,
+                                         arg,
+                                         gpu_time_used,
+                                         gemm_gflop_count<T>(M, N, K),
+                                         gemm_gbyte_count<T>(M, N, K),
+                                         hipblas_error);
+    }
+}
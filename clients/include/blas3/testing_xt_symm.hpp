@@ -0,0 +1,240 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasXtSymmModel
+    = ArgumentModel<e_a_type, e_side, e_uplo, e_M, e_N, e_alpha, e_lda, e_ldb, e_beta, e_ldc>;
+
+inline void testname_xt_symm(const Arguments& arg, std::string& name)
+{
+    hipblasXtSymmModel{}.test_name(arg, name);
+}
+
+template <typename T>
+hipblasStatus_t hipblas_xt_symm_call(hipblasXtHandle_t handle,
+                                     hipblasSideMode_t side,
+                                     hipblasFillMode_t uplo,
+                                     size_t            M,
+                                     size_t            N,
+                                     const T*          alpha,
+                                     const T*          A,
+                                     size_t            lda,
+                                     const T*          B,
+                                     size_t            ldb,
+                                     const T*          beta,
+                                     T*                C,
+                                     size_t            ldc)
+{
+    // clang-format off
+    if constexpr(std::is_same_v<T, float>)
+        return hipblasXtSsymm(handle, side, uplo, M, N, alpha, A, lda, B, ldb, beta, C, ldc);
+    else if constexpr(std::is_same_v<T, double>)
+        return hipblasXtDsymm(handle, side, uplo, M, N, alpha, A, lda, B, ldb, beta, C, ldc);
+    else if constexpr(std::is_same_v<T, hipblasComplex>)
+        return hipblasXtCsymm(handle, side, uplo, M, N, (const hipComplex*)alpha,
+                              (const hipComplex*)A, lda, (const hipComplex*)B, ldb,
+                              (const hipComplex*)beta, (hipComplex*)C, ldc);
+    else if constexpr(std::is_same_v<T, hipblasDoubleComplex>)
+        return hipblasXtZsymm(handle, side, uplo, M, N, (const hipDoubleComplex*)alpha,
+                              (const hipDoubleComplex*)A, lda, (const hipDoubleComplex*)B, ldb,
+                              (const hipDoubleComplex*)beta, (hipDoubleComplex*)C, ldc);
+    else
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    // clang-format on
+}
+
+template <typename T>
+void testing_xt_symm_bad_arg(const Arguments& arg)
+{
+    hipblasLocalXtHandle handle;
+
+    size_t M   = 101;
+    size_t N   = 100;
+    size_t lda = 102;
+    size_t ldb = 103;
+    size_t ldc = 104;
+
+    hipblasSideMode_t side = HIPBLAS_SIDE_LEFT;
+    hipblasFillMode_t uplo = HIPBLAS_FILL_MODE_LOWER;
+
+    host_matrix<T> hA(M, M, lda);
+    host_matrix<T> hB(M, N, ldb);
+    host_matrix<T> hC(M, N, ldc);
+
+    T        h_alpha(1), h_beta(2), h_zero(0);
+    const T* alpha = &h_alpha;
+    const T* beta  = &h_beta;
+    const T* zero  = &h_zero;
+
+    // clang-format off
+    EXPECT_HIPBLAS_STATUS(hipblas_xt_symm_call<T>(nullptr, side, uplo, M, N, alpha, hA, lda, hB,
+                                                  ldb, beta, hC, ldc),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblas_xt_symm_call<T>(handle, HIPBLAS_SIDE_BOTH, uplo, M, N, alpha,
+                                                  hA, lda, hB, ldb, beta, hC, ldc),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_HIPBLAS_STATUS(hipblas_xt_symm_call<T>(handle, side, HIPBLAS_FILL_MODE_FULL, M, N,
+                                                  alpha, hA, lda, hB, ldb, beta, hC, ldc),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_HIPBLAS_STATUS(hipblas_xt_symm_call<T>(handle, side, uplo, M, N, alpha, hA, M - 1, hB,
+                                                  ldb, beta, hC, ldc),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblas_xt_symm_call<T>(handle, side, uplo, M, N, alpha, hA, lda, hB,
+                                                  M - 1, beta, hC, ldc),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblas_xt_symm_call<T>(handle, side, uplo, M, N, alpha, hA, lda, hB,
+                                                  ldb, beta, hC, M - 1),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    if(arg.bad_arg_all)
+    {
+        EXPECT_HIPBLAS_STATUS(hipblas_xt_symm_call<T>(handle, side, uplo, M, N, nullptr, hA, lda,
+                                                      hB, ldb, beta, hC, ldc),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(hipblas_xt_symm_call<T>(handle, side, uplo, M, N, alpha, hA, lda,
+                                                      hB, ldb, nullptr, hC, ldc),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(hipblas_xt_symm_call<T>(handle, side, uplo, M, N, alpha, nullptr,
+                                                      lda, hB, ldb, beta, hC, ldc),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(hipblas_xt_symm_call<T>(handle, side, uplo, M, N, alpha, hA, lda,
+                                                      nullptr, ldb, beta, hC, ldc),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(hipblas_xt_symm_call<T>(handle, side, uplo, M, N, alpha, hA, lda,
+                                                      hB, ldb, beta, nullptr, ldc),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+
+        // If alpha == 0, A and B can be nullptr
+        CHECK_HIPBLAS_ERROR(hipblas_xt_symm_call<T>(handle, side, uplo, M, N, zero, nullptr, lda,
+                                                    nullptr, ldb, beta, hC, ldc));
+    }
+
+    // If M == 0 || N == 0, can have nullptrs
+    CHECK_HIPBLAS_ERROR(hipblas_xt_symm_call<T>(handle, side, uplo, 0, N, nullptr, nullptr, lda,
+                                                nullptr, ldb, nullptr, nullptr, ldc));
+    CHECK_HIPBLAS_ERROR(hipblas_xt_symm_call<T>(handle, side, uplo, M, 0, nullptr, nullptr, lda,
+                                                nullptr, ldb, nullptr, nullptr, ldc));
+    // clang-format on
+}
+
+template <typename T>
+void testing_xt_symm(const Arguments& arg)
+{
+    hipblasSideMode_t side = char2hipblas_side(arg.side);
+    hipblasFillMode_t uplo = char2hipblas_fill(arg.uplo);
+    int64_t           M    = arg.M;
+    int64_t           N    = arg.N;
+    int64_t           lda  = arg.lda;
+    int64_t           ldb  = arg.ldb;
+    int64_t           ldc  = arg.ldc;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    hipblasLocalXtHandle handle;
+
+    int64_t dim_A = side == HIPBLAS_SIDE_LEFT ? M : N;
+
+    bool invalid_size = M < 0 || N < 0 || ldc < M || ldb < M || lda < dim_A;
+    if(invalid_size || !M || !N)
+    {
+        EXPECT_HIPBLAS_STATUS(hipblas_xt_symm_call<T>(handle,
+                                                      side,
+                                                      uplo,
+                                                      std::max(M, int64_t(0)),
+                                                      std::max(N, int64_t(0)),
+                                                      nullptr,
+                                                      nullptr,
+                                                      std::max(lda, int64_t(0)),
+                                                      nullptr,
+                                                      std::max(ldb, int64_t(0)),
+                                                      nullptr,
+                                                      nullptr,
+                                                      std::max(ldc, int64_t(0))),
+                              invalid_size ? HIPBLAS_STATUS_INVALID_VALUE
+                                           : HIPBLAS_STATUS_SUCCESS);
+        return;
+    }
+
+    double gpu_time_used, hipblas_error;
+
+    host_matrix<T> hA(dim_A, dim_A, lda);
+    host_matrix<T> hB(M, N, ldb);
+    host_matrix<T> hC(M, N, ldc);
+    host_matrix<T> hC_cpu(M, N, ldc);
+
+    // Initial Data on CPU
+    hipblas_init_matrix(hA, arg, hipblas_client_never_set_nan, hipblas_symmetric_matrix, true);
+    hipblas_init_matrix(hB, arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix, false, true);
+    hipblas_init_matrix(hC, arg, hipblas_client_beta_sets_nan, hipblas_general_matrix);
+
+    hC_cpu = hC;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        CHECK_HIPBLAS_ERROR(hipblas_xt_symm_call<T>(
+            handle, side, uplo, M, N, &h_alpha, hA, lda, hB, ldb, &h_beta, hC, ldc));
+
+        /* =====================================================================
+           CPU BLAS
+        =================================================================== */
+        ref_symm<T>(side, uplo, M, N, h_alpha, hA, lda, hB, ldb, h_beta, hC_cpu, ldc);
+
+        if(arg.unit_check)
+            unit_check_general<T>(M, N, ldc, hC_cpu, hC);
+        if(arg.norm_check)
+            hipblas_error = norm_check_general<T>('F', M, N, ldc, hC_cpu, hC);
+    }
+
+    if(arg.timing)
+    {
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us();
+
+            CHECK_HIPBLAS_ERROR(hipblas_xt_symm_call<T>(
+                handle, side, uplo, M, N, &h_alpha, hA, lda, hB, ldb, &h_beta, hC, ldc));
+        }
+        gpu_time_used = get_time_us() - gpu_time_used;
+
+        hipblasXtSymmModel{}.log_args<T>(std::cout,
+                                         arg,
+                                         gpu_time_used,
+                                         symm_gflop_count<T>(M, N, dim_A),
+                                         symm_gbyte_count<T>(M, N, dim_A),
+                                         hipblas_error);
+    }
+}
@@ -0,0 +1,231 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasXtSyrkModel
+    = ArgumentModel<e_a_type, e_uplo, e_transA, e_N, e_K, e_alpha, e_lda, e_beta, e_ldc>;
+
+inline void testname_xt_syrk(const Arguments& arg, std::string& name)
+{
+    hipblasXtSyrkModel{}.test_name(arg, name);
+}
+
+template <typename T>
+hipblasStatus_t hipblas_xt_syrk_call(hipblasXtHandle_t  handle,
+                                     hipblasFillMode_t  uplo,
+                                     hipblasOperation_t transA,
+                                     size_t             N,
+                                     size_t             K,
+                                     const T*           alpha,
+                                     const T*           A,
+                                     size_t             lda,
+                                     const T*           beta,
+                                     T*                 C,
+                                     size_t             ldc)
+{
+    // clang-format off
+    if constexpr(std::is_same_v<T, float>)
+        return hipblasXtSsyrk(handle, uplo, transA, N, K, alpha, A, lda, beta, C, ldc);
+    else if constexpr(std::is_same_v<T, double>)
+        return hipblasXtDsyrk(handle, uplo, transA, N, K, alpha, A, lda, beta, C, ldc);
+    else if constexpr(std::is_same_v<T, hipblasComplex>)
+        return hipblasXtCsyrk(handle, uplo, transA, N, K, (const hipComplex*)alpha,
+                              (const hipComplex*)A, lda, (const hipComplex*)beta,
+                              (hipComplex*)C, ldc);
+    else if constexpr(std::is_same_v<T, hipblasDoubleComplex>)
+        return hipblasXtZsyrk(handle, uplo, transA, N, K, (const hipDoubleComplex*)alpha,
+                              (const hipDoubleComplex*)A, lda, (const hipDoubleComplex*)beta,
+                              (hipDoubleComplex*)C, ldc);
+    else
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    // clang-format on
+}
+
+template <typename T>
+void testing_xt_syrk_bad_arg(const Arguments& arg)
+{
+    hipblasLocalXtHandle handle;
+
+    size_t N   = 101;
+    size_t K   = 100;
+    size_t lda = 102;
+    size_t ldc = 104;
+
+    hipblasFillMode_t  uplo   = HIPBLAS_FILL_MODE_LOWER;
+    hipblasOperation_t transA = HIPBLAS_OP_N;
+
+    host_matrix<T> hA(N, K, lda);
+    host_matrix<T> hC(N, N, ldc);
+
+    T        h_alpha(1), h_beta(2), h_zero(0);
+    const T* alpha = &h_alpha;
+    const T* beta  = &h_beta;
+    const T* zero  = &h_zero;
+
+    // clang-format off
+    EXPECT_HIPBLAS_STATUS(hipblas_xt_syrk_call<T>(nullptr, uplo, transA, N, K, alpha, hA, lda,
+                                                  beta, hC, ldc),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblas_xt_syrk_call<T>(handle, HIPBLAS_FILL_MODE_FULL, transA, N, K,
+                                                  alpha, hA, lda, beta, hC, ldc),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_HIPBLAS_STATUS(hipblas_xt_syrk_call<T>(handle, uplo,
+                                                  (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL, N,
+                                                  K, alpha, hA, lda, beta, hC, ldc),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+    if(is_complex<T>)
+        EXPECT_HIPBLAS_STATUS(hipblas_xt_syrk_call<T>(handle, uplo, HIPBLAS_OP_C, N, K, alpha,
+                                                      hA, lda, beta, hC, ldc),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblas_xt_syrk_call<T>(handle, uplo, transA, N, K, alpha, hA, N - 1,
+                                                  beta, hC, ldc),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblas_xt_syrk_call<T>(handle, uplo, transA, N, K, alpha, hA, lda,
+                                                  beta, hC, N - 1),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    if(arg.bad_arg_all)
+    {
+        EXPECT_HIPBLAS_STATUS(hipblas_xt_syrk_call<T>(handle, uplo, transA, N, K, nullptr, hA,
+                                                      lda, beta, hC, ldc),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(hipblas_xt_syrk_call<T>(handle, uplo, transA, N, K, alpha, hA, lda,
+                                                      nullptr, hC, ldc),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(hipblas_xt_syrk_call<T>(handle, uplo, transA, N, K, alpha, nullptr,
+                                                      lda, beta, hC, ldc),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(hipblas_xt_syrk_call<T>(handle, uplo, transA, N, K, alpha, hA, lda,
+                                                      beta, nullptr, ldc),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+
+        // If alpha == 0, A can be nullptr
+        CHECK_HIPBLAS_ERROR(hipblas_xt_syrk_call<T>(handle, uplo, transA, N, K, zero, nullptr,
+                                                    lda, beta, hC, ldc));
+    }
+
+    // If N == 0, can have nullptrs
+    CHECK_HIPBLAS_ERROR(hipblas_xt_syrk_call<T>(handle, uplo, transA, 0, K, nullptr, nullptr,
+                                                lda, nullptr, nullptr, ldc));
+    // clang-format on
+}
+
+template <typename T>
+void testing_xt_syrk(const Arguments& arg)
+{
+    hipblasFillMode_t  uplo   = char2hipblas_fill(arg.uplo);
+    hipblasOperation_t transA = char2hipblas_operation(arg.transA);
+    int64_t            N      = arg.N;
+    int64_t            K      = arg.K;
+    int64_t            lda    = arg.lda;
+    int64_t            ldc    = arg.ldc;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    hipblasLocalXtHandle handle;
+
+    int64_t rows = transA == HIPBLAS_OP_N ? N : std::max(K, int64_t(1));
+    int64_t cols = transA == HIPBLAS_OP_N ? std::max(K, int64_t(1)) : N;
+
+    bool invalid_size = N < 0 || K < 0 || ldc < N || lda < rows;
+    if(invalid_size || !N)
+    {
+        EXPECT_HIPBLAS_STATUS(hipblas_xt_syrk_call<T>(handle,
+                                                      uplo,
+                                                      transA,
+                                                      std::max(N, int64_t(0)),
+                                                      std::max(K, int64_t(0)),
+                                                      nullptr,
+                                                      nullptr,
+                                                      std::max(lda, int64_t(0)),
+                                                      nullptr,
+                                                      nullptr,
+                                                      std::max(ldc, int64_t(0))),
+                              invalid_size ? HIPBLAS_STATUS_INVALID_VALUE
+                                           : HIPBLAS_STATUS_SUCCESS);
+        return;
+    }
+
+    double gpu_time_used, hipblas_error;
+
+    host_matrix<T> hA(rows, cols, lda);
+    host_matrix<T> hC(N, N, ldc);
+    host_matrix<T> hC_cpu(N, N, ldc);
+
+    // Initial Data on CPU
+    hipblas_init_matrix(hA, arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix, true);
+    hipblas_init_matrix(hC, arg, hipblas_client_beta_sets_nan, hipblas_symmetric_matrix, false);
+
+    hC_cpu = hC;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        CHECK_HIPBLAS_ERROR(hipblas_xt_syrk_call<T>(
+            handle, uplo, transA, N, K, &h_alpha, hA, lda, &h_beta, hC, ldc));
+
+        /* =====================================================================
+           CPU BLAS
+        =================================================================== */
+        ref_syrk<T>(uplo, transA, N, K, h_alpha, hA, lda, h_beta, hC_cpu, ldc);
+
+        // The whole of C is compared, which also checks that the tiles outside the uplo
+        // triangle are not written
+        if(arg.unit_check)
+            unit_check_general<T>(N, N, ldc, hC_cpu, hC);
+        if(arg.norm_check)
+            hipblas_error = norm_check_general<T>('F', N, N, ldc, hC_cpu, hC);
+    }
+
+    if(arg.timing)
+    {
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us();
+
+            CHECK_HIPBLAS_ERROR(hipblas_xt_syrk_call<T>(
+                handle, uplo, transA, N, K, &h_alpha, hA, lda, &h_beta, hC, ldc));
+        }
+        gpu_time_used = get_time_us() - gpu_time_used;
+
+        hipblasXtSyrkModel{}.log_args<T>(std::cout,
+                                         arg,
+                                         gpu_time_used,
+                                         syrk_gflop_count<T>(N, K),
+                                         syrk_gbyte_count<T>(N, K),
+                                         hipblas_error);
+    }
+}
@@ -0,0 +1,243 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasXtTrsmModel
+    = ArgumentModel<e_a_type, e_side, e_uplo, e_transA, e_diag, e_M, e_N, e_alpha, e_lda, e_ldb>;
+
+inline void testname_xt_trsm(const Arguments& arg, std::string& name)
+{
+    hipblasXtTrsmModel{}.test_name(arg, name);
+}
+
+template <typename T>
+hipblasStatus_t hipblas_xt_trsm_call(hipblasXtHandle_t  handle,
+                                     hipblasSideMode_t  side,
+                                     hipblasFillMode_t  uplo,
+                                     hipblasOperation_t transA,
+                                     hipblasDiagType_t  diag,
+                                     size_t             M,
+                                     size_t             N,
+                                     const T*           alpha,
+                                     const T*           A,
+                                     size_t             lda,
+                                     T*                 B,
+                                     size_t             ldb)
+{
+    // clang-format off
+    if constexpr(std::is_same_v<T, float>)
+        return hipblasXtStrsm(handle, side, uplo, transA, diag, M, N, alpha, A, lda, B, ldb);
+    else if constexpr(std::is_same_v<T, double>)
+        return hipblasXtDtrsm(handle, side, uplo, transA, diag, M, N, alpha, A, lda, B, ldb);
+    else if constexpr(std::is_same_v<T, hipblasComplex>)
+        return hipblasXtCtrsm(handle, side, uplo, transA, diag, M, N, (const hipComplex*)alpha,
+                              (const hipComplex*)A, lda, (hipComplex*)B, ldb);
+    else if constexpr(std::is_same_v<T, hipblasDoubleComplex>)
+        return hipblasXtZtrsm(handle, side, uplo, transA, diag, M, N,
+                              (const hipDoubleComplex*)alpha, (const hipDoubleComplex*)A, lda,
+                              (hipDoubleComplex*)B, ldb);
+    else
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    // clang-format on
+}
+
+template <typename T>
+void testing_xt_trsm_bad_arg(const Arguments& arg)
+{
+    hipblasLocalXtHandle handle;
+
+    size_t M   = 101;
+    size_t N   = 100;
+    size_t lda = 102;
+    size_t ldb = 103;
+
+    hipblasSideMode_t  side   = HIPBLAS_SIDE_LEFT;
+    hipblasFillMode_t  uplo   = HIPBLAS_FILL_MODE_LOWER;
+    hipblasOperation_t transA = HIPBLAS_OP_N;
+    hipblasDiagType_t  diag   = HIPBLAS_DIAG_NON_UNIT;
+
+    host_matrix<T> hA(M, M, lda);
+    host_matrix<T> hB(M, N, ldb);
+
+    T        h_alpha(1);
+    const T* alpha = &h_alpha;
+
+    // clang-format off
+    EXPECT_HIPBLAS_STATUS(hipblas_xt_trsm_call<T>(nullptr, side, uplo, transA, diag, M, N, alpha,
+                                                  hA, lda, hB, ldb),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblas_xt_trsm_call<T>(handle, HIPBLAS_SIDE_BOTH, uplo, transA, diag,
+                                                  M, N, alpha, hA, lda, hB, ldb),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_HIPBLAS_STATUS(hipblas_xt_trsm_call<T>(handle, side, HIPBLAS_FILL_MODE_FULL, transA,
+                                                  diag, M, N, alpha, hA, lda, hB, ldb),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_HIPBLAS_STATUS(hipblas_xt_trsm_call<T>(handle, side, uplo,
+                                                  (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
+                                                  diag, M, N, alpha, hA, lda, hB, ldb),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_HIPBLAS_STATUS(hipblas_xt_trsm_call<T>(handle, side, uplo, transA,
+                                                  (hipblasDiagType_t)HIPBLAS_FILL_MODE_FULL, M,
+                                                  N, alpha, hA, lda, hB, ldb),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_HIPBLAS_STATUS(hipblas_xt_trsm_call<T>(handle, side, uplo, transA, diag, M, N, alpha,
+                                                  hA, M - 1, hB, ldb),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblas_xt_trsm_call<T>(handle, side, uplo, transA, diag, M, N, alpha,
+                                                  hA, lda, hB, M - 1),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    if(arg.bad_arg_all)
+    {
+        EXPECT_HIPBLAS_STATUS(hipblas_xt_trsm_call<T>(handle, side, uplo, transA, diag, M, N,
+                                                      nullptr, hA, lda, hB, ldb),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(hipblas_xt_trsm_call<T>(handle, side, uplo, transA, diag, M, N,
+                                                      alpha, nullptr, lda, hB, ldb),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(hipblas_xt_trsm_call<T>(handle, side, uplo, transA, diag, M, N,
+                                                      alpha, hA, lda, nullptr, ldb),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+    }
+
+    // If M == 0 || N == 0, can have nullptrs
+    CHECK_HIPBLAS_ERROR(hipblas_xt_trsm_call<T>(handle, side, uplo, transA, diag, 0, N, nullptr,
+                                                nullptr, lda, nullptr, ldb));
+    CHECK_HIPBLAS_ERROR(hipblas_xt_trsm_call<T>(handle, side, uplo, transA, diag, M, 0, nullptr,
+                                                nullptr, lda, nullptr, ldb));
+    // clang-format on
+}
+
+template <typename T>
+void testing_xt_trsm(const Arguments& arg)
+{
+    hipblasSideMode_t  side   = char2hipblas_side(arg.side);
+    hipblasFillMode_t  uplo   = char2hipblas_fill(arg.uplo);
+    hipblasOperation_t transA = char2hipblas_operation(arg.transA);
+    hipblasDiagType_t  diag   = char2hipblas_diagonal(arg.diag);
+    int64_t            M      = arg.M;
+    int64_t            N      = arg.N;
+    int64_t            lda    = arg.lda;
+    int64_t            ldb    = arg.ldb;
+
+    T h_alpha = arg.get_alpha<T>();
+
+    int64_t K = (side == HIPBLAS_SIDE_LEFT ? M : N);
+
+    hipblasLocalXtHandle handle;
+
+    bool invalid_size = M < 0 || N < 0 || lda < K || ldb < M;
+    if(invalid_size || !M || !N)
+    {
+        EXPECT_HIPBLAS_STATUS(hipblas_xt_trsm_call<T>(handle,
+                                                      side,
+                                                      uplo,
+                                                      transA,
+                                                      diag,
+                                                      std::max(M, int64_t(0)),
+                                                      std::max(N, int64_t(0)),
+                                                      nullptr,
+                                                      nullptr,
+                                                      std::max(lda, int64_t(0)),
+                                                      nullptr,
+                                                      std::max(ldb, int64_t(0))),
+                              invalid_size ? HIPBLAS_STATUS_INVALID_VALUE
+                                           : HIPBLAS_STATUS_SUCCESS);
+        return;
+    }
+
+    double gpu_time_used, hipblas_error;
+
+    host_matrix<T> hA(K, K, lda);
+    host_matrix<T> hB(M, N, ldb);
+    host_matrix<T> hB_cpu(M, N, ldb);
+
+    // Initial data on CPU
+    hipblas_init_matrix(
+        hA, arg, hipblas_client_never_set_nan, hipblas_diagonally_dominant_triangular_matrix, true);
+    hipblas_init_matrix(hB, arg, hipblas_client_never_set_nan, hipblas_general_matrix, false, true);
+
+    //  make hA unit diagonal if diag == HIPBLAS_DIAG_UNIT
+    if(diag == HIPBLAS_DIAG_UNIT)
+    {
+        make_unit_diagonal(uplo, (T*)hA, lda, K);
+    }
+
+    // Calculate hB = hA*hX;
+    ref_trmm<T>(side, uplo, transA, diag, M, N, T(1.0) / h_alpha, (const T*)hA, lda, hB, ldb);
+
+    hB_cpu = hB;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        /* =====================================================================
+           HIPBLAS
+        =================================================================== */
+        CHECK_HIPBLAS_ERROR(hipblas_xt_trsm_call<T>(
+            handle, side, uplo, transA, diag, M, N, &h_alpha, hA, lda, hB, ldb));
+
+        /* =====================================================================
+           CPU BLAS
+        =================================================================== */
+        ref_trsm<T>(side, uplo, transA, diag, M, N, h_alpha, (const T*)hA, lda, hB_cpu, ldb);
+
+        // The panels are solved one block at a time with gemm updates, so the result is
+        // compared with the tolerance of trsm
+        real_t<T> eps       = std::numeric_limits<real_t<T>>::epsilon();
+        double    tolerance = eps * 40 * M;
+
+        hipblas_error = norm_check_general<T>('F', M, N, ldb, hB_cpu, hB);
+        if(arg.unit_check)
+            unit_check_error(hipblas_error, tolerance);
+    }
+
+    if(arg.timing)
+    {
+        // B is overwritten by each call, which does not change the work done
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us();
+
+            CHECK_HIPBLAS_ERROR(hipblas_xt_trsm_call<T>(
+                handle, side, uplo, transA, diag, M, N, &h_alpha, hA, lda, hB, ldb));
+        }
+        gpu_time_used = get_time_us() - gpu_time_used;
+
+        hipblasXtTrsmModel{}.log_args<T>(std::cout,
+                                         arg,
+                                         gpu_time_used,
+                                         trsm_gflop_count<T>(M, N, K),
+                                         trsm_gbyte_count<T>(M, N, K),
+                                         hipblas_error);
+    }
+}
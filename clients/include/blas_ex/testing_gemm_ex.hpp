@@ -493,19 +493,21 @@ void testing_gemm_ex(const Arguments& arg)
         CHECK_HIP_ERROR(hC_device.transfer_from(dC));
 
         // reference BLAS
-        ref_gemm<Ti, To, Tex>(transA,
-                              transB,
-                              M,
-                              N,
-                              K,
-                              h_alpha_Tex,
-                              hA.data(),
-                              lda,
-                              hB.data(),
-                              ldb,
-                              h_beta_Tex,
-                              hC_gold.data(),
-                              ldc);
+        ref_cached(arg, "gemm", {ref_cache_output(hC_gold)}, [&] {
+            ref_gemm<Ti, To, Tex>(transA,
+                                  transB,
+                                  M,
+                                  N,
+                                  K,
+                                  h_alpha_Tex,
+                                  hA.data(),
+                                  lda,
+                                  hB.data(),
+                                  ldb,
+                                  h_beta_Tex,
+                                  hC_gold.data(),
+                                  ldc);
+        });
 
         if(unit_check)
         {
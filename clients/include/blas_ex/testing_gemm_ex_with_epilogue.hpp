@@ -0,0 +1,367 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGemmExWithEpilogueModel = ArgumentModel<e_a_type,
+                                                     e_transA,
+                                                     e_transB,
+                                                     e_M,
+                                                     e_N,
+                                                     e_K,
+                                                     e_alpha,
+                                                     e_lda,
+                                                     e_ldb,
+                                                     e_beta,
+                                                     e_ldc>;
+
+inline void testname_gemm_ex_with_epilogue(const Arguments& arg, std::string& name)
+{
+    hipblasGemmExWithEpilogueModel{}.test_name(arg, name);
+}
+
+// The epilogue is tested with real single and double precision, where the per-column
+// scalars have the type of C
+template <typename T>
+constexpr hipDataType hipblas_epilogue_datatype()
+{
+    return std::is_same_v<T, double> ? HIP_R_64F : HIP_R_32F;
+}
+
+template <typename T>
+constexpr hipblasComputeType_t hipblas_epilogue_compute_type()
+{
+    return std::is_same_v<T, double> ? HIPBLAS_COMPUTE_64F : HIPBLAS_COMPUTE_32F;
+}
+
+template <typename Ti, typename To = Ti, typename Tex = To>
+void testing_gemm_ex_with_epilogue_bad_arg(const Arguments& arg)
+{
+    using T = To;
+
+    hipblasLocalHandle handle(arg);
+
+    hipDataType          type        = hipblas_epilogue_datatype<T>();
+    hipblasComputeType_t computeType = hipblas_epilogue_compute_type<T>();
+    hipblasGemmAlgo_t    algo        = HIPBLAS_GEMM_DEFAULT;
+    hipblasOperation_t   transA      = HIPBLAS_OP_N;
+    hipblasOperation_t   transB      = HIPBLAS_OP_N;
+
+    int M   = 101;
+    int N   = 100;
+    int K   = 102;
+    int lda = 103;
+    int ldb = 104;
+    int ldc = 105;
+
+    device_matrix<T> dA(M, K, lda);
+    device_matrix<T> dB(K, N, ldb);
+    device_matrix<T> dC(M, N, ldc);
+    device_matrix<T> dAux(M, N, ldc);
+    device_vector<T> dBias(M);
+    device_vector<T> dAlphaVec(N);
+    device_vector<T> dBetaVec(N);
+
+    T alpha = 1, beta = 1;
+
+    hipblasEpilogue_t epilogue{};
+    epilogue.bias       = dBias;
+    epilogue.activation = HIPBLAS_EPILOGUE_ACTIVATION_RELU;
+    epilogue.aux        = dAux;
+    epilogue.ldaux      = ldc;
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    // clang-format off
+
+    auto call = [&](hipblasHandle_t h, const hipblasEpilogue_t* e) {
+        return hipblasGemmExWithEpilogue(h, transA, transB, M, N, K, &alpha,
+                                         dA, type, lda,
+                                         dB, type, ldb, &beta,
+                                         dC, type, ldc,
+                                         computeType, algo, e);
+    };
+
+    EXPECT_HIPBLAS_STATUS(call(nullptr, &epilogue), HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    hipblasEpilogue_t bad = epilogue;
+    bad.activation        = hipblasEpilogueActivation_t(3);
+    EXPECT_HIPBLAS_STATUS(call(handle, &bad), HIPBLAS_STATUS_INVALID_ENUM);
+
+    bad       = epilogue;
+    bad.ldaux = M - 1;
+    EXPECT_HIPBLAS_STATUS(call(handle, &bad), HIPBLAS_STATUS_INVALID_VALUE);
+
+    // alpha and beta vectors come together
+    bad             = epilogue;
+    bad.alphaVector = dAlphaVec;
+    EXPECT_HIPBLAS_STATUS(call(handle, &bad), HIPBLAS_STATUS_INVALID_VALUE);
+
+    // With no epilogue, or one that does nothing, the call is hipblasGemmEx
+    CHECK_HIPBLAS_ERROR(call(handle, nullptr));
+    hipblasEpilogue_t none{};
+    CHECK_HIPBLAS_ERROR(call(handle, &none));
+
+    // If M == 0 || N == 0, the epilogue does nothing
+    CHECK_HIPBLAS_ERROR(hipblasGemmExWithEpilogue(handle, transA, transB, 0, N, K, nullptr,
+                                                  nullptr, type, lda,
+                                                  nullptr, type, ldb, nullptr,
+                                                  nullptr, type, ldc,
+                                                  computeType, algo, &epilogue));
+
+    // clang-format on
+}
+
+template <typename Ti, typename To = Ti, typename Tex = To>
+void testing_gemm_ex_with_epilogue(const Arguments& arg)
+{
+    using T = To;
+
+    hipblasGemmAlgo_t algo = HIPBLAS_GEMM_DEFAULT;
+
+    hipblasOperation_t transA = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB = char2hipblas_operation(arg.transB);
+    int                M      = arg.M;
+    int                N      = arg.N;
+    int                K      = arg.K;
+    int                lda    = arg.lda;
+    int                ldb    = arg.ldb;
+    int                ldc    = arg.ldc;
+
+    hipDataType          type         = hipblas_epilogue_datatype<T>();
+    hipblasComputeType_t compute_type = hipblas_epilogue_compute_type<T>();
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    int norm_check = arg.norm_check;
+    int unit_check = arg.unit_check;
+    int timing     = arg.timing;
+
+    int A_row = transA == HIPBLAS_OP_N ? M : K;
+    int A_col = transA == HIPBLAS_OP_N ? K : M;
+    int B_row = transB == HIPBLAS_OP_N ? K : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+    // check here to prevent undefined memory allocation error
+    if(M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M)
+    {
+        return;
+    }
+
+    // Allocate host memory
+    host_matrix<T> hA(A_row, A_col, lda);
+    host_matrix<T> hB(B_row, B_col, ldb);
+    host_matrix<T> hC(M, N, ldc);
+    host_matrix<T> hC_host(M, N, ldc);
+    host_matrix<T> hC_gold(M, N, ldc);
+    host_matrix<T> hAux_host(M, N, ldc);
+    host_matrix<T> hAux_gold(M, N, ldc);
+    host_matrix<T> hD(M, N, M);
+    host_vector<T> hBias(M);
+    host_vector<T> hAlphaVec(N);
+    host_vector<T> hBetaVec(N);
+
+    // Allocate device memory
+    device_matrix<T> dA(A_row, A_col, lda);
+    device_matrix<T> dB(B_row, B_col, ldb);
+    device_matrix<T> dC(M, N, ldc);
+    device_matrix<T> dAux(M, N, ldc);
+    device_vector<T> dBias(M);
+    device_vector<T> dAlphaVec(N);
+    device_vector<T> dBetaVec(N);
+
+    double             gpu_time_used, hipblas_error_host = 0;
+    hipblasLocalHandle handle(arg);
+
+    // Initial Data on CPU
+    hipblas_init_matrix(hA, arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix, true);
+    hipblas_init_matrix(
+        hB, arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix, false, true);
+    hipblas_init_matrix(hC, arg, hipblas_client_beta_sets_nan, hipblas_general_matrix);
+    hipblas_init_vector(hBias, arg, hipblas_client_never_set_nan, true);
+    hipblas_init_vector(hAlphaVec, arg, hipblas_client_never_set_nan, false, true);
+    hipblas_init_vector(hBetaVec, arg, hipblas_client_never_set_nan);
+
+    // every other column ignores C
+    for(int j = 0; j < N; j += 2)
+        hBetaVec[j] = T(0);
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIP_ERROR(dBias.transfer_from(hBias));
+    CHECK_HIP_ERROR(dAlphaVec.transfer_from(hAlphaVec));
+    CHECK_HIP_ERROR(dBetaVec.transfer_from(hBetaVec));
+
+    auto run = [&](const hipblasEpilogue_t& epilogue) {
+        return hipblasGemmExWithEpilogue(handle,
+                                         transA,
+                                         transB,
+                                         M,
+                                         N,
+                                         K,
+                                         &h_alpha,
+                                         dA,
+                                         type,
+                                         lda,
+                                         dB,
+                                         type,
+                                         ldb,
+                                         &h_beta,
+                                         dC,
+                                         type,
+                                         ldc,
+                                         compute_type,
+                                         algo,
+                                         &epilogue);
+    };
+
+    // GELU goes through tanh, which the device may round differently from the host
+    auto check = [&](hipblasEpilogueActivation_t activation) {
+        if(unit_check && activation != HIPBLAS_EPILOGUE_ACTIVATION_GELU)
+            unit_check_general<T>(M, N, ldc, hC_gold, hC_host);
+        else if(unit_check)
+        {
+            const T* gold    = hC_gold;
+            double   max_abs = 1;
+            for(int j = 0; j < N; j++)
+                for(int i = 0; i < M; i++)
+                    max_abs = std::max(max_abs, double(std::abs(gold[i + j * size_t(ldc)])));
+            const double tol = max_abs * std::numeric_limits<T>::epsilon() * 16;
+            near_check_general<T>(M, N, ldc, hC_gold.data(), hC_host.data(), tol);
+        }
+        if(norm_check)
+            hipblas_error_host
+                = std::max(hipblas_error_host,
+                           hipblas_abs(norm_check_general<T>('F', M, N, ldc, hC_gold, hC_host)));
+    };
+
+    if(unit_check || norm_check)
+    {
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+        for(auto activation : {HIPBLAS_EPILOGUE_ACTIVATION_NONE,
+                               HIPBLAS_EPILOGUE_ACTIVATION_RELU,
+                               HIPBLAS_EPILOGUE_ACTIVATION_GELU})
+        {
+            // bias, aux and activation after the scalar alpha and beta
+            hipblasEpilogue_t epilogue{};
+            epilogue.bias       = dBias;
+            epilogue.activation = activation;
+            epilogue.aux        = dAux;
+            epilogue.ldaux      = ldc;
+
+            CHECK_HIP_ERROR(dC.transfer_from(hC));
+            CHECK_HIPBLAS_ERROR(run(epilogue));
+            CHECK_HIP_ERROR(hC_host.transfer_from(dC));
+            CHECK_HIP_ERROR(hAux_host.transfer_from(dAux));
+
+            hC_gold = hC;
+            ref_gemm<T>(transA,
+                        transB,
+                        M,
+                        N,
+                        K,
+                        h_alpha,
+                        hA.data(),
+                        lda,
+                        hB.data(),
+                        ldb,
+                        h_beta,
+                        hC_gold.data(),
+                        ldc);
+            ref_epilogue_bias<T>(M, N, hC_gold, ldc, hBias);
+            hAux_gold = hC_gold;
+            ref_epilogue_activation<T>(M, N, hC_gold, ldc, activation);
+
+            if(unit_check)
+                unit_check_general<T>(M, N, ldc, hAux_gold, hAux_host);
+            check(activation);
+
+            // per-column alpha and beta, with the bias and activation
+            epilogue.aux         = nullptr;
+            epilogue.alphaVector = dAlphaVec;
+            epilogue.betaVector  = dBetaVec;
+
+            CHECK_HIP_ERROR(dC.transfer_from(hC));
+            CHECK_HIPBLAS_ERROR(run(epilogue));
+            CHECK_HIP_ERROR(hC_host.transfer_from(dC));
+
+            hC_gold = hC;
+            ref_gemm<T>(transA,
+                        transB,
+                        M,
+                        N,
+                        K,
+                        T(1),
+                        hA.data(),
+                        lda,
+                        hB.data(),
+                        ldb,
+                        T(0),
+                        hD.data(),
+                        M);
+            ref_epilogue_scale_columns<T, T>(M, N, hD, M, hAlphaVec, hBetaVec, hC_gold, ldc);
+            ref_epilogue_bias<T>(M, N, hC_gold, ldc, hBias);
+            ref_epilogue_activation<T>(M, N, hC_gold, ldc, activation);
+
+            check(activation);
+        }
+    }
+
+    if(timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+        hipblasEpilogue_t epilogue{};
+        epilogue.bias       = dBias;
+        epilogue.activation = HIPBLAS_EPILOGUE_ACTIVATION_RELU;
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+
+            CHECK_HIPBLAS_ERROR(run(epilogue));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasGemmExWithEpilogueModel{}.log_args<T>(std::cout,
+                                                     arg,
+                                                     gpu_time_used,
+                                                     gemm_gflop_count<T>(M, N, K),
+                                                     gemm_gbyte_count<T>(M, N, K),
+                                                     hipblas_error_host);
+    }
+}
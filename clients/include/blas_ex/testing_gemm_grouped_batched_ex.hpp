@@ -0,0 +1,451 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGemmGroupedBatchedExModel = ArgumentModel<e_a_type,
+                                                       e_c_type,
+                                                       e_compute_type,
+                                                       e_transA,
+                                                       e_transB,
+                                                       e_M,
+                                                       e_N,
+                                                       e_K,
+                                                       e_alpha,
+                                                       e_lda,
+                                                       e_ldb,
+                                                       e_beta,
+                                                       e_ldc,
+                                                       e_batch_count>;
+
+inline void testname_gemm_grouped_batched_ex(const Arguments& arg, std::string& name)
+{
+    hipblasGemmGroupedBatchedExModel{}.test_name(arg, name);
+}
+
+// hipblasGemmGroupedBatchedEx only takes hipDataType and hipblasComputeType_t, so the
+// types are derived from the template arguments rather than from arg
+template <typename T>
+constexpr hipDataType hipblas_grouped_datatype()
+{
+    if constexpr(std::is_same_v<T, hipblasHalf>)
+        return HIP_R_16F;
+    else if constexpr(std::is_same_v<T, hipblasBfloat16>)
+        return HIP_R_16BF;
+    else if constexpr(std::is_same_v<T, double>)
+        return HIP_R_64F;
+    else if constexpr(std::is_same_v<T, int8_t>)
+        return HIP_R_8I;
+    else if constexpr(std::is_same_v<T, int32_t>)
+        return HIP_R_32I;
+    else if constexpr(std::is_same_v<T, hipblasComplex>)
+        return HIP_C_32F;
+    else if constexpr(std::is_same_v<T, hipblasDoubleComplex>)
+        return HIP_C_64F;
+    else
+        return HIP_R_32F;
+}
+
+template <typename Tex>
+constexpr hipblasComputeType_t hipblas_grouped_compute_type()
+{
+    if constexpr(std::is_same_v<Tex, hipblasHalf>)
+        return HIPBLAS_COMPUTE_16F;
+    else if constexpr(std::is_same_v<Tex, double> || std::is_same_v<Tex, hipblasDoubleComplex>)
+        return HIPBLAS_COMPUTE_64F;
+    else if constexpr(std::is_same_v<Tex, int32_t>)
+        return HIPBLAS_COMPUTE_32I;
+    else
+        return HIPBLAS_COMPUTE_32F;
+}
+
+template <typename Ti, typename To = Ti, typename Tex = To>
+void testing_gemm_grouped_batched_ex_bad_arg(const Arguments& arg)
+{
+    hipblasLocalHandle handle(arg);
+
+    hipDataType          aType       = hipblas_grouped_datatype<Ti>();
+    hipDataType          cType       = hipblas_grouped_datatype<To>();
+    hipblasComputeType_t computeType = hipblas_grouped_compute_type<Tex>();
+
+    int64_t M           = 101;
+    int64_t N           = 100;
+    int64_t K           = 102;
+    int64_t batch_count = 2;
+
+    device_batch_matrix<Ti> dA(M, K, M, batch_count);
+    device_batch_matrix<Ti> dB(K, N, K, batch_count);
+    device_batch_matrix<To> dC(M, N, M, batch_count);
+
+    hipblasOperation_t transA[] = {HIPBLAS_OP_N};
+    hipblasOperation_t transB[] = {HIPBLAS_OP_N};
+    int                m[]      = {int(M)};
+    int                n[]      = {int(N)};
+    int                k[]      = {int(K)};
+    int                lda[]    = {int(M)};
+    int                ldb[]    = {int(K)};
+    int                ldc[]    = {int(M)};
+    int                size[]   = {int(batch_count)};
+    int                zero[]   = {0};
+    Tex                alpha[]  = {Tex(1)};
+    Tex                beta[]   = {Tex(1)};
+
+    auto A = (const void**)dA.ptr_on_device();
+    auto B = (const void**)dB.ptr_on_device();
+    auto C = (void**)dC.ptr_on_device();
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    // clang-format off
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmGroupedBatchedEx(nullptr, transA, transB, m, n, k, alpha,
+                                                      A, aType, lda, B, aType, ldb, beta,
+                                                      C, cType, ldc, 1, size, computeType),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmGroupedBatchedEx(handle, transA, transB, m, n, k, alpha,
+                                                      A, aType, lda, B, aType, ldb, beta,
+                                                      C, cType, ldc, -1, size, computeType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmGroupedBatchedEx(handle, transA, transB, nullptr, n, k, alpha,
+                                                      A, aType, lda, B, aType, ldb, beta,
+                                                      C, cType, ldc, 1, size, computeType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmGroupedBatchedEx(handle, transA, transB, m, n, k, nullptr,
+                                                      A, aType, lda, B, aType, ldb, beta,
+                                                      C, cType, ldc, 1, size, computeType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmGroupedBatchedEx(handle, transA, transB, m, n, k, alpha,
+                                                      A, aType, ldb, B, aType, ldb, beta,
+                                                      C, cType, ldc, 1, size, computeType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmGroupedBatchedEx(handle, transA, transB, m, n, k, alpha,
+                                                      nullptr, aType, lda, B, aType, ldb, beta,
+                                                      C, cType, ldc, 1, size, computeType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    // nothing to do, so no arrays are needed
+    EXPECT_HIPBLAS_STATUS(hipblasGemmGroupedBatchedEx(handle, nullptr, nullptr, nullptr, nullptr,
+                                                      nullptr, nullptr, nullptr, aType, nullptr,
+                                                      nullptr, aType, nullptr, nullptr, nullptr,
+                                                      cType, nullptr, 0, nullptr, computeType),
+                          HIPBLAS_STATUS_SUCCESS);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmGroupedBatchedEx(handle, transA, transB, m, n, k, alpha,
+                                                      nullptr, aType, lda, nullptr, aType, ldb,
+                                                      beta, nullptr, cType, ldc, 1, zero,
+                                                      computeType),
+                          HIPBLAS_STATUS_SUCCESS);
+
+    // clang-format on
+}
+
+template <typename Ti, typename To = Ti, typename Tex = To>
+void testing_gemm_grouped_batched_ex(const Arguments& arg)
+{
+    hipblasOperation_t transA = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB = char2hipblas_operation(arg.transB);
+
+    int M = arg.M;
+    int N = arg.N;
+    int K = arg.K;
+
+    int lda = arg.lda;
+    int ldb = arg.ldb;
+    int ldc = arg.ldc;
+
+    int batch_count = arg.batch_count;
+
+    hipDataType          a_type       = hipblas_grouped_datatype<Ti>();
+    hipDataType          c_type       = hipblas_grouped_datatype<To>();
+    hipblasComputeType_t compute_type = hipblas_grouped_compute_type<Tex>();
+
+    Tex h_alpha_Tex = arg.get_alpha<Tex>();
+    Tex h_beta_Tex  = arg.get_beta<Tex>();
+
+    int norm_check = arg.norm_check;
+    int unit_check = arg.unit_check;
+    int timing     = arg.timing;
+
+    int A_row = transA == HIPBLAS_OP_N ? M : K;
+    int B_row = transB == HIPBLAS_OP_N ? K : N;
+
+    // check here to prevent undefined memory allocation error
+    if(M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M || batch_count < 0)
+    {
+        return;
+    }
+
+    // Four groups of batch_count problems each. Groups 0 and 1 are identical, so the
+    // library may run them as one call; groups 2 and 3 are larger and use other scalars.
+    const int group_count = 4;
+
+    std::vector<hipblasOperation_t> transA_array(group_count, transA);
+    std::vector<hipblasOperation_t> transB_array(group_count, transB);
+    std::vector<int>                m_array{M, M, M + 1, M + 2};
+    std::vector<int>                n_array{N, N, N + 2, N};
+    std::vector<int>                k_array{K, K, K + 3, K + 1};
+    std::vector<int>                group_size(group_count, batch_count);
+    std::vector<Tex>                alpha_array{h_alpha_Tex, h_alpha_Tex, h_beta_Tex, h_alpha_Tex};
+    std::vector<Tex>                beta_array{h_beta_Tex, h_beta_Tex, h_alpha_Tex, h_beta_Tex};
+    std::vector<int>                lda_array(group_count);
+    std::vector<int>                ldb_array(group_count);
+    std::vector<int>                ldc_array(group_count);
+
+    // Naming: `h` is in CPU (host) memory(eg hA), `d` is in GPU (device) memory (eg dA).
+    std::vector<std::unique_ptr<host_batch_matrix<Ti>>>   hA(group_count);
+    std::vector<std::unique_ptr<host_batch_matrix<Ti>>>   hB(group_count);
+    std::vector<std::unique_ptr<host_batch_matrix<To>>>   hC_host(group_count);
+    std::vector<std::unique_ptr<host_batch_matrix<To>>>   hC_device(group_count);
+    std::vector<std::unique_ptr<host_batch_matrix<To>>>   hC_gold(group_count);
+    std::vector<std::unique_ptr<device_batch_matrix<Ti>>> dA(group_count);
+    std::vector<std::unique_ptr<device_batch_matrix<Ti>>> dB(group_count);
+    std::vector<std::unique_ptr<device_batch_matrix<To>>> dC(group_count);
+
+    int64_t total_count = int64_t(group_count) * batch_count;
+
+    std::vector<const void*> hA_ptrs, hB_ptrs;
+    std::vector<void*>       hC_ptrs;
+
+    double gflops = 0, gbytes = 0;
+
+    for(int g = 0; g < group_count; g++)
+    {
+        int m = m_array[g], n = n_array[g], k = k_array[g];
+
+        int A_row_g = transA == HIPBLAS_OP_N ? m : k;
+        int A_col_g = transA == HIPBLAS_OP_N ? k : m;
+        int B_row_g = transB == HIPBLAS_OP_N ? k : n;
+        int B_col_g = transB == HIPBLAS_OP_N ? n : k;
+
+        lda_array[g] = std::max(lda, A_row_g);
+        ldb_array[g] = std::max(ldb, B_row_g);
+        ldc_array[g] = std::max(ldc, m);
+
+        using host_A   = host_batch_matrix<Ti>;
+        using host_C   = host_batch_matrix<To>;
+        using device_A = device_batch_matrix<Ti>;
+        using device_C = device_batch_matrix<To>;
+
+        hA[g]        = std::make_unique<host_A>(A_row_g, A_col_g, lda_array[g], batch_count);
+        hB[g]        = std::make_unique<host_A>(B_row_g, B_col_g, ldb_array[g], batch_count);
+        hC_host[g]   = std::make_unique<host_C>(m, n, ldc_array[g], batch_count);
+        hC_device[g] = std::make_unique<host_C>(m, n, ldc_array[g], batch_count);
+        hC_gold[g]   = std::make_unique<host_C>(m, n, ldc_array[g], batch_count);
+        dA[g]        = std::make_unique<device_A>(A_row_g, A_col_g, lda_array[g], batch_count);
+        dB[g]        = std::make_unique<device_A>(B_row_g, B_col_g, ldb_array[g], batch_count);
+        dC[g]        = std::make_unique<device_C>(m, n, ldc_array[g], batch_count);
+
+        CHECK_HIP_ERROR(hA[g]->memcheck());
+        CHECK_HIP_ERROR(hB[g]->memcheck());
+        CHECK_HIP_ERROR(hC_host[g]->memcheck());
+        CHECK_HIP_ERROR(hC_device[g]->memcheck());
+        CHECK_HIP_ERROR(hC_gold[g]->memcheck());
+        CHECK_DEVICE_ALLOCATION(dA[g]->memcheck());
+        CHECK_DEVICE_ALLOCATION(dB[g]->memcheck());
+        CHECK_DEVICE_ALLOCATION(dC[g]->memcheck());
+
+        hipblas_init_matrix(
+            *hA[g], arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix, true);
+        hipblas_init_matrix(
+            *hB[g], arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix, false, true);
+        hipblas_init_matrix(*hC_host[g], arg, hipblas_client_beta_sets_nan, hipblas_general_matrix);
+
+        hC_device[g]->copy_from(*hC_host[g]);
+        hC_gold[g]->copy_from(*hC_host[g]);
+
+        CHECK_HIP_ERROR(dA[g]->transfer_from(*hA[g]));
+        CHECK_HIP_ERROR(dB[g]->transfer_from(*hB[g]));
+        CHECK_HIP_ERROR(dC[g]->transfer_from(*hC_host[g]));
+
+        // The pointer arrays passed to hipBLAS hold the problems of every group in order
+        for(int b = 0; b < batch_count; b++)
+        {
+            hA_ptrs.push_back((*dA[g])[b]);
+            hB_ptrs.push_back((*dB[g])[b]);
+            hC_ptrs.push_back((*dC[g])[b]);
+        }
+
+        // log_args scales these by batch_count
+        gflops += gemm_gflop_count<Tex>(m, n, k);
+        gbytes += gemm_gbyte_count<Tex>(m, n, k);
+    }
+
+    device_vector<const void*> dA_ptrs(std::max(total_count, int64_t(1)));
+    device_vector<const void*> dB_ptrs(std::max(total_count, int64_t(1)));
+    device_vector<void*>       dC_ptrs(std::max(total_count, int64_t(1)));
+    device_vector<Tex>         d_alpha(group_count);
+    device_vector<Tex>         d_beta(group_count);
+
+    CHECK_DEVICE_ALLOCATION(dA_ptrs.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB_ptrs.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC_ptrs.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+
+    CHECK_HIP_ERROR(hipMemcpy(
+        dA_ptrs, hA_ptrs.data(), sizeof(void*) * total_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dB_ptrs, hB_ptrs.data(), sizeof(void*) * total_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dC_ptrs, hC_ptrs.data(), sizeof(void*) * total_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        d_alpha, alpha_array.data(), sizeof(Tex) * group_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(d_beta, beta_array.data(), sizeof(Tex) * group_count, hipMemcpyHostToDevice));
+
+    double             gpu_time_used, hipblas_error_host = 0, hipblas_error_device = 0;
+    hipblasLocalHandle handle(arg);
+
+    auto run = [&](const void* alpha, const void* beta) {
+        return hipblasGemmGroupedBatchedEx(handle,
+                                           transA_array.data(),
+                                           transB_array.data(),
+                                           m_array.data(),
+                                           n_array.data(),
+                                           k_array.data(),
+                                           alpha,
+                                           (const void**)dA_ptrs,
+                                           a_type,
+                                           lda_array.data(),
+                                           (const void**)dB_ptrs,
+                                           a_type,
+                                           ldb_array.data(),
+                                           beta,
+                                           (void**)dC_ptrs,
+                                           c_type,
+                                           ldc_array.data(),
+                                           group_count,
+                                           group_size.data(),
+                                           compute_type);
+    };
+
+    if(unit_check || norm_check)
+    {
+        // hipBLAS
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        CHECK_HIPBLAS_ERROR(run(alpha_array.data(), beta_array.data()));
+
+        for(int g = 0; g < group_count; g++)
+        {
+            CHECK_HIP_ERROR(hC_host[g]->transfer_from(*dC[g]));
+            CHECK_HIP_ERROR(dC[g]->transfer_from(*hC_device[g]));
+        }
+
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        CHECK_HIPBLAS_ERROR(run(d_alpha, d_beta));
+
+        for(int g = 0; g < group_count; g++)
+            CHECK_HIP_ERROR(hC_device[g]->transfer_from(*dC[g]));
+
+        // CPU BLAS
+        for(int g = 0; g < group_count; g++)
+        {
+            ref_batched(batch_count, [&](int64_t b) {
+                ref_gemm<Ti, To, Tex>(transA,
+                                      transB,
+                                      m_array[g],
+                                      n_array[g],
+                                      k_array[g],
+                                      alpha_array[g],
+                                      (*hA[g])[b],
+                                      lda_array[g],
+                                      (*hB[g])[b],
+                                      ldb_array[g],
+                                      beta_array[g],
+                                      (*hC_gold[g])[b],
+                                      ldc_array[g]);
+            });
+
+            int m = m_array[g], n = n_array[g], ldc_g = ldc_array[g];
+            if(unit_check)
+            {
+                // check for float16/bfloat16 input
+                if((getArchMajor() == 11)
+                   && ((std::is_same<Tex, float>{} && std::is_same<Ti, hipblasBfloat16>{})
+                       || (std::is_same<Tex, float>{} && std::is_same<Ti, hipblasHalf>{})
+                       || (std::is_same<Tex, hipblasHalf>{} && std::is_same<Ti, hipblasHalf>{})))
+                {
+                    const double tol = k_array[g] * sum_error_tolerance_for_gfx11<Tex, Ti, To>;
+                    near_check_general<To>(
+                        m, n, batch_count, ldc_g, *hC_gold[g], *hC_host[g], tol);
+                    near_check_general<To>(
+                        m, n, batch_count, ldc_g, *hC_gold[g], *hC_device[g], tol);
+                }
+                else
+                {
+                    unit_check_general<To>(m, n, batch_count, ldc_g, *hC_gold[g], *hC_host[g]);
+                    unit_check_general<To>(m, n, batch_count, ldc_g, *hC_gold[g], *hC_device[g]);
+                }
+            }
+
+            if(norm_check)
+            {
+                double error_host = norm_check_general<To>(
+                    'F', m, n, ldc_g, *hC_gold[g], *hC_host[g], batch_count);
+                double error_device = norm_check_general<To>(
+                    'F', m, n, ldc_g, *hC_gold[g], *hC_device[g], batch_count);
+
+                hipblas_error_host   = std::max(hipblas_error_host, error_host);
+                hipblas_error_device = std::max(hipblas_error_device, error_device);
+            }
+        }
+    }
+
+    if(timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+
+            CHECK_HIPBLAS_ERROR(run(alpha_array.data(), beta_array.data()));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasGemmGroupedBatchedExModel{}.log_args<To>(std::cout,
+                                                        arg,
+                                                        gpu_time_used,
+                                                        gflops,
+                                                        gbytes,
+                                                        hipblas_error_host,
+                                                        hipblas_error_device);
+    }
+}
@@ -0,0 +1,318 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGemmPackedExModel = ArgumentModel<e_a_type,
+                                               e_transA,
+                                               e_transB,
+                                               e_M,
+                                               e_N,
+                                               e_K,
+                                               e_alpha,
+                                               e_lda,
+                                               e_ldb,
+                                               e_beta,
+                                               e_ldc>;
+
+inline void testname_gemm_packed_ex(const Arguments& arg, std::string& name)
+{
+    hipblasGemmPackedExModel{}.test_name(arg, name);
+}
+
+// Packed gemm is tested with Ti == To == Tex, with the computation in the precision of T
+template <typename T>
+constexpr hipDataType hipblas_packed_datatype()
+{
+    if constexpr(std::is_same_v<T, double>)
+        return HIP_R_64F;
+    else if constexpr(std::is_same_v<T, hipblasComplex>)
+        return HIP_C_32F;
+    else if constexpr(std::is_same_v<T, hipblasDoubleComplex>)
+        return HIP_C_64F;
+    else
+        return HIP_R_32F;
+}
+
+template <typename T>
+constexpr hipblasComputeType_t hipblas_packed_compute_type()
+{
+    if constexpr(std::is_same_v<T, double> || std::is_same_v<T, hipblasDoubleComplex>)
+        return HIPBLAS_COMPUTE_64F;
+    else
+        return HIPBLAS_COMPUTE_32F;
+}
+
+template <typename Ti, typename To = Ti, typename Tex = To>
+void testing_gemm_packed_ex_bad_arg(const Arguments& arg)
+{
+    using T = To;
+
+    hipblasLocalHandle handle(arg);
+
+    hipDataType          type        = hipblas_packed_datatype<T>();
+    hipblasComputeType_t computeType = hipblas_packed_compute_type<T>();
+    hipblasGemmAlgo_t    algo        = HIPBLAS_GEMM_DEFAULT;
+
+    int M   = 101;
+    int N   = 100;
+    int K   = 102;
+    int lda = 103;
+    int ldb = 104;
+    int ldc = 105;
+
+    device_matrix<T> dA(M, K, lda);
+    device_matrix<T> dB(K, N, ldb);
+    device_matrix<T> dC(M, N, ldc);
+
+    T alpha = 1, beta = 1;
+
+    size_t size;
+    hipblasPackedMatrix_t packed = nullptr;
+
+    EXPECT_HIPBLAS_STATUS(hipblasMatrixPackGetSize(nullptr, HIPBLAS_OP_N, M, K, type, &size),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasMatrixPackGetSize(
+            handle, (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL, M, K, type, &size),
+        HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_HIPBLAS_STATUS(hipblasMatrixPackGetSize(handle, HIPBLAS_OP_N, M, K, type, nullptr),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    CHECK_HIPBLAS_ERROR(hipblasMatrixPackGetSize(handle, HIPBLAS_OP_N, M, K, type, &size));
+
+    EXPECT_HIPBLAS_STATUS(hipblasMatrixPack(nullptr, HIPBLAS_OP_N, M, K, dA, type, lda, &packed),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasMatrixPack(handle,
+                                            (hipblasOperation_t)HIPBLAS_FILL_MODE_FULL,
+                                            M,
+                                            K,
+                                            dA,
+                                            type,
+                                            lda,
+                                            &packed),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_HIPBLAS_STATUS(hipblasMatrixPack(handle, HIPBLAS_OP_N, M, K, dA, type, M - 1, &packed),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasMatrixPack(handle, HIPBLAS_OP_N, M, K, nullptr, type, lda, &packed),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasMatrixPack(handle, HIPBLAS_OP_N, M, K, dA, type, lda, nullptr),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    CHECK_HIPBLAS_ERROR(hipblasMatrixPack(handle, HIPBLAS_OP_N, M, K, dA, type, lda, &packed));
+
+    // clang-format off
+
+    // m and k must be those the matrix was packed with
+    EXPECT_HIPBLAS_STATUS(hipblasGemmPackedEx(nullptr, packed, HIPBLAS_OP_N, M, N, K, &alpha,
+                                              dB, type, ldb, &beta, dC, type, ldc, computeType,
+                                              algo),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasGemmPackedEx(handle, nullptr, HIPBLAS_OP_N, M, N, K, &alpha,
+                                              dB, type, ldb, &beta, dC, type, ldc, computeType,
+                                              algo),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasGemmPackedEx(handle, packed, HIPBLAS_OP_N, M + 1, N, K, &alpha,
+                                              dB, type, ldb, &beta, dC, type, ldc, computeType,
+                                              algo),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasGemmPackedEx(handle, packed, HIPBLAS_OP_N, M, N, K - 1, &alpha,
+                                              dB, type, ldb, &beta, dC, type, ldc, computeType,
+                                              algo),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    // clang-format on
+
+    CHECK_HIPBLAS_ERROR(hipblasMatrixPackDestroy(packed));
+    CHECK_HIPBLAS_ERROR(hipblasMatrixPackDestroy(nullptr));
+}
+
+template <typename Ti, typename To = Ti, typename Tex = To>
+void testing_gemm_packed_ex(const Arguments& arg)
+{
+    using T = To;
+
+    hipblasGemmAlgo_t algo = HIPBLAS_GEMM_DEFAULT;
+
+    hipblasOperation_t transA = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB = char2hipblas_operation(arg.transB);
+    int                M      = arg.M;
+    int                N      = arg.N;
+    int                K      = arg.K;
+    int                lda    = arg.lda;
+    int                ldb    = arg.ldb;
+    int                ldc    = arg.ldc;
+
+    hipDataType          type         = hipblas_packed_datatype<T>();
+    hipblasComputeType_t compute_type = hipblas_packed_compute_type<T>();
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    int norm_check = arg.norm_check;
+    int unit_check = arg.unit_check;
+    int timing     = arg.timing;
+
+    int A_row = transA == HIPBLAS_OP_N ? M : K;
+    int A_col = transA == HIPBLAS_OP_N ? K : M;
+    int B_row = transB == HIPBLAS_OP_N ? K : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+    // check here to prevent undefined memory allocation error
+    if(M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M)
+    {
+        return;
+    }
+
+    // Allocate host memory
+    host_matrix<T> hA(A_row, A_col, lda);
+    host_matrix<T> hB(B_row, B_col, ldb);
+    host_matrix<T> hC_host(M, N, ldc);
+    host_matrix<T> hC_device(M, N, ldc);
+    host_matrix<T> hC_gold(M, N, ldc);
+
+    // Allocate device memory
+    device_matrix<T> dA(A_row, A_col, lda);
+    device_matrix<T> dB(B_row, B_col, ldb);
+    device_matrix<T> dC(M, N, ldc);
+    device_vector<T> d_alpha(1);
+    device_vector<T> d_beta(1);
+
+    double             gpu_time_used, hipblas_error_host, hipblas_error_device;
+    hipblasLocalHandle handle(arg);
+
+    // Initial Data on CPU
+    hipblas_init_matrix(hA, arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix, true);
+    hipblas_init_matrix(
+        hB, arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix, false, true);
+    hipblas_init_matrix(hC_host, arg, hipblas_client_beta_sets_nan, hipblas_general_matrix);
+
+    hC_gold = hC_device = hC_host;
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIP_ERROR(dC.transfer_from(hC_host));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+    // A is not read after packing
+    hipblasPackedMatrix_t packed;
+    CHECK_HIPBLAS_ERROR(hipblasMatrixPack(handle, transA, M, K, dA, type, lda, &packed));
+    CHECK_HIP_ERROR(hipMemset(dA, 0, sizeof(T) * size_t(lda) * A_col));
+
+    auto run = [&](const void* alpha, const void* beta) {
+        return hipblasGemmPackedEx(handle,
+                                   packed,
+                                   transB,
+                                   M,
+                                   N,
+                                   K,
+                                   alpha,
+                                   dB,
+                                   type,
+                                   ldb,
+                                   beta,
+                                   dC,
+                                   type,
+                                   ldc,
+                                   compute_type,
+                                   algo);
+    };
+
+    if(unit_check || norm_check)
+    {
+        // hipBLAS
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        CHECK_HIPBLAS_ERROR(run(&h_alpha, &h_beta));
+
+        CHECK_HIP_ERROR(hC_host.transfer_from(dC));
+        CHECK_HIP_ERROR(dC.transfer_from(hC_device));
+
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        CHECK_HIPBLAS_ERROR(run(d_alpha, d_beta));
+
+        CHECK_HIP_ERROR(hC_device.transfer_from(dC));
+
+        // reference BLAS
+        ref_gemm<T>(transA,
+                    transB,
+                    M,
+                    N,
+                    K,
+                    h_alpha,
+                    hA.data(),
+                    lda,
+                    hB.data(),
+                    ldb,
+                    h_beta,
+                    hC_gold.data(),
+                    ldc);
+
+        if(unit_check)
+        {
+            unit_check_general<T>(M, N, ldc, hC_gold, hC_host);
+            unit_check_general<T>(M, N, ldc, hC_gold, hC_device);
+        }
+        if(norm_check)
+        {
+            hipblas_error_host
+                = hipblas_abs(norm_check_general<T>('F', M, N, ldc, hC_gold, hC_host));
+            hipblas_error_device
+                = hipblas_abs(norm_check_general<T>('F', M, N, ldc, hC_gold, hC_device));
+        }
+    }
+
+    if(timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+
+            CHECK_HIPBLAS_ERROR(run(&h_alpha, &h_beta));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasGemmPackedExModel{}.log_args<T>(std::cout,
+                                               arg,
+                                               gpu_time_used,
+                                               gemm_gflop_count<T>(M, N, K),
+                                               gemm_gbyte_count<T>(M, N, K),
+                                               hipblas_error_host,
+                                               hipblas_error_device);
+    }
+
+    CHECK_HIPBLAS_ERROR(hipblasMatrixPackDestroy(packed));
+}
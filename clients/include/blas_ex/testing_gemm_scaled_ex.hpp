@@ -0,0 +1,529 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGemmScaledExModel = ArgumentModel<e_c_type,
+                                               e_transA,
+                                               e_transB,
+                                               e_M,
+                                               e_N,
+                                               e_K,
+                                               e_alpha,
+                                               e_lda,
+                                               e_ldb,
+                                               e_beta,
+                                               e_ldc,
+                                               e_batch_count>;
+
+inline void testname_gemm_scaled_ex(const Arguments& arg, std::string& name)
+{
+    hipblasGemmScaledExModel{}.test_name(arg, name);
+}
+
+// The FP8 formats of A and B; every combination is tested
+constexpr hipDataType hipblas_fp8_types[] = {HIPBLAS_R_8F_E4M3,
+                                             HIPBLAS_R_8F_E5M2,
+                                             HIPBLAS_R_8F_E4M3_FNUZ,
+                                             HIPBLAS_R_8F_E5M2_FNUZ};
+
+// C has the type To, with the computation and alpha and beta in float
+template <typename To>
+constexpr hipDataType hipblas_scaled_datatype()
+{
+    if constexpr(std::is_same_v<To, hipblasHalf>)
+        return HIP_R_16F;
+    else if constexpr(std::is_same_v<To, hipblasBfloat16>)
+        return HIP_R_16BF;
+    else
+        return HIP_R_32F;
+}
+
+template <typename To>
+inline double hipblas_scaled_to_double(To x)
+{
+    if constexpr(std::is_same_v<To, hipblasHalf>)
+        return half_to_float(x);
+    else if constexpr(std::is_same_v<To, hipblasBfloat16>)
+        return bfloat16_to_float(x);
+    else
+        return x;
+}
+
+// Random FP8 codes of magnitude at most 8, so that half results cannot overflow
+inline void hipblas_init_fp8(uint8_t* A, size_t size, hipDataType type)
+{
+    for(size_t i = 0; i < size; i++)
+    {
+        float x;
+        do
+        {
+            A[i] = uint8_t(std::uniform_int_distribution<int>(0, 255)(hipblas_rng));
+            x    = ref_fp8_to_float(A[i], type);
+        } while(!(std::abs(x) <= 8));
+    }
+}
+
+// Powers of two, so that the scaled inputs stay exact
+inline void hipblas_init_fp8_scale(float* scale, size_t size)
+{
+    for(size_t i = 0; i < size; i++)
+        scale[i] = std::ldexp(1.0f, std::uniform_int_distribution<int>(-1, 1)(hipblas_rng));
+}
+
+enum class hipblas_scaled_api
+{
+    single,
+    batched,
+    strided_batched
+};
+
+template <typename Ti, typename To = Ti, typename Tex = To>
+void testing_gemm_scaled_ex_bad_arg(const Arguments& arg)
+{
+    hipblasLocalHandle handle(arg);
+
+    hipDataType          aType       = HIPBLAS_R_8F_E4M3;
+    hipDataType          bType       = HIPBLAS_R_8F_E5M2;
+    hipDataType          cType       = hipblas_scaled_datatype<To>();
+    hipblasComputeType_t computeType = HIPBLAS_COMPUTE_32F;
+    hipblasGemmAlgo_t    algo        = HIPBLAS_GEMM_DEFAULT;
+    hipblasOperation_t   transA      = HIPBLAS_OP_N;
+    hipblasOperation_t   transB      = HIPBLAS_OP_N;
+
+    hipblasGemmScaleMode_t tensor = HIPBLAS_GEMM_SCALE_TENSOR;
+
+    int           M           = 101;
+    int           N           = 100;
+    int           K           = 102;
+    int           lda         = 103;
+    int           ldb         = 104;
+    int           ldc         = 105;
+    int           batch_count = 2;
+    hipblasStride strideA     = hipblasStride(lda) * K;
+    hipblasStride strideB     = hipblasStride(ldb) * N;
+    hipblasStride strideC     = hipblasStride(ldc) * N;
+
+    device_vector<uint8_t>  dA(strideA * batch_count);
+    device_vector<uint8_t>  dB(strideB * batch_count);
+    device_vector<To>       dC(strideC * batch_count);
+    device_vector<uint8_t*> dA_array(batch_count);
+    device_vector<uint8_t*> dB_array(batch_count);
+    device_vector<To*>      dC_array(batch_count);
+    device_vector<float>    dScale(1);
+
+    float alpha = 1, beta = 1;
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    // clang-format off
+
+    auto call = [&](hipblasHandle_t h, int k, hipDataType a, hipDataType c,
+                    hipblasGemmScaleMode_t mode, int ld, hipblasComputeType_t compute) {
+        return hipblasGemmScaledEx(h, transA, transB, M, N, k, &alpha,
+                                   dA, a, ld, dScale, mode,
+                                   dB, bType, ldb, dScale, tensor, &beta,
+                                   dC, c, ldc, compute, algo);
+    };
+
+    EXPECT_HIPBLAS_STATUS(call(nullptr, K, aType, cType, tensor, lda, computeType),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(call(handle, K, aType, cType, hipblasGemmScaleMode_t(2), lda, computeType),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_HIPBLAS_STATUS(call(handle, K, aType, cType, tensor, M - 1, computeType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(call(handle, -1, aType, cType, tensor, lda, computeType),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    // A and B are FP8, C is not, and the computation is in float
+    EXPECT_HIPBLAS_STATUS(call(handle, K, HIP_R_32F, cType, tensor, lda, computeType),
+                          HIPBLAS_STATUS_NOT_SUPPORTED);
+    EXPECT_HIPBLAS_STATUS(call(handle, K, aType, HIP_R_64F, tensor, lda, computeType),
+                          HIPBLAS_STATUS_NOT_SUPPORTED);
+    EXPECT_HIPBLAS_STATUS(call(handle, K, aType, cType, tensor, lda, HIPBLAS_COMPUTE_64F),
+                          HIPBLAS_STATUS_NOT_SUPPORTED);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmScaledEx(handle, transA, transB, M, N, K, nullptr,
+                                              dA, aType, lda, nullptr, tensor,
+                                              dB, bType, ldb, nullptr, tensor, &beta,
+                                              dC, cType, ldc, computeType, algo),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasGemmScaledEx(handle, transA, transB, M, N, K, &alpha,
+                                              nullptr, aType, lda, nullptr, tensor,
+                                              dB, bType, ldb, nullptr, tensor, &beta,
+                                              dC, cType, ldc, computeType, algo),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasGemmScaledEx(handle, transA, transB, M, N, K, &alpha,
+                                              dA, aType, lda, nullptr, tensor,
+                                              dB, bType, ldb, nullptr, tensor, &beta,
+                                              nullptr, cType, ldc, computeType, algo),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGemmBatchedScaledEx(handle, transA, transB, M, N, K, &alpha,
+                                                     (const void**)(uint8_t**)dA_array, aType, lda, nullptr, tensor,
+                                                     (const void**)(uint8_t**)dB_array, bType, ldb, nullptr, tensor, &beta,
+                                                     (void**)(To**)dC_array, cType, ldc, -1, computeType, algo),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasGemmStridedBatchedScaledEx(handle, transA, transB, M, N, K, &alpha,
+                                                            dA, aType, lda, strideA, nullptr, tensor,
+                                                            dB, bType, ldb, strideB, nullptr, tensor, &beta,
+                                                            dC, cType, ldc, strideC, -1, computeType, algo),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    // If M == 0 || N == 0 || batch_count == 0, can have nullptrs
+    CHECK_HIPBLAS_ERROR(hipblasGemmScaledEx(handle, transA, transB, 0, N, K, nullptr,
+                                            nullptr, aType, lda, nullptr, tensor,
+                                            nullptr, bType, ldb, nullptr, tensor, nullptr,
+                                            nullptr, cType, ldc, computeType, algo));
+    CHECK_HIPBLAS_ERROR(hipblasGemmBatchedScaledEx(handle, transA, transB, M, N, K, nullptr,
+                                                   nullptr, aType, lda, nullptr, tensor,
+                                                   nullptr, bType, ldb, nullptr, tensor, nullptr,
+                                                   nullptr, cType, ldc, 0, computeType, algo));
+    CHECK_HIPBLAS_ERROR(hipblasGemmStridedBatchedScaledEx(handle, transA, transB, M, 0, K, nullptr,
+                                                          nullptr, aType, lda, strideA, nullptr, tensor,
+                                                          nullptr, bType, ldb, strideB, nullptr, tensor, nullptr,
+                                                          nullptr, cType, ldc, strideC, batch_count, computeType, algo));
+
+    // clang-format on
+}
+
+template <typename To>
+void testing_gemm_scaled_ex_template(const Arguments& arg, hipblas_scaled_api api)
+{
+    hipblasGemmAlgo_t algo = HIPBLAS_GEMM_DEFAULT;
+
+    hipblasOperation_t transA = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB = char2hipblas_operation(arg.transB);
+
+    int M           = arg.M;
+    int N           = arg.N;
+    int K           = arg.K;
+    int lda         = arg.lda;
+    int ldb         = arg.ldb;
+    int ldc         = arg.ldc;
+    int batch_count = api == hipblas_scaled_api::single ? 1 : arg.batch_count;
+
+    hipDataType          cType       = hipblas_scaled_datatype<To>();
+    hipblasComputeType_t computeType = HIPBLAS_COMPUTE_32F;
+
+    float h_alpha = arg.get_alpha<float>();
+    float h_beta  = arg.get_beta<float>();
+
+    int norm_check = arg.norm_check;
+    int unit_check = arg.unit_check;
+    int timing     = arg.timing;
+
+    int A_row = transA == HIPBLAS_OP_N ? M : K;
+    int A_col = transA == HIPBLAS_OP_N ? K : M;
+    int B_row = transB == HIPBLAS_OP_N ? K : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+    // check here to prevent undefined memory allocation error
+    if(M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M || batch_count < 0)
+    {
+        return;
+    }
+
+    // Each batch is stored strided; the batched function gets pointers into the strided batch
+    hipblasStride strideA = hipblasStride(lda) * A_col;
+    hipblasStride strideB = hipblasStride(ldb) * B_col;
+    hipblasStride strideC = hipblasStride(ldc) * N;
+
+    host_vector<uint8_t> hA(strideA * batch_count);
+    host_vector<uint8_t> hB(strideB * batch_count);
+    host_vector<To>      hC(strideC * batch_count);
+    host_vector<To>      hC_host(strideC * batch_count);
+    host_vector<To>      hC_gold(strideC * batch_count);
+    host_vector<float>   hScaleA(std::max(M, 1));
+    host_vector<float>   hScaleB(std::max(N, 1));
+
+    device_vector<uint8_t>  dA(strideA * batch_count);
+    device_vector<uint8_t>  dB(strideB * batch_count);
+    device_vector<To>       dC(strideC * batch_count);
+    device_vector<uint8_t*> dA_array(batch_count);
+    device_vector<uint8_t*> dB_array(batch_count);
+    device_vector<To*>      dC_array(batch_count);
+    device_vector<float>    dScaleA(std::max(M, 1));
+    device_vector<float>    dScaleB(std::max(N, 1));
+
+    double             gpu_time_used, hipblas_error_host = 0;
+    hipblasLocalHandle handle(arg);
+
+    hipblas_init_vector(hC, arg, hipblas_client_beta_sets_nan);
+    hipblas_init_fp8_scale(hScaleA, hScaleA.size());
+    hipblas_init_fp8_scale(hScaleB, hScaleB.size());
+
+    std::vector<uint8_t*> hA_array(batch_count), hB_array(batch_count);
+    std::vector<To*>      hC_array(batch_count);
+    for(int b = 0; b < batch_count; b++)
+    {
+        hA_array[b] = (uint8_t*)dA + b * strideA;
+        hB_array[b] = (uint8_t*)dB + b * strideB;
+        hC_array[b] = (To*)dC + b * strideC;
+    }
+    CHECK_HIP_ERROR(hipMemcpy(
+        dA_array, hA_array.data(), sizeof(uint8_t*) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dB_array, hB_array.data(), sizeof(uint8_t*) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dC_array, hC_array.data(), sizeof(To*) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(dScaleA.transfer_from(hScaleA));
+    CHECK_HIP_ERROR(dScaleB.transfer_from(hScaleB));
+
+    auto run = [&](hipDataType            aType,
+                   hipDataType            bType,
+                   const float*           scaleA,
+                   hipblasGemmScaleMode_t modeA,
+                   const float*           scaleB,
+                   hipblasGemmScaleMode_t modeB) {
+        if(api == hipblas_scaled_api::single)
+            return hipblasGemmScaledEx(handle,
+                                       transA,
+                                       transB,
+                                       M,
+                                       N,
+                                       K,
+                                       &h_alpha,
+                                       dA,
+                                       aType,
+                                       lda,
+                                       scaleA,
+                                       modeA,
+                                       dB,
+                                       bType,
+                                       ldb,
+                                       scaleB,
+                                       modeB,
+                                       &h_beta,
+                                       dC,
+                                       cType,
+                                       ldc,
+                                       computeType,
+                                       algo);
+        else if(api == hipblas_scaled_api::batched)
+            return hipblasGemmBatchedScaledEx(handle,
+                                              transA,
+                                              transB,
+                                              M,
+                                              N,
+                                              K,
+                                              &h_alpha,
+                                              (const void**)(uint8_t**)dA_array,
+                                              aType,
+                                              lda,
+                                              scaleA,
+                                              modeA,
+                                              (const void**)(uint8_t**)dB_array,
+                                              bType,
+                                              ldb,
+                                              scaleB,
+                                              modeB,
+                                              &h_beta,
+                                              (void**)(To**)dC_array,
+                                              cType,
+                                              ldc,
+                                              batch_count,
+                                              computeType,
+                                              algo);
+        else
+            return hipblasGemmStridedBatchedScaledEx(handle,
+                                                     transA,
+                                                     transB,
+                                                     M,
+                                                     N,
+                                                     K,
+                                                     &h_alpha,
+                                                     dA,
+                                                     aType,
+                                                     lda,
+                                                     strideA,
+                                                     scaleA,
+                                                     modeA,
+                                                     dB,
+                                                     bType,
+                                                     ldb,
+                                                     strideB,
+                                                     scaleB,
+                                                     modeB,
+                                                     &h_beta,
+                                                     dC,
+                                                     cType,
+                                                     ldc,
+                                                     strideC,
+                                                     batch_count,
+                                                     computeType,
+                                                     algo);
+    };
+
+    if(unit_check || norm_check)
+    {
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+        // The decoded inputs are exact, so the results only differ in the order of the sums
+        // and in the rounding to To
+        const double eps = std::is_same_v<To, hipblasHalf>       ? 1.0 / 1024
+                           : std::is_same_v<To, hipblasBfloat16> ? 1.0 / 128
+                                                                 : 0;
+
+        for(hipDataType aType : hipblas_fp8_types)
+        {
+            for(hipDataType bType : hipblas_fp8_types)
+            {
+                hipblas_init_fp8(hA, hA.size(), aType);
+                hipblas_init_fp8(hB, hB.size(), bType);
+                CHECK_HIP_ERROR(dA.transfer_from(hA));
+                CHECK_HIP_ERROR(dB.transfer_from(hB));
+
+                // a tensor scale of A with a vector scale of B, then the other way round
+                // with no scale for B
+                for(bool vectorA : {false, true})
+                {
+                    const float* scaleB  = vectorA ? nullptr : (const float*)dScaleB;
+                    bool         vectorB = !vectorA;
+
+                    CHECK_HIP_ERROR(dC.transfer_from(hC));
+                    CHECK_HIPBLAS_ERROR(run(aType,
+                                            bType,
+                                            dScaleA,
+                                            vectorA ? HIPBLAS_GEMM_SCALE_VECTOR
+                                                    : HIPBLAS_GEMM_SCALE_TENSOR,
+                                            scaleB,
+                                            vectorB ? HIPBLAS_GEMM_SCALE_VECTOR
+                                                    : HIPBLAS_GEMM_SCALE_TENSOR));
+                    CHECK_HIP_ERROR(hC_host.transfer_from(dC));
+
+                    hC_gold = hC;
+                    ref_batched(batch_count, [&](int64_t b) {
+                            ref_gemm_scaled<To>(transA,
+                                                transB,
+                                                M,
+                                                N,
+                                                K,
+                                                h_alpha,
+                                                hA + b * strideA,
+                                                aType,
+                                                lda,
+                                                hScaleA,
+                                                vectorA,
+                                                hB + b * strideB,
+                                                bType,
+                                                ldb,
+                                                vectorA ? nullptr : (const float*)hScaleB,
+                                                vectorB,
+                                                h_beta,
+                                                hC_gold + b * strideC,
+                                                ldc);
+                    });
+
+                    double max_abs = 1;
+                    for(size_t i = 0; i < hC_gold.size(); i++)
+                        max_abs = std::max(max_abs, std::abs(hipblas_scaled_to_double(hC_gold[i])));
+                    const double tol
+                        = max_abs * (eps + K * std::numeric_limits<float>::epsilon());
+
+                    if(unit_check)
+                        for(int b = 0; b < batch_count; b++)
+                            near_check_general<To>(M,
+                                                   N,
+                                                   ldc,
+                                                   hC_gold + b * strideC,
+                                                   hC_host + b * strideC,
+                                                   tol);
+                    if(norm_check)
+                        for(int b = 0; b < batch_count; b++)
+                            hipblas_error_host = std::max(
+                                hipblas_error_host,
+                                hipblas_abs(norm_check_general<To>('F',
+                                                                   M,
+                                                                   N,
+                                                                   ldc,
+                                                                   hC_gold + b * strideC,
+                                                                   hC_host + b * strideC)));
+                }
+            }
+        }
+    }
+
+    if(timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+        hipblas_init_fp8(hA, hA.size(), HIPBLAS_R_8F_E4M3);
+        hipblas_init_fp8(hB, hB.size(), HIPBLAS_R_8F_E4M3);
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_HIP_ERROR(dB.transfer_from(hB));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+
+            CHECK_HIPBLAS_ERROR(run(HIPBLAS_R_8F_E4M3,
+                                    HIPBLAS_R_8F_E4M3,
+                                    dScaleA,
+                                    HIPBLAS_GEMM_SCALE_TENSOR,
+                                    dScaleB,
+                                    HIPBLAS_GEMM_SCALE_TENSOR));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        // one byte per element of A and B
+        double gbytes = (double(M) * K + double(K) * N + 2.0 * M * N * sizeof(To)) * batch_count
+                        / 1e9;
+        hipblasGemmScaledExModel{}.log_args<To>(std::cout,
+                                                arg,
+                                                gpu_time_used,
+                                                gemm_gflop_count<float>(M, N, K) * batch_count,
+                                                gbytes,
+                                                hipblas_error_host);
+    }
+}
+
+template <typename Ti, typename To = Ti, typename Tex = To>
+void testing_gemm_scaled_ex(const Arguments& arg)
+{
+    testing_gemm_scaled_ex_template<To>(arg, hipblas_scaled_api::single);
+}
+
+template <typename Ti, typename To = Ti, typename Tex = To>
+void testing_gemm_batched_scaled_ex(const Arguments& arg)
+{
+    testing_gemm_scaled_ex_template<To>(arg, hipblas_scaled_api::batched);
+}
+
+template <typename Ti, typename To = Ti, typename Tex = To>
+void testing_gemm_strided_batched_scaled_ex(const Arguments& arg)
+{
+    testing_gemm_scaled_ex_template<To>(arg, hipblas_scaled_api::strided_batched);
+}
@@ -555,22 +555,23 @@ void testing_gemm_strided_batched_ex(const Arguments& arg)
         CHECK_HIP_ERROR(hC_device.transfer_from(dC));
 
         // CPU BLAS
-        for(int b = 0; b < batch_count; b++)
-        {
-            ref_gemm<Ti, To, Tex>(transA,
-                                  transB,
-                                  M,
-                                  N,
-                                  K,
-                                  h_alpha_Tex,
-                                  hA[b],
-                                  lda,
-                                  hB[b],
-                                  ldb,
-                                  h_beta_Tex,
-                                  hC_gold[b],
-                                  ldc);
-        }
+        ref_cached(arg, "gemm", {ref_cache_output(hC_gold)}, [&] {
+            ref_batched(batch_count, [&](int64_t b) {
+                ref_gemm<Ti, To, Tex>(transA,
+                                      transB,
+                                      M,
+                                      N,
+                                      K,
+                                      h_alpha_Tex,
+                                      hA[b],
+                                      lda,
+                                      hB[b],
+                                      ldb,
+                                      h_beta_Tex,
+                                      hC_gold[b],
+                                      ldc);
+            });
+        });
 
         if(unit_check)
         {
@@ -232,10 +232,9 @@ void testing_nrm2_strided_batched_ex(const Arguments& arg)
                     CPU BLAS
         =================================================================== */
 
-        for(int64_t b = 0; b < batch_count; b++)
-        {
+        ref_batched(batch_count, [&](int64_t b) {
             ref_nrm2<Tx, Tr>(N, hx[b], incx, &(h_cpu_result[b]));
-        }
+        });
 
         double abs_result = h_cpu_result[0] > 0 ? h_cpu_result[0] : -h_cpu_result[0];
         double abs_error;
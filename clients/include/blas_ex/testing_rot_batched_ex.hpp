@@ -282,10 +282,9 @@ void testing_rot_batched_ex(const Arguments& arg)
         CHECK_HIP_ERROR(hy_device.transfer_from(dy));
 
         // CBLAS
-        for(int64_t b = 0; b < batch_count; b++)
-        {
+        ref_batched(batch_count, [&](int64_t b) {
             ref_rot<Tx, Tcs, Tcs>(N, hx_cpu[b], incx, hy_cpu[b], incy, *hc, *hs);
-        }
+        });
 
         if(arg.unit_check)
         {
@@ -226,10 +226,7 @@ void testing_scal_strided_batched_ex(const Arguments& arg)
         /* =====================================================================
                     CPU BLAS
         =================================================================== */
-        for(int64_t b = 0; b < batch_count; b++)
-        {
-            ref_scal<Tx, Ta>(N, h_alpha, hx_cpu[b], incx);
-        }
+        ref_batched(batch_count, [&](int64_t b) { ref_scal<Tx, Ta>(N, h_alpha, hx_cpu[b], incx); });
 
         for(size_t b = 0; b < batch_count; b++)
         {
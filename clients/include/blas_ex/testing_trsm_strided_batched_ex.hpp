@@ -471,8 +471,7 @@ void testing_trsm_strided_batched_ex(const Arguments& arg)
         make_unit_diagonal(uplo, hA);
     }
 
-    for(int b = 0; b < batch_count; b++)
-    {
+    ref_batched(batch_count, [&](int64_t b) {
         // Calculate hB = hA*hX;
         ref_trmm<T>(side,
                     uplo,
@@ -485,7 +484,7 @@ void testing_trsm_strided_batched_ex(const Arguments& arg)
                     lda,
                     hB_host[b],
                     ldb);
-    }
+    });
 
     hB_device.copy_from(hB_host);
     hB_cpu.copy_from(hB_host);
@@ -589,11 +588,10 @@ void testing_trsm_strided_batched_ex(const Arguments& arg)
         /* =====================================================================
            CPU BLAS
         =================================================================== */
-        for(int b = 0; b < batch_count; b++)
-        {
+        ref_batched(batch_count, [&](int64_t b) {
             ref_trsm<T>(
                 side, uplo, transA, diag, M, N, h_alpha, (const T*)hA[b], lda, hB_cpu[b], ldb);
-        }
+        });
 
         // if enable norm check, norm check is invasive
         real_t<T> eps       = std::numeric_limits<real_t<T>>::epsilon();
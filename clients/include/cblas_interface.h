@@ -564,6 +564,49 @@ void ref_gemm(hipblasOperation_t transA,
               To*                C,
               int64_t            ldc);
 
+// gemm epilogues, applied in place to the m x n matrix C in the order scale, bias, aux, activation
+template <typename T, typename Ts>
+void ref_epilogue_scale_columns(int64_t   m,
+                                int64_t   n,
+                                const T*  D,
+                                int64_t   ldd,
+                                const Ts* alphaVec,
+                                const Ts* betaVec,
+                                T*        C,
+                                int64_t   ldc);
+
+template <typename T>
+void ref_epilogue_bias(int64_t m, int64_t n, T* C, int64_t ldc, const T* bias);
+
+template <typename T>
+void ref_epilogue_activation(
+    int64_t m, int64_t n, T* C, int64_t ldc, hipblasEpilogueActivation_t activation);
+
+// fp8 gemm, decoding A and B exactly to float with their scales applied. A null scale is one; a
+// vector scale has one entry per row of op(A) or per column of op(B).
+float ref_fp8_to_float(uint8_t x, hipDataType type);
+
+template <typename To>
+void ref_gemm_scaled(hipblasOperation_t transA,
+                     hipblasOperation_t transB,
+                     int64_t            m,
+                     int64_t            n,
+                     int64_t            k,
+                     float              alpha,
+                     const uint8_t*     A,
+                     hipDataType        aType,
+                     int64_t            lda,
+                     const float*       scaleA,
+                     bool               vectorA,
+                     const uint8_t*     B,
+                     hipDataType        bType,
+                     int64_t            ldb,
+                     const float*       scaleB,
+                     bool               vectorB,
+                     float              beta,
+                     To*                C,
+                     int64_t            ldc);
+
 // dgmm
 template <typename T>
 void ref_dgmm(hipblasSideMode_t side,
@@ -804,6 +847,12 @@ void ref_trmm(hipblasSideMode_t  side,
 template <typename T>
 int ref_potrf(char uplo, int m, T* A, int lda);
 
+template <typename T>
+int ref_potrs(char uplo, int n, int nrhs, T* A, int lda, T* B, int ldb);
+
+template <typename T>
+int ref_potri(char uplo, int n, T* A, int lda);
+
 template <typename T>
 int ref_getrf(int m, int n, T* A, int lda, int* ipiv);
 
@@ -821,4 +870,14 @@ int ref_gels(char trans, int m, int n, int nrhs, T* A, int lda, T* B, int ldb, T
 
 #endif
 
+/*
+ * ===========================================================================
+ *    threading
+ * ===========================================================================
+ */
+
+// Sets the number of threads the host BLAS uses for each call and returns the previous
+// setting, or returns 0 and does nothing if the linked library does not allow it
+int ref_set_blas_threads(int threads);
+
 /* ============================================================================================ */
@@ -7294,6 +7294,178 @@ hipblasStatus_t hipblasZgelsStridedBatchedCast(hipblasHandle_t       handle,
                                                int*                  deviceInfo,
                                                const int             batchCount);
 
+// potrf
+hipblasStatus_t hipblasCpotrfCast(hipblasHandle_t         handle,
+                                  const hipblasFillMode_t uplo,
+                                  const int               n,
+                                  hipblasComplex*         A,
+                                  const int               lda,
+                                  int*                    info);
+
+hipblasStatus_t hipblasZpotrfCast(hipblasHandle_t         handle,
+                                  const hipblasFillMode_t uplo,
+                                  const int               n,
+                                  hipblasDoubleComplex*   A,
+                                  const int               lda,
+                                  int*                    info);
+
+// potrf_batched
+hipblasStatus_t hipblasCpotrfBatchedCast(hipblasHandle_t         handle,
+                                         const hipblasFillMode_t uplo,
+                                         const int               n,
+                                         hipblasComplex* const   A[],
+                                         const int               lda,
+                                         int*                    info,
+                                         const int               batchCount);
+
+hipblasStatus_t hipblasZpotrfBatchedCast(hipblasHandle_t             handle,
+                                         const hipblasFillMode_t     uplo,
+                                         const int                   n,
+                                         hipblasDoubleComplex* const A[],
+                                         const int                   lda,
+                                         int*                        info,
+                                         const int                   batchCount);
+
+// potrf_strided_batched
+hipblasStatus_t hipblasCpotrfStridedBatchedCast(hipblasHandle_t         handle,
+                                                const hipblasFillMode_t uplo,
+                                                const int               n,
+                                                hipblasComplex*         A,
+                                                const int               lda,
+                                                const hipblasStride     strideA,
+                                                int*                    info,
+                                                const int               batchCount);
+
+hipblasStatus_t hipblasZpotrfStridedBatchedCast(hipblasHandle_t         handle,
+                                                const hipblasFillMode_t uplo,
+                                                const int               n,
+                                                hipblasDoubleComplex*   A,
+                                                const int               lda,
+                                                const hipblasStride     strideA,
+                                                int*                    info,
+                                                const int               batchCount);
+
+// potrs
+hipblasStatus_t hipblasCpotrsCast(hipblasHandle_t         handle,
+                                  const hipblasFillMode_t uplo,
+                                  const int               n,
+                                  const int               nrhs,
+                                  hipblasComplex*         A,
+                                  const int               lda,
+                                  hipblasComplex*         B,
+                                  const int               ldb,
+                                  int*                    info);
+
+hipblasStatus_t hipblasZpotrsCast(hipblasHandle_t         handle,
+                                  const hipblasFillMode_t uplo,
+                                  const int               n,
+                                  const int               nrhs,
+                                  hipblasDoubleComplex*   A,
+                                  const int               lda,
+                                  hipblasDoubleComplex*   B,
+                                  const int               ldb,
+                                  int*                    info);
+
+// potrs_batched
+hipblasStatus_t hipblasCpotrsBatchedCast(hipblasHandle_t         handle,
+                                         const hipblasFillMode_t uplo,
+                                         const int               n,
+                                         const int               nrhs,
+                                         hipblasComplex* const   A[],
+                                         const int               lda,
+                                         hipblasComplex* const   B[],
+                                         const int               ldb,
+                                         int*                    info,
+                                         const int               batchCount);
+
+hipblasStatus_t hipblasZpotrsBatchedCast(hipblasHandle_t             handle,
+                                         const hipblasFillMode_t     uplo,
+                                         const int                   n,
+                                         const int                   nrhs,
+                                         hipblasDoubleComplex* const A[],
+                                         const int                   lda,
+                                         hipblasDoubleComplex* const B[],
+                                         const int                   ldb,
+                                         int*                        info,
+                                         const int                   batchCount);
+
+// potrs_strided_batched
+hipblasStatus_t hipblasCpotrsStridedBatchedCast(hipblasHandle_t         handle,
+                                                const hipblasFillMode_t uplo,
+                                                const int               n,
+                                                const int               nrhs,
+                                                hipblasComplex*         A,
+                                                const int               lda,
+                                                const hipblasStride     strideA,
+                                                hipblasComplex*         B,
+                                                const int               ldb,
+                                                const hipblasStride     strideB,
+                                                int*                    info,
+                                                const int               batchCount);
+
+hipblasStatus_t hipblasZpotrsStridedBatchedCast(hipblasHandle_t         handle,
+                                                const hipblasFillMode_t uplo,
+                                                const int               n,
+                                                const int               nrhs,
+                                                hipblasDoubleComplex*   A,
+                                                const int               lda,
+                                                const hipblasStride     strideA,
+                                                hipblasDoubleComplex*   B,
+                                                const int               ldb,
+                                                const hipblasStride     strideB,
+                                                int*                    info,
+                                                const int               batchCount);
+
+// potri
+hipblasStatus_t hipblasCpotriCast(hipblasHandle_t         handle,
+                                  const hipblasFillMode_t uplo,
+                                  const int               n,
+                                  hipblasComplex*         A,
+                                  const int               lda,
+                                  int*                    info);
+
+hipblasStatus_t hipblasZpotriCast(hipblasHandle_t         handle,
+                                  const hipblasFillMode_t uplo,
+                                  const int               n,
+                                  hipblasDoubleComplex*   A,
+                                  const int               lda,
+                                  int*                    info);
+
+// potri_batched
+hipblasStatus_t hipblasCpotriBatchedCast(hipblasHandle_t         handle,
+                                         const hipblasFillMode_t uplo,
+                                         const int               n,
+                                         hipblasComplex* const   A[],
+                                         const int               lda,
+                                         int*                    info,
+                                         const int               batchCount);
+
+hipblasStatus_t hipblasZpotriBatchedCast(hipblasHandle_t             handle,
+                                         const hipblasFillMode_t     uplo,
+                                         const int                   n,
+                                         hipblasDoubleComplex* const A[],
+                                         const int                   lda,
+                                         int*                        info,
+                                         const int                   batchCount);
+
+// potri_strided_batched
+hipblasStatus_t hipblasCpotriStridedBatchedCast(hipblasHandle_t         handle,
+                                                const hipblasFillMode_t uplo,
+                                                const int               n,
+                                                hipblasComplex*         A,
+                                                const int               lda,
+                                                const hipblasStride     strideA,
+                                                int*                    info,
+                                                const int               batchCount);
+
+hipblasStatus_t hipblasZpotriStridedBatchedCast(hipblasHandle_t         handle,
+                                                const hipblasFillMode_t uplo,
+                                                const int               n,
+                                                hipblasDoubleComplex*   A,
+                                                const int               lda,
+                                                const hipblasStride     strideA,
+                                                int*                    info,
+                                                const int               batchCount);
 #endif
 
 namespace
@@ -12101,6 +12273,145 @@ namespace
     MAP2CF_V2(hipblasGelsStridedBatched, hipblasComplex, hipblasCgelsStridedBatched);
     MAP2CF_V2(hipblasGelsStridedBatched, hipblasDoubleComplex, hipblasZgelsStridedBatched);
 
+    // potrf
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasPotrf)(hipblasHandle_t         handle,
+                                    const hipblasFillMode_t uplo,
+                                    const int               n,
+                                    T*                      A,
+                                    const int               lda,
+                                    int*                    info);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasPotrfBatched)(hipblasHandle_t         handle,
+                                           const hipblasFillMode_t uplo,
+                                           const int               n,
+                                           T* const                A[],
+                                           const int               lda,
+                                           int*                    info,
+                                           const int               batchCount);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasPotrfStridedBatched)(hipblasHandle_t         handle,
+                                                  const hipblasFillMode_t uplo,
+                                                  const int               n,
+                                                  T*                      A,
+                                                  const int               lda,
+                                                  const hipblasStride     strideA,
+                                                  int*                    info,
+                                                  const int               batchCount);
+
+    MAP2CF(hipblasPotrf, float, hipblasSpotrf);
+    MAP2CF(hipblasPotrf, double, hipblasDpotrf);
+    MAP2CF_V2(hipblasPotrf, hipblasComplex, hipblasCpotrf);
+    MAP2CF_V2(hipblasPotrf, hipblasDoubleComplex, hipblasZpotrf);
+
+    MAP2CF(hipblasPotrfBatched, float, hipblasSpotrfBatched);
+    MAP2CF(hipblasPotrfBatched, double, hipblasDpotrfBatched);
+    MAP2CF_V2(hipblasPotrfBatched, hipblasComplex, hipblasCpotrfBatched);
+    MAP2CF_V2(hipblasPotrfBatched, hipblasDoubleComplex, hipblasZpotrfBatched);
+
+    MAP2CF(hipblasPotrfStridedBatched, float, hipblasSpotrfStridedBatched);
+    MAP2CF(hipblasPotrfStridedBatched, double, hipblasDpotrfStridedBatched);
+    MAP2CF_V2(hipblasPotrfStridedBatched, hipblasComplex, hipblasCpotrfStridedBatched);
+    MAP2CF_V2(hipblasPotrfStridedBatched, hipblasDoubleComplex, hipblasZpotrfStridedBatched);
+
+    // potrs
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasPotrs)(hipblasHandle_t         handle,
+                                    const hipblasFillMode_t uplo,
+                                    const int               n,
+                                    const int               nrhs,
+                                    T*                      A,
+                                    const int               lda,
+                                    T*                      B,
+                                    const int               ldb,
+                                    int*                    info);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasPotrsBatched)(hipblasHandle_t         handle,
+                                           const hipblasFillMode_t uplo,
+                                           const int               n,
+                                           const int               nrhs,
+                                           T* const                A[],
+                                           const int               lda,
+                                           T* const                B[],
+                                           const int               ldb,
+                                           int*                    info,
+                                           const int               batchCount);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasPotrsStridedBatched)(hipblasHandle_t         handle,
+                                                  const hipblasFillMode_t uplo,
+                                                  const int               n,
+                                                  const int               nrhs,
+                                                  T*                      A,
+                                                  const int               lda,
+                                                  const hipblasStride     strideA,
+                                                  T*                      B,
+                                                  const int               ldb,
+                                                  const hipblasStride     strideB,
+                                                  int*                    info,
+                                                  const int               batchCount);
+
+    MAP2CF(hipblasPotrs, float, hipblasSpotrs);
+    MAP2CF(hipblasPotrs, double, hipblasDpotrs);
+    MAP2CF_V2(hipblasPotrs, hipblasComplex, hipblasCpotrs);
+    MAP2CF_V2(hipblasPotrs, hipblasDoubleComplex, hipblasZpotrs);
+
+    MAP2CF(hipblasPotrsBatched, float, hipblasSpotrsBatched);
+    MAP2CF(hipblasPotrsBatched, double, hipblasDpotrsBatched);
+    MAP2CF_V2(hipblasPotrsBatched, hipblasComplex, hipblasCpotrsBatched);
+    MAP2CF_V2(hipblasPotrsBatched, hipblasDoubleComplex, hipblasZpotrsBatched);
+
+    MAP2CF(hipblasPotrsStridedBatched, float, hipblasSpotrsStridedBatched);
+    MAP2CF(hipblasPotrsStridedBatched, double, hipblasDpotrsStridedBatched);
+    MAP2CF_V2(hipblasPotrsStridedBatched, hipblasComplex, hipblasCpotrsStridedBatched);
+    MAP2CF_V2(hipblasPotrsStridedBatched, hipblasDoubleComplex, hipblasZpotrsStridedBatched);
+
+    // potri
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasPotri)(hipblasHandle_t         handle,
+                                    const hipblasFillMode_t uplo,
+                                    const int               n,
+                                    T*                      A,
+                                    const int               lda,
+                                    int*                    info);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasPotriBatched)(hipblasHandle_t         handle,
+                                           const hipblasFillMode_t uplo,
+                                           const int               n,
+                                           T* const                A[],
+                                           const int               lda,
+                                           int*                    info,
+                                           const int               batchCount);
+
+    template <typename T, bool FORTRAN = false>
+    hipblasStatus_t (*hipblasPotriStridedBatched)(hipblasHandle_t         handle,
+                                                  const hipblasFillMode_t uplo,
+                                                  const int               n,
+                                                  T*                      A,
+                                                  const int               lda,
+                                                  const hipblasStride     strideA,
+                                                  int*                    info,
+                                                  const int               batchCount);
+
+    MAP2CF(hipblasPotri, float, hipblasSpotri);
+    MAP2CF(hipblasPotri, double, hipblasDpotri);
+    MAP2CF_V2(hipblasPotri, hipblasComplex, hipblasCpotri);
+    MAP2CF_V2(hipblasPotri, hipblasDoubleComplex, hipblasZpotri);
+
+    MAP2CF(hipblasPotriBatched, float, hipblasSpotriBatched);
+    MAP2CF(hipblasPotriBatched, double, hipblasDpotriBatched);
+    MAP2CF_V2(hipblasPotriBatched, hipblasComplex, hipblasCpotriBatched);
+    MAP2CF_V2(hipblasPotriBatched, hipblasDoubleComplex, hipblasZpotriBatched);
+
+    MAP2CF(hipblasPotriStridedBatched, float, hipblasSpotriStridedBatched);
+    MAP2CF(hipblasPotriStridedBatched, double, hipblasDpotriStridedBatched);
+    MAP2CF_V2(hipblasPotriStridedBatched, hipblasComplex, hipblasCpotriStridedBatched);
+    MAP2CF_V2(hipblasPotriStridedBatched, hipblasDoubleComplex, hipblasZpotriStridedBatched);
+
 #endif
 }
 
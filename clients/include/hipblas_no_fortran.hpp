@@ -1356,5 +1356,41 @@
 #define hipblasDgeqrfStridedBatchedFortran hipblasDgeqrfStridedBatched
 #define hipblasCgeqrfStridedBatchedFortran hipblasCgeqrfStridedBatched
 #define hipblasZgeqrfStridedBatchedFortran hipblasZgeqrfStridedBatched
+#define hipblasSpotrfFortran hipblasSpotrf
+#define hipblasDpotrfFortran hipblasDpotrf
+#define hipblasCpotrfFortran hipblasCpotrf
+#define hipblasZpotrfFortran hipblasZpotrf
+#define hipblasSpotrfBatchedFortran hipblasSpotrfBatched
+#define hipblasDpotrfBatchedFortran hipblasDpotrfBatched
+#define hipblasCpotrfBatchedFortran hipblasCpotrfBatched
+#define hipblasZpotrfBatchedFortran hipblasZpotrfBatched
+#define hipblasSpotrfStridedBatchedFortran hipblasSpotrfStridedBatched
+#define hipblasDpotrfStridedBatchedFortran hipblasDpotrfStridedBatched
+#define hipblasCpotrfStridedBatchedFortran hipblasCpotrfStridedBatched
+#define hipblasZpotrfStridedBatchedFortran hipblasZpotrfStridedBatched
+#define hipblasSpotrsFortran hipblasSpotrs
+#define hipblasDpotrsFortran hipblasDpotrs
+#define hipblasCpotrsFortran hipblasCpotrs
+#define hipblasZpotrsFortran hipblasZpotrs
+#define hipblasSpotrsBatchedFortran hipblasSpotrsBatched
+#define hipblasDpotrsBatchedFortran hipblasDpotrsBatched
+#define hipblasCpotrsBatchedFortran hipblasCpotrsBatched
+#define hipblasZpotrsBatchedFortran hipblasZpotrsBatched
+#define hipblasSpotrsStridedBatchedFortran hipblasSpotrsStridedBatched
+#define hipblasDpotrsStridedBatchedFortran hipblasDpotrsStridedBatched
+#define hipblasCpotrsStridedBatchedFortran hipblasCpotrsStridedBatched
+#define hipblasZpotrsStridedBatchedFortran hipblasZpotrsStridedBatched
+#define hipblasSpotriFortran hipblasSpotri
+#define hipblasDpotriFortran hipblasDpotri
+#define hipblasCpotriFortran hipblasCpotri
+#define hipblasZpotriFortran hipblasZpotri
+#define hipblasSpotriBatchedFortran hipblasSpotriBatched
+#define hipblasDpotriBatchedFortran hipblasDpotriBatched
+#define hipblasCpotriBatchedFortran hipblasCpotriBatched
+#define hipblasZpotriBatchedFortran hipblasZpotriBatched
+#define hipblasSpotriStridedBatchedFortran hipblasSpotriStridedBatched
+#define hipblasDpotriStridedBatchedFortran hipblasDpotriStridedBatched
+#define hipblasCpotriStridedBatchedFortran hipblasCpotriStridedBatched
+#define hipblasZpotriStridedBatchedFortran hipblasZpotriStridedBatched
 
 #endif
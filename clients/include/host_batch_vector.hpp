@@ -120,6 +120,14 @@ public:
         return 0;
     }
 
+    //!
+    //! @brief Returns nmemb.
+    //!
+    size_t nmemb() const
+    {
+        return this->m_nmemb;
+    }
+
     //!
     //! @brief Random access to the vectors.
     //! @param batch_index the batch index.
@@ -128,6 +128,14 @@ public:
         return m_stride;
     }
 
+    //!
+    //! @brief Returns nmemb.
+    //!
+    size_t nmemb() const
+    {
+        return m_nmemb;
+    }
+
     //!
     //! @brief Returns pointer.
     //! @param batch_index The batch index.
@@ -0,0 +1,80 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "cblas_interface.h"
+#include <cstdint>
+
+//!
+//! @brief Keeps the host BLAS to the given number of threads per call while in scope.
+//!
+class ref_blas_threads
+{
+public:
+    explicit ref_blas_threads(int threads)
+        : m_previous(ref_set_blas_threads(threads))
+    {
+    }
+
+    ~ref_blas_threads()
+    {
+        if(m_previous)
+            ref_set_blas_threads(m_previous);
+    }
+
+    ref_blas_threads(const ref_blas_threads&) = delete;
+    ref_blas_threads& operator=(const ref_blas_threads&) = delete;
+
+private:
+    int m_previous;
+};
+
+//!
+//! @brief Runs the CPU reference of each problem of a batch, ref(b) for b in [0, batch_count).
+//!        The problems run in parallel on the OpenMP threads, with the host BLAS kept to one
+//!        thread per call so that the two do not oversubscribe the CPU. ref must only write
+//!        the outputs of problem b.
+//!
+template <typename F>
+void ref_batched(int64_t batch_count, F&& ref)
+{
+#ifdef _OPENMP
+    if(batch_count > 1 && omp_get_max_threads() > 1 && !omp_in_parallel())
+    {
+        ref_blas_threads single(1);
+
+#pragma omp parallel for schedule(dynamic)
+        for(int64_t b = 0; b < batch_count; b++)
+            ref(b);
+        return;
+    }
+#endif
+
+    for(int64_t b = 0; b < batch_count; b++)
+        ref(b);
+}
@@ -0,0 +1,123 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas_arguments.hpp"
+#include <cstddef>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+//
+// On-disk cache of CPU reference results.
+//
+// The inputs of a test are a function of its Arguments and of hipblas_seed, so its reference
+// outputs can be reused by later runs. The cache is off unless the environment variable
+// HIPBLAS_CLIENT_REF_CACHE names a directory; HIPBLAS_CLIENT_REF_CACHE_GB_LIMIT bounds its
+// size (default 8), the least recently used entries being removed first. The entries are keyed
+// by the Arguments, the seed and the hipBLAS version, so the directory must be cleared when the
+// host reference BLAS changes.
+//
+
+//!
+//! @brief A host output of a reference computation.
+//!
+struct ref_cache_buffer
+{
+    void*       data;
+    size_t      bytes;
+    const char* type; // typeid name of the elements
+};
+
+//!
+//! @brief Returns true if the cache is enabled.
+//!
+bool ref_cache_enabled();
+
+//!
+//! @brief Fills the outputs from the cache entry of the reference tag of the test arg.
+//! @return true on a hit, false if there is no valid entry.
+//!
+bool ref_cache_load(const Arguments&                     arg,
+                    const char*                          tag,
+                    const std::vector<ref_cache_buffer>& outputs);
+
+//!
+//! @brief Stores the outputs as the cache entry of the reference tag of the test arg.
+//!
+void ref_cache_store(const Arguments&                     arg,
+                     const char*                          tag,
+                     const std::vector<ref_cache_buffer>& outputs);
+
+template <typename T>
+ref_cache_buffer ref_cache_output(T* data, size_t nmemb)
+{
+    return {data, nmemb * sizeof(T), typeid(T).name()};
+}
+
+template <typename C, typename = void>
+constexpr bool ref_cache_has_data = false;
+
+template <typename C>
+constexpr bool ref_cache_has_data<C, std::void_t<decltype(std::declval<C&>().data())>> = true;
+
+template <typename C, typename = void>
+constexpr bool ref_cache_has_nmemb = false;
+
+template <typename C>
+constexpr bool ref_cache_has_nmemb<C, std::void_t<decltype(std::declval<C&>().nmemb())>> = true;
+
+//!
+//! @brief The output held by a host container. The batched containers hold their batches
+//!        contiguously from the first one.
+//!
+template <typename C>
+ref_cache_buffer ref_cache_output(C& x)
+{
+    if constexpr(ref_cache_has_data<C> && ref_cache_has_nmemb<C>)
+        return ref_cache_output(x.data(), x.nmemb()); // strided batched
+    else if constexpr(ref_cache_has_data<C>)
+        return ref_cache_output(x.data(), x.size()); // host_vector, host_matrix
+    else
+        return ref_cache_output(x.batch_count() ? x[0] : nullptr, x.nmemb() * x.batch_count());
+}
+
+//!
+//! @brief Runs the reference computation ref(), which writes the given host outputs, unless
+//!        the cache holds its result for the test arg. tag names the reference within the
+//!        tester.
+//!
+template <typename F>
+void ref_cached(const Arguments&                     arg,
+                const char*                          tag,
+                const std::vector<ref_cache_buffer>& outputs,
+                F&&                                  ref)
+{
+    if(!ref_cache_load(arg, tag, outputs))
+    {
+        ref();
+        ref_cache_store(arg, tag, outputs);
+    }
+}
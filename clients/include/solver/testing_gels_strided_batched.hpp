@@ -460,13 +460,12 @@ void testing_gels_strided_batched(const Arguments& arg)
         /* =====================================================================
            CPU LAPACK
         =================================================================== */
-        int            sizeW = std::max(1, std::min(M, N) + std::max(std::min(M, N), nrhs));
-        host_vector<T> hW(sizeW);
+        int sizeW = std::max(1, std::min(M, N) + std::max(std::min(M, N), nrhs));
 
-        for(int b = 0; b < batch_count; b++)
-        {
+        ref_batched(batch_count, [&](int64_t b) {
+            host_vector<T> hW(sizeW);
             info[b] = ref_gels(transc, M, N, nrhs, hA[b], lda, hB[b], ldb, hW.data(), sizeW);
-        }
+        });
 
         hipblas_error = norm_check_general<T>(
             'F', std::max(M, N), nrhs, ldb, strideB, hB.data(), hB_res.data(), batch_count);
@@ -224,12 +224,11 @@ void testing_geqrf_batched(const Arguments& arg)
         ref_geqrf(M, N, hA[0], lda, hIpiv[0], work.data(), -1);
         int lwork = type2int(work[0]);
 
-        // Perform factorization
-        work = host_vector<T>(lwork);
-        for(int b = 0; b < batch_count; b++)
-        {
-            ref_geqrf(M, N, hA[b], lda, hIpiv[b], work.data(), N);
-        }
+        // Perform factorization, with a workspace for each problem
+        ref_batched(batch_count, [&](int64_t b) {
+            host_vector<T> work_b(lwork);
+            ref_geqrf(M, N, hA[b], lda, hIpiv[b], work_b.data(), N);
+        });
 
         double e1 = norm_check_general<T>('F', M, N, lda, hA, hA1, batch_count);
         double e2 = norm_check_general<T>('F', Ipiv_size, 1, Ipiv_size, hIpiv, hIpiv1, batch_count);
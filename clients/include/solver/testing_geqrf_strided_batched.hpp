@@ -257,12 +257,11 @@ void testing_geqrf_strided_batched(const Arguments& arg)
         ref_geqrf(M, N, hA.data(), lda, hIpiv.data(), work.data(), -1);
         int lwork = type2int(work[0]);
 
-        // Perform factorization
-        work = host_vector<T>(lwork);
-        for(int b = 0; b < batch_count; b++)
-        {
-            ref_geqrf(M, N, hA[b], lda, hIpiv.data() + b * strideP, work.data(), N);
-        }
+        // Perform factorization, with a workspace for each problem
+        ref_batched(batch_count, [&](int64_t b) {
+            host_vector<T> work_b(lwork);
+            ref_geqrf(M, N, hA[b], lda, hIpiv.data() + b * strideP, work_b.data(), N);
+        });
 
         double e1     = norm_check_general<T>('F', M, N, lda, strideA, hA, hA1, batch_count);
         double e2     = norm_check_general<T>('F', K, 1, K, strideP, hIpiv, hIpiv1, batch_count);
@@ -0,0 +1,343 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "gtest/gtest.h"
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+using hipblasGesvModel = ArgumentModel<e_a_type, e_N, e_K, e_lda, e_ldb, e_ldc>;
+
+inline void testname_gesv(const Arguments& arg, std::string& name)
+{
+    hipblasGesvModel{}.test_name(arg, name);
+}
+
+// There are no Fortran or 64-bit gesv functions, so the tests call the C API directly;
+// hipblasDoubleComplex and hipDoubleComplex have the same layout. Only double (DSgesv) and
+// double complex (ZCgesv) have a mixed precision solver.
+template <typename T>
+hipblasStatus_t hipblas_gesv_call(hipblasHandle_t handle,
+                                  int             n,
+                                  int             nrhs,
+                                  T*              A,
+                                  int             lda,
+                                  int*            ipiv,
+                                  T*              B,
+                                  int             ldb,
+                                  T*              X,
+                                  int             ldx,
+                                  int*            iter,
+                                  int*            info,
+                                  int*            deviceInfo)
+{
+    using Tc = hipDoubleComplex;
+    if constexpr(std::is_same_v<T, double>)
+        return hipblasDSgesv(
+            handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, iter, info, deviceInfo);
+    else if constexpr(std::is_same_v<T, hipblasDoubleComplex>)
+        return hipblasZCgesv(
+            handle, n, nrhs, (Tc*)A, lda, ipiv, (Tc*)B, ldb, (Tc*)X, ldx, iter, info, deviceInfo);
+    else
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+template <typename T>
+void testing_gesv_bad_arg(const Arguments& arg)
+{
+    hipblasLocalHandle handle(arg);
+    const int          N    = 100;
+    const int          nrhs = 2;
+    const int          lda  = 101;
+    const int          ldb  = 102;
+    const int          ldx  = 103;
+
+    device_matrix<T>   dA(N, N, lda);
+    device_matrix<T>   dB(N, nrhs, ldb);
+    device_matrix<T>   dX(N, nrhs, ldx);
+    device_vector<int> dIpiv(N);
+    device_vector<int> dInfo(1);
+    int                iter = 0;
+    int                info = 0;
+    int                expectedInfo;
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblas_gesv_call<T>(
+            nullptr, N, nrhs, dA, lda, dIpiv, dB, ldb, dX, ldx, &iter, &info, dInfo),
+        HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblas_gesv_call<T>(
+            handle, N, nrhs, dA, lda, dIpiv, dB, ldb, dX, ldx, &iter, nullptr, dInfo),
+        HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblas_gesv_call<T>(
+            handle, -1, nrhs, dA, lda, dIpiv, dB, ldb, dX, ldx, &iter, &info, dInfo),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -1;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblas_gesv_call<T>(handle, N, -1, dA, lda, dIpiv, dB, ldb, dX, ldx, &iter, &info, dInfo),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -2;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblas_gesv_call<T>(
+            handle, N, nrhs, nullptr, lda, dIpiv, dB, ldb, dX, ldx, &iter, &info, dInfo),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -3;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblas_gesv_call<T>(
+            handle, N, nrhs, dA, N - 1, dIpiv, dB, ldb, dX, ldx, &iter, &info, dInfo),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -4;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblas_gesv_call<T>(
+            handle, N, nrhs, dA, lda, nullptr, dB, ldb, dX, ldx, &iter, &info, dInfo),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -5;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblas_gesv_call<T>(
+            handle, N, nrhs, dA, lda, dIpiv, nullptr, ldb, dX, ldx, &iter, &info, dInfo),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -6;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblas_gesv_call<T>(
+            handle, N, nrhs, dA, lda, dIpiv, dB, N - 1, dX, ldx, &iter, &info, dInfo),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -7;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblas_gesv_call<T>(
+            handle, N, nrhs, dA, lda, dIpiv, dB, ldb, nullptr, ldx, &iter, &info, dInfo),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -8;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblas_gesv_call<T>(
+            handle, N, nrhs, dA, lda, dIpiv, dB, ldb, dX, N - 1, &iter, &info, dInfo),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -9;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblas_gesv_call<T>(
+            handle, N, nrhs, dA, lda, dIpiv, dB, ldb, dX, ldx, nullptr, &info, dInfo),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -10;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblas_gesv_call<T>(
+            handle, N, nrhs, dA, lda, dIpiv, dB, ldb, dX, ldx, &iter, &info, nullptr),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -12;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    // If N == 0, A, ipiv, B and X can be nullptr, and iter and deviceInfo are still written
+    int hInfo = -1;
+    iter      = -1;
+    CHECK_HIP_ERROR(hipMemcpy(dInfo, &hInfo, sizeof(int), hipMemcpyHostToDevice));
+    EXPECT_HIPBLAS_STATUS(hipblas_gesv_call<T>(handle,
+                                               0,
+                                               nrhs,
+                                               nullptr,
+                                               lda,
+                                               nullptr,
+                                               nullptr,
+                                               ldb,
+                                               nullptr,
+                                               ldx,
+                                               &iter,
+                                               &info,
+                                               dInfo),
+                          HIPBLAS_STATUS_SUCCESS);
+    CHECK_HIP_ERROR(hipMemcpy(&hInfo, dInfo, sizeof(int), hipMemcpyDeviceToHost));
+    expectedInfo = 0;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+    unit_check_general(1, 1, 1, &expectedInfo, &iter);
+    unit_check_general(1, 1, 1, &expectedInfo, &hInfo);
+
+    // If nrhs == 0, B and X can be nullptr
+    EXPECT_HIPBLAS_STATUS(
+        hipblas_gesv_call<T>(
+            handle, N, 0, dA, lda, dIpiv, nullptr, ldb, nullptr, ldx, &iter, &info, dInfo),
+        HIPBLAS_STATUS_SUCCESS);
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+}
+
+template <typename T>
+void testing_gesv(const Arguments& arg)
+{
+    using U  = real_t<T>;
+    int N    = arg.N;
+    int nrhs = arg.K;
+    int lda  = arg.lda;
+    int ldb  = arg.ldb;
+    int ldx  = arg.ldc;
+
+    // Check to prevent memory allocation error
+    if(N < 0 || nrhs < 0 || lda < N || ldb < N || ldx < N)
+    {
+        return;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_matrix<T>   hA(N, N, lda);
+    host_matrix<T>   hA1(N, N, lda);
+    host_matrix<T>   hB(N, nrhs, ldb);
+    host_matrix<T>   hX(N, nrhs, ldx);
+    host_matrix<T>   hX1(N, nrhs, ldx);
+    host_vector<int> hIpiv(N);
+    int              iter = -100, info = -1, hInfo = -1;
+
+    device_matrix<T>   dA(N, N, lda);
+    device_matrix<T>   dB(N, nrhs, ldb);
+    device_matrix<T>   dX(N, nrhs, ldx);
+    device_vector<int> dIpiv(N);
+    device_vector<int> dInfo(1);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dX.memcheck());
+    CHECK_DEVICE_ALLOCATION(dIpiv.memcheck());
+    CHECK_DEVICE_ALLOCATION(dInfo.memcheck());
+
+    double             gpu_time_used, hipblas_error;
+    hipblasLocalHandle handle(arg);
+
+    // Initial hA, hB on CPU
+    hipblas_init_matrix(hA, arg, hipblas_client_never_set_nan, hipblas_general_matrix, true);
+    hipblas_init_matrix(hB, arg, hipblas_client_never_set_nan, hipblas_general_matrix, false, true);
+
+    T* A = (T*)hA;
+    // scale A to avoid singularities, and so that refinement converges
+    for(int i = 0; i < N; i++)
+    {
+        for(int j = 0; j < N; j++)
+        {
+            if(i == j)
+                A[i + j * lda] += 400;
+            else
+                A[i + j * lda] -= 4;
+        }
+    }
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIP_ERROR(hipMemcpy(dInfo, &hInfo, sizeof(int), hipMemcpyHostToDevice));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        // The solver switches to host pointer mode for its gemms and must restore the mode
+        hipblasPointerMode_t mode = HIPBLAS_POINTER_MODE_HOST;
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        CHECK_HIPBLAS_ERROR(hipblas_gesv_call<T>(
+            handle, N, nrhs, dA, lda, dIpiv, dB, ldb, dX, ldx, &iter, &info, dInfo));
+        CHECK_HIPBLAS_ERROR(hipblasGetPointerMode(handle, &mode));
+        int expected_mode = HIPBLAS_POINTER_MODE_DEVICE, restored_mode = mode;
+        unit_check_general(1, 1, 1, &expected_mode, &restored_mode);
+
+        // copy output from device to CPU
+        CHECK_HIP_ERROR(hX1.transfer_from(dX));
+        CHECK_HIP_ERROR(hA1.transfer_from(dA));
+        CHECK_HIP_ERROR(hipMemcpy(&hInfo, dInfo, sizeof(int), hipMemcpyDeviceToHost));
+
+        // A is only changed when refinement falls back to a double precision factorization
+        if(arg.unit_check && iter >= 0)
+            unit_check_general<T>(N, N, lda, hA.data(), hA1.data());
+
+        /* =====================================================================
+           CPU LAPACK
+        =================================================================== */
+        for(int j = 0; j < nrhs; j++)
+            for(int i = 0; i < N; i++)
+                hX.data()[i + size_t(j) * ldx] = hB.data()[i + size_t(j) * ldb];
+
+        ref_getrf<T>(N, N, hA.data(), lda, hIpiv.data());
+        ref_getrs('N', N, nrhs, hA.data(), lda, hIpiv.data(), hX.data(), ldx);
+
+        hipblas_error = norm_check_general<T>('F', N, nrhs, ldx, hX.data(), hX1.data());
+
+        // A is diagonally dominant, so refinement must converge and write deviceInfo
+        if(iter < 0)
+            hipblas_error += 1.0;
+        if(hInfo != 0)
+            hipblas_error += 1.0;
+
+        if(arg.unit_check)
+        {
+            double eps       = std::numeric_limits<U>::epsilon();
+            double tolerance = N * eps * 100;
+            int    zero      = 0;
+
+            unit_check_error(hipblas_error, tolerance);
+            unit_check_general(1, 1, 1, &zero, &info);
+        }
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int it = 0; it < runs; it++)
+        {
+            if(it == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+
+            CHECK_HIPBLAS_ERROR(hipblas_gesv_call<T>(
+                handle, N, nrhs, dA, lda, dIpiv, dB, ldb, dX, ldx, &iter, &info, dInfo));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasGesvModel{}.log_args<T>(std::cout,
+                                       arg,
+                                       gpu_time_used,
+                                       ArgumentLogging::NA_value,
+                                       ArgumentLogging::NA_value,
+                                       hipblas_error);
+    }
+}
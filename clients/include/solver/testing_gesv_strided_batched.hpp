@@ -0,0 +1,663 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "gtest/gtest.h"
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+using hipblasGesvStridedBatchedModel
+    = ArgumentModel<e_a_type, e_N, e_K, e_lda, e_ldb, e_ldc, e_stride_scale, e_batch_count>;
+
+inline void testname_gesv_strided_batched(const Arguments& arg, std::string& name)
+{
+    hipblasGesvStridedBatchedModel{}.test_name(arg, name);
+}
+
+// As hipblas_gesv_call, for the strided batched functions
+template <typename T>
+hipblasStatus_t hipblas_gesv_strided_batched_call(hipblasHandle_t handle,
+                                                  int             n,
+                                                  int             nrhs,
+                                                  T*              A,
+                                                  int             lda,
+                                                  hipblasStride   strideA,
+                                                  int*            ipiv,
+                                                  hipblasStride   strideP,
+                                                  T*              B,
+                                                  int             ldb,
+                                                  hipblasStride   strideB,
+                                                  T*              X,
+                                                  int             ldx,
+                                                  hipblasStride   strideX,
+                                                  int*            iter,
+                                                  int*            info,
+                                                  int*            deviceInfo,
+                                                  int             batch_count)
+{
+    using Tc = hipDoubleComplex;
+    // clang-format off
+    if constexpr(std::is_same_v<T, double>)
+        return hipblasDSgesvStridedBatched(handle, n, nrhs, A, lda, strideA, ipiv, strideP,
+                                           B, ldb, strideB, X, ldx, strideX,
+                                           iter, info, deviceInfo, batch_count);
+    else if constexpr(std::is_same_v<T, hipblasDoubleComplex>)
+        return hipblasZCgesvStridedBatched(handle, n, nrhs, (Tc*)A, lda, strideA, ipiv, strideP,
+                                           (Tc*)B, ldb, strideB, (Tc*)X, ldx, strideX,
+                                           iter, info, deviceInfo, batch_count);
+    else
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    // clang-format on
+}
+
+template <typename T>
+void testing_gesv_strided_batched_bad_arg(const Arguments& arg)
+{
+    hipblasLocalHandle  handle(arg);
+    const int           N           = 100;
+    const int           nrhs        = 2;
+    const int           lda         = 101;
+    const int           ldb         = 102;
+    const int           ldx         = 103;
+    const int           batch_count = 2;
+    const hipblasStride strideA     = size_t(lda) * N;
+    const hipblasStride strideP     = N;
+    const hipblasStride strideB     = size_t(ldb) * nrhs;
+    const hipblasStride strideX     = size_t(ldx) * nrhs;
+
+    device_strided_batch_matrix<T> dA(N, N, lda, strideA, batch_count);
+    device_strided_batch_matrix<T> dB(N, nrhs, ldb, strideB, batch_count);
+    device_strided_batch_matrix<T> dX(N, nrhs, ldx, strideX, batch_count);
+    device_vector<int>             dIpiv(strideP * batch_count);
+    device_vector<int>             dInfo(batch_count);
+    host_vector<int>               iter(batch_count);
+    host_vector<int>               hInfo(batch_count);
+    int                            info = 0;
+    int                            expectedInfo;
+
+    EXPECT_HIPBLAS_STATUS(hipblas_gesv_strided_batched_call<T>(handle,
+                                                               N,
+                                                               nrhs,
+                                                               dA,
+                                                               lda,
+                                                               strideA,
+                                                               dIpiv,
+                                                               strideP,
+                                                               dB,
+                                                               ldb,
+                                                               strideB,
+                                                               dX,
+                                                               ldx,
+                                                               strideX,
+                                                               iter,
+                                                               nullptr,
+                                                               dInfo,
+                                                               batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblas_gesv_strided_batched_call<T>(handle,
+                                                               -1,
+                                                               nrhs,
+                                                               dA,
+                                                               lda,
+                                                               strideA,
+                                                               dIpiv,
+                                                               strideP,
+                                                               dB,
+                                                               ldb,
+                                                               strideB,
+                                                               dX,
+                                                               ldx,
+                                                               strideX,
+                                                               iter,
+                                                               &info,
+                                                               dInfo,
+                                                               batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -1;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(hipblas_gesv_strided_batched_call<T>(handle,
+                                                               N,
+                                                               -1,
+                                                               dA,
+                                                               lda,
+                                                               strideA,
+                                                               dIpiv,
+                                                               strideP,
+                                                               dB,
+                                                               ldb,
+                                                               strideB,
+                                                               dX,
+                                                               ldx,
+                                                               strideX,
+                                                               iter,
+                                                               &info,
+                                                               dInfo,
+                                                               batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -2;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(hipblas_gesv_strided_batched_call<T>(handle,
+                                                               N,
+                                                               nrhs,
+                                                               nullptr,
+                                                               lda,
+                                                               strideA,
+                                                               dIpiv,
+                                                               strideP,
+                                                               dB,
+                                                               ldb,
+                                                               strideB,
+                                                               dX,
+                                                               ldx,
+                                                               strideX,
+                                                               iter,
+                                                               &info,
+                                                               dInfo,
+                                                               batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -3;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(hipblas_gesv_strided_batched_call<T>(handle,
+                                                               N,
+                                                               nrhs,
+                                                               dA,
+                                                               N - 1,
+                                                               strideA,
+                                                               dIpiv,
+                                                               strideP,
+                                                               dB,
+                                                               ldb,
+                                                               strideB,
+                                                               dX,
+                                                               ldx,
+                                                               strideX,
+                                                               iter,
+                                                               &info,
+                                                               dInfo,
+                                                               batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -4;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(hipblas_gesv_strided_batched_call<T>(handle,
+                                                               N,
+                                                               nrhs,
+                                                               dA,
+                                                               lda,
+                                                               strideA,
+                                                               nullptr,
+                                                               strideP,
+                                                               dB,
+                                                               ldb,
+                                                               strideB,
+                                                               dX,
+                                                               ldx,
+                                                               strideX,
+                                                               iter,
+                                                               &info,
+                                                               dInfo,
+                                                               batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -6;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(hipblas_gesv_strided_batched_call<T>(handle,
+                                                               N,
+                                                               nrhs,
+                                                               dA,
+                                                               lda,
+                                                               strideA,
+                                                               dIpiv,
+                                                               strideP,
+                                                               nullptr,
+                                                               ldb,
+                                                               strideB,
+                                                               dX,
+                                                               ldx,
+                                                               strideX,
+                                                               iter,
+                                                               &info,
+                                                               dInfo,
+                                                               batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -8;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(hipblas_gesv_strided_batched_call<T>(handle,
+                                                               N,
+                                                               nrhs,
+                                                               dA,
+                                                               lda,
+                                                               strideA,
+                                                               dIpiv,
+                                                               strideP,
+                                                               dB,
+                                                               N - 1,
+                                                               strideB,
+                                                               dX,
+                                                               ldx,
+                                                               strideX,
+                                                               iter,
+                                                               &info,
+                                                               dInfo,
+                                                               batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -9;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(hipblas_gesv_strided_batched_call<T>(handle,
+                                                               N,
+                                                               nrhs,
+                                                               dA,
+                                                               lda,
+                                                               strideA,
+                                                               dIpiv,
+                                                               strideP,
+                                                               dB,
+                                                               ldb,
+                                                               strideB,
+                                                               nullptr,
+                                                               ldx,
+                                                               strideX,
+                                                               iter,
+                                                               &info,
+                                                               dInfo,
+                                                               batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -11;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(hipblas_gesv_strided_batched_call<T>(handle,
+                                                               N,
+                                                               nrhs,
+                                                               dA,
+                                                               lda,
+                                                               strideA,
+                                                               dIpiv,
+                                                               strideP,
+                                                               dB,
+                                                               ldb,
+                                                               strideB,
+                                                               dX,
+                                                               N - 1,
+                                                               strideX,
+                                                               iter,
+                                                               &info,
+                                                               dInfo,
+                                                               batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -12;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(hipblas_gesv_strided_batched_call<T>(handle,
+                                                               N,
+                                                               nrhs,
+                                                               dA,
+                                                               lda,
+                                                               strideA,
+                                                               dIpiv,
+                                                               strideP,
+                                                               dB,
+                                                               ldb,
+                                                               strideB,
+                                                               dX,
+                                                               ldx,
+                                                               strideX,
+                                                               nullptr,
+                                                               &info,
+                                                               dInfo,
+                                                               batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -14;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(hipblas_gesv_strided_batched_call<T>(handle,
+                                                               N,
+                                                               nrhs,
+                                                               dA,
+                                                               lda,
+                                                               strideA,
+                                                               dIpiv,
+                                                               strideP,
+                                                               dB,
+                                                               ldb,
+                                                               strideB,
+                                                               dX,
+                                                               ldx,
+                                                               strideX,
+                                                               iter,
+                                                               &info,
+                                                               nullptr,
+                                                               batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -16;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(hipblas_gesv_strided_batched_call<T>(handle,
+                                                               N,
+                                                               nrhs,
+                                                               dA,
+                                                               lda,
+                                                               strideA,
+                                                               dIpiv,
+                                                               strideP,
+                                                               dB,
+                                                               ldb,
+                                                               strideB,
+                                                               dX,
+                                                               ldx,
+                                                               strideX,
+                                                               iter,
+                                                               &info,
+                                                               dInfo,
+                                                               -1),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -17;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    // If batch_count == 0, A, ipiv, B, X, iter and deviceInfo can be nullptr
+    EXPECT_HIPBLAS_STATUS(hipblas_gesv_strided_batched_call<T>(handle,
+                                                               N,
+                                                               nrhs,
+                                                               nullptr,
+                                                               lda,
+                                                               strideA,
+                                                               nullptr,
+                                                               strideP,
+                                                               nullptr,
+                                                               ldb,
+                                                               strideB,
+                                                               nullptr,
+                                                               ldx,
+                                                               strideX,
+                                                               nullptr,
+                                                               &info,
+                                                               nullptr,
+                                                               0),
+                          HIPBLAS_STATUS_SUCCESS);
+    expectedInfo = 0;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    // If N == 0, A, ipiv, B and X can be nullptr, and iter and deviceInfo are still written
+    // for every problem
+    for(int b = 0; b < batch_count; b++)
+        iter[b] = hInfo[b] = -1;
+    CHECK_HIP_ERROR(dInfo.transfer_from(hInfo));
+    EXPECT_HIPBLAS_STATUS(hipblas_gesv_strided_batched_call<T>(handle,
+                                                               0,
+                                                               nrhs,
+                                                               nullptr,
+                                                               lda,
+                                                               strideA,
+                                                               nullptr,
+                                                               strideP,
+                                                               nullptr,
+                                                               ldb,
+                                                               strideB,
+                                                               nullptr,
+                                                               ldx,
+                                                               strideX,
+                                                               iter,
+                                                               &info,
+                                                               dInfo,
+                                                               batch_count),
+                          HIPBLAS_STATUS_SUCCESS);
+    CHECK_HIP_ERROR(hInfo.transfer_from(dInfo));
+    host_vector<int> zeros(batch_count);
+    for(int b = 0; b < batch_count; b++)
+        zeros[b] = 0;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+    unit_check_general(1, batch_count, 1, zeros.data(), iter.data());
+    unit_check_general(1, batch_count, 1, zeros.data(), hInfo.data());
+
+    // If nrhs == 0, B and X can be nullptr
+    EXPECT_HIPBLAS_STATUS(hipblas_gesv_strided_batched_call<T>(handle,
+                                                               N,
+                                                               0,
+                                                               dA,
+                                                               lda,
+                                                               strideA,
+                                                               dIpiv,
+                                                               strideP,
+                                                               nullptr,
+                                                               ldb,
+                                                               strideB,
+                                                               nullptr,
+                                                               ldx,
+                                                               strideX,
+                                                               iter,
+                                                               &info,
+                                                               dInfo,
+                                                               batch_count),
+                          HIPBLAS_STATUS_SUCCESS);
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+}
+
+template <typename T>
+void testing_gesv_strided_batched(const Arguments& arg)
+{
+    using U             = real_t<T>;
+    int    N            = arg.N;
+    int    nrhs         = arg.K;
+    int    lda          = arg.lda;
+    int    ldb          = arg.ldb;
+    int    ldx          = arg.ldc;
+    double stride_scale = arg.stride_scale;
+    int    batch_count  = arg.batch_count;
+
+    hipblasStride strideA = size_t(lda) * N * stride_scale;
+    hipblasStride strideB = size_t(ldb) * nrhs * stride_scale;
+    hipblasStride strideX = size_t(ldx) * nrhs * stride_scale;
+    hipblasStride strideP = size_t(N) * stride_scale;
+
+    // Check to prevent memory allocation error
+    if(N < 0 || nrhs < 0 || lda < N || ldb < N || ldx < N || batch_count < 0)
+    {
+        return;
+    }
+    if(batch_count == 0)
+    {
+        return;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_strided_batch_matrix<T> hA(N, N, lda, strideA, batch_count);
+    host_strided_batch_matrix<T> hA1(N, N, lda, strideA, batch_count);
+    host_strided_batch_matrix<T> hB(N, nrhs, ldb, strideB, batch_count);
+    host_strided_batch_matrix<T> hX(N, nrhs, ldx, strideX, batch_count);
+    host_strided_batch_matrix<T> hX1(N, nrhs, ldx, strideX, batch_count);
+    host_vector<int>             hIpiv(strideP * batch_count);
+    host_vector<int>             iter(batch_count);
+    host_vector<int>             hInfo(batch_count);
+    int                          info = -1;
+
+    // Check host memory allocation
+    CHECK_HIP_ERROR(hA.memcheck());
+    CHECK_HIP_ERROR(hA1.memcheck());
+    CHECK_HIP_ERROR(hB.memcheck());
+    CHECK_HIP_ERROR(hX.memcheck());
+    CHECK_HIP_ERROR(hX1.memcheck());
+
+    device_strided_batch_matrix<T> dA(N, N, lda, strideA, batch_count);
+    device_strided_batch_matrix<T> dB(N, nrhs, ldb, strideB, batch_count);
+    device_strided_batch_matrix<T> dX(N, nrhs, ldx, strideX, batch_count);
+    device_vector<int>             dIpiv(strideP * batch_count);
+    device_vector<int>             dInfo(batch_count);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dX.memcheck());
+    CHECK_DEVICE_ALLOCATION(dIpiv.memcheck());
+    CHECK_DEVICE_ALLOCATION(dInfo.memcheck());
+
+    double             gpu_time_used, hipblas_error;
+    hipblasLocalHandle handle(arg);
+
+    // Initial hA, hB on CPU
+    hipblas_init_matrix(hA, arg, hipblas_client_never_set_nan, hipblas_general_matrix, true);
+    hipblas_init_matrix(hB, arg, hipblas_client_never_set_nan, hipblas_general_matrix, false, true);
+
+    // scale A to avoid singularities, and so that refinement converges
+    for(int b = 0; b < batch_count; b++)
+    {
+        for(int i = 0; i < N; i++)
+        {
+            for(int j = 0; j < N; j++)
+            {
+                if(i == j)
+                    hA[b][i + j * lda] += 400;
+                else
+                    hA[b][i + j * lda] -= 4;
+            }
+        }
+        iter[b]  = -100;
+        hInfo[b] = -1;
+    }
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIP_ERROR(dInfo.transfer_from(hInfo));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        // The solver switches to host pointer mode for its gemms and must restore the mode
+        hipblasPointerMode_t mode = HIPBLAS_POINTER_MODE_HOST;
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        CHECK_HIPBLAS_ERROR(hipblas_gesv_strided_batched_call<T>(handle,
+                                                                 N,
+                                                                 nrhs,
+                                                                 dA,
+                                                                 lda,
+                                                                 strideA,
+                                                                 dIpiv,
+                                                                 strideP,
+                                                                 dB,
+                                                                 ldb,
+                                                                 strideB,
+                                                                 dX,
+                                                                 ldx,
+                                                                 strideX,
+                                                                 iter,
+                                                                 &info,
+                                                                 dInfo,
+                                                                 batch_count));
+        CHECK_HIPBLAS_ERROR(hipblasGetPointerMode(handle, &mode));
+        int expected_mode = HIPBLAS_POINTER_MODE_DEVICE, restored_mode = mode;
+        unit_check_general(1, 1, 1, &expected_mode, &restored_mode);
+
+        // copy output from device to CPU
+        CHECK_HIP_ERROR(hX1.transfer_from(dX));
+        CHECK_HIP_ERROR(hA1.transfer_from(dA));
+        CHECK_HIP_ERROR(hInfo.transfer_from(dInfo));
+
+        // A_i is only changed when refinement falls back to a double precision factorization
+        for(int b = 0; b < batch_count; b++)
+        {
+            if(arg.unit_check && iter[b] >= 0)
+                unit_check_general<T>(N, N, lda, hA[b], hA1[b]);
+        }
+
+        /* =====================================================================
+           CPU LAPACK
+        =================================================================== */
+        ref_batched(batch_count, [&](int64_t b) {
+            for(int j = 0; j < nrhs; j++)
+                for(int i = 0; i < N; i++)
+                    hX[b][i + size_t(j) * ldx] = hB[b][i + size_t(j) * ldb];
+
+            ref_getrf<T>(N, N, hA[b], lda, hIpiv.data() + b * strideP);
+            ref_getrs('N', N, nrhs, hA[b], lda, hIpiv.data() + b * strideP, hX[b], ldx);
+        });
+
+        hipblas_error = norm_check_general<T>('F', N, nrhs, ldx, strideX, hX, hX1, batch_count);
+
+        // A is diagonally dominant, so refinement must converge and write deviceInfo
+        for(int b = 0; b < batch_count; b++)
+        {
+            if(iter[b] < 0 || hInfo[b] != 0)
+                hipblas_error += 1.0;
+        }
+
+        if(arg.unit_check)
+        {
+            double eps       = std::numeric_limits<U>::epsilon();
+            double tolerance = N * eps * 100;
+            int    zero      = 0;
+
+            unit_check_error(hipblas_error, tolerance);
+            unit_check_general(1, 1, 1, &zero, &info);
+        }
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int it = 0; it < runs; it++)
+        {
+            if(it == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+
+            CHECK_HIPBLAS_ERROR(hipblas_gesv_strided_batched_call<T>(handle,
+                                                                     N,
+                                                                     nrhs,
+                                                                     dA,
+                                                                     lda,
+                                                                     strideA,
+                                                                     dIpiv,
+                                                                     strideP,
+                                                                     dB,
+                                                                     ldb,
+                                                                     strideB,
+                                                                     dX,
+                                                                     ldx,
+                                                                     strideX,
+                                                                     iter,
+                                                                     &info,
+                                                                     dInfo,
+                                                                     batch_count));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasGesvStridedBatchedModel{}.log_args<T>(std::cout,
+                                                     arg,
+                                                     gpu_time_used,
+                                                     ArgumentLogging::NA_value,
+                                                     ArgumentLogging::NA_value,
+                                                     hipblas_error);
+    }
+}
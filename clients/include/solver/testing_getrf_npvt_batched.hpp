@@ -167,10 +167,9 @@ void testing_getrf_npvt_batched(const Arguments& arg)
         /* =====================================================================
            CPU LAPACK
         =================================================================== */
-        for(int b = 0; b < batch_count; b++)
-        {
+        ref_batched(batch_count, [&](int64_t b) {
             hInfo[b] = ref_getrf(M, N, hA[b], lda, hIpiv.data() + b * strideP);
-        }
+        });
 
         hipblas_error = norm_check_general<T>('F', M, N, lda, hA, hA1, batch_count);
         if(arg.unit_check)
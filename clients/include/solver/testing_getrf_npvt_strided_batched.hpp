@@ -169,10 +169,9 @@ void testing_getrf_npvt_strided_batched(const Arguments& arg)
         /* =====================================================================
            CPU LAPACK
         =================================================================== */
-        for(int b = 0; b < batch_count; b++)
-        {
+        ref_batched(batch_count, [&](int64_t b) {
             hInfo[b] = ref_getrf(M, N, hA[b], lda, hIpiv[b]);
-        }
+        });
 
         hipblas_error = norm_check_general<T>('F', M, N, lda, strideA, hA, hA1, batch_count);
 
@@ -190,8 +190,7 @@ void testing_getri_batched(const Arguments& arg)
     // Initial hA on CPU
     hipblas_init_matrix(hA, arg, hipblas_client_never_set_nan, hipblas_general_matrix, true);
 
-    for(int b = 0; b < batch_count; b++)
-    {
+    ref_batched(batch_count, [&](int64_t b) {
         // scale A to avoid singularities
         for(int i = 0; i < M; i++)
         {
@@ -207,7 +206,7 @@ void testing_getri_batched(const Arguments& arg)
         // perform LU factorization on A
         int* hIpivb = hIpiv.data() + b * strideP;
         hInfo[b]    = ref_getrf(M, N, hA[b], lda, hIpivb);
-    }
+    });
 
     CHECK_HIP_ERROR(dA.transfer_from(hA));
     CHECK_HIP_ERROR(dC.transfer_from(hC));
@@ -239,8 +238,7 @@ void testing_getri_batched(const Arguments& arg)
         /* =====================================================================
            CPU LAPACK
         =================================================================== */
-        for(int b = 0; b < batch_count; b++)
-        {
+        ref_batched(batch_count, [&](int64_t b) {
             // Workspace query
             host_vector<T> work(1);
             ref_getri(N, hA[b], lda, hIpiv.data() + b * strideP, work.data(), -1);
@@ -249,7 +247,10 @@ void testing_getri_batched(const Arguments& arg)
             // Perform inversion
             work     = host_vector<T>(lwork);
             hInfo[b] = ref_getri(N, hA[b], lda, hIpiv.data() + b * strideP, work.data(), lwork);
+        });
 
+        for(int b = 0; b < batch_count; b++)
+        {
             hipblas_error = norm_check_general<T>('F', M, N, lda, hA[b], hA1[b]);
             if(arg.unit_check)
             {
@@ -182,8 +182,7 @@ void testing_getri_npvt_batched(const Arguments& arg)
     // Initial hA on CPU
     hipblas_init_matrix(hA, arg, hipblas_client_never_set_nan, hipblas_general_matrix, true);
 
-    for(int b = 0; b < batch_count; b++)
-    {
+    ref_batched(batch_count, [&](int64_t b) {
         // scale A to avoid singularities
         for(int i = 0; i < M; i++)
         {
@@ -199,7 +198,7 @@ void testing_getri_npvt_batched(const Arguments& arg)
         // perform LU factorization on A
         int* hIpivb = hIpiv.data() + b * strideP;
         hInfo[b]    = ref_getrf(M, N, hA[b], lda, hIpivb);
-    }
+    });
 
     CHECK_HIP_ERROR(dA.transfer_from(hA));
     CHECK_HIP_ERROR(dC.transfer_from(hC));
@@ -228,8 +227,7 @@ void testing_getri_npvt_batched(const Arguments& arg)
         /* =====================================================================
            CPU LAPACK
         =================================================================== */
-        for(int b = 0; b < batch_count; b++)
-        {
+        ref_batched(batch_count, [&](int64_t b) {
             // Workspace query
             host_vector<T> work(1);
             ref_getri(N, hA[b], lda, hIpiv.data() + b * strideP, work.data(), -1);
@@ -238,7 +236,7 @@ void testing_getri_npvt_batched(const Arguments& arg)
             // Perform inversion
             work     = host_vector<T>(lwork);
             hInfo[b] = ref_getri(N, hA[b], lda, hIpiv.data() + b * strideP, work.data(), lwork);
-        }
+        });
 
         hipblas_error = norm_check_general<T>('F', M, N, lda, hA, hA1, batch_count);
         if(arg.unit_check)
@@ -289,10 +289,9 @@ void testing_getrs_batched(const Arguments& arg)
            CPU LAPACK
         =================================================================== */
 
-        for(int b = 0; b < batch_count; b++)
-        {
+        ref_batched(batch_count, [&](int64_t b) {
             ref_getrs('N', N, 1, hA[b], lda, hIpiv.data() + b * strideP, hB[b], ldb);
-        }
+        });
 
         hipblas_error = norm_check_general<T>('F', N, 1, ldb, hB, hB1, batch_count);
         if(arg.unit_check)
@@ -1,5 +1,5 @@
 /* ************************************************************************
- * Copyright (C) 2016-2023 Advanced Micro Devices, Inc. All rights reserved.
+ * Copyright (C) 2016-2024 Advanced Micro Devices, Inc. All rights reserved.
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -23,37 +23,129 @@
 
 #pragma once
 
-#include <fstream>
+#include <algorithm>
 #include <iostream>
-#include <stdlib.h>
+#include <utility>
 #include <vector>
 
-#include "testing_common.hpp"
+#include "cblas_interface.h"
+#include "ref_batched.hpp"
+
+// Order of the square tiles the blocked reference computes the triangle of C in
+constexpr int64_t syrkx_reference_nb = 128;
+
+// C = alpha * op(A) * op(B)^T + beta * C on the uplo triangle of the n x n matrix C, or
+// with op(B)^H when CONJ, which is herkx. Off-diagonal tiles of C are computed with
+// ref_gemm and diagonal tiles with a small kernel; the tiles run in parallel.
+template <bool CONJ, typename T, typename U>
+void syrkx_reference_blocked(hipblasFillMode_t  uplo,
+                             hipblasOperation_t trans,
+                             int64_t            n,
+                             int64_t            k,
+                             T                  alpha,
+                             T*                 a,
+                             int64_t            lda,
+                             T*                 b,
+                             int64_t            ldb,
+                             U                  beta,
+                             T*                 c,
+                             int64_t            ldc)
+{
+    if(n <= 0 || (beta == 1 && (k == 0 || alpha == T(0))))
+        return;
+
+    bool lower = uplo == HIPBLAS_FILL_MODE_LOWER;
+    bool notr  = trans == HIPBLAS_OP_N;
+
+    // op(A)(i, l) and op(B)(j, l), conjugated for herkx when it is the conjugated operand
+    auto opA = [&](int64_t i, int64_t l) {
+        if(notr)
+            return a[i + l * lda];
+        if constexpr(CONJ)
+            return std::conj(a[l + i * lda]);
+        return a[l + i * lda];
+    };
+    auto opB = [&](int64_t j, int64_t l) {
+        if(!notr)
+            return b[l + j * ldb];
+        if constexpr(CONJ)
+            return std::conj(b[j + l * ldb]);
+        return b[j + l * ldb];
+    };
+
+    // Tiles (I, J) of the triangle, I being the tile row
+    const int64_t                             nb = syrkx_reference_nb;
+    std::vector<std::pair<int64_t, int64_t>> tiles;
+    for(int64_t J = 0; J < n; J += nb)
+        for(int64_t I = lower ? J : 0; I < (lower ? n : J + 1); I += nb)
+            tiles.emplace_back(I, J);
+
+    auto tile = [&](int64_t t) {
+        int64_t I = tiles[t].first, J = tiles[t].second;
+        int64_t mb = std::min(nb, n - I), jb = std::min(nb, n - J);
+
+        if(I != J)
+        {
+            hipblasOperation_t transA = notr ? HIPBLAS_OP_N : trans;
+            hipblasOperation_t transB
+                = notr ? (CONJ ? HIPBLAS_OP_C : HIPBLAS_OP_T) : HIPBLAS_OP_N;
+            ref_gemm<T>(transA,
+                        transB,
+                        mb,
+                        jb,
+                        k,
+                        alpha,
+                        notr ? a + I : a + I * lda,
+                        lda,
+                        notr ? b + J : b + J * ldb,
+                        ldb,
+                        T(beta),
+                        c + I + J * ldc,
+                        ldc);
+            return;
+        }
+
+        // C is not read where beta is zero, matching BLAS semantics
+        for(int64_t j = J; j < J + jb; j++)
+        {
+            int64_t i_begin = lower ? j : I, i_end = lower ? I + mb : j + 1;
+            for(int64_t i = i_begin; i < i_end; i++)
+            {
+                T sum = 0;
+                if(alpha != T(0))
+                    for(int64_t l = 0; l < k; l++)
+                        sum += opA(i, l) * opB(j, l);
+
+                T& cij = c[i + j * ldc];
+                cij    = beta == 0 ? alpha * sum : T(beta) * cij + alpha * sum;
+            }
+
+            if constexpr(CONJ)
+                c[j + j * ldc].imag(0);
+        }
+    };
+
+    // The tiles are independent problems, run like the problems of a batch
+    ref_batched(tiles.size(), tile);
+}
 
 // reference implementation of syrkx. This function is not part of legacy BLAS.
 template <typename T>
 void syrkx_reference(hipblasFillMode_t  uplo,
                      hipblasOperation_t trans,
-                     int                n,
-                     int                k,
+                     int64_t            n,
+                     int64_t            k,
                      T                  alpha,
                      T*                 a,
-                     int                lda,
+                     int64_t            lda,
                      T*                 b,
-                     int                ldb,
+                     int64_t            ldb,
                      T                  beta,
                      T*                 c,
-                     int                ldc)
+                     int64_t            ldc)
 {
-    int a_s1 = HIPBLAS_OP_N == trans ? 1 : lda;
-    int a_s2 = HIPBLAS_OP_N == trans ? lda : 1;
-    int b_s1 = HIPBLAS_OP_N == trans ? 1 : ldb;
-    int b_s2 = HIPBLAS_OP_N == trans ? ldb : 1;
-    int c_s1 = 1;
-    int c_s2 = ldc;
-
     // argument error
-    int nrow = trans == HIPBLAS_OP_N ? n : k;
+    int64_t nrow = trans == HIPBLAS_OP_N ? n : k;
     if(n < 0)
     {
         std::cout << "ERROR: syrkx_reference n < 0" << std::endl;
@@ -80,35 +172,5 @@ void syrkx_reference(hipblasFillMode_t  uplo,
         return;
     }
 
-    // quick return
-    if((n == 0) || (((alpha == 0) || (k == 0)) && (beta == 1)))
-        return;
-
-    // rank kx update with special cases for alpha == 0, beta == 0
-    for(int i1 = 0; i1 < n; i1++)
-    {
-        int i2_start = HIPBLAS_FILL_MODE_LOWER == uplo ? 0 : i1;
-        int i2_end   = HIPBLAS_FILL_MODE_LOWER == uplo ? i1 + 1 : n;
-        for(int i2 = i2_start; i2 < i2_end; i2++)
-        {
-            if(alpha == 0 && beta == 0)
-            {
-                c[i1 * c_s1 + i2 * c_s2] = 0.0;
-            }
-            else if(alpha == 0)
-            {
-                c[i1 * c_s1 + i2 * c_s2] *= beta;
-            }
-            else
-            {
-                T t = 0;
-                for(int i3 = 0; i3 < k; i3++)
-                {
-                    t += a[i1 * a_s1 + i3 * a_s2] * b[i2 * b_s1 + i3 * b_s2];
-                }
-                c[i1 * c_s1 + i2 * c_s2] = beta * c[i1 * c_s1 + i2 * c_s2] + alpha * t;
-            }
-        }
-    }
-    return;
+    syrkx_reference_blocked<false>(uplo, trans, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
@@ -54,6 +54,8 @@
 #include "host_vector.hpp"
 #include "near.h"
 #include "norm.h"
+#include "ref_batched.hpp"
+#include "ref_cache.hpp"
 #include "testing_macros.hpp"
 #include "unit.h"
 #include "utility.h"
@@ -556,6 +556,29 @@ public:
     }
 };
 
+/* ============================================================================================ */
+/*! \brief  local hipblasXt context on all devices which is automatically created and destroyed.
+ *          The default block dimension is small so that the test sizes span several blocks.  */
+class hipblasLocalXtHandle
+{
+    hipblasXtHandle_t m_handle;
+
+public:
+    explicit hipblasLocalXtHandle(int block_dim = 64);
+
+    ~hipblasLocalXtHandle();
+
+    hipblasLocalXtHandle(const hipblasLocalXtHandle&) = delete;
+    hipblasLocalXtHandle(hipblasLocalXtHandle&&)      = delete;
+    hipblasLocalXtHandle& operator=(const hipblasLocalXtHandle&) = delete;
+    hipblasLocalXtHandle& operator=(hipblasLocalXtHandle&&) = delete;
+
+    operator hipblasXtHandle_t() const
+    {
+        return m_handle;
+    }
+};
+
 hipblasStatus_t hipblas_internal_convert_hip_to_hipblas_status(hipError_t status);
 
 hipblasStatus_t hipblas_internal_convert_hip_to_hipblas_status_and_log(hipError_t status);
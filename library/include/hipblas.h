@@ -99,6 +99,26 @@
 /*! \brief hipblasHanlde_t is a void pointer, to store the library context (either rocBLAS or cuBLAS)*/
 typedef void* hipblasHandle_t;
 
+/*! \brief hipblasXtHandle_t stores the device list and resources of the hipblasXt functions */
+typedef struct hipblasXtContext* hipblasXtHandle_t;
+
+/*! \brief hipblasGraph_t stores a sequence of hipBLAS calls recorded by hipblasBeginCapture and
+ *         hipblasEndCapture */
+typedef struct hipblasGraph* hipblasGraph_t;
+
+/*! \brief hipblasHandlePool_t stores the handles and workspaces of a pool of handles shared by
+ *         threads */
+typedef struct hipblasHandlePoolContext* hipblasHandlePool_t;
+
+/*! \brief hipblasPackedMatrix_t stores a matrix packed by hipblasMatrixPack for
+ *         hipblasGemmPackedEx */
+typedef struct hipblasPackedMatrix* hipblasPackedMatrix_t;
+
+/*! \brief Progress callback of the out-of-core gemm functions, called with the number of tiles
+ *         of C done, the number of tiles and the user data given to
+ *         hipblasSetOutOfCoreProgressCallback */
+typedef void (*hipblasOutOfCoreProgress_t)(int64_t tilesDone, int64_t tilesTotal, void* userData);
+
 /*! \brief To specify the datatype to be unsigned short */
 
 #if __cplusplus < 201103L || !defined(HIPBLAS_USE_HIP_HALF)
@@ -602,6 +622,83 @@ typedef enum
     = 0x10 /**< enumerator rocblas_gemm_flags_fp16_alt_impl_rnz */
 } hipblasGemmFlags_t;
 
+/*! \brief Activation applied by the epilogue of hipblasGemmExWithEpilogue */
+typedef enum
+{
+    HIPBLAS_EPILOGUE_ACTIVATION_NONE = 0, /**< No activation */
+    HIPBLAS_EPILOGUE_ACTIVATION_RELU = 1, /**< max(x, 0) */
+    HIPBLAS_EPILOGUE_ACTIVATION_GELU
+    = 2 /**< 0.5 x (1 + tanh(sqrt(2 / pi) (x + 0.044715 x^3))), the tanh approximation of GELU */
+} hipblasEpilogueActivation_t;
+
+/*! \brief Operations fused after the product of hipblasGemmExWithEpilogue. All pointers are
+ *         device pointers and may be nullptr. */
+typedef struct
+{
+    /** m values of the type of C, added to every column of the result */
+    const void* bias;
+    /** activation applied last */
+    hipblasEpilogueActivation_t activation;
+    /** m x n matrix of the type of C, set to the result before the activation */
+    void* aux;
+    /** leading dimension of aux */
+    int ldaux;
+    /** n values of alpha, one per column of C, used in place of alpha */
+    const void* alphaVector;
+    /** n values of beta, one per column of C, used in place of beta */
+    const void* betaVector;
+} hipblasEpilogue_t;
+
+/*! \brief 8-bit floating point types of the scaled gemm functions. The values are those of
+ *         hipDataType in the HIP releases that define them: E4M3 and E5M2 are the OCP formats,
+ *         and the FNUZ formats have no negative zero and no infinity, with NaN encoded as 0x80. */
+#define HIPBLAS_R_8F_E4M3 ((hipDataType)28)
+#define HIPBLAS_R_8F_E5M2 ((hipDataType)29)
+#define HIPBLAS_R_8F_E4M3_FNUZ ((hipDataType)1000)
+#define HIPBLAS_R_8F_E5M2_FNUZ ((hipDataType)1001)
+
+/*! \brief How the scale of an operand of the scaled gemm functions is applied */
+typedef enum
+{
+    HIPBLAS_GEMM_SCALE_TENSOR = 0, /**< one float scale for the whole matrix */
+    HIPBLAS_GEMM_SCALE_VECTOR
+    = 1 /**< one float scale per row of op( A ), or per column of op( B ) */
+} hipblasGemmScaleMode_t;
+
+/*! \brief Statistics kept by a handle, set with hipblasSetStatsMode */
+typedef enum
+{
+    HIPBLAS_STATS_MODE_OFF = 0, /**< No statistics are kept, the default */
+    HIPBLAS_STATS_MODE_COUNT
+    = 1, /**< Calls, floating point operations and bytes are counted per routine family */
+    HIPBLAS_STATS_MODE_TIMED
+    = 2 /**< As HIPBLAS_STATS_MODE_COUNT, and device time is measured with events */
+} hipblasStatsMode_t;
+
+/*! \brief Statistics of one routine family, as returned by hipblasGetStats */
+typedef struct
+{
+    /** name of the family, the hipblas-bench function without its _batched, _strided_batched
+        and _ex suffixes, e.g. "gemm" for hipblasSgemmStridedBatched and hipblasGemmEx */
+    const char* routine;
+    /** number of calls */
+    uint64_t calls;
+    /** floating point operations of the calls, as counted by hipblas-bench */
+    double flops;
+    /** bytes of device memory read and written by the calls, as counted by hipblas-bench */
+    double bytes;
+    /** device time of the calls made in HIPBLAS_STATS_MODE_TIMED, in seconds */
+    double deviceSeconds;
+} hipblasRoutineStats_t;
+
+/*! \brief Prefetching of the operands in managed memory, set with hipblasSetPrefetchMode */
+typedef enum
+{
+    HIPBLAS_PREFETCH_MODE_OFF = 0, /**< Operands are not prefetched, the default */
+    HIPBLAS_PREFETCH_MODE_MANAGED
+    = 1 /**< Operands in managed memory are prefetched to the device before the call */
+} hipblasPrefetchMode_t;
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -850,6 +947,428 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSetAtomicsMode(hipblasHandle_t      handle
 HIPBLAS_EXPORT hipblasStatus_t hipblasGetAtomicsMode(hipblasHandle_t       handle,
                                                      hipblasAtomicsMode_t* atomics_mode);
 
+/*! \brief Get workspace cache statistics
+    \details
+    With the rocBLAS backend, routines that need device workspace (trsv, trsm, trtri and the
+    solver functions) remember the workspace size required per routine and shape bucket, and
+    grow the workspace of the handle before the call when a known shape is seen again. A hit is
+    a call whose shape was known; a miss is a call with a new shape, which may need to be re-run
+    to query the workspace size. With the cuBLAS backend both counters are always 0.
+    @param[in]
+    handle      [hipblasHandle_t]
+                handle to the hipblas library context queue.
+    @param[out]
+    hits        number of calls whose workspace size was already known
+    @param[out]
+    misses      number of calls with a shape not seen before on this handle
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetWorkspaceCacheStats(hipblasHandle_t handle,
+                                                             uint64_t*       hits,
+                                                             uint64_t*       misses);
+
+/*! \brief Set a device workspace owned by the caller
+    \details
+    Gives the handle a workspace of workspaceSizeInBytes bytes of device memory, after which no
+    hipBLAS call on the handle allocates device memory, so that calls can be captured in a graph
+    and do not wait on the allocator. The backend uses the workspace in its user-managed memory
+    mode (rocblas_set_workspace or cublasSetWorkspace), the memory hipBLAS needs for itself, such as
+    the buffers of the routines it emulates, is taken from the end of the workspace, and a call
+    which needs more than the workspace holds fails with HIPBLAS_STATUS_ALLOC_FAILED. With the
+    rocBLAS backend the workspace is never grown, and gemm tuning (HIPBLAS_GEMM_TUNING), which
+    allocates its own output buffer, only uses the solutions already tuned. The out-of-core gemm
+    functions place their tiles in at most half of the workspace.
+
+    The sizes needed are returned by the hipblasGetWorkspaceSizeFor functions; the workspace must
+    hold the largest size of the calls made on the handle. It must stay allocated until the
+    handle is destroyed or given another workspace, and must not be used by other work meanwhile.
+    It stays in effect when the stream of the handle is changed with hipblasSetStream. Setting
+    nullptr with 0 bytes returns the handle to the memory managed by the backend; with cuBLAS,
+    routines then run without a workspace.
+    @param[in]
+    handle      [hipblasHandle_t]
+                handle to the hipblas library context queue.
+    @param[in]
+    workspace   device memory aligned to 256 bytes, or nullptr.
+    @param[in]
+    workspaceSizeInBytes
+                size of workspace in bytes, 0 if workspace is nullptr.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetWorkspace(hipblasHandle_t handle,
+                                                   void*           workspace,
+                                                   size_t          workspaceSizeInBytes);
+
+/*! @{
+    \brief Workspace size queries
+    \details
+    Return the size in bytes of the workspace the routine needs with the given sizes and types,
+    to size the memory given to hipblasSetWorkspace. The types follow hipblasGemmEx with the
+    HIPBLAS_V2 interface, and type is one of HIP_R_32F, HIP_R_64F, HIP_C_32F and HIP_C_64F.
+
+    With the rocBLAS backend the size is queried from rocBLAS or rocSOLVER, which run the
+    argument checks of the routine without launching it. cuBLAS has no such queries, so with it
+    the size returned is the workspace its documentation recommends: 32 MiB on devices of
+    compute capability 9.0 and above and 4 MiB on others. getrf is not supported with cuBLAS.
+    @param[in]
+    handle      [hipblasHandle_t]
+                handle to the hipblas library context queue.
+    @param[out]
+    workspaceSizeInBytes
+                size of the workspace needed in bytes.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasGetWorkspaceSizeForGemmEx(hipblasHandle_t      handle,
+                                     hipblasOperation_t   transa,
+                                     hipblasOperation_t   transb,
+                                     int                  m,
+                                     int                  n,
+                                     int                  k,
+                                     hipDataType          aType,
+                                     int                  lda,
+                                     hipDataType          bType,
+                                     int                  ldb,
+                                     hipDataType          cType,
+                                     int                  ldc,
+                                     hipblasComputeType_t computeType,
+                                     hipblasGemmAlgo_t    algo,
+                                     size_t*              workspaceSizeInBytes);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasGetWorkspaceSizeForGemmStridedBatchedEx(hipblasHandle_t      handle,
+                                                   hipblasOperation_t   transa,
+                                                   hipblasOperation_t   transb,
+                                                   int                  m,
+                                                   int                  n,
+                                                   int                  k,
+                                                   hipDataType          aType,
+                                                   int                  lda,
+                                                   hipDataType          bType,
+                                                   int                  ldb,
+                                                   hipDataType          cType,
+                                                   int                  ldc,
+                                                   int                  batchCount,
+                                                   hipblasComputeType_t computeType,
+                                                   hipblasGemmAlgo_t    algo,
+                                                   size_t*              workspaceSizeInBytes);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasGetWorkspaceSizeForTrsm(hipblasHandle_t    handle,
+                                   hipblasSideMode_t  side,
+                                   hipblasFillMode_t  uplo,
+                                   hipblasOperation_t transA,
+                                   hipblasDiagType_t  diag,
+                                   int                m,
+                                   int                n,
+                                   hipDataType        type,
+                                   int                lda,
+                                   int                ldb,
+                                   size_t*            workspaceSizeInBytes);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetWorkspaceSizeForGetrf(
+    hipblasHandle_t handle, int n, hipDataType type, int lda, size_t* workspaceSizeInBytes);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasGetWorkspaceSizeForPotrf(hipblasHandle_t   handle,
+                                    hipblasFillMode_t uplo,
+                                    int               n,
+                                    hipDataType       type,
+                                    int               lda,
+                                    size_t*           workspaceSizeInBytes);
+//! @}
+
+/*! \brief Begin recording the hipBLAS calls made on a handle
+    \details
+    Until hipblasEndCapture, the calls made on handle to the routines that can be recorded are
+    recorded instead of run: axpy, scal, copy, gemv, gemm and gemmStridedBatched in their S, D, C
+    and Z forms. The arguments are recorded as given. Scalars given in host pointer mode are copied,
+    and pointers to scalars in device pointer mode are kept, so that the device pointer mode is used
+    for every scalar when the graph is launched.
+
+    During the capture the handle's stream is a stream in HIP capture mode, which
+    hipblasGetStream returns; calls to routines that are not recorded are not run, and make
+    hipblasEndCapture fail.
+    @param[in]
+    handle      [hipblasHandle_t]
+                handle to the hipblas library context queue.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasBeginCapture(hipblasHandle_t handle);
+
+/*! \brief End recording the hipBLAS calls made on a handle
+    \details
+    Returns the calls recorded since hipblasBeginCapture in a graph, and gives the handle back its
+    stream. If a routine that cannot be recorded was called during the capture,
+    HIPBLAS_STATUS_NOT_SUPPORTED is returned and no graph is made.
+    @param[in]
+    handle      [hipblasHandle_t]
+                handle to the hipblas library context queue.
+    @param[out]
+    graph       the recorded calls, to be destroyed with hipblasGraphDestroy.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasEndCapture(hipblasHandle_t handle, hipblasGraph_t* graph);
+
+/*! \brief Run the calls of a graph
+    \details
+    Runs the recorded calls in order on the stream of handle, which may be another handle than the
+    one they were recorded on, in device pointer mode. The pointer mode of handle is restored
+    afterwards.
+
+    The calls are themselves captured into a HIP graph, which is launched; it is kept for the next
+    launch on the same handle and stream, and updated after hipblasGraphUpdatePointer. So that the
+    HIP graph holds no allocation, handle should have a workspace set with hipblasSetWorkspace. If
+    the calls cannot be captured, for instance on the null stream, they are run directly.
+    @param[in]
+    graph       [hipblasGraph_t]
+                graph made by hipblasEndCapture.
+    @param[in]
+    handle      [hipblasHandle_t]
+                handle to the hipblas library context queue, which must not be capturing.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGraphLaunch(hipblasGraph_t graph, hipblasHandle_t handle);
+
+/*! \brief Replace a pointer argument of the calls of a graph
+    \details
+    Every argument of the recorded calls equal to oldPointer, a vector, matrix or array of pointers
+    or a scalar recorded in device pointer mode, is given newPointer instead.
+    HIPBLAS_STATUS_INVALID_VALUE is returned if there is none.
+    @param[in]
+    graph       [hipblasGraph_t]
+                graph made by hipblasEndCapture.
+    @param[in]
+    oldPointer  pointer given to the calls.
+    @param[in]
+    newPointer  pointer to give instead.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGraphUpdatePointer(hipblasGraph_t graph,
+                                                         const void*    oldPointer,
+                                                         const void*    newPointer);
+
+/*! \brief Set a scalar argument of a call of a graph
+    \details
+    Sets a scalar which was recorded in host pointer mode; value points to a host value of the type
+    of the scalar. HIPBLAS_STATUS_INVALID_VALUE is returned if the call has no such scalar, or if it
+    was recorded in device pointer mode, in which case the device memory it points to can be set
+    instead.
+    @param[in]
+    graph       [hipblasGraph_t]
+                graph made by hipblasEndCapture.
+    @param[in]
+    node        index of the call, in the order they were recorded.
+    @param[in]
+    scalar      0 for alpha, 1 for beta.
+    @param[in]
+    value       host pointer to the new value.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGraphUpdateScalar(hipblasGraph_t graph,
+                                                        int            node,
+                                                        int            scalar,
+                                                        const void*    value);
+
+/*! \brief Get the number of calls of a graph
+    @param[in]
+    graph       [hipblasGraph_t]
+                graph made by hipblasEndCapture.
+    @param[out]
+    count       number of calls recorded.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGraphGetNodeCount(hipblasGraph_t graph, int* count);
+
+/*! \brief Destroy a graph made by hipblasEndCapture
+    @param[in]
+    graph       [hipblasGraph_t]
+                graph made by hipblasEndCapture.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGraphDestroy(hipblasGraph_t graph);
+
+/*! \brief Get staging engine statistics
+    \details
+    hipblasSetMatrix, hipblasGetMatrix, hipblasSetVector, hipblasGetVector and their Async
+    variants copy large transfers to or from pageable host memory through a process-wide pool of
+    pinned buffers: the strided columns are packed on the host into pinned chunks by several
+    threads, and the packing of one chunk overlaps the DMA of the previous one. Transfers smaller
+    than HIPBLAS_STAGING_THRESHOLD bytes (default 1 MiB) and transfers from pinned or device memory
+    are done by the backend. An Async get to pageable memory returns once the data is in host
+    memory. The engine is disabled with HIPBLAS_STAGING=0; HIPBLAS_STAGING_CHUNK_SIZE and
+    HIPBLAS_STAGING_THREADS set the chunk size in bytes and the number of packing threads.
+    @param[out]
+    copies      number of transfers done by the staging engine
+    @param[out]
+    bytes       number of bytes in those transfers
+    @param[out]
+    gigabytesPerSecond
+                achieved throughput in GB/s of the transfers that completed before returning,
+                which are all of them except Async sets, or 0 if there were none
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetStagingStats(uint64_t* copies,
+                                                      uint64_t* bytes,
+                                                      double*   gigabytesPerSecond);
+
+/*! \brief Reset the staging engine statistics reported by hipblasGetStagingStats */
+HIPBLAS_EXPORT hipblasStatus_t hipblasResetStagingStats(void);
+
+/*! \brief Create a pool of handles
+    \details
+    A pool lends handles to threads with hipblasHandlePoolAcquire, so that threads which each run
+    requests do not share one handle or create their own. Handles are created when first needed
+    for a thread, device and stream, and a thread which acquires a handle again on the same device
+    and stream is given the same handle back when it is idle. At most maxHandlesPerDevice handles
+    are created per device; past that an idle handle of the device is given to the new thread and
+    stream, and when none is idle hipblasHandlePoolAcquire waits for one to be released.
+
+    With workspaceSizeInBytes greater than 0, the handles lent are given a workspace of that size
+    with hipblasSetWorkspace. Workspaces are held by handles only while they are acquired, so a
+    device has no more workspaces than handles acquired at once; a workspace used on another
+    stream is waited for on the stream of the next handle it is given to. With 0 the handles use
+    the memory managed by the backend.
+    @param[out]
+    pool        pointer to the new pool.
+    @param[in]
+    maxHandlesPerDevice
+                maximum number of handles created per device, greater than 0.
+    @param[in]
+    workspaceSizeInBytes
+                size of the workspace given to each handle acquired, or 0.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasHandlePoolCreate(hipblasHandlePool_t* pool,
+                                                       int                  maxHandlesPerDevice,
+                                                       size_t               workspaceSizeInBytes);
+
+/*! \brief Destroy a pool of handles and its handles and workspaces
+    \details
+    HIPBLAS_STATUS_INVALID_VALUE is returned, and the pool is kept, if a handle is acquired.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasHandlePoolDestroy(hipblasHandlePool_t pool);
+
+/*! \brief Acquire a handle of a pool
+    \details
+    Returns a handle of the current device, set to stream and to host pointer mode, for the
+    calling thread only until it is given back with hipblasHandlePoolRelease. The handle must not
+    be destroyed, and must not be given another workspace when the pool has workspaces.
+    @param[in]
+    pool        [hipblasHandlePool_t]
+                pool of handles.
+    @param[in]
+    stream      stream the handle runs on.
+    @param[out]
+    handle      the handle acquired.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasHandlePoolAcquire(hipblasHandlePool_t pool,
+                                                        hipStream_t         stream,
+                                                        hipblasHandle_t*    handle);
+
+/*! \brief Give back a handle acquired from a pool
+    \details
+    The work queued on the handle may still be running; the handle can be released without
+    synchronizing its stream.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasHandlePoolRelease(hipblasHandlePool_t pool,
+                                                        hipblasHandle_t     handle);
+
+/*! \brief Get statistics of a pool of handles, to choose its size
+    @param[in]
+    pool        [hipblasHandlePool_t]
+                pool of handles.
+    @param[out]
+    handlesCreated
+                number of handles created.
+    @param[out]
+    acquires    number of handles acquired.
+    @param[out]
+    waits       number of acquires which waited for a handle to be released.
+    @param[out]
+    waitSeconds total time in seconds spent waiting.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasHandlePoolGetStats(hipblasHandlePool_t pool,
+                                                         uint64_t*           handlesCreated,
+                                                         uint64_t*           acquires,
+                                                         uint64_t*           waits,
+                                                         double*             waitSeconds);
+
+/*! \brief Set the statistics kept by a handle
+    \details
+    With statistics on, every call made on the handle is counted under its routine family, with
+    the floating point operations and bytes hipblas-bench reports for it. Routines implemented on
+    top of other hipBLAS routines are counted as the routines they call, and routines without a
+    size, such as rotg, count calls only. Counters are atomic and spread over several cache
+    lines, so threads sharing a handle do not wait for each other.
+
+    In HIPBLAS_STATS_MODE_TIMED an event is recorded on the stream of the handle before and after
+    each call, and the time between them is added when the events complete. Calls made while the
+    stream is being captured are not timed. Turning statistics off keeps the counts.
+    @param[in]
+    handle      [hipblasHandle_t]
+                handle to the hipblas library context queue.
+    @param[in]
+    mode        [hipblasStatsMode_t]
+                statistics to keep.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetStatsMode(hipblasHandle_t handle, hipblasStatsMode_t mode);
+
+/*! \brief Get the statistics kept by a handle, set with hipblasSetStatsMode */
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetStatsMode(hipblasHandle_t     handle,
+                                                   hipblasStatsMode_t* mode);
+
+/*! \brief Get the statistics of a handle per routine family
+    \details
+    Returns the families called since statistics were turned on or reset, sorted by name. With
+    handle nullptr the statistics are those of every handle of the process that has kept
+    statistics, including destroyed handles. In HIPBLAS_STATS_MODE_TIMED the function waits for
+    the timed calls that have not completed.
+    @param[in]
+    handle      [hipblasHandle_t]
+                handle to the hipblas library context queue, or nullptr.
+    @param[out]
+    stats       array of *count entries, or nullptr to query the number of families.
+    @param[inout]
+    count       on input the size of stats, on output the number of families. When stats is
+                smaller than that, the first families are returned and HIPBLAS_STATUS_INVALID_VALUE
+                is returned.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetStats(hipblasHandle_t        handle,
+                                               hipblasRoutineStats_t* stats,
+                                               int*                   count);
+
+/*! \brief Set the statistics of a handle to 0, or those of the process with handle nullptr */
+HIPBLAS_EXPORT hipblasStatus_t hipblasResetStats(hipblasHandle_t handle);
+
+/*! \brief Set the prefetching of the operands of a handle in managed memory
+    \details
+    In HIPBLAS_PREFETCH_MODE_MANAGED, the memory each operand of a call spans, computed from its
+    sizes, leading dimension, increment and stride, is prefetched to the current device with
+    hipMemPrefetchAsync on the stream of the handle when it lies in memory allocated with
+    hipMallocManaged, so that the kernels do not fault on its pages. Whether an allocation is
+    managed memory is found from its pointer attributes the first time it is seen and remembered
+    by the handle.
+
+    The operands of axpy, scal, copy, gemv, gemm, gemmStridedBatched, hipblasGemmEx and
+    hipblasGemmStridedBatchedEx, with their _v2 and WithFlags forms, are prefetched. Nothing is
+    prefetched while the stream of the handle is being captured, and a prefetch which fails is
+    skipped.
+    @param[in]
+    handle      [hipblasHandle_t]
+                handle to the hipblas library context queue.
+    @param[in]
+    mode        [hipblasPrefetchMode_t]
+                operands to prefetch.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetPrefetchMode(hipblasHandle_t       handle,
+                                                      hipblasPrefetchMode_t mode);
+
+/*! \brief Get the prefetching of the operands of a handle, set with hipblasSetPrefetchMode */
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetPrefetchMode(hipblasHandle_t        handle,
+                                                      hipblasPrefetchMode_t* mode);
+
+/*! \brief Get the number of operands a handle has prefetched
+    @param[in]
+    handle      [hipblasHandle_t]
+                handle to the hipblas library context queue.
+    @param[out]
+    prefetches  number of prefetches issued
+    @param[out]
+    bytes       bytes of managed memory prefetched
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetPrefetchStats(hipblasHandle_t handle,
+                                                       uint64_t*       prefetches,
+                                                       uint64_t*       bytes);
+
 /*
  * ===========================================================================
  *    level 1 BLAS
@@ -20146,6 +20665,239 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgemmStridedBatched_v2_64(hipblasHandle_t
                                                                 int64_t                 batchCount);
 //! @}
 
+/*! @{
+    \brief BLAS Level 3 API
+
+    \details
+    gemm3m performs the complex matrix-matrix operation of gemm,
+
+        C = alpha*op( A )*op( B ) + beta*C,
+
+    with the three real multiplications per complex product of the Gauss (3M) method: with
+    op( A ) = Ar + i*Ai and op( B ) = Br + i*Bi,
+
+        op( A )*op( B ) = (T1 - T2) + i*(T3 - T1 - T2),
+
+    where T1 = Ar*Br, T2 = Ai*Bi and T3 = (Ar + Ai)*(Br + Bi). This takes about 25% fewer
+    flops than gemm, and the imaginary part can be less accurate when the real and imaginary
+    parts of A or B differ widely in magnitude. The batched forms use the same method on each
+    problem of the batch.
+
+    cuBLAS has Cgemm3m, Cgemm3mBatched, Cgemm3mStridedBatched and Zgemm3m, which are called
+    on that backend. Elsewhere A and B are split into real planes of Ar, Ai and Ar + Ai by one
+    kernel of hipBLAS, into device memory of the library taken from the workspace of the handle
+    if one was set with hipblasSetWorkspace, T1, T2 and T3 are computed with the real gemm of
+    the backend, and a second kernel forms the complex product and applies alpha and beta.
+
+    - Supported precisions in rocBLAS : c,z (from real gemm)
+    - Supported precisions in cuBLAS  : c,z (native, except the batched z forms)
+
+    The parameters are those of hipblasCgemm, hipblasCgemmBatched and
+    hipblasCgemmStridedBatched.
+
+    ********************************************************************/
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemm3m(hipblasHandle_t       handle,
+                                              hipblasOperation_t    transA,
+                                              hipblasOperation_t    transB,
+                                              int                   m,
+                                              int                   n,
+                                              int                   k,
+                                              const hipblasComplex* alpha,
+                                              const hipblasComplex* AP,
+                                              int                   lda,
+                                              const hipblasComplex* BP,
+                                              int                   ldb,
+                                              const hipblasComplex* beta,
+                                              hipblasComplex*       CP,
+                                              int                   ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgemm3m(hipblasHandle_t             handle,
+                                              hipblasOperation_t          transA,
+                                              hipblasOperation_t          transB,
+                                              int                         m,
+                                              int                         n,
+                                              int                         k,
+                                              const hipblasDoubleComplex* alpha,
+                                              const hipblasDoubleComplex* AP,
+                                              int                         lda,
+                                              const hipblasDoubleComplex* BP,
+                                              int                         ldb,
+                                              const hipblasDoubleComplex* beta,
+                                              hipblasDoubleComplex*       CP,
+                                              int                         ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemm3m_v2(hipblasHandle_t    handle,
+                                                 hipblasOperation_t transA,
+                                                 hipblasOperation_t transB,
+                                                 int                m,
+                                                 int                n,
+                                                 int                k,
+                                                 const hipComplex*  alpha,
+                                                 const hipComplex*  AP,
+                                                 int                lda,
+                                                 const hipComplex*  BP,
+                                                 int                ldb,
+                                                 const hipComplex*  beta,
+                                                 hipComplex*        CP,
+                                                 int                ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgemm3m_v2(hipblasHandle_t         handle,
+                                                 hipblasOperation_t      transA,
+                                                 hipblasOperation_t      transB,
+                                                 int                     m,
+                                                 int                     n,
+                                                 int                     k,
+                                                 const hipDoubleComplex* alpha,
+                                                 const hipDoubleComplex* AP,
+                                                 int                     lda,
+                                                 const hipDoubleComplex* BP,
+                                                 int                     ldb,
+                                                 const hipDoubleComplex* beta,
+                                                 hipDoubleComplex*       CP,
+                                                 int                     ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemm3mBatched(hipblasHandle_t             handle,
+                                                     hipblasOperation_t          transA,
+                                                     hipblasOperation_t          transB,
+                                                     int                         m,
+                                                     int                         n,
+                                                     int                         k,
+                                                     const hipblasComplex*       alpha,
+                                                     const hipblasComplex* const AP[],
+                                                     int                         lda,
+                                                     const hipblasComplex* const BP[],
+                                                     int                         ldb,
+                                                     const hipblasComplex*       beta,
+                                                     hipblasComplex* const       CP[],
+                                                     int                         ldc,
+                                                     int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgemm3mBatched(hipblasHandle_t                   handle,
+                                                     hipblasOperation_t                transA,
+                                                     hipblasOperation_t                transB,
+                                                     int                               m,
+                                                     int                               n,
+                                                     int                               k,
+                                                     const hipblasDoubleComplex*       alpha,
+                                                     const hipblasDoubleComplex* const AP[],
+                                                     int                               lda,
+                                                     const hipblasDoubleComplex* const BP[],
+                                                     int                               ldb,
+                                                     const hipblasDoubleComplex*       beta,
+                                                     hipblasDoubleComplex* const       CP[],
+                                                     int                               ldc,
+                                                     int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemm3mBatched_v2(hipblasHandle_t         handle,
+                                                        hipblasOperation_t      transA,
+                                                        hipblasOperation_t      transB,
+                                                        int                     m,
+                                                        int                     n,
+                                                        int                     k,
+                                                        const hipComplex*       alpha,
+                                                        const hipComplex* const AP[],
+                                                        int                     lda,
+                                                        const hipComplex* const BP[],
+                                                        int                     ldb,
+                                                        const hipComplex*       beta,
+                                                        hipComplex* const       CP[],
+                                                        int                     ldc,
+                                                        int                     batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgemm3mBatched_v2(hipblasHandle_t               handle,
+                                                        hipblasOperation_t            transA,
+                                                        hipblasOperation_t            transB,
+                                                        int                           m,
+                                                        int                           n,
+                                                        int                           k,
+                                                        const hipDoubleComplex*       alpha,
+                                                        const hipDoubleComplex* const AP[],
+                                                        int                           lda,
+                                                        const hipDoubleComplex* const BP[],
+                                                        int                           ldb,
+                                                        const hipDoubleComplex*       beta,
+                                                        hipDoubleComplex* const       CP[],
+                                                        int                           ldc,
+                                                        int                           batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemm3mStridedBatched(hipblasHandle_t       handle,
+                                                            hipblasOperation_t    transA,
+                                                            hipblasOperation_t    transB,
+                                                            int                   m,
+                                                            int                   n,
+                                                            int                   k,
+                                                            const hipblasComplex* alpha,
+                                                            const hipblasComplex* AP,
+                                                            int                   lda,
+                                                            long long             strideA,
+                                                            const hipblasComplex* BP,
+                                                            int                   ldb,
+                                                            long long             strideB,
+                                                            const hipblasComplex* beta,
+                                                            hipblasComplex*       CP,
+                                                            int                   ldc,
+                                                            long long             strideC,
+                                                            int                   batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgemm3mStridedBatched(hipblasHandle_t             handle,
+                                                            hipblasOperation_t          transA,
+                                                            hipblasOperation_t          transB,
+                                                            int                         m,
+                                                            int                         n,
+                                                            int                         k,
+                                                            const hipblasDoubleComplex* alpha,
+                                                            const hipblasDoubleComplex* AP,
+                                                            int                         lda,
+                                                            long long                   strideA,
+                                                            const hipblasDoubleComplex* BP,
+                                                            int                         ldb,
+                                                            long long                   strideB,
+                                                            const hipblasDoubleComplex* beta,
+                                                            hipblasDoubleComplex*       CP,
+                                                            int                         ldc,
+                                                            long long                   strideC,
+                                                            int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemm3mStridedBatched_v2(hipblasHandle_t    handle,
+                                                               hipblasOperation_t transA,
+                                                               hipblasOperation_t transB,
+                                                               int                m,
+                                                               int                n,
+                                                               int                k,
+                                                               const hipComplex*  alpha,
+                                                               const hipComplex*  AP,
+                                                               int                lda,
+                                                               long long          strideA,
+                                                               const hipComplex*  BP,
+                                                               int                ldb,
+                                                               long long          strideB,
+                                                               const hipComplex*  beta,
+                                                               hipComplex*        CP,
+                                                               int                ldc,
+                                                               long long          strideC,
+                                                               int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgemm3mStridedBatched_v2(hipblasHandle_t         handle,
+                                                               hipblasOperation_t      transA,
+                                                               hipblasOperation_t      transB,
+                                                               int                     m,
+                                                               int                     n,
+                                                               int                     k,
+                                                               const hipDoubleComplex* alpha,
+                                                               const hipDoubleComplex* AP,
+                                                               int                     lda,
+                                                               long long               strideA,
+                                                               const hipDoubleComplex* BP,
+                                                               int                     ldb,
+                                                               long long               strideB,
+                                                               const hipDoubleComplex* beta,
+                                                               hipDoubleComplex*       CP,
+                                                               int                     ldc,
+                                                               long long               strideC,
+                                                               int                     batchCount);
+//! @}
+
 /*! @{
     \brief BLAS Level 3 API
 
@@ -30591,6 +31343,1294 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgelsStridedBatched_v2(hipblasHandle_t
                                                              const int           batchCount);
 ///@}
 
+/*! @{
+    \brief SOLVER API
+
+    \details
+    gesv solves the system of n linear equations on n variables
+
+    \f[
+        A X = B,
+    \f]
+
+    by mixed precision iterative refinement. A is factored with partial pivoting in single
+    precision (DSgesv) or single complex precision (ZCgesv) with \ref hipblasSgetrf "getrf", and
+    the solution is refined in double precision: each step computes the residual B - A X
+    with gemm, solves for a correction with \ref hipblasSgetrs "getrs" on the single precision
+    factors and adds it to X. Refinement stops when, for every column x of X and r of the
+    residual, ||r||_inf <= sqrt(n) * eps * ||A||_inf * ||x||_inf, with eps the unit roundoff of
+    double precision. If it has not stopped after 30 steps, or A or a residual overflows single
+    precision, or the single precision factorization fails, A is factored in double precision
+    instead and the system is solved with it, as LAPACK dsgesv and zcgesv do. When refinement
+    succeeds the factorization takes about half the time of a double precision one.
+
+    The conversions between the precisions and the convergence tests run on the device, and
+    only their flags and norms are copied to the host. Problems of a batch are solved one after
+    the other. The function returns when the solution is complete.
+
+    The solver is built on getrf and getrs, so HIPBLAS_STATUS_NOT_SUPPORTED is returned when
+    hipBLAS is built without rocSOLVER, and with the cuBLAS backend, which has no getrs for a
+    single problem.
+
+    - Supported precisions in rocSOLVER : ds,zc
+    - Supported precisions in cuBLAS    : No support
+
+    @param[in]
+    handle      hipblasHandle_t.
+    @param[in]
+    n           int. n >= 0.\n
+                The order of the system, i.e. the number of columns and rows of A.
+    @param[in]
+    nrhs        int. nrhs >= 0.\n
+                The number of right hand sides, i.e., the number of columns of B and X.
+    @param[inout]
+    A           pointer to type. Array on the GPU of dimension lda*n.\n
+                On entry, the matrix A. On exit, A is unchanged when iter >= 0, and holds the
+                factors L and U of the double precision factorization A = P*L*U when iter < 0.
+    @param[in]
+    lda         int. lda >= n.\n
+                Specifies the leading dimension of A.
+    @param[out]
+    ipiv        pointer to int. Array on the GPU of dimension n.\n
+                The pivot indices of the last factorization of A.
+    @param[in]
+    B           pointer to type. Array on the GPU of dimension ldb*nrhs.\n
+                The right hand side matrix B. It is not changed.
+    @param[in]
+    ldb         int. ldb >= n.\n
+                Specifies the leading dimension of B.
+    @param[out]
+    X           pointer to type. Array on the GPU of dimension ldx*nrhs.\n
+                The solution matrix X.
+    @param[in]
+    ldx         int. ldx >= n.\n
+                Specifies the leading dimension of X.
+    @param[out]
+    iter        pointer to an int on the host.\n
+                If iter >= 0, the number of refinement steps taken.
+                If iter < 0, A was factored in double precision because:
+                -2: A or a residual overflows single precision,
+                -3: the single precision factorization found an exactly zero pivot,
+                -31: refinement did not converge in 30 steps.
+    @param[out]
+    info        pointer to an int on the host.\n
+                If info = 0, successful exit.
+                If info = j < 0, the argument at position -j is invalid.
+    @param[out]
+    deviceInfo  pointer to int on the GPU.\n
+                If deviceInfo = 0, successful exit.
+                If deviceInfo = j > 0, the double precision factor U is singular: U[j,j] is the
+                first zero pivot, and X was not computed.
+    ********************************************************************/
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDSgesv(hipblasHandle_t handle,
+                                             const int       n,
+                                             const int       nrhs,
+                                             double*         A,
+                                             const int       lda,
+                                             int*            ipiv,
+                                             double*         B,
+                                             const int       ldb,
+                                             double*         X,
+                                             const int       ldx,
+                                             int*            iter,
+                                             int*            info,
+                                             int*            deviceInfo);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZCgesv(hipblasHandle_t   handle,
+                                             const int         n,
+                                             const int         nrhs,
+                                             hipDoubleComplex* A,
+                                             const int         lda,
+                                             int*              ipiv,
+                                             hipDoubleComplex* B,
+                                             const int         ldb,
+                                             hipDoubleComplex* X,
+                                             const int         ldx,
+                                             int*              iter,
+                                             int*              info,
+                                             int*              deviceInfo);
+//! @}
+
+/*! @{
+    \brief SOLVER API
+
+    \details
+    gesvBatched solves the system of n linear equations on n variables
+
+    \f[
+        A_i X_i = B_i, for i = 1, ..., batchCount,
+    \f]
+
+    by mixed precision iterative refinement. A_i is factored with partial pivoting in single
+    precision (DSgesv) or single complex precision (ZCgesv) with \ref hipblasSgetrf "getrf", and
+    the solution is refined in double precision: each step computes the residual B_i - A_i X_i
+    with gemm, solves for a correction with \ref hipblasSgetrs "getrs" on the single precision
+    factors and adds it to X_i. Refinement stops when, for every column x of X_i and r of the
+    residual, ||r||_inf <= sqrt(n) * eps * ||A_i||_inf * ||x||_inf, with eps the unit roundoff of
+    double precision. If it has not stopped after 30 steps, or A_i or a residual overflows single
+    precision, or the single precision factorization fails, A_i is factored in double precision
+    instead and the system is solved with it, as LAPACK dsgesv and zcgesv do. When refinement
+    succeeds the factorization takes about half the time of a double precision one.
+
+    The conversions between the precisions and the convergence tests run on the device, and
+    only their flags and norms are copied to the host. Problems of a batch are solved one after
+    the other. The function returns when the solution is complete.
+
+    The solver is built on getrf and getrs, so HIPBLAS_STATUS_NOT_SUPPORTED is returned when
+    hipBLAS is built without rocSOLVER, and with the cuBLAS backend, which has no getrs for a
+    single problem.
+
+    - Supported precisions in rocSOLVER : ds,zc
+    - Supported precisions in cuBLAS    : No support
+
+    @param[in]
+    handle      hipblasHandle_t.
+    @param[in]
+    n           int. n >= 0.\n
+                The order of the system, i.e. the number of columns and rows of A_i.
+    @param[in]
+    nrhs        int. nrhs >= 0.\n
+                The number of right hand sides, i.e., the number of columns of B_i and X_i.
+    @param[inout]
+    A           array of pointers to type. Each pointer points to an array on the GPU of dimension lda*n.\n
+                On entry, the matrices A_i. On exit, A_i is unchanged when iter[i] >= 0, and
+                holds the factors of the double precision factorization A_i = P_i*L_i*U_i when
+                iter[i] < 0.
+    @param[in]
+    lda         int. lda >= n.\n
+                Specifies the leading dimension of matrices A_i.
+    @param[out]
+    ipiv        pointer to int. Array on the GPU of dimension n*batchCount.\n
+                The pivot indices of the last factorization of each A_i, n per problem.
+    @param[in]
+    B           array of pointers to type. Each pointer points to an array on the GPU of dimension ldb*nrhs.\n
+                The right hand side matrices B_i. They are not changed.
+    @param[in]
+    ldb         int. ldb >= n.\n
+                Specifies the leading dimension of matrices B_i.
+    @param[out]
+    X           array of pointers to type. Each pointer points to an array on the GPU of dimension ldx*nrhs.\n
+                The solution matrices X_i.
+    @param[in]
+    ldx         int. ldx >= n.\n
+                Specifies the leading dimension of matrices X_i.
+    @param[out]
+    iter        pointer to int. Array of batchCount integers on the host.\n
+                The number of refinement steps of each problem, or a negative value as for
+                \ref hipblasDSgesv "DSgesv" when A_i was factored in double precision.
+    @param[out]
+    info        pointer to an int on the host.\n
+                If info = 0, successful exit.
+                If info = j < 0, the argument at position -j is invalid.
+    @param[out]
+    deviceInfo  pointer to int. Array of batchCount integers on the GPU.\n
+                If deviceInfo[i] = 0, successful exit for A_i.
+                If deviceInfo[i] = j > 0, the double precision factor U_i is singular and X_i
+                was not computed.
+    @param[in]
+    batchCount  int. batchCount >= 0.\n
+                Number of problems in the batch.
+    ********************************************************************/
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDSgesvBatched(hipblasHandle_t handle,
+                                                    const int       n,
+                                                    const int       nrhs,
+                                                    double* const   A[],
+                                                    const int       lda,
+                                                    int*            ipiv,
+                                                    double* const   B[],
+                                                    const int       ldb,
+                                                    double* const   X[],
+                                                    const int       ldx,
+                                                    int*            iter,
+                                                    int*            info,
+                                                    int*            deviceInfo,
+                                                    const int       batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZCgesvBatched(hipblasHandle_t         handle,
+                                                    const int               n,
+                                                    const int               nrhs,
+                                                    hipDoubleComplex* const A[],
+                                                    const int               lda,
+                                                    int*                    ipiv,
+                                                    hipDoubleComplex* const B[],
+                                                    const int               ldb,
+                                                    hipDoubleComplex* const X[],
+                                                    const int               ldx,
+                                                    int*                    iter,
+                                                    int*                    info,
+                                                    int*                    deviceInfo,
+                                                    const int               batchCount);
+//! @}
+
+/*! @{
+    \brief SOLVER API
+
+    \details
+    gesvStridedBatched solves the system of n linear equations on n variables
+
+    \f[
+        A_i X_i = B_i, for i = 1, ..., batchCount,
+    \f]
+
+    by mixed precision iterative refinement. A_i is factored with partial pivoting in single
+    precision (DSgesv) or single complex precision (ZCgesv) with \ref hipblasSgetrf "getrf", and
+    the solution is refined in double precision: each step computes the residual B_i - A_i X_i
+    with gemm, solves for a correction with \ref hipblasSgetrs "getrs" on the single precision
+    factors and adds it to X_i. Refinement stops when, for every column x of X_i and r of the
+    residual, ||r||_inf <= sqrt(n) * eps * ||A_i||_inf * ||x||_inf, with eps the unit roundoff of
+    double precision. If it has not stopped after 30 steps, or A_i or a residual overflows single
+    precision, or the single precision factorization fails, A_i is factored in double precision
+    instead and the system is solved with it, as LAPACK dsgesv and zcgesv do. When refinement
+    succeeds the factorization takes about half the time of a double precision one.
+
+    The conversions between the precisions and the convergence tests run on the device, and
+    only their flags and norms are copied to the host. Problems of a batch are solved one after
+    the other. The function returns when the solution is complete.
+
+    The solver is built on getrf and getrs, so HIPBLAS_STATUS_NOT_SUPPORTED is returned when
+    hipBLAS is built without rocSOLVER, and with the cuBLAS backend, which has no getrs for a
+    single problem.
+
+    - Supported precisions in rocSOLVER : ds,zc
+    - Supported precisions in cuBLAS    : No support
+
+    @param[in]
+    handle      hipblasHandle_t.
+    @param[in]
+    n           int. n >= 0.\n
+                The order of the system, i.e. the number of columns and rows of A_i.
+    @param[in]
+    nrhs        int. nrhs >= 0.\n
+                The number of right hand sides, i.e., the number of columns of B_i and X_i.
+    @param[inout]
+    A           pointer to type. Array on the GPU (the size depends on the value of strideA).\n
+                On entry, the matrices A_i. On exit, A_i is unchanged when iter[i] >= 0, and
+                holds the factors of the double precision factorization A_i = P_i*L_i*U_i when
+                iter[i] < 0.
+    @param[in]
+    lda         int. lda >= n.\n
+                Specifies the leading dimension of matrices A_i.
+    @param[in]
+    strideA     hipblasStride.\n
+                Stride from the start of one matrix A_i to the next one A_(i+1).
+    @param[out]
+    ipiv        pointer to int. Array on the GPU (the size depends on the value of strideP).\n
+                The pivot indices of the last factorization of each A_i.
+    @param[in]
+    strideP     hipblasStride.\n
+                Stride from the start of one vector ipiv_i to the next one ipiv_(i+1).
+    @param[in]
+    B           pointer to type. Array on the GPU (the size depends on the value of strideB).\n
+                The right hand side matrices B_i. They are not changed.
+    @param[in]
+    ldb         int. ldb >= n.\n
+                Specifies the leading dimension of matrices B_i.
+    @param[in]
+    strideB     hipblasStride.\n
+                Stride from the start of one matrix B_i to the next one B_(i+1).
+    @param[out]
+    X           pointer to type. Array on the GPU (the size depends on the value of strideX).\n
+                The solution matrices X_i.
+    @param[in]
+    ldx         int. ldx >= n.\n
+                Specifies the leading dimension of matrices X_i.
+    @param[in]
+    strideX     hipblasStride.\n
+                Stride from the start of one matrix X_i to the next one X_(i+1).
+    @param[out]
+    iter        pointer to int. Array of batchCount integers on the host.\n
+                The number of refinement steps of each problem, or a negative value as for
+                \ref hipblasDSgesv "DSgesv" when A_i was factored in double precision.
+    @param[out]
+    info        pointer to an int on the host.\n
+                If info = 0, successful exit.
+                If info = j < 0, the argument at position -j is invalid.
+    @param[out]
+    deviceInfo  pointer to int. Array of batchCount integers on the GPU.\n
+                If deviceInfo[i] = 0, successful exit for A_i.
+                If deviceInfo[i] = j > 0, the double precision factor U_i is singular and X_i
+                was not computed.
+    @param[in]
+    batchCount  int. batchCount >= 0.\n
+                Number of problems in the batch.
+    ********************************************************************/
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDSgesvStridedBatched(hipblasHandle_t     handle,
+                                                           const int           n,
+                                                           const int           nrhs,
+                                                           double*             A,
+                                                           const int           lda,
+                                                           const hipblasStride strideA,
+                                                           int*                ipiv,
+                                                           const hipblasStride strideP,
+                                                           double*             B,
+                                                           const int           ldb,
+                                                           const hipblasStride strideB,
+                                                           double*             X,
+                                                           const int           ldx,
+                                                           const hipblasStride strideX,
+                                                           int*                iter,
+                                                           int*                info,
+                                                           int*                deviceInfo,
+                                                           const int           batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZCgesvStridedBatched(hipblasHandle_t     handle,
+                                                           const int           n,
+                                                           const int           nrhs,
+                                                           hipDoubleComplex*   A,
+                                                           const int           lda,
+                                                           const hipblasStride strideA,
+                                                           int*                ipiv,
+                                                           const hipblasStride strideP,
+                                                           hipDoubleComplex*   B,
+                                                           const int           ldb,
+                                                           const hipblasStride strideB,
+                                                           hipDoubleComplex*   X,
+                                                           const int           ldx,
+                                                           const hipblasStride strideX,
+                                                           int*                iter,
+                                                           int*                info,
+                                                           int*                deviceInfo,
+                                                           const int           batchCount);
+//! @}
+
+/*! @{
+    \brief SOLVER API
+
+    \details
+    potrf computes the Cholesky factorization of a Hermitian (symmetric in the real
+    case) positive definite n-by-n matrix A.
+
+    Depending on the value of uplo, the factorization has the form:
+
+    \f[
+        \begin{array}{cl}
+        A = U^H U & \: \text{if uplo is upper, or}\\
+        A = L L^H & \: \text{if uplo is lower.}
+        \end{array}
+    \f]
+
+    where U is upper triangular and L is lower triangular. Only the uplo
+    triangle of A is read and overwritten; the other triangle is not referenced.
+
+    On the cuBLAS backend, which has no Cholesky factorization, the diagonal blocks are
+    factored on the host and the trailing matrix is updated with trsm and syrk/herk.
+
+    - Supported precisions in rocSOLVER : s,d,c,z
+    - Supported precisions in cuBLAS    : s,d,c,z
+
+    @param[in]
+    handle    hipblasHandle_t.
+    @param[in]
+    uplo      hipblasFillMode_t.\n
+              Specifies whether the upper or lower triangle of A is factored.
+    @param[in]
+    n         int. n >= 0.\n
+              The number of rows and columns of the matrix A.
+    @param[inout]
+    A         pointer to type. Array on the GPU of dimension lda*n.\n
+              On entry, the matrix A to be factored.
+              On exit, the triangular factor U or L.
+    @param[in]
+    lda       int. lda >= n.\n
+              Specifies the leading dimension of A.
+    @param[out]
+    info      pointer to a int on the GPU.\n
+              If info = 0, successful exit.
+              If info = j > 0, the leading minor of order j of A is not positive definite.
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSpotrf(hipblasHandle_t         handle,
+                                             const hipblasFillMode_t uplo,
+                                             const int               n,
+                                             float*                  A,
+                                             const int               lda,
+                                             int*                    info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDpotrf(hipblasHandle_t         handle,
+                                             const hipblasFillMode_t uplo,
+                                             const int               n,
+                                             double*                 A,
+                                             const int               lda,
+                                             int*                    info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCpotrf(hipblasHandle_t         handle,
+                                             const hipblasFillMode_t uplo,
+                                             const int               n,
+                                             hipblasComplex*         A,
+                                             const int               lda,
+                                             int*                    info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZpotrf(hipblasHandle_t         handle,
+                                             const hipblasFillMode_t uplo,
+                                             const int               n,
+                                             hipblasDoubleComplex*   A,
+                                             const int               lda,
+                                             int*                    info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCpotrf_v2(hipblasHandle_t         handle,
+                                                const hipblasFillMode_t uplo,
+                                                const int               n,
+                                                hipComplex*             A,
+                                                const int               lda,
+                                                int*                    info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZpotrf_v2(hipblasHandle_t         handle,
+                                                const hipblasFillMode_t uplo,
+                                                const int               n,
+                                                hipDoubleComplex*       A,
+                                                const int               lda,
+                                                int*                    info);
+//! @}
+
+/*! @{
+    \brief SOLVER API
+
+    \details
+    potrfBatched computes the Cholesky factorization of a batch of Hermitian positive
+    definite n-by-n matrices.
+
+    Depending on the value of uplo, the factorization of matrix \f$A_i\f$ in the batch has the form:
+
+    \f[
+        \begin{array}{cl}
+        A_i = U_i^H U_i & \: \text{if uplo is upper, or}\\
+        A_i = L_i L_i^H & \: \text{if uplo is lower.}
+        \end{array}
+    \f]
+
+    where \f$U_i\f$ is upper triangular and \f$L_i\f$ is lower triangular. Only the uplo
+    triangle of \f$A_i\f$ is read and overwritten; the other triangle is not referenced.
+
+    On the cuBLAS backend, which has no Cholesky factorization, the diagonal blocks are
+    factored on the host and the trailing matrix is updated with trsm and syrk/herk.
+
+    - Supported precisions in rocSOLVER : s,d,c,z
+    - Supported precisions in cuBLAS    : s,d,c,z
+
+    @param[in]
+    handle    hipblasHandle_t.
+    @param[in]
+    uplo      hipblasFillMode_t.\n
+              Specifies whether the upper or lower triangle of each A_i is factored.
+    @param[in]
+    n         int. n >= 0.\n
+              The number of rows and columns of all matrices A_i in the batch.
+    @param[inout]
+    A         array of pointers to type. Each pointer points to an array on the GPU of dimension lda*n.\n
+              On entry, the matrices A_i to be factored.
+              On exit, the triangular factors U_i or L_i.
+    @param[in]
+    lda       int. lda >= n.\n
+              Specifies the leading dimension of matrices A_i.
+    @param[out]
+    info      pointer to int. Array of batchCount integers on the GPU.\n
+              If info[i] = 0, successful exit for A_i.
+              If info[i] = j > 0, the leading minor of order j of A_i is not positive definite.
+    @param[in]
+    batchCount int. batchCount >= 0.\n
+                Number of matrices in the batch.
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSpotrfBatched(hipblasHandle_t         handle,
+                                                    const hipblasFillMode_t uplo,
+                                                    const int               n,
+                                                    float* const            A[],
+                                                    const int               lda,
+                                                    int*                    info,
+                                                    const int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDpotrfBatched(hipblasHandle_t         handle,
+                                                    const hipblasFillMode_t uplo,
+                                                    const int               n,
+                                                    double* const           A[],
+                                                    const int               lda,
+                                                    int*                    info,
+                                                    const int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCpotrfBatched(hipblasHandle_t         handle,
+                                                    const hipblasFillMode_t uplo,
+                                                    const int               n,
+                                                    hipblasComplex* const   A[],
+                                                    const int               lda,
+                                                    int*                    info,
+                                                    const int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZpotrfBatched(hipblasHandle_t             handle,
+                                                    const hipblasFillMode_t     uplo,
+                                                    const int                   n,
+                                                    hipblasDoubleComplex* const A[],
+                                                    const int                   lda,
+                                                    int*                        info,
+                                                    const int                   batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCpotrfBatched_v2(hipblasHandle_t         handle,
+                                                       const hipblasFillMode_t uplo,
+                                                       const int               n,
+                                                       hipComplex* const       A[],
+                                                       const int               lda,
+                                                       int*                    info,
+                                                       const int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZpotrfBatched_v2(hipblasHandle_t         handle,
+                                                       const hipblasFillMode_t uplo,
+                                                       const int               n,
+                                                       hipDoubleComplex* const A[],
+                                                       const int               lda,
+                                                       int*                    info,
+                                                       const int               batchCount);
+//! @}
+
+/*! @{
+    \brief SOLVER API
+
+    \details
+    potrfStridedBatched computes the Cholesky factorization of a batch of Hermitian positive
+    definite n-by-n matrices.
+
+    Depending on the value of uplo, the factorization of matrix \f$A_i\f$ in the batch has the form:
+
+    \f[
+        \begin{array}{cl}
+        A_i = U_i^H U_i & \: \text{if uplo is upper, or}\\
+        A_i = L_i L_i^H & \: \text{if uplo is lower.}
+        \end{array}
+    \f]
+
+    where \f$U_i\f$ is upper triangular and \f$L_i\f$ is lower triangular. Only the uplo
+    triangle of \f$A_i\f$ is read and overwritten; the other triangle is not referenced.
+
+    On the cuBLAS backend, which has no Cholesky factorization, the diagonal blocks are
+    factored on the host and the trailing matrix is updated with trsm and syrk/herk.
+
+    - Supported precisions in rocSOLVER : s,d,c,z
+    - Supported precisions in cuBLAS    : s,d,c,z
+
+    @param[in]
+    handle    hipblasHandle_t.
+    @param[in]
+    uplo      hipblasFillMode_t.\n
+              Specifies whether the upper or lower triangle of each A_i is factored.
+    @param[in]
+    n         int. n >= 0.\n
+              The number of rows and columns of all matrices A_i in the batch.
+    @param[inout]
+    A         pointer to type. Array on the GPU (the size depends on the value of strideA).\n
+              On entry, the matrices A_i to be factored.
+              On exit, the triangular factors U_i or L_i.
+    @param[in]
+    lda       int. lda >= n.\n
+              Specifies the leading dimension of matrices A_i.
+    @param[in]
+    strideA   hipblasStride.\n
+              Stride from the start of one matrix A_i to the next one A_(i+1).
+              There is no restriction for the value of strideA. Normal use case is strideA >= lda*n
+    @param[out]
+    info      pointer to int. Array of batchCount integers on the GPU.\n
+              If info[i] = 0, successful exit for A_i.
+              If info[i] = j > 0, the leading minor of order j of A_i is not positive definite.
+    @param[in]
+    batchCount int. batchCount >= 0.\n
+                Number of matrices in the batch.
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSpotrfStridedBatched(hipblasHandle_t         handle,
+                                                           const hipblasFillMode_t uplo,
+                                                           const int               n,
+                                                           float*                  A,
+                                                           const int               lda,
+                                                           const hipblasStride     strideA,
+                                                           int*                    info,
+                                                           const int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDpotrfStridedBatched(hipblasHandle_t         handle,
+                                                           const hipblasFillMode_t uplo,
+                                                           const int               n,
+                                                           double*                 A,
+                                                           const int               lda,
+                                                           const hipblasStride     strideA,
+                                                           int*                    info,
+                                                           const int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCpotrfStridedBatched(hipblasHandle_t         handle,
+                                                           const hipblasFillMode_t uplo,
+                                                           const int               n,
+                                                           hipblasComplex*         A,
+                                                           const int               lda,
+                                                           const hipblasStride     strideA,
+                                                           int*                    info,
+                                                           const int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZpotrfStridedBatched(hipblasHandle_t         handle,
+                                                           const hipblasFillMode_t uplo,
+                                                           const int               n,
+                                                           hipblasDoubleComplex*   A,
+                                                           const int               lda,
+                                                           const hipblasStride     strideA,
+                                                           int*                    info,
+                                                           const int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCpotrfStridedBatched_v2(hipblasHandle_t         handle,
+                                                              const hipblasFillMode_t uplo,
+                                                              const int               n,
+                                                              hipComplex*             A,
+                                                              const int               lda,
+                                                              const hipblasStride     strideA,
+                                                              int*                    info,
+                                                              const int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZpotrfStridedBatched_v2(hipblasHandle_t         handle,
+                                                              const hipblasFillMode_t uplo,
+                                                              const int               n,
+                                                              hipDoubleComplex*       A,
+                                                              const int               lda,
+                                                              const hipblasStride     strideA,
+                                                              int*                    info,
+                                                              const int               batchCount);
+//! @}
+
+/*! @{
+    \brief SOLVER API
+
+    \details
+    potrs solves a system of n linear equations on n variables in its factorized form.
+
+    It solves the system
+
+    \f[
+        A X = B
+    \f]
+
+    where A is a Hermitian positive definite matrix defined by its triangular factor
+    as returned by \ref hipblasSpotrf "potrf".
+
+    - Supported precisions in rocSOLVER : s,d,c,z
+    - Supported precisions in cuBLAS    : s,d,c,z
+
+    @param[in]
+    handle    hipblasHandle_t.
+    @param[in]
+    uplo      hipblasFillMode_t.\n
+              Specifies whether the factor stored is upper or lower triangular.
+    @param[in]
+    n         int. n >= 0.\n
+              The number of rows and columns of the matrix A.
+    @param[in]
+    nrhs      int. nrhs >= 0.\n
+              The number of right hand sides, i.e., the number of columns
+              of the matrix B.
+    @param[in]
+    A         pointer to type. Array on the GPU of dimension lda*n.\n
+              The factor U or L of the Cholesky factorization returned by \ref hipblasSpotrf "potrf".
+    @param[in]
+    lda       int. lda >= n.\n
+              Specifies the leading dimension of A.
+    @param[in,out]
+    B         pointer to type. Array on the GPU of dimension ldb*nrhs.\n
+              On entry, the right hand side matrix B.
+              On exit, the solution matrix X.
+    @param[in]
+    ldb       int. ldb >= n.\n
+              The leading dimension of B.
+    @param[out]
+    info      pointer to a int on the host.\n
+              If info = 0, successful exit.
+              If info = j < 0, the argument at position -j is invalid.
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSpotrs(hipblasHandle_t         handle,
+                                             const hipblasFillMode_t uplo,
+                                             const int               n,
+                                             const int               nrhs,
+                                             float*                  A,
+                                             const int               lda,
+                                             float*                  B,
+                                             const int               ldb,
+                                             int*                    info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDpotrs(hipblasHandle_t         handle,
+                                             const hipblasFillMode_t uplo,
+                                             const int               n,
+                                             const int               nrhs,
+                                             double*                 A,
+                                             const int               lda,
+                                             double*                 B,
+                                             const int               ldb,
+                                             int*                    info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCpotrs(hipblasHandle_t         handle,
+                                             const hipblasFillMode_t uplo,
+                                             const int               n,
+                                             const int               nrhs,
+                                             hipblasComplex*         A,
+                                             const int               lda,
+                                             hipblasComplex*         B,
+                                             const int               ldb,
+                                             int*                    info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZpotrs(hipblasHandle_t         handle,
+                                             const hipblasFillMode_t uplo,
+                                             const int               n,
+                                             const int               nrhs,
+                                             hipblasDoubleComplex*   A,
+                                             const int               lda,
+                                             hipblasDoubleComplex*   B,
+                                             const int               ldb,
+                                             int*                    info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCpotrs_v2(hipblasHandle_t         handle,
+                                                const hipblasFillMode_t uplo,
+                                                const int               n,
+                                                const int               nrhs,
+                                                hipComplex*             A,
+                                                const int               lda,
+                                                hipComplex*             B,
+                                                const int               ldb,
+                                                int*                    info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZpotrs_v2(hipblasHandle_t         handle,
+                                                const hipblasFillMode_t uplo,
+                                                const int               n,
+                                                const int               nrhs,
+                                                hipDoubleComplex*       A,
+                                                const int               lda,
+                                                hipDoubleComplex*       B,
+                                                const int               ldb,
+                                                int*                    info);
+//! @}
+
+/*! @{
+    \brief SOLVER API
+
+    \details
+    potrsBatched solves a batch of systems of n linear equations on n variables
+    in their factorized forms.
+
+    For each instance i in the batch, it solves the system
+
+    \f[
+        A_i X_i = B_i
+    \f]
+
+    where \f$A_i\f$ is a Hermitian positive definite matrix defined by its triangular factor
+    as returned by \ref hipblasSpotrfBatched "potrfBatched".
+
+    - Supported precisions in rocSOLVER : s,d,c,z
+    - Supported precisions in cuBLAS    : s,d,c,z
+
+    @param[in]
+    handle    hipblasHandle_t.
+    @param[in]
+    uplo      hipblasFillMode_t.\n
+              Specifies whether the factors stored are upper or lower triangular.
+    @param[in]
+    n         int. n >= 0.\n
+              The number of rows and columns of all matrices A_i in the batch.
+    @param[in]
+    nrhs      int. nrhs >= 0.\n
+              The number of right hand sides, i.e., the number of columns
+              of the matrices B_i.
+    @param[in]
+    A         array of pointers to type. Each pointer points to an array on the GPU of dimension lda*n.\n
+              The factors U_i or L_i of the Cholesky factorizations returned by \ref hipblasSpotrfBatched "potrfBatched".
+    @param[in]
+    lda       int. lda >= n.\n
+              Specifies the leading dimension of matrices A_i.
+    @param[in,out]
+    B         array of pointers to type. Each pointer points to an array on the GPU of dimension ldb*nrhs.\n
+              On entry, the right hand side matrices B_i.
+              On exit, the solution matrices X_i.
+    @param[in]
+    ldb       int. ldb >= n.\n
+              The leading dimension of B_i.
+    @param[out]
+    info      pointer to a int on the host.\n
+              If info = 0, successful exit.
+              If info = j < 0, the argument at position -j is invalid.
+    @param[in]
+    batchCount int. batchCount >= 0.\n
+                Number of matrices in the batch.
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSpotrsBatched(hipblasHandle_t         handle,
+                                                    const hipblasFillMode_t uplo,
+                                                    const int               n,
+                                                    const int               nrhs,
+                                                    float* const            A[],
+                                                    const int               lda,
+                                                    float* const            B[],
+                                                    const int               ldb,
+                                                    int*                    info,
+                                                    const int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDpotrsBatched(hipblasHandle_t         handle,
+                                                    const hipblasFillMode_t uplo,
+                                                    const int               n,
+                                                    const int               nrhs,
+                                                    double* const           A[],
+                                                    const int               lda,
+                                                    double* const           B[],
+                                                    const int               ldb,
+                                                    int*                    info,
+                                                    const int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCpotrsBatched(hipblasHandle_t         handle,
+                                                    const hipblasFillMode_t uplo,
+                                                    const int               n,
+                                                    const int               nrhs,
+                                                    hipblasComplex* const   A[],
+                                                    const int               lda,
+                                                    hipblasComplex* const   B[],
+                                                    const int               ldb,
+                                                    int*                    info,
+                                                    const int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZpotrsBatched(hipblasHandle_t             handle,
+                                                    const hipblasFillMode_t     uplo,
+                                                    const int                   n,
+                                                    const int                   nrhs,
+                                                    hipblasDoubleComplex* const A[],
+                                                    const int                   lda,
+                                                    hipblasDoubleComplex* const B[],
+                                                    const int                   ldb,
+                                                    int*                        info,
+                                                    const int                   batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCpotrsBatched_v2(hipblasHandle_t         handle,
+                                                       const hipblasFillMode_t uplo,
+                                                       const int               n,
+                                                       const int               nrhs,
+                                                       hipComplex* const       A[],
+                                                       const int               lda,
+                                                       hipComplex* const       B[],
+                                                       const int               ldb,
+                                                       int*                    info,
+                                                       const int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZpotrsBatched_v2(hipblasHandle_t         handle,
+                                                       const hipblasFillMode_t uplo,
+                                                       const int               n,
+                                                       const int               nrhs,
+                                                       hipDoubleComplex* const A[],
+                                                       const int               lda,
+                                                       hipDoubleComplex* const B[],
+                                                       const int               ldb,
+                                                       int*                    info,
+                                                       const int               batchCount);
+//! @}
+
+/*! @{
+    \brief SOLVER API
+
+    \details
+    potrsStridedBatched solves a batch of systems of n linear equations on n variables
+    in their factorized forms.
+
+    For each instance i in the batch, it solves the system
+
+    \f[
+        A_i X_i = B_i
+    \f]
+
+    where \f$A_i\f$ is a Hermitian positive definite matrix defined by its triangular factor
+    as returned by \ref hipblasSpotrfStridedBatched "potrfStridedBatched".
+
+    - Supported precisions in rocSOLVER : s,d,c,z
+    - Supported precisions in cuBLAS    : s,d,c,z
+
+    @param[in]
+    handle    hipblasHandle_t.
+    @param[in]
+    uplo      hipblasFillMode_t.\n
+              Specifies whether the factors stored are upper or lower triangular.
+    @param[in]
+    n         int. n >= 0.\n
+              The number of rows and columns of all matrices A_i in the batch.
+    @param[in]
+    nrhs      int. nrhs >= 0.\n
+              The number of right hand sides, i.e., the number of columns
+              of the matrices B_i.
+    @param[in]
+    A         pointer to type. Array on the GPU (the size depends on the value of strideA).\n
+              The factors U_i or L_i of the Cholesky factorizations returned by \ref hipblasSpotrfStridedBatched "potrfStridedBatched".
+    @param[in]
+    lda       int. lda >= n.\n
+              Specifies the leading dimension of matrices A_i.
+    @param[in]
+    strideA   hipblasStride.\n
+              Stride from the start of one matrix A_i to the next one A_(i+1).
+              There is no restriction for the value of strideA. Normal use case is strideA >= lda*n
+    @param[in,out]
+    B         pointer to type. Array on the GPU (the size depends on the value of strideB).\n
+              On entry, the right hand side matrices B_i.
+              On exit, the solution matrices X_i.
+    @param[in]
+    ldb       int. ldb >= n.\n
+              The leading dimension of B_i.
+    @param[in]
+    strideB   hipblasStride.\n
+              Stride from the start of one matrix B_i to the next one B_(i+1).
+              There is no restriction for the value of strideB. Normal use case is strideB >= ldb*nrhs
+    @param[out]
+    info      pointer to a int on the host.\n
+              If info = 0, successful exit.
+              If info = j < 0, the argument at position -j is invalid.
+    @param[in]
+    batchCount int. batchCount >= 0.\n
+                Number of matrices in the batch.
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSpotrsStridedBatched(hipblasHandle_t         handle,
+                                                           const hipblasFillMode_t uplo,
+                                                           const int               n,
+                                                           const int               nrhs,
+                                                           float*                  A,
+                                                           const int               lda,
+                                                           const hipblasStride     strideA,
+                                                           float*                  B,
+                                                           const int               ldb,
+                                                           const hipblasStride     strideB,
+                                                           int*                    info,
+                                                           const int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDpotrsStridedBatched(hipblasHandle_t         handle,
+                                                           const hipblasFillMode_t uplo,
+                                                           const int               n,
+                                                           const int               nrhs,
+                                                           double*                 A,
+                                                           const int               lda,
+                                                           const hipblasStride     strideA,
+                                                           double*                 B,
+                                                           const int               ldb,
+                                                           const hipblasStride     strideB,
+                                                           int*                    info,
+                                                           const int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCpotrsStridedBatched(hipblasHandle_t         handle,
+                                                           const hipblasFillMode_t uplo,
+                                                           const int               n,
+                                                           const int               nrhs,
+                                                           hipblasComplex*         A,
+                                                           const int               lda,
+                                                           const hipblasStride     strideA,
+                                                           hipblasComplex*         B,
+                                                           const int               ldb,
+                                                           const hipblasStride     strideB,
+                                                           int*                    info,
+                                                           const int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZpotrsStridedBatched(hipblasHandle_t         handle,
+                                                           const hipblasFillMode_t uplo,
+                                                           const int               n,
+                                                           const int               nrhs,
+                                                           hipblasDoubleComplex*   A,
+                                                           const int               lda,
+                                                           const hipblasStride     strideA,
+                                                           hipblasDoubleComplex*   B,
+                                                           const int               ldb,
+                                                           const hipblasStride     strideB,
+                                                           int*                    info,
+                                                           const int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCpotrsStridedBatched_v2(hipblasHandle_t         handle,
+                                                              const hipblasFillMode_t uplo,
+                                                              const int               n,
+                                                              const int               nrhs,
+                                                              hipComplex*             A,
+                                                              const int               lda,
+                                                              const hipblasStride     strideA,
+                                                              hipComplex*             B,
+                                                              const int               ldb,
+                                                              const hipblasStride     strideB,
+                                                              int*                    info,
+                                                              const int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZpotrsStridedBatched_v2(hipblasHandle_t         handle,
+                                                              const hipblasFillMode_t uplo,
+                                                              const int               n,
+                                                              const int               nrhs,
+                                                              hipDoubleComplex*       A,
+                                                              const int               lda,
+                                                              const hipblasStride     strideA,
+                                                              hipDoubleComplex*       B,
+                                                              const int               ldb,
+                                                              const hipblasStride     strideB,
+                                                              int*                    info,
+                                                              const int               batchCount);
+//! @}
+
+/*! @{
+    \brief SOLVER API
+
+    \details
+    potri computes the inverse of a Hermitian positive definite n-by-n matrix A,
+    using the Cholesky factorization computed by \ref hipblasSpotrf "potrf".
+
+    \f[
+        A^{-1} = (U^H U)^{-1} = (L L^H)^{-1}
+    \f]
+
+    Only the uplo triangle of A is overwritten with the inverse.
+
+    On the cuBLAS backend the inverse of the factor is formed with trsm in an n-by-n
+    workspace the library allocates, and the product with syrk/herk.
+
+    - Supported precisions in rocSOLVER : s,d,c,z
+    - Supported precisions in cuBLAS    : s,d,c,z
+
+    @param[in]
+    handle    hipblasHandle_t.
+    @param[in]
+    uplo      hipblasFillMode_t.\n
+              Specifies whether the factor stored is upper or lower triangular.
+    @param[in]
+    n         int. n >= 0.\n
+              The number of rows and columns of the matrix A.
+    @param[inout]
+    A         pointer to type. Array on the GPU of dimension lda*n.\n
+              On entry, the factor U or L returned by \ref hipblasSpotrf "potrf".
+              On exit, the uplo triangle of the inverse of A.
+    @param[in]
+    lda       int. lda >= n.\n
+              Specifies the leading dimension of A.
+    @param[out]
+    info      pointer to a int on the GPU.\n
+              If info = 0, successful exit.
+              If info = j > 0, A is singular. A[j,j] is the first zero element of the diagonal of the factor.
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSpotri(hipblasHandle_t         handle,
+                                             const hipblasFillMode_t uplo,
+                                             const int               n,
+                                             float*                  A,
+                                             const int               lda,
+                                             int*                    info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDpotri(hipblasHandle_t         handle,
+                                             const hipblasFillMode_t uplo,
+                                             const int               n,
+                                             double*                 A,
+                                             const int               lda,
+                                             int*                    info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCpotri(hipblasHandle_t         handle,
+                                             const hipblasFillMode_t uplo,
+                                             const int               n,
+                                             hipblasComplex*         A,
+                                             const int               lda,
+                                             int*                    info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZpotri(hipblasHandle_t         handle,
+                                             const hipblasFillMode_t uplo,
+                                             const int               n,
+                                             hipblasDoubleComplex*   A,
+                                             const int               lda,
+                                             int*                    info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCpotri_v2(hipblasHandle_t         handle,
+                                                const hipblasFillMode_t uplo,
+                                                const int               n,
+                                                hipComplex*             A,
+                                                const int               lda,
+                                                int*                    info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZpotri_v2(hipblasHandle_t         handle,
+                                                const hipblasFillMode_t uplo,
+                                                const int               n,
+                                                hipDoubleComplex*       A,
+                                                const int               lda,
+                                                int*                    info);
+//! @}
+
+/*! @{
+    \brief SOLVER API
+
+    \details
+    potriBatched computes the inverses of a batch of Hermitian positive definite
+    n-by-n matrices \f$A_i\f$, using the Cholesky factorizations computed by
+    \ref hipblasSpotrfBatched "potrfBatched".
+
+    \f[
+        A_i^{-1} = (U_i^H U_i)^{-1} = (L_i L_i^H)^{-1}
+    \f]
+
+    Only the uplo triangle of \f$A_i\f$ is overwritten with the inverse.
+
+    On the cuBLAS backend the inverse of the factor is formed with trsm in an n-by-n
+    workspace the library allocates, and the product with syrk/herk.
+
+    - Supported precisions in rocSOLVER : s,d,c,z
+    - Supported precisions in cuBLAS    : s,d,c,z
+
+    @param[in]
+    handle    hipblasHandle_t.
+    @param[in]
+    uplo      hipblasFillMode_t.\n
+              Specifies whether the factors stored are upper or lower triangular.
+    @param[in]
+    n         int. n >= 0.\n
+              The number of rows and columns of all matrices A_i in the batch.
+    @param[inout]
+    A         array of pointers to type. Each pointer points to an array on the GPU of dimension lda*n.\n
+              On entry, the factors U_i or L_i returned by \ref hipblasSpotrfBatched "potrfBatched".
+              On exit, the uplo triangles of the inverses of A_i.
+    @param[in]
+    lda       int. lda >= n.\n
+              Specifies the leading dimension of matrices A_i.
+    @param[out]
+    info      pointer to int. Array of batchCount integers on the GPU.\n
+              If info[i] = 0, successful exit for A_i.
+              If info[i] = j > 0, A_i is singular. A_i[j,j] is the first zero element of the diagonal of the factor.
+    @param[in]
+    batchCount int. batchCount >= 0.\n
+                Number of matrices in the batch.
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSpotriBatched(hipblasHandle_t         handle,
+                                                    const hipblasFillMode_t uplo,
+                                                    const int               n,
+                                                    float* const            A[],
+                                                    const int               lda,
+                                                    int*                    info,
+                                                    const int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDpotriBatched(hipblasHandle_t         handle,
+                                                    const hipblasFillMode_t uplo,
+                                                    const int               n,
+                                                    double* const           A[],
+                                                    const int               lda,
+                                                    int*                    info,
+                                                    const int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCpotriBatched(hipblasHandle_t         handle,
+                                                    const hipblasFillMode_t uplo,
+                                                    const int               n,
+                                                    hipblasComplex* const   A[],
+                                                    const int               lda,
+                                                    int*                    info,
+                                                    const int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZpotriBatched(hipblasHandle_t             handle,
+                                                    const hipblasFillMode_t     uplo,
+                                                    const int                   n,
+                                                    hipblasDoubleComplex* const A[],
+                                                    const int                   lda,
+                                                    int*                        info,
+                                                    const int                   batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCpotriBatched_v2(hipblasHandle_t         handle,
+                                                       const hipblasFillMode_t uplo,
+                                                       const int               n,
+                                                       hipComplex* const       A[],
+                                                       const int               lda,
+                                                       int*                    info,
+                                                       const int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZpotriBatched_v2(hipblasHandle_t         handle,
+                                                       const hipblasFillMode_t uplo,
+                                                       const int               n,
+                                                       hipDoubleComplex* const A[],
+                                                       const int               lda,
+                                                       int*                    info,
+                                                       const int               batchCount);
+//! @}
+
+/*! @{
+    \brief SOLVER API
+
+    \details
+    potriStridedBatched computes the inverses of a batch of Hermitian positive definite
+    n-by-n matrices \f$A_i\f$, using the Cholesky factorizations computed by
+    \ref hipblasSpotrfStridedBatched "potrfStridedBatched".
+
+    \f[
+        A_i^{-1} = (U_i^H U_i)^{-1} = (L_i L_i^H)^{-1}
+    \f]
+
+    Only the uplo triangle of \f$A_i\f$ is overwritten with the inverse.
+
+    On the cuBLAS backend the inverse of the factor is formed with trsm in an n-by-n
+    workspace the library allocates, and the product with syrk/herk.
+
+    - Supported precisions in rocSOLVER : s,d,c,z
+    - Supported precisions in cuBLAS    : s,d,c,z
+
+    @param[in]
+    handle    hipblasHandle_t.
+    @param[in]
+    uplo      hipblasFillMode_t.\n
+              Specifies whether the factors stored are upper or lower triangular.
+    @param[in]
+    n         int. n >= 0.\n
+              The number of rows and columns of all matrices A_i in the batch.
+    @param[inout]
+    A         pointer to type. Array on the GPU (the size depends on the value of strideA).\n
+              On entry, the factors U_i or L_i returned by \ref hipblasSpotrfStridedBatched "potrfStridedBatched".
+              On exit, the uplo triangles of the inverses of A_i.
+    @param[in]
+    lda       int. lda >= n.\n
+              Specifies the leading dimension of matrices A_i.
+    @param[in]
+    strideA   hipblasStride.\n
+              Stride from the start of one matrix A_i to the next one A_(i+1).
+              There is no restriction for the value of strideA. Normal use case is strideA >= lda*n
+    @param[out]
+    info      pointer to int. Array of batchCount integers on the GPU.\n
+              If info[i] = 0, successful exit for A_i.
+              If info[i] = j > 0, A_i is singular. A_i[j,j] is the first zero element of the diagonal of the factor.
+    @param[in]
+    batchCount int. batchCount >= 0.\n
+                Number of matrices in the batch.
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSpotriStridedBatched(hipblasHandle_t         handle,
+                                                           const hipblasFillMode_t uplo,
+                                                           const int               n,
+                                                           float*                  A,
+                                                           const int               lda,
+                                                           const hipblasStride     strideA,
+                                                           int*                    info,
+                                                           const int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDpotriStridedBatched(hipblasHandle_t         handle,
+                                                           const hipblasFillMode_t uplo,
+                                                           const int               n,
+                                                           double*                 A,
+                                                           const int               lda,
+                                                           const hipblasStride     strideA,
+                                                           int*                    info,
+                                                           const int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCpotriStridedBatched(hipblasHandle_t         handle,
+                                                           const hipblasFillMode_t uplo,
+                                                           const int               n,
+                                                           hipblasComplex*         A,
+                                                           const int               lda,
+                                                           const hipblasStride     strideA,
+                                                           int*                    info,
+                                                           const int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZpotriStridedBatched(hipblasHandle_t         handle,
+                                                           const hipblasFillMode_t uplo,
+                                                           const int               n,
+                                                           hipblasDoubleComplex*   A,
+                                                           const int               lda,
+                                                           const hipblasStride     strideA,
+                                                           int*                    info,
+                                                           const int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCpotriStridedBatched_v2(hipblasHandle_t         handle,
+                                                              const hipblasFillMode_t uplo,
+                                                              const int               n,
+                                                              hipComplex*             A,
+                                                              const int               lda,
+                                                              const hipblasStride     strideA,
+                                                              int*                    info,
+                                                              const int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZpotriStridedBatched_v2(hipblasHandle_t         handle,
+                                                              const hipblasFillMode_t uplo,
+                                                              const int               n,
+                                                              hipDoubleComplex*       A,
+                                                              const int               lda,
+                                                              const hipblasStride     strideA,
+                                                              int*                    info,
+                                                              const int               batchCount);
+//! @}
+
 /*! @{
     \brief SOLVER API
 
@@ -31849,6 +33889,384 @@ HIPBLAS_EXPORT hipblasStatus_t
                                             hipblasGemmAlgo_t    algo,
                                             hipblasGemmFlags_t   flags);
 
+/*! \brief BLAS EX API
+
+    \details
+    gemmGroupedBatchedEx performs groups of batched matrix-matrix operations
+
+        C_i = alpha_g*op_g(A_i)*op_g(B_i) + beta_g*C_i,
+
+    where the problems are divided into groupCount groups and every problem i in group g
+    shares the operations, sizes m_g, n_g and k_g, leading dimensions and scalars alpha_g
+    and beta_g of that group. Different groups can have different sizes.
+
+    The problems of group 0 come first in the arrays A, B and C, followed by the problems
+    of group 1, and so on. The groups are run as batched gemm calls on the backend, and
+    adjacent groups with identical parameters share a call.
+
+    - Supported types are determined by the backend. See rocBLAS/cuBLAS documentation.
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    transAArray [hipblasOperation_t]
+              host array of groupCount values specifying the form of op( A ) for each group.
+    @param[in]
+    transBArray [hipblasOperation_t]
+              host array of groupCount values specifying the form of op( B ) for each group.
+    @param[in]
+    mArray    [int]
+              host array of groupCount values of matrix dimension m for each group.
+    @param[in]
+    nArray    [int]
+              host array of groupCount values of matrix dimension n for each group.
+    @param[in]
+    kArray    [int]
+              host array of groupCount values of matrix dimension k for each group.
+    @param[in]
+    alphaArray [const void *]
+              device or host array of groupCount scalars alpha, depending on the pointer mode.
+              Scalars have the precision of computeType and are real or complex as aType is.
+    @param[in]
+    A         [void *]
+              device array of device pointers to each matrix A_i, for all groups.
+    @param[in]
+    aType     [hipDataType]
+              specifies the datatype of each matrix A_i.
+    @param[in]
+    ldaArray  [int]
+              host array of groupCount leading dimensions of A_i for each group.
+    @param[in]
+    B         [void *]
+              device array of device pointers to each matrix B_i, for all groups.
+    @param[in]
+    bType     [hipDataType]
+              specifies the datatype of each matrix B_i.
+    @param[in]
+    ldbArray  [int]
+              host array of groupCount leading dimensions of B_i for each group.
+    @param[in]
+    betaArray [const void *]
+              device or host array of groupCount scalars beta, depending on the pointer mode.
+    @param[in]
+    C         [void *]
+              device array of device pointers to each matrix C_i, for all groups.
+    @param[in]
+    cType     [hipDataType]
+              specifies the datatype of each matrix C_i.
+    @param[in]
+    ldcArray  [int]
+              host array of groupCount leading dimensions of C_i for each group.
+    @param[in]
+    groupCount
+              [int]
+              number of groups.
+    @param[in]
+    groupSize [int]
+              host array of groupCount values specifying the number of problems in each group.
+    @param[in]
+    computeType
+              [hipblasComputeType_t]
+              specifies the datatype of computation.
+
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmGroupedBatchedEx(hipblasHandle_t          handle,
+                                                           const hipblasOperation_t transAArray[],
+                                                           const hipblasOperation_t transBArray[],
+                                                           const int                mArray[],
+                                                           const int                nArray[],
+                                                           const int                kArray[],
+                                                           const void*              alphaArray,
+                                                           const void*              A[],
+                                                           hipDataType              aType,
+                                                           const int                ldaArray[],
+                                                           const void*              B[],
+                                                           hipDataType              bType,
+                                                           const int                ldbArray[],
+                                                           const void*              betaArray,
+                                                           void*                    C[],
+                                                           hipDataType              cType,
+                                                           const int                ldcArray[],
+                                                           int                      groupCount,
+                                                           const int                groupSize[],
+                                                           hipblasComputeType_t     computeType);
+
+/*! \brief BLAS EX API
+
+    \details
+    gemmExWithEpilogue performs the matrix-matrix operation of hipblasGemmEx followed by the
+    operations of an epilogue on the result,
+
+        C(:,j) = act( alpha_j*op( A )*op( B )(:,j) + beta_j*C(:,j) + bias ),
+
+    in one call, so that the result does not go back and forth through memory for each
+    operation. The value before the activation is also written to aux when it is given, for use
+    in the backward pass. alpha_j and beta_j are the values of alphaVector and betaVector when they
+    are given, and alpha and beta otherwise.
+
+    The backends of hipBLAS have no fused epilogues, so the product is computed by hipblasGemmEx
+    and the epilogue is applied by a single kernel of hipBLAS. With scalar alpha and beta, the
+    kernel updates C in place; with alphaVector and betaVector, the product is computed into device
+    memory of the library first, taken from the workspace of the handle if one was set with
+    hipblasSetWorkspace. With no epilogue, or an epilogue that does nothing, the call is the same
+    as hipblasGemmEx.
+
+    - Supported types of C with an epilogue: HIP_R_16F, HIP_R_16BF, HIP_R_32F, HIP_R_64F.
+    - alphaVector and betaVector are given together, and hold values of type float, or of type
+      double when cType is HIP_R_64F; computeType must then be HIPBLAS_COMPUTE_32F or
+      HIPBLAS_COMPUTE_64F respectively.
+
+    The other parameters are those of hipblasGemmEx with the HIPBLAS_V2 interface.
+    @param[in]
+    epilogue  [const hipblasEpilogue_t *]
+              host pointer to the epilogue, or nullptr.
+
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmExWithEpilogue(hipblasHandle_t          handle,
+                                                         hipblasOperation_t       transA,
+                                                         hipblasOperation_t       transB,
+                                                         int                      m,
+                                                         int                      n,
+                                                         int                      k,
+                                                         const void*              alpha,
+                                                         const void*              A,
+                                                         hipDataType              aType,
+                                                         int                      lda,
+                                                         const void*              B,
+                                                         hipDataType              bType,
+                                                         int                      ldb,
+                                                         const void*              beta,
+                                                         void*                    C,
+                                                         hipDataType              cType,
+                                                         int                      ldc,
+                                                         hipblasComputeType_t     computeType,
+                                                         hipblasGemmAlgo_t        algo,
+                                                         const hipblasEpilogue_t* epilogue);
+
+/*! @{
+    \brief BLAS EX API
+
+    \details
+    gemmScaledEx performs the matrix-matrix operation of hipblasGemmEx on 8-bit floating point
+    matrices with scale factors,
+
+        C = alpha*( SA*op( A ) )*( op( B )*SB ) + beta*C,
+
+    where SA and SB are diagonal: with HIPBLAS_GEMM_SCALE_TENSOR, scaleA and scaleB hold one value
+    and SA and SB are that value times the identity, and with HIPBLAS_GEMM_SCALE_VECTOR, scaleA
+    holds m values, one per row of op( A ), and scaleB holds n values, one per column of op( B ).
+    The scales are device pointers to float, and a nullptr scale is 1. The batched functions use
+    the same scales for every problem of the batch.
+
+    The products are accumulated in float. The backends of hipBLAS have no 8-bit floating point
+    gemm with scales, so A and B are decoded and scaled to float by a kernel of hipBLAS, into
+    device memory of the library taken from the workspace of the handle if one was set with
+    hipblasSetWorkspace, and multiplied with the float gemm of the backend. The decoding is exact.
+    With a cType of HIP_R_16F or HIP_R_16BF, the product is also computed into that memory, and a
+    second kernel applies alpha and beta and rounds the result.
+
+    - Supported types of A and B: HIPBLAS_R_8F_E4M3, HIPBLAS_R_8F_E5M2, HIPBLAS_R_8F_E4M3_FNUZ and
+      HIPBLAS_R_8F_E5M2_FNUZ, in any combination.
+    - Supported types of C: HIP_R_32F, HIP_R_16F, HIP_R_16BF.
+    - computeType must be HIPBLAS_COMPUTE_32F, and alpha and beta are float.
+
+    The other parameters are those of hipblasGemmEx, hipblasGemmBatchedEx and
+    hipblasGemmStridedBatchedEx with the HIPBLAS_V2 interface.
+    @param[in]
+    scaleA    [const float *]
+              device pointer to the scale of A, or nullptr.
+    @param[in]
+    scaleModeA [hipblasGemmScaleMode_t]
+              specifies how scaleA is applied.
+    @param[in]
+    scaleB    [const float *]
+              device pointer to the scale of B, or nullptr.
+    @param[in]
+    scaleModeB [hipblasGemmScaleMode_t]
+              specifies how scaleB is applied.
+
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmScaledEx(hipblasHandle_t        handle,
+                                                   hipblasOperation_t     transA,
+                                                   hipblasOperation_t     transB,
+                                                   int                    m,
+                                                   int                    n,
+                                                   int                    k,
+                                                   const void*            alpha,
+                                                   const void*            A,
+                                                   hipDataType            aType,
+                                                   int                    lda,
+                                                   const float*           scaleA,
+                                                   hipblasGemmScaleMode_t scaleModeA,
+                                                   const void*            B,
+                                                   hipDataType            bType,
+                                                   int                    ldb,
+                                                   const float*           scaleB,
+                                                   hipblasGemmScaleMode_t scaleModeB,
+                                                   const void*            beta,
+                                                   void*                  C,
+                                                   hipDataType            cType,
+                                                   int                    ldc,
+                                                   hipblasComputeType_t   computeType,
+                                                   hipblasGemmAlgo_t      algo);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmBatchedScaledEx(hipblasHandle_t        handle,
+                                                          hipblasOperation_t     transA,
+                                                          hipblasOperation_t     transB,
+                                                          int                    m,
+                                                          int                    n,
+                                                          int                    k,
+                                                          const void*            alpha,
+                                                          const void*            A[],
+                                                          hipDataType            aType,
+                                                          int                    lda,
+                                                          const float*           scaleA,
+                                                          hipblasGemmScaleMode_t scaleModeA,
+                                                          const void*            B[],
+                                                          hipDataType            bType,
+                                                          int                    ldb,
+                                                          const float*           scaleB,
+                                                          hipblasGemmScaleMode_t scaleModeB,
+                                                          const void*            beta,
+                                                          void*                  C[],
+                                                          hipDataType            cType,
+                                                          int                    ldc,
+                                                          int                    batchCount,
+                                                          hipblasComputeType_t   computeType,
+                                                          hipblasGemmAlgo_t      algo);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasGemmStridedBatchedScaledEx(hipblasHandle_t        handle,
+                                      hipblasOperation_t     transA,
+                                      hipblasOperation_t     transB,
+                                      int                    m,
+                                      int                    n,
+                                      int                    k,
+                                      const void*            alpha,
+                                      const void*            A,
+                                      hipDataType            aType,
+                                      int                    lda,
+                                      hipblasStride          strideA,
+                                      const float*           scaleA,
+                                      hipblasGemmScaleMode_t scaleModeA,
+                                      const void*            B,
+                                      hipDataType            bType,
+                                      int                    ldb,
+                                      hipblasStride          strideB,
+                                      const float*           scaleB,
+                                      hipblasGemmScaleMode_t scaleModeB,
+                                      const void*            beta,
+                                      void*                  C,
+                                      hipDataType            cType,
+                                      int                    ldc,
+                                      hipblasStride          strideC,
+                                      int                    batchCount,
+                                      hipblasComputeType_t   computeType,
+                                      hipblasGemmAlgo_t      algo);
+//! @}
+
+/*! @{
+    \brief BLAS EX API
+
+    \details
+    matrixPack stores op( A ), the m by k first operand of a gemm, in a packed layout for
+    hipblasGemmPackedEx. When the same A is used by many gemms, as the weights in inference
+    are, it is packed once and every gemm reads it in the packed layout instead of the layout
+    of the caller.
+
+    The packed layout is op( A ) transposed, so that a column of the packed matrix holds a row
+    of op( A ) and the gemm reads A along k like B. Its leading dimension is rounded up to a
+    multiple of 128 bytes, so that every column is aligned. Conjugation is applied when packing.
+
+    The packed matrix is in device memory allocated by matrixPack for the current device, not
+    in the workspace of the handle; matrixPackGetSize returns its size and matrixPackDestroy
+    frees it. Packing runs on the stream of the handle.
+
+    - Supported types: HIP_R_8I, HIP_R_16F, HIP_R_16BF, HIP_R_32F, HIP_R_64F, HIP_C_32F, HIP_C_64F.
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    transA    [hipblasOperation_t]
+              specifies the form of op( A ).
+    @param[in]
+    m         [int]
+              number of rows of op( A ).
+    @param[in]
+    k         [int]
+              number of columns of op( A ).
+    @param[in]
+    A         [void *]
+              device pointer to the matrix A.
+    @param[in]
+    aType     [hipDataType]
+              specifies the datatype of matrix A.
+    @param[in]
+    lda       [int]
+              specifies the leading dimension of A.
+    @param[out]
+    packedA   [hipblasPackedMatrix_t *]
+              the packed matrix.
+    @param[out]
+    sizeInBytes
+              size of the device memory of the packed matrix in bytes.
+
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasMatrixPackGetSize(hipblasHandle_t    handle,
+                                                        hipblasOperation_t transA,
+                                                        int                m,
+                                                        int                k,
+                                                        hipDataType        aType,
+                                                        size_t*            sizeInBytes);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasMatrixPack(hipblasHandle_t        handle,
+                                                 hipblasOperation_t     transA,
+                                                 int                    m,
+                                                 int                    k,
+                                                 const void*            A,
+                                                 hipDataType            aType,
+                                                 int                    lda,
+                                                 hipblasPackedMatrix_t* packedA);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasMatrixPackDestroy(hipblasPackedMatrix_t packedA);
+//! @}
+
+/*! \brief BLAS EX API
+
+    \details
+    gemmPackedEx performs the matrix-matrix operation of hipblasGemmEx,
+
+        C = alpha*op( A )*op( B ) + beta*C,
+
+    where op( A ) was packed by hipblasMatrixPack. m and k must be the sizes op( A ) was packed
+    with, and the type of A is the type it was packed with. The gemm runs on the device the
+    matrix was packed on.
+
+    The other parameters are those of hipblasGemmEx with the HIPBLAS_V2 interface.
+    @param[in]
+    packedA   [hipblasPackedMatrix_t]
+              the packed matrix op( A ).
+
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmPackedEx(hipblasHandle_t       handle,
+                                                   hipblasPackedMatrix_t packedA,
+                                                   hipblasOperation_t    transB,
+                                                   int                   m,
+                                                   int                   n,
+                                                   int                   k,
+                                                   const void*           alpha,
+                                                   const void*           B,
+                                                   hipDataType           bType,
+                                                   int                   ldb,
+                                                   const void*           beta,
+                                                   void*                 C,
+                                                   hipDataType           cType,
+                                                   int                   ldc,
+                                                   hipblasComputeType_t  computeType,
+                                                   hipblasGemmAlgo_t     algo);
+
 /*! BLAS EX API
 
     \details
@@ -34772,6 +37190,794 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasScalStridedBatchedEx_v2_64(hipblasHandle_t
                                                                  int64_t         batchCount,
                                                                  hipDataType     executionType);
 
+/*
+ * ===========================================================================
+ *    hipblasXt multi-device Level 3 BLAS
+ * ===========================================================================
+ */
+
+/*! \brief Create a hipblasXt context
+    \details
+    The hipblasXt functions take matrices in host memory and split the work into tiles that
+    are scheduled over a list of devices, initially the current device. Each device has its own
+    hipBLAS handle, two streams and device buffers, so that the transfers of one tile overlap
+    the computation of another. A device that runs out of tiles takes tiles from the others.
+    Operands in pinned host memory give the best overlap. A context must not be used by several
+    threads at once.
+    @param[out]
+    handle      pointer to the new context
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasXtCreate(hipblasXtHandle_t* handle);
+
+/*! \brief Destroy a hipblasXt context and release its device resources */
+HIPBLAS_EXPORT hipblasStatus_t hipblasXtDestroy(hipblasXtHandle_t handle);
+
+/*! \brief Select the devices the hipblasXt functions run on
+    @param[in]
+    handle      [hipblasXtHandle_t]
+                handle to the hipblasXt context.
+    @param[in]
+    nbDevices   number of devices, at least 1
+    @param[in]
+    deviceId    array of nbDevices distinct device ids
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasXtDeviceSelect(hipblasXtHandle_t handle,
+                                                     int               nbDevices,
+                                                     int               deviceId[]);
+
+/*! \brief Set the tile size of the hipblasXt functions
+    \details
+    Output tiles are blockDim x blockDim; the default is 1024. Each device needs device memory
+    for two sets of three such tiles.
+    @param[in]
+    handle      [hipblasXtHandle_t]
+                handle to the hipblasXt context.
+    @param[in]
+    blockDim    tile size, greater than 0
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasXtSetBlockDim(hipblasXtHandle_t handle, int blockDim);
+
+/*! \brief Get the tile size of the hipblasXt functions */
+HIPBLAS_EXPORT hipblasStatus_t hipblasXtGetBlockDim(hipblasXtHandle_t handle, int* blockDim);
+
+/*! @{
+    \brief hipblasXt multi-device Level 3 API
+
+    \details
+    hipblasXtgemm performs the matrix-matrix operation
+
+        C = alpha*op( A )*op( B ) + beta*C,
+
+    on the devices of handle, with A, B and C in host memory. C is split into tiles of
+    blockDim x blockDim that are scheduled over the devices; see hipblasXtDeviceSelect.
+
+    - Supported precisions in rocBLAS : s,d,c,z
+    - Supported precisions in cuBLAS  : s,d,c,z
+
+    @param[in]
+    handle    [hipblasXtHandle_t]
+              handle to the hipblasXt context.
+    @param[in]
+    transa    [hipblasOperation_t]
+              specifies the form of op( A )
+    @param[in]
+    transb    [hipblasOperation_t]
+              specifies the form of op( B )
+    @param[in]
+    m         [size_t]
+              number or rows of matrices op( A ) and C
+    @param[in]
+    n         [size_t]
+              number of columns of matrices op( B ) and C
+    @param[in]
+    k         [size_t]
+              number of columns of matrix op( A ) and number of rows of matrix op( B )
+    @param[in]
+    alpha     host pointer specifying the scalar alpha.
+    @param[in]
+    A         host pointer storing matrix A.
+    @param[in]
+    lda       [size_t]
+              specifies the leading dimension of A.
+    @param[in]
+    B         host pointer storing matrix B.
+    @param[in]
+    ldb       [size_t]
+              specifies the leading dimension of B.
+    @param[in]
+    beta      host pointer specifying the scalar beta.
+    @param[in, out]
+    C         host pointer storing matrix C.
+    @param[in]
+    ldc       [size_t]
+              specifies the leading dimension of C.
+
+    ********************************************************************/
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasXtSgemm(hipblasXtHandle_t  handle,
+                                              hipblasOperation_t transa,
+                                              hipblasOperation_t transb,
+                                              size_t             m,
+                                              size_t             n,
+                                              size_t             k,
+                                              const float*       alpha,
+                                              const float*       A,
+                                              size_t             lda,
+                                              const float*       B,
+                                              size_t             ldb,
+                                              const float*       beta,
+                                              float*             C,
+                                              size_t             ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasXtDgemm(hipblasXtHandle_t  handle,
+                                              hipblasOperation_t transa,
+                                              hipblasOperation_t transb,
+                                              size_t             m,
+                                              size_t             n,
+                                              size_t             k,
+                                              const double*      alpha,
+                                              const double*      A,
+                                              size_t             lda,
+                                              const double*      B,
+                                              size_t             ldb,
+                                              const double*      beta,
+                                              double*            C,
+                                              size_t             ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasXtCgemm(hipblasXtHandle_t  handle,
+                                              hipblasOperation_t transa,
+                                              hipblasOperation_t transb,
+                                              size_t             m,
+                                              size_t             n,
+                                              size_t             k,
+                                              const hipComplex*  alpha,
+                                              const hipComplex*  A,
+                                              size_t             lda,
+                                              const hipComplex*  B,
+                                              size_t             ldb,
+                                              const hipComplex*  beta,
+                                              hipComplex*        C,
+                                              size_t             ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasXtZgemm(hipblasXtHandle_t       handle,
+                                              hipblasOperation_t      transa,
+                                              hipblasOperation_t      transb,
+                                              size_t                  m,
+                                              size_t                  n,
+                                              size_t                  k,
+                                              const hipDoubleComplex* alpha,
+                                              const hipDoubleComplex* A,
+                                              size_t                  lda,
+                                              const hipDoubleComplex* B,
+                                              size_t                  ldb,
+                                              const hipDoubleComplex* beta,
+                                              hipDoubleComplex*       C,
+                                              size_t                  ldc);
+//! @}
+
+/*! @{
+    \brief hipblasXt multi-device Level 3 API
+
+    \details
+    hipblasXtsyrk performs the symmetric rank k update
+
+        C = alpha*op( A )*op( A )**T + beta*C,
+
+    on the devices of handle, with A and C in host memory. Only the tiles of C that meet
+    the uplo triangle are computed, and only that triangle is written.
+
+    - Supported precisions in rocBLAS : s,d,c,z
+    - Supported precisions in cuBLAS  : s,d,c,z
+
+    @param[in]
+    handle    [hipblasXtHandle_t]
+              handle to the hipblasXt context.
+    @param[in]
+    uplo      [hipblasFillMode_t]
+              HIPBLAS_FILL_MODE_UPPER:  C is an upper triangular matrix
+              HIPBLAS_FILL_MODE_LOWER:  C is a  lower triangular matrix
+    @param[in]
+    trans     [hipblasOperation_t]
+              HIPBLAS_OP_T: op(A) = A**T
+              HIPBLAS_OP_N: op(A) = A
+              HIPBLAS_OP_C: op(A) = A**T, for real precisions only
+    @param[in]
+    n         [size_t]
+              n specifies the number of rows and columns of C.
+    @param[in]
+    k         [size_t]
+              k specifies the number of columns of op(A).
+    @param[in]
+    alpha     host pointer specifying the scalar alpha.
+    @param[in]
+    A         host pointer storing matrix A.
+    @param[in]
+    lda       [size_t]
+              specifies the leading dimension of A.
+    @param[in]
+    beta      host pointer specifying the scalar beta.
+    @param[in, out]
+    C         host pointer storing matrix C.
+    @param[in]
+    ldc       [size_t]
+              specifies the leading dimension of C.
+
+    ********************************************************************/
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasXtSsyrk(hipblasXtHandle_t  handle,
+                                              hipblasFillMode_t  uplo,
+                                              hipblasOperation_t trans,
+                                              size_t             n,
+                                              size_t             k,
+                                              const float*       alpha,
+                                              const float*       A,
+                                              size_t             lda,
+                                              const float*       beta,
+                                              float*             C,
+                                              size_t             ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasXtDsyrk(hipblasXtHandle_t  handle,
+                                              hipblasFillMode_t  uplo,
+                                              hipblasOperation_t trans,
+                                              size_t             n,
+                                              size_t             k,
+                                              const double*      alpha,
+                                              const double*      A,
+                                              size_t             lda,
+                                              const double*      beta,
+                                              double*            C,
+                                              size_t             ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasXtCsyrk(hipblasXtHandle_t  handle,
+                                              hipblasFillMode_t  uplo,
+                                              hipblasOperation_t trans,
+                                              size_t             n,
+                                              size_t             k,
+                                              const hipComplex*  alpha,
+                                              const hipComplex*  A,
+                                              size_t             lda,
+                                              const hipComplex*  beta,
+                                              hipComplex*        C,
+                                              size_t             ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasXtZsyrk(hipblasXtHandle_t       handle,
+                                              hipblasFillMode_t       uplo,
+                                              hipblasOperation_t      trans,
+                                              size_t                  n,
+                                              size_t                  k,
+                                              const hipDoubleComplex* alpha,
+                                              const hipDoubleComplex* A,
+                                              size_t                  lda,
+                                              const hipDoubleComplex* beta,
+                                              hipDoubleComplex*       C,
+                                              size_t                  ldc);
+//! @}
+
+/*! @{
+    \brief hipblasXt multi-device Level 3 API
+
+    \details
+    hipblasXttrsm solves
+
+        op(A)*X = alpha*B or X*op(A) = alpha*B,
+
+    on the devices of handle, with A and B in host memory; X overwrites B. Panels of
+    blockDim whole columns (left side) or rows (right side) of B are solved independently,
+    so each device needs memory for one panel of B on top of its tile buffers.
+
+    - Supported precisions in rocBLAS : s,d,c,z
+    - Supported precisions in cuBLAS  : s,d,c,z
+
+    @param[in]
+    handle    [hipblasXtHandle_t]
+              handle to the hipblasXt context.
+    @param[in]
+    side      [hipblasSideMode_t]
+              HIPBLAS_SIDE_LEFT:       op(A)*X = alpha*B.
+              HIPBLAS_SIDE_RIGHT:      X*op(A) = alpha*B.
+    @param[in]
+    uplo      [hipblasFillMode_t]
+              HIPBLAS_FILL_MODE_UPPER:  A is an upper triangular matrix.
+              HIPBLAS_FILL_MODE_LOWER:  A is a  lower triangular matrix.
+    @param[in]
+    trans     [hipblasOperation_t]
+              specifies the form of op( A )
+    @param[in]
+    diag      [hipblasDiagType_t]
+              HIPBLAS_DIAG_UNIT:     A is assumed to be unit triangular.
+              HIPBLAS_DIAG_NON_UNIT:  A is not assumed to be unit triangular.
+    @param[in]
+    m         [size_t]
+              m specifies the number of rows of B.
+    @param[in]
+    n         [size_t]
+              n specifies the number of columns of B.
+    @param[in]
+    alpha     host pointer specifying the scalar alpha.
+    @param[in]
+    A         host pointer storing matrix A.
+    @param[in]
+    lda       [size_t]
+              specifies the leading dimension of A.
+    @param[in,out]
+    B         host pointer storing matrix B.
+    @param[in]
+    ldb       [size_t]
+              specifies the leading dimension of B.
+
+    ********************************************************************/
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasXtStrsm(hipblasXtHandle_t  handle,
+                                              hipblasSideMode_t  side,
+                                              hipblasFillMode_t  uplo,
+                                              hipblasOperation_t trans,
+                                              hipblasDiagType_t  diag,
+                                              size_t             m,
+                                              size_t             n,
+                                              const float*       alpha,
+                                              const float*       A,
+                                              size_t             lda,
+                                              float*             B,
+                                              size_t             ldb);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasXtDtrsm(hipblasXtHandle_t  handle,
+                                              hipblasSideMode_t  side,
+                                              hipblasFillMode_t  uplo,
+                                              hipblasOperation_t trans,
+                                              hipblasDiagType_t  diag,
+                                              size_t             m,
+                                              size_t             n,
+                                              const double*      alpha,
+                                              const double*      A,
+                                              size_t             lda,
+                                              double*            B,
+                                              size_t             ldb);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasXtCtrsm(hipblasXtHandle_t  handle,
+                                              hipblasSideMode_t  side,
+                                              hipblasFillMode_t  uplo,
+                                              hipblasOperation_t trans,
+                                              hipblasDiagType_t  diag,
+                                              size_t             m,
+                                              size_t             n,
+                                              const hipComplex*  alpha,
+                                              const hipComplex*  A,
+                                              size_t             lda,
+                                              hipComplex*        B,
+                                              size_t             ldb);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasXtZtrsm(hipblasXtHandle_t       handle,
+                                              hipblasSideMode_t       side,
+                                              hipblasFillMode_t       uplo,
+                                              hipblasOperation_t      trans,
+                                              hipblasDiagType_t       diag,
+                                              size_t                  m,
+                                              size_t                  n,
+                                              const hipDoubleComplex* alpha,
+                                              const hipDoubleComplex* A,
+                                              size_t                  lda,
+                                              hipDoubleComplex*       B,
+                                              size_t                  ldb);
+//! @}
+
+/*! @{
+    \brief hipblasXt multi-device Level 3 API
+
+    \details
+    hipblasXtsymm performs one of the matrix-matrix operations
+
+        C = alpha*A*B + beta*C if side == HIPBLAS_SIDE_LEFT,
+        C = alpha*B*A + beta*C if side == HIPBLAS_SIDE_RIGHT,
+
+    on the devices of handle, where A is a symmetric matrix of which only the uplo triangle
+    is stored, and A, B and C are in host memory.
+
+    - Supported precisions in rocBLAS : s,d,c,z
+    - Supported precisions in cuBLAS  : s,d,c,z
+
+    @param[in]
+    handle    [hipblasXtHandle_t]
+              handle to the hipblasXt context.
+    @param[in]
+    side  [hipblasSideMode_t]
+            HIPBLAS_SIDE_LEFT:      C := alpha*A*B + beta*C
+            HIPBLAS_SIDE_RIGHT:     C := alpha*B*A + beta*C
+    @param[in]
+    uplo    [hipblasFillMode_t]
+            HIPBLAS_FILL_MODE_UPPER:  A is an upper triangular matrix
+            HIPBLAS_FILL_MODE_LOWER:  A is a  lower triangular matrix
+    @param[in]
+    m       [size_t]
+            m specifies the number of rows of B and C.
+    @param[in]
+    n       [size_t]
+            n specifies the number of columns of B and C.
+    @param[in]
+    alpha   host pointer specifying the scalar alpha.
+    @param[in]
+    A       host pointer storing matrix A.
+    @param[in]
+    lda     [size_t]
+            specifies the leading dimension of A.
+    @param[in]
+    B       host pointer storing matrix B.
+    @param[in]
+    ldb     [size_t]
+            specifies the leading dimension of B.
+    @param[in]
+    beta    host pointer specifying the scalar beta.
+    @param[in, out]
+    C       host pointer storing matrix C.
+    @param[in]
+    ldc     [size_t]
+            specifies the leading dimension of C.
+
+    ********************************************************************/
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasXtSsymm(hipblasXtHandle_t handle,
+                                              hipblasSideMode_t side,
+                                              hipblasFillMode_t uplo,
+                                              size_t            m,
+                                              size_t            n,
+                                              const float*      alpha,
+                                              const float*      A,
+                                              size_t            lda,
+                                              const float*      B,
+                                              size_t            ldb,
+                                              const float*      beta,
+                                              float*            C,
+                                              size_t            ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasXtDsymm(hipblasXtHandle_t handle,
+                                              hipblasSideMode_t side,
+                                              hipblasFillMode_t uplo,
+                                              size_t            m,
+                                              size_t            n,
+                                              const double*     alpha,
+                                              const double*     A,
+                                              size_t            lda,
+                                              const double*     B,
+                                              size_t            ldb,
+                                              const double*     beta,
+                                              double*           C,
+                                              size_t            ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasXtCsymm(hipblasXtHandle_t handle,
+                                              hipblasSideMode_t side,
+                                              hipblasFillMode_t uplo,
+                                              size_t            m,
+                                              size_t            n,
+                                              const hipComplex* alpha,
+                                              const hipComplex* A,
+                                              size_t            lda,
+                                              const hipComplex* B,
+                                              size_t            ldb,
+                                              const hipComplex* beta,
+                                              hipComplex*       C,
+                                              size_t            ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasXtZsymm(hipblasXtHandle_t       handle,
+                                              hipblasSideMode_t       side,
+                                              hipblasFillMode_t       uplo,
+                                              size_t                  m,
+                                              size_t                  n,
+                                              const hipDoubleComplex* alpha,
+                                              const hipDoubleComplex* A,
+                                              size_t                  lda,
+                                              const hipDoubleComplex* B,
+                                              size_t                  ldb,
+                                              const hipDoubleComplex* beta,
+                                              hipDoubleComplex*       C,
+                                              size_t                  ldc);
+//! @}
+
+/*
+ * ===========================================================================
+ *    Out-of-core gemm
+ * ===========================================================================
+ */
+
+/*! \brief Set the device memory budget of the out-of-core gemm functions
+    \details
+    The out-of-core gemm functions take matrices in host memory, which may be larger than the
+    device memory, and stream them through device buffers of at most bytes bytes in total.
+    The tile size of C is the largest that fits the budget. With a budget of 0, the default,
+    three quarters of the device memory free when the function is called is used.
+    @param[in]
+    handle      [hipblasHandle_t]
+                handle to the hipblas library context queue.
+    @param[in]
+    bytes       device memory budget in bytes, or 0
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetOutOfCoreMemoryBudget(hipblasHandle_t handle,
+                                                               size_t          bytes);
+
+/*! \brief Get the device memory budget of the out-of-core gemm functions */
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetOutOfCoreMemoryBudget(hipblasHandle_t handle,
+                                                               size_t*         bytes);
+
+/*! \brief Set the progress callback of the out-of-core gemm functions
+    \details
+    callback is called each time a tile of C has been written back to host memory, from a
+    thread of hipBLAS and before the out-of-core function returns. It must not use handle.
+    @param[in]
+    handle      [hipblasHandle_t]
+                handle to the hipblas library context queue.
+    @param[in]
+    callback    progress callback, or NULL for none
+    @param[in]
+    userData    passed to callback
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasSetOutOfCoreProgressCallback(hipblasHandle_t            handle,
+                                        hipblasOutOfCoreProgress_t callback,
+                                        void*                      userData);
+
+/*! @{
+    \brief Out-of-core gemm API
+
+    \details
+    hipblasGemmOutOfCore performs the matrix-matrix operation
+
+        C = alpha*op( A )*op( B ) + beta*C,
+
+    with A, B and C in host memory, on the current device. C is computed one tile at a time;
+    the panels of A and B each tile needs are streamed through a device memory budget, see
+    hipblasSetOutOfCoreMemoryBudget, and two tiles are in flight at once so that transfers
+    overlap computation. The function starts after the work already queued on the stream of
+    handle and returns when C has been written; the stream and pointer mode of handle are
+    left as they were. Operands in pinned host memory give the best overlap.
+
+    - Supported precisions in rocBLAS : s,d,c,z
+    - Supported precisions in cuBLAS  : s,d,c,z
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    transA    [hipblasOperation_t]
+              specifies the form of op( A )
+    @param[in]
+    transB    [hipblasOperation_t]
+              specifies the form of op( B )
+    @param[in]
+    m         [int64_t]
+              number or rows of matrices op( A ) and C
+    @param[in]
+    n         [int64_t]
+              number of columns of matrices op( B ) and C
+    @param[in]
+    k         [int64_t]
+              number of columns of matrix op( A ) and number of rows of matrix op( B )
+    @param[in]
+    alpha     host pointer specifying the scalar alpha.
+    @param[in]
+    A         host pointer storing matrix A.
+    @param[in]
+    lda       [int64_t]
+              specifies the leading dimension of A.
+    @param[in]
+    B         host pointer storing matrix B.
+    @param[in]
+    ldb       [int64_t]
+              specifies the leading dimension of B.
+    @param[in]
+    beta      host pointer specifying the scalar beta.
+    @param[in, out]
+    C         host pointer storing matrix C.
+    @param[in]
+    ldc       [int64_t]
+              specifies the leading dimension of C.
+
+    ********************************************************************/
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgemmOutOfCore(hipblasHandle_t    handle,
+                                                     hipblasOperation_t transA,
+                                                     hipblasOperation_t transB,
+                                                     int64_t            m,
+                                                     int64_t            n,
+                                                     int64_t            k,
+                                                     const float*       alpha,
+                                                     const float*       A,
+                                                     int64_t            lda,
+                                                     const float*       B,
+                                                     int64_t            ldb,
+                                                     const float*       beta,
+                                                     float*             C,
+                                                     int64_t            ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgemmOutOfCore(hipblasHandle_t    handle,
+                                                     hipblasOperation_t transA,
+                                                     hipblasOperation_t transB,
+                                                     int64_t            m,
+                                                     int64_t            n,
+                                                     int64_t            k,
+                                                     const double*      alpha,
+                                                     const double*      A,
+                                                     int64_t            lda,
+                                                     const double*      B,
+                                                     int64_t            ldb,
+                                                     const double*      beta,
+                                                     double*            C,
+                                                     int64_t            ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemmOutOfCore(hipblasHandle_t    handle,
+                                                     hipblasOperation_t transA,
+                                                     hipblasOperation_t transB,
+                                                     int64_t            m,
+                                                     int64_t            n,
+                                                     int64_t            k,
+                                                     const hipComplex*  alpha,
+                                                     const hipComplex*  A,
+                                                     int64_t            lda,
+                                                     const hipComplex*  B,
+                                                     int64_t            ldb,
+                                                     const hipComplex*  beta,
+                                                     hipComplex*        C,
+                                                     int64_t            ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgemmOutOfCore(hipblasHandle_t         handle,
+                                                     hipblasOperation_t      transA,
+                                                     hipblasOperation_t      transB,
+                                                     int64_t                 m,
+                                                     int64_t                 n,
+                                                     int64_t                 k,
+                                                     const hipDoubleComplex* alpha,
+                                                     const hipDoubleComplex* A,
+                                                     int64_t                 lda,
+                                                     const hipDoubleComplex* B,
+                                                     int64_t                 ldb,
+                                                     const hipDoubleComplex* beta,
+                                                     hipDoubleComplex*       C,
+                                                     int64_t                 ldc);
+//! @}
+
+/*! @{
+    \brief Out-of-core gemm API
+
+    \details
+    hipblasGemmStridedBatchedOutOfCore performs the matrix-matrix operations
+
+        C_i = alpha*op( A_i )*op( B_i ) + beta*C_i, for i = 1, ..., batchCount,
+
+    with A_i, B_i and C_i in host memory, on the current device. The tiles of all the problems
+    are streamed as in hipblasGemmOutOfCore, and the progress callback counts the tiles of all
+    the problems.
+
+    - Supported precisions in rocBLAS : s,d,c,z
+    - Supported precisions in cuBLAS  : s,d,c,z
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    transA    [hipblasOperation_t]
+              specifies the form of op( A )
+    @param[in]
+    transB    [hipblasOperation_t]
+              specifies the form of op( B )
+    @param[in]
+    m         [int64_t]
+              number or rows of matrices op( A_i ) and C_i
+    @param[in]
+    n         [int64_t]
+              number of columns of matrices op( B_i ) and C_i
+    @param[in]
+    k         [int64_t]
+              number of columns of matrix op( A_i ) and number of rows of matrix op( B_i )
+    @param[in]
+    alpha     host pointer specifying the scalar alpha.
+    @param[in]
+    A         host pointer pointing to the first matrix A_1.
+    @param[in]
+    lda       [int64_t]
+              specifies the leading dimension of each A_i.
+    @param[in]
+    strideA   [hipblasStride]
+              stride from the start of one A_i matrix to the next A_(i + 1).
+    @param[in]
+    B         host pointer pointing to the first matrix B_1.
+    @param[in]
+    ldb       [int64_t]
+              specifies the leading dimension of each B_i.
+    @param[in]
+    strideB   [hipblasStride]
+              stride from the start of one B_i matrix to the next B_(i + 1).
+    @param[in]
+    beta      host pointer specifying the scalar beta.
+    @param[in, out]
+    C         host pointer pointing to the first matrix C_1.
+    @param[in]
+    ldc       [int64_t]
+              specifies the leading dimension of each C_i.
+    @param[in]
+    strideC   [hipblasStride]
+              stride from the start of one C_i matrix to the next C_(i + 1).
+    @param[in]
+    batchCount
+              [int64_t]
+              number of gemm operations in the batch.
+
+    ********************************************************************/
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgemmStridedBatchedOutOfCore(hipblasHandle_t    handle,
+                                                                   hipblasOperation_t transA,
+                                                                   hipblasOperation_t transB,
+                                                                   int64_t            m,
+                                                                   int64_t            n,
+                                                                   int64_t            k,
+                                                                   const float*       alpha,
+                                                                   const float*       A,
+                                                                   int64_t            lda,
+                                                                   hipblasStride      strideA,
+                                                                   const float*       B,
+                                                                   int64_t            ldb,
+                                                                   hipblasStride      strideB,
+                                                                   const float*       beta,
+                                                                   float*             C,
+                                                                   int64_t            ldc,
+                                                                   hipblasStride      strideC,
+                                                                   int64_t            batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgemmStridedBatchedOutOfCore(hipblasHandle_t    handle,
+                                                                   hipblasOperation_t transA,
+                                                                   hipblasOperation_t transB,
+                                                                   int64_t            m,
+                                                                   int64_t            n,
+                                                                   int64_t            k,
+                                                                   const double*      alpha,
+                                                                   const double*      A,
+                                                                   int64_t            lda,
+                                                                   hipblasStride      strideA,
+                                                                   const double*      B,
+                                                                   int64_t            ldb,
+                                                                   hipblasStride      strideB,
+                                                                   const double*      beta,
+                                                                   double*            C,
+                                                                   int64_t            ldc,
+                                                                   hipblasStride      strideC,
+                                                                   int64_t            batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemmStridedBatchedOutOfCore(hipblasHandle_t    handle,
+                                                                   hipblasOperation_t transA,
+                                                                   hipblasOperation_t transB,
+                                                                   int64_t            m,
+                                                                   int64_t            n,
+                                                                   int64_t            k,
+                                                                   const hipComplex*  alpha,
+                                                                   const hipComplex*  A,
+                                                                   int64_t            lda,
+                                                                   hipblasStride      strideA,
+                                                                   const hipComplex*  B,
+                                                                   int64_t            ldb,
+                                                                   hipblasStride      strideB,
+                                                                   const hipComplex*  beta,
+                                                                   hipComplex*        C,
+                                                                   int64_t            ldc,
+                                                                   hipblasStride      strideC,
+                                                                   int64_t            batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZgemmStridedBatchedOutOfCore(hipblasHandle_t         handle,
+                                        hipblasOperation_t      transA,
+                                        hipblasOperation_t      transB,
+                                        int64_t                 m,
+                                        int64_t                 n,
+                                        int64_t                 k,
+                                        const hipDoubleComplex* alpha,
+                                        const hipDoubleComplex* A,
+                                        int64_t                 lda,
+                                        hipblasStride           strideA,
+                                        const hipDoubleComplex* B,
+                                        int64_t                 ldb,
+                                        hipblasStride           strideB,
+                                        const hipDoubleComplex* beta,
+                                        hipDoubleComplex*       C,
+                                        int64_t                 ldc,
+                                        hipblasStride           strideC,
+                                        int64_t                 batchCount);
+//! @}
+
 #ifdef HIPBLAS_V2
 
 // HIPBLAS_V2 Ex functions using hipDataType
@@ -35423,6 +38629,13 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasScalStridedBatchedEx_v2_64(hipblasHandle_t
 #define hipblasCgemmStridedBatched_64 hipblasCgemmStridedBatched_v2_64
 #define hipblasZgemmStridedBatched_64 hipblasZgemmStridedBatched_v2_64
 
+#define hipblasCgemm3m hipblasCgemm3m_v2
+#define hipblasZgemm3m hipblasZgemm3m_v2
+#define hipblasCgemm3mBatched hipblasCgemm3mBatched_v2
+#define hipblasZgemm3mBatched hipblasZgemm3mBatched_v2
+#define hipblasCgemm3mStridedBatched hipblasCgemm3mStridedBatched_v2
+#define hipblasZgemm3mStridedBatched hipblasZgemm3mStridedBatched_v2
+
 #define hipblasCherk hipblasCherk_v2
 #define hipblasZherk hipblasZherk_v2
 #define hipblasCherkBatched hipblasCherkBatched_v2
@@ -35629,6 +38842,27 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasScalStridedBatchedEx_v2_64(hipblasHandle_t
 #define hipblasCgeqrfStridedBatched hipblasCgeqrfStridedBatched_v2
 #define hipblasZgeqrfStridedBatched hipblasZgeqrfStridedBatched_v2
 
+#define hipblasCpotrf hipblasCpotrf_v2
+#define hipblasZpotrf hipblasZpotrf_v2
+#define hipblasCpotrfBatched hipblasCpotrfBatched_v2
+#define hipblasZpotrfBatched hipblasZpotrfBatched_v2
+#define hipblasCpotrfStridedBatched hipblasCpotrfStridedBatched_v2
+#define hipblasZpotrfStridedBatched hipblasZpotrfStridedBatched_v2
+
+#define hipblasCpotrs hipblasCpotrs_v2
+#define hipblasZpotrs hipblasZpotrs_v2
+#define hipblasCpotrsBatched hipblasCpotrsBatched_v2
+#define hipblasZpotrsBatched hipblasZpotrsBatched_v2
+#define hipblasCpotrsStridedBatched hipblasCpotrsStridedBatched_v2
+#define hipblasZpotrsStridedBatched hipblasZpotrsStridedBatched_v2
+
+#define hipblasCpotri hipblasCpotri_v2
+#define hipblasZpotri hipblasZpotri_v2
+#define hipblasCpotriBatched hipblasCpotriBatched_v2
+#define hipblasZpotriBatched hipblasZpotriBatched_v2
+#define hipblasCpotriStridedBatched hipblasCpotriStridedBatched_v2
+#define hipblasZpotriStridedBatched hipblasZpotriStridedBatched_v2
+
 #endif
 
 /*! HIPBLAS Auxiliary API
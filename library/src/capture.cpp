@@ -0,0 +1,320 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "handle_state.hpp"
+#include "exceptions.hpp"
+#include <atomic>
+#include <memory>
+
+// Number of captures in progress, so that the entry points which can be recorded only
+// look up the state of their handle while one is
+static std::atomic<int> hipblas_capture_sessions{0};
+
+hipblas_capture_session::hipblas_capture_session()
+{
+    hipblas_capture_sessions++;
+}
+
+hipblas_capture_session::~hipblas_capture_session()
+{
+    // The handle was destroyed during the capture
+    hipStreamCaptureStatus capturing = hipStreamCaptureStatusNone;
+    if(guard && hipStreamIsCapturing(guard, &capturing) == hipSuccess
+       && capturing != hipStreamCaptureStatusNone)
+    {
+        hipGraph_t graph = nullptr;
+        if(hipStreamEndCapture(guard, &graph) == hipSuccess && graph)
+            (void)hipGraphDestroy(graph);
+    }
+    if(guard)
+        (void)hipStreamDestroy(guard);
+    hipblas_capture_sessions--;
+}
+
+hipblas_capture_graph* hipblas_capturing(hipblasHandle_t handle)
+{
+    if(!hipblas_capture_sessions.load(std::memory_order_relaxed) || !handle)
+        return nullptr;
+
+    hipblas_handle_state& state = hipblas_get_handle_state(handle);
+    return state.capture ? &state.capture->calls : nullptr;
+}
+
+// The recorded calls, with the device copy of their scalars and the HIP graph they
+// were last captured into, for the handle and stream of the last launch
+struct hipblasGraph
+{
+    ~hipblasGraph()
+    {
+        if(exec)
+            (void)hipGraphExecDestroy(exec);
+        if(scalars)
+            (void)hipFree(scalars);
+    }
+
+    hipblas_capture_graph calls;
+    void*                 scalars = nullptr;
+
+    hipGraphExec_t  exec         = nullptr;
+    hipblasHandle_t exec_handle  = nullptr;
+    hipStream_t     exec_stream  = nullptr;
+    uint64_t        exec_version = 0;
+    bool            exec_failed  = false; // the calls could not be captured there
+};
+
+// Runs the calls directly on handle in device pointer mode
+static hipblasStatus_t hipblasGraphReplay(hipblasGraph_t graph, hipblasHandle_t handle)
+{
+    hipblasPointerMode_t mode;
+    hipblasStatus_t      status = hipblasGetPointerMode(handle, &mode);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    status = graph->calls.replay(handle, graph->scalars);
+    (void)hipblasSetPointerMode(handle, mode);
+    return status;
+}
+
+// Captures the calls on stream into graph->exec, updating the HIP graph of an earlier
+// capture when its topology allows
+static hipblasStatus_t
+    hipblasGraphInstantiate(hipblasGraph_t graph, hipblasHandle_t handle, hipStream_t stream)
+{
+    graph->exec_handle  = handle;
+    graph->exec_stream  = stream;
+    graph->exec_version = graph->calls.version();
+    graph->exec_failed  = true;
+
+    if(hipStreamBeginCapture(stream, hipStreamCaptureModeThreadLocal) != hipSuccess)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    hipblasStatus_t status    = hipblasGraphReplay(graph, handle);
+    hipGraph_t      hip_graph = nullptr;
+    hipError_t      error     = hipStreamEndCapture(stream, &hip_graph);
+    if(status != HIPBLAS_STATUS_SUCCESS || error != hipSuccess)
+    {
+        if(hip_graph)
+            (void)hipGraphDestroy(hip_graph);
+        return status;
+    }
+
+    hipGraphNode_t           error_node;
+    hipGraphExecUpdateResult result;
+    if(!graph->exec
+       || hipGraphExecUpdate(graph->exec, hip_graph, &error_node, &result) != hipSuccess)
+    {
+        if(graph->exec)
+            (void)hipGraphExecDestroy(graph->exec);
+        graph->exec = nullptr;
+        error       = hipGraphInstantiate(&graph->exec, hip_graph, nullptr, nullptr, 0);
+        if(error != hipSuccess)
+            graph->exec = nullptr;
+    }
+    (void)hipGraphDestroy(hip_graph);
+    graph->exec_failed = !graph->exec;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+extern "C" {
+
+hipblasStatus_t hipblasBeginCapture(hipblasHandle_t handle)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    hipblas_handle_state& state = hipblas_get_handle_state(handle);
+    if(state.capture)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    auto            session = std::make_unique<hipblas_capture_session>();
+    hipblasStatus_t status  = hipblasGetStream(handle, &session->stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    hipError_t error = hipStreamCreateWithFlags(&session->guard, hipStreamNonBlocking);
+    if(error == hipSuccess)
+        error = hipStreamBeginCapture(session->guard, hipStreamCaptureModeRelaxed);
+    if(error != hipSuccess)
+        return hipblas_hip_to_status(error);
+
+    status = hipblasSetStream(handle, session->guard);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        state.capture = std::move(session);
+    return status;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasEndCapture(hipblasHandle_t handle, hipblasGraph_t* graph)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!graph)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblas_handle_state& state = hipblas_get_handle_state(handle);
+    if(!state.capture)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    std::unique_ptr<hipblas_capture_session> session = std::move(state.capture);
+    hipblasStatus_t status = hipblasSetStream(handle, session->stream);
+
+    // Work left on the guard stream comes from routines which were not recorded; a
+    // failed capture, from one which synchronized
+    hipGraph_t guard_graph = nullptr;
+    size_t     nodes       = 0;
+    hipError_t error       = hipStreamEndCapture(session->guard, &guard_graph);
+    if(error == hipSuccess)
+        error = hipGraphGetNodes(guard_graph, nullptr, &nodes);
+    if(guard_graph)
+        (void)hipGraphDestroy(guard_graph);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    if(error != hipSuccess || nodes)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    auto result   = std::make_unique<hipblasGraph>();
+    result->calls = std::move(session->calls);
+    if(!result->calls.scalars().empty())
+    {
+        error = hipMalloc(&result->scalars, result->calls.scalars().size());
+        if(error != hipSuccess)
+        {
+            result->scalars = nullptr;
+            return hipblas_hip_to_status(error);
+        }
+    }
+    *graph = result.release();
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGraphLaunch(hipblasGraph_t graph, hipblasHandle_t handle)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!graph || hipblas_capturing(handle))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipStream_t     stream;
+    hipblasStatus_t status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // Copies from pageable memory are staged before hipMemcpyAsync returns, so the
+    // scalars can be set again right away
+    if(graph->calls.take_scalars_changed())
+    {
+        const std::vector<char>& scalars = graph->calls.scalars();
+        hipError_t               error   = hipMemcpyAsync(
+            graph->scalars, scalars.data(), scalars.size(), hipMemcpyHostToDevice, stream);
+        if(error != hipSuccess)
+            return hipblas_hip_to_status(error);
+    }
+
+    // The null stream cannot be captured
+    if(!stream)
+        return hipblasGraphReplay(graph, handle);
+
+    bool current = graph->exec_handle == handle && graph->exec_stream == stream
+                   && graph->exec_version == graph->calls.version();
+    if(!current)
+    {
+        status = hipblasGraphInstantiate(graph, handle, stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+    }
+    if(graph->exec_failed)
+        return hipblasGraphReplay(graph, handle);
+    return hipblas_hip_to_status(hipGraphLaunch(graph->exec, stream));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGraphUpdatePointer(hipblasGraph_t graph,
+                                          const void*    oldPointer,
+                                          const void*    newPointer)
+try
+{
+    if(!graph)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    return graph->calls.update_pointer(oldPointer, newPointer) ? HIPBLAS_STATUS_SUCCESS
+                                                               : HIPBLAS_STATUS_INVALID_VALUE;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t
+    hipblasGraphUpdateScalar(hipblasGraph_t graph, int node, int scalar, const void* value)
+try
+{
+    if(!graph || node < 0 || scalar < 0 || !value)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    return graph->calls.update_scalar(node, scalar, value) ? HIPBLAS_STATUS_SUCCESS
+                                                           : HIPBLAS_STATUS_INVALID_VALUE;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGraphGetNodeCount(hipblasGraph_t graph, int* count)
+try
+{
+    if(!graph || !count)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    *count = int(graph->calls.size());
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGraphDestroy(hipblasGraph_t graph)
+try
+{
+    if(!graph)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    delete graph;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+} // extern "C"
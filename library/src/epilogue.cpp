@@ -0,0 +1,203 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "device_scratch.hpp"
+#include "epilogue.hpp"
+#include "exceptions.hpp"
+#include <algorithm>
+
+static size_t hipblas_epilogue_type_size(hipDataType type)
+{
+    switch(type)
+    {
+    case HIP_R_16F:
+    case HIP_R_16BF:
+        return 2;
+    case HIP_R_32F:
+        return 4;
+    case HIP_R_64F:
+        return 8;
+    default:
+        return 0;
+    }
+}
+
+extern "C" {
+
+hipblasStatus_t hipblasGemmExWithEpilogue(hipblasHandle_t          handle,
+                                          hipblasOperation_t       transA,
+                                          hipblasOperation_t       transB,
+                                          int                      m,
+                                          int                      n,
+                                          int                      k,
+                                          const void*              alpha,
+                                          const void*              A,
+                                          hipDataType              aType,
+                                          int                      lda,
+                                          const void*              B,
+                                          hipDataType              bType,
+                                          int                      ldb,
+                                          const void*              beta,
+                                          void*                    C,
+                                          hipDataType              cType,
+                                          int                      ldc,
+                                          hipblasComputeType_t     computeType,
+                                          hipblasGemmAlgo_t        algo,
+                                          const hipblasEpilogue_t* epilogue)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    bool vectors = epilogue && (epilogue->alphaVector || epilogue->betaVector);
+    if(!epilogue
+       || (!epilogue->bias && !epilogue->aux && !vectors
+           && epilogue->activation == HIPBLAS_EPILOGUE_ACTIVATION_NONE))
+        return hipblasGemmEx_v2(handle,
+                                transA,
+                                transB,
+                                m,
+                                n,
+                                k,
+                                alpha,
+                                A,
+                                aType,
+                                lda,
+                                B,
+                                bType,
+                                ldb,
+                                beta,
+                                C,
+                                cType,
+                                ldc,
+                                computeType,
+                                algo);
+
+    if(epilogue->activation != HIPBLAS_EPILOGUE_ACTIVATION_NONE
+       && epilogue->activation != HIPBLAS_EPILOGUE_ACTIVATION_RELU
+       && epilogue->activation != HIPBLAS_EPILOGUE_ACTIVATION_GELU)
+        return HIPBLAS_STATUS_INVALID_ENUM;
+    if(m < 0 || n < 0 || ldc < m || (epilogue->aux && epilogue->ldaux < m))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    size_t type_size = hipblas_epilogue_type_size(cType);
+    if(!type_size)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(vectors)
+    {
+        if(!epilogue->alphaVector || !epilogue->betaVector)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(computeType != (cType == HIP_R_64F ? HIPBLAS_COMPUTE_64F : HIPBLAS_COMPUTE_32F))
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+
+    hipStream_t     stream;
+    hipblasStatus_t status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    hipblas_epilogue_args args;
+    args.type       = cType;
+    args.m          = m;
+    args.n          = n;
+    args.C          = C;
+    args.ldc        = ldc;
+    args.bias       = epilogue->bias;
+    args.aux        = epilogue->aux;
+    args.ldaux      = epilogue->ldaux;
+    args.activation = epilogue->activation;
+
+    // With per-column scalars the product goes to D, and the kernel combines it with C
+    hipblas_device_scratch product(handle);
+    if(vectors)
+    {
+        status = product.reserve(std::max(size_t(m) * n * type_size, size_t(1)));
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        hipblasPointerMode_t mode;
+        status = hipblasGetPointerMode(handle, &mode);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        float  one_f = 1, zero_f = 0;
+        double one_d = 1, zero_d = 0;
+        bool   dp    = cType == HIP_R_64F;
+        status       = hipblasGemmEx_v2(handle,
+                                  transA,
+                                  transB,
+                                  m,
+                                  n,
+                                  k,
+                                  dp ? (const void*)&one_d : &one_f,
+                                  A,
+                                  aType,
+                                  lda,
+                                  B,
+                                  bType,
+                                  ldb,
+                                  dp ? (const void*)&zero_d : &zero_f,
+                                  product.data(),
+                                  cType,
+                                  std::max(m, 1),
+                                  computeType,
+                                  algo);
+        (void)hipblasSetPointerMode(handle, mode);
+
+        args.D     = product.data();
+        args.ldd   = std::max(m, 1);
+        args.alpha = epilogue->alphaVector;
+        args.beta  = epilogue->betaVector;
+    }
+    else
+        status = hipblasGemmEx_v2(handle,
+                                  transA,
+                                  transB,
+                                  m,
+                                  n,
+                                  k,
+                                  alpha,
+                                  A,
+                                  aType,
+                                  lda,
+                                  B,
+                                  bType,
+                                  ldb,
+                                  beta,
+                                  C,
+                                  cType,
+                                  ldc,
+                                  computeType,
+                                  algo);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    return hipblas_launch_epilogue(args, stream);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+} // extern "C"
@@ -0,0 +1,99 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+// The epilogue kernel of hipblasGemmExWithEpilogue, for the backends that have no
+// fused epilogue.
+
+#include "epilogue.hpp"
+#include <algorithm>
+#include <hip/hip_bfloat16.h>
+#include <hip/hip_fp16.h>
+#include <hip/hip_runtime.h>
+
+// Element types are converted to Ts, double for double and float for the others
+template <typename T, typename Ts>
+__global__ void __launch_bounds__(256) hipblas_epilogue_kernel(hipblas_epilogue_args args)
+{
+    int64_t i = int64_t(blockIdx.x) * blockDim.x + threadIdx.x;
+    if(i >= args.m)
+        return;
+
+    const Ts bias = args.bias ? Ts(((const T*)args.bias)[i]) : Ts(0);
+    for(int64_t j = blockIdx.y; j < args.n; j += gridDim.y)
+    {
+        T* C = (T*)args.C + i + j * args.ldc;
+        Ts x;
+        if(args.D)
+        {
+            Ts alpha = ((const Ts*)args.alpha)[j];
+            Ts beta  = ((const Ts*)args.beta)[j];
+            x        = alpha * Ts(((const T*)args.D)[i + j * args.ldd]);
+            if(beta != Ts(0))
+                x += beta * Ts(*C);
+        }
+        else
+            x = Ts(*C);
+        x += bias;
+
+        if(args.aux)
+            ((T*)args.aux)[i + j * args.ldaux] = T(x);
+
+        if(args.activation == HIPBLAS_EPILOGUE_ACTIVATION_RELU)
+            x = x > Ts(0) ? x : Ts(0);
+        else if(args.activation == HIPBLAS_EPILOGUE_ACTIVATION_GELU)
+            x = Ts(0.5) * x
+                * (Ts(1) + tanh(Ts(0.7978845608028654) * (x + Ts(0.044715) * x * x * x)));
+        *C = T(x);
+    }
+}
+
+template <typename T, typename Ts>
+static hipblasStatus_t hipblas_launch_epilogue_template(const hipblas_epilogue_args& args,
+                                                        hipStream_t                  stream)
+{
+    constexpr int threads = 256;
+    dim3          grid((args.m + threads - 1) / threads, std::min<int64_t>(args.n, 65535));
+    hipLaunchKernelGGL((hipblas_epilogue_kernel<T, Ts>), grid, dim3(threads), 0, stream, args);
+    return hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                           : HIPBLAS_STATUS_EXECUTION_FAILED;
+}
+
+hipblasStatus_t hipblas_launch_epilogue(const hipblas_epilogue_args& args, hipStream_t stream)
+{
+    if(args.m <= 0 || args.n <= 0)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    switch(args.type)
+    {
+    case HIP_R_16F:
+        return hipblas_launch_epilogue_template<__half, float>(args, stream);
+    case HIP_R_16BF:
+        return hipblas_launch_epilogue_template<hip_bfloat16, float>(args, stream);
+    case HIP_R_32F:
+        return hipblas_launch_epilogue_template<float, float>(args, stream);
+    case HIP_R_64F:
+        return hipblas_launch_epilogue_template<double, double>(args, stream);
+    default:
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+}
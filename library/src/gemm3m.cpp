@@ -0,0 +1,285 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "device_scratch.hpp"
+#include "gemm3m.hpp"
+#include <algorithm>
+#include <type_traits>
+
+static size_t hipblas_gemm3m_align(size_t size)
+{
+    return (size + hipblas_workspace_alignment - 1) / hipblas_workspace_alignment
+           * hipblas_workspace_alignment;
+}
+
+// The product of one pair of planes of the split A and B into a plane of P, for all the
+// matrices of the batch
+template <typename T>
+static hipblasStatus_t hipblas_gemm3m_real(hipblasHandle_t    handle,
+                                           hipblasOperation_t transA,
+                                           hipblasOperation_t transB,
+                                           int                m,
+                                           int                n,
+                                           int                k,
+                                           const T*           A,
+                                           int                lda,
+                                           const T*           B,
+                                           int                ldb,
+                                           T*                 P,
+                                           int                batchCount)
+{
+    const T one = 1, zero = 0;
+    if constexpr(std::is_same_v<T, float>)
+        return hipblasSgemmStridedBatched(handle,
+                                          transA,
+                                          transB,
+                                          m,
+                                          n,
+                                          k,
+                                          &one,
+                                          A,
+                                          lda,
+                                          (long long)lda * (transA == HIPBLAS_OP_N ? k : m),
+                                          B,
+                                          ldb,
+                                          (long long)ldb * (transB == HIPBLAS_OP_N ? n : k),
+                                          &zero,
+                                          P,
+                                          m,
+                                          (long long)m * n,
+                                          batchCount);
+    else
+        return hipblasDgemmStridedBatched(handle,
+                                          transA,
+                                          transB,
+                                          m,
+                                          n,
+                                          k,
+                                          &one,
+                                          A,
+                                          lda,
+                                          (long long)lda * (transA == HIPBLAS_OP_N ? k : m),
+                                          B,
+                                          ldb,
+                                          (long long)ldb * (transB == HIPBLAS_OP_N ? n : k),
+                                          &zero,
+                                          P,
+                                          m,
+                                          (long long)m * n,
+                                          batchCount);
+}
+
+template <typename T>
+static hipblasStatus_t hipblas_gemm3m_template(hipblasHandle_t    handle,
+                                               hipDataType        type,
+                                               hipblasOperation_t transA,
+                                               hipblasOperation_t transB,
+                                               int                m,
+                                               int                n,
+                                               int                k,
+                                               const void*        alpha,
+                                               const void*        A,
+                                               int                lda,
+                                               int64_t            strideA,
+                                               const void*        B,
+                                               int                ldb,
+                                               int64_t            strideB,
+                                               const void*        beta,
+                                               void*              C,
+                                               int                ldc,
+                                               int64_t            strideC,
+                                               int                batchCount,
+                                               bool               batched)
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    for(auto trans : {transA, transB})
+        if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T && trans != HIPBLAS_OP_C)
+            return HIPBLAS_STATUS_INVALID_ENUM;
+
+    int rowsA = transA == HIPBLAS_OP_N ? m : k, colsA = transA == HIPBLAS_OP_N ? k : m;
+    int rowsB = transB == HIPBLAS_OP_N ? k : n, colsB = transB == HIPBLAS_OP_N ? n : k;
+    if(m < 0 || n < 0 || k < 0 || batchCount < 0 || lda < std::max(rowsA, 1)
+       || ldb < std::max(rowsB, 1) || ldc < std::max(m, 1))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    if(!m || !n || !batchCount)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    hipblasPointerMode_t mode;
+    hipblasStatus_t      status = hipblasGetPointerMode(handle, &mode);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    if(!alpha || !beta || !C || (k && (!A || !B)))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipStream_t stream;
+    status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // Three planes each of the split A and B and of the real products
+    int64_t planeA = int64_t(rowsA) * colsA * batchCount;
+    int64_t planeB = int64_t(rowsB) * colsB * batchCount;
+    int64_t planeP = int64_t(m) * n * batchCount;
+    size_t  sizeA  = hipblas_gemm3m_align(3 * sizeof(T) * planeA);
+    size_t  sizeB  = hipblas_gemm3m_align(3 * sizeof(T) * planeB);
+    size_t  sizeP  = 3 * sizeof(T) * planeP;
+
+    hipblas_device_scratch scratch(handle);
+    status = scratch.reserve(sizeA + sizeB + sizeP);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    T* dA = (T*)scratch.data();
+    T* dB = (T*)((char*)scratch.data() + sizeA);
+    T* dP = (T*)((char*)scratch.data() + sizeA + sizeB);
+
+    hipblas_gemm3m_split_args splitA;
+    splitA.type        = type;
+    splitA.rows        = rowsA;
+    splitA.cols        = colsA;
+    splitA.A           = A;
+    splitA.batched     = batched;
+    splitA.lda         = lda;
+    splitA.stride      = strideA;
+    splitA.D           = dA;
+    splitA.batch_count = batchCount;
+    splitA.conjugate   = transA == HIPBLAS_OP_C;
+
+    hipblas_gemm3m_split_args splitB;
+    splitB.type        = type;
+    splitB.rows        = rowsB;
+    splitB.cols        = colsB;
+    splitB.A           = B;
+    splitB.batched     = batched;
+    splitB.lda         = ldb;
+    splitB.stride      = strideB;
+    splitB.D           = dB;
+    splitB.batch_count = batchCount;
+    splitB.conjugate   = transB == HIPBLAS_OP_C;
+
+    status = hipblas_launch_gemm3m_split(splitA, stream);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblas_launch_gemm3m_split(splitB, stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // The conjugation is in the split, so the real products only transpose
+    hipblasOperation_t opA = transA == HIPBLAS_OP_N ? HIPBLAS_OP_N : HIPBLAS_OP_T;
+    hipblasOperation_t opB = transB == HIPBLAS_OP_N ? HIPBLAS_OP_N : HIPBLAS_OP_T;
+    int                ldA = std::max(rowsA, 1), ldB = std::max(rowsB, 1);
+
+    status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // T1 = Ar*Br, T2 = Ai*Bi and T3 = (Ar + Ai)*(Br + Bi)
+    for(int plane = 0; plane < 3 && status == HIPBLAS_STATUS_SUCCESS; plane++)
+        status = hipblas_gemm3m_real<T>(handle,
+                                        opA,
+                                        opB,
+                                        m,
+                                        n,
+                                        k,
+                                        dA + plane * planeA,
+                                        ldA,
+                                        dB + plane * planeB,
+                                        ldB,
+                                        dP + plane * planeP,
+                                        batchCount);
+    (void)hipblasSetPointerMode(handle, mode);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    hipblas_gemm3m_merge_args merge;
+    merge.type        = type;
+    merge.m           = m;
+    merge.n           = n;
+    merge.P           = dP;
+    merge.C           = C;
+    merge.batched     = batched;
+    merge.ldc         = ldc;
+    merge.stride      = strideC;
+    merge.batch_count = batchCount;
+    if(mode == HIPBLAS_POINTER_MODE_HOST)
+    {
+        for(int i = 0; i < 2; i++)
+        {
+            merge.alpha[i] = ((const T*)alpha)[i];
+            merge.beta[i]  = ((const T*)beta)[i];
+        }
+    }
+    else
+    {
+        merge.alpha_ptr = alpha;
+        merge.beta_ptr  = beta;
+    }
+    return hipblas_launch_gemm3m_merge(merge, stream);
+}
+
+hipblasStatus_t hipblas_gemm3m(hipblasHandle_t    handle,
+                               hipDataType        type,
+                               hipblasOperation_t transA,
+                               hipblasOperation_t transB,
+                               int                m,
+                               int                n,
+                               int                k,
+                               const void*        alpha,
+                               const void*        A,
+                               int                lda,
+                               int64_t            strideA,
+                               const void*        B,
+                               int                ldb,
+                               int64_t            strideB,
+                               const void*        beta,
+                               void*              C,
+                               int                ldc,
+                               int64_t            strideC,
+                               int                batchCount,
+                               bool               batched)
+{
+    auto gemm3m = type == HIP_C_32F ? hipblas_gemm3m_template<float>
+                                    : hipblas_gemm3m_template<double>;
+    return gemm3m(handle,
+                  type,
+                  transA,
+                  transB,
+                  m,
+                  n,
+                  k,
+                  alpha,
+                  A,
+                  lda,
+                  strideA,
+                  B,
+                  ldb,
+                  strideB,
+                  beta,
+                  C,
+                  ldc,
+                  strideC,
+                  batchCount,
+                  batched);
+}
@@ -0,0 +1,141 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "gemm3m.hpp"
+#include <algorithm>
+#include <hip/hip_runtime.h>
+
+// The complex matrices are read and written as pairs of T, the real and imaginary parts
+
+template <typename T>
+__global__ void __launch_bounds__(256) hipblas_gemm3m_split_kernel(hipblas_gemm3m_split_args args)
+{
+    int64_t r = int64_t(blockIdx.x) * blockDim.x + threadIdx.x;
+    if(r >= args.rows)
+        return;
+
+    const int64_t size  = args.rows * args.cols;
+    const int64_t plane = size * args.batch_count;
+    for(int64_t b = blockIdx.z; b < args.batch_count; b += gridDim.z)
+    {
+        const T* A = args.batched ? ((const T* const*)args.A)[b]
+                                  : (const T*)args.A + 2 * b * args.stride;
+        T*       D = (T*)args.D + b * size;
+        for(int64_t c = blockIdx.y; c < args.cols; c += gridDim.y)
+        {
+            T re = A[2 * (r + c * args.lda)];
+            T im = A[2 * (r + c * args.lda) + 1];
+            if(args.conjugate)
+                im = -im;
+
+            int64_t i        = r + c * args.rows;
+            D[i]             = re;
+            D[plane + i]     = im;
+            D[2 * plane + i] = re + im;
+        }
+    }
+}
+
+template <typename T>
+__global__ void __launch_bounds__(256) hipblas_gemm3m_merge_kernel(hipblas_gemm3m_merge_args args)
+{
+    int64_t i = int64_t(blockIdx.x) * blockDim.x + threadIdx.x;
+    if(i >= args.m)
+        return;
+
+    const T* alpha_ptr = (const T*)args.alpha_ptr;
+    const T* beta_ptr  = (const T*)args.beta_ptr;
+    T        alpha_re  = alpha_ptr ? alpha_ptr[0] : T(args.alpha[0]);
+    T        alpha_im  = alpha_ptr ? alpha_ptr[1] : T(args.alpha[1]);
+    T        beta_re   = beta_ptr ? beta_ptr[0] : T(args.beta[0]);
+    T        beta_im   = beta_ptr ? beta_ptr[1] : T(args.beta[1]);
+
+    const int64_t size  = args.m * args.n;
+    const int64_t plane = size * args.batch_count;
+    for(int64_t b = blockIdx.z; b < args.batch_count; b += gridDim.z)
+    {
+        T*       C = args.batched ? ((T* const*)args.C)[b] : (T*)args.C + 2 * b * args.stride;
+        const T* P = (const T*)args.P + b * size;
+        for(int64_t j = blockIdx.y; j < args.n; j += gridDim.y)
+        {
+            int64_t p  = i + j * args.m;
+            T       t1 = P[p], t2 = P[plane + p], t3 = P[2 * plane + p];
+            T       re = t1 - t2;
+            T       im = t3 - t1 - t2;
+
+            T* c    = C + 2 * (i + j * args.ldc);
+            T  x_re = alpha_re * re - alpha_im * im;
+            T  x_im = alpha_re * im + alpha_im * re;
+            if(beta_re != 0 || beta_im != 0)
+            {
+                x_re += beta_re * c[0] - beta_im * c[1];
+                x_im += beta_re * c[1] + beta_im * c[0];
+            }
+            c[0] = x_re;
+            c[1] = x_im;
+        }
+    }
+}
+
+static dim3 hipblas_gemm3m_grid(int64_t rows, int64_t cols, int64_t batch_count)
+{
+    return dim3((rows + 255) / 256,
+                std::min<int64_t>(cols, 65535),
+                std::min<int64_t>(batch_count, 65535));
+}
+
+hipblasStatus_t hipblas_launch_gemm3m_split(const hipblas_gemm3m_split_args& args,
+                                            hipStream_t                      stream)
+{
+    if(args.rows <= 0 || args.cols <= 0 || args.batch_count <= 0)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    dim3 grid = hipblas_gemm3m_grid(args.rows, args.cols, args.batch_count);
+    if(args.type == HIP_C_32F)
+        hipLaunchKernelGGL((hipblas_gemm3m_split_kernel<float>), grid, 256, 0, stream, args);
+    else if(args.type == HIP_C_64F)
+        hipLaunchKernelGGL((hipblas_gemm3m_split_kernel<double>), grid, 256, 0, stream, args);
+    else
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    return hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                           : HIPBLAS_STATUS_EXECUTION_FAILED;
+}
+
+hipblasStatus_t hipblas_launch_gemm3m_merge(const hipblas_gemm3m_merge_args& args,
+                                            hipStream_t                      stream)
+{
+    if(args.m <= 0 || args.n <= 0 || args.batch_count <= 0)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    dim3 grid = hipblas_gemm3m_grid(args.m, args.n, args.batch_count);
+    if(args.type == HIP_C_32F)
+        hipLaunchKernelGGL((hipblas_gemm3m_merge_kernel<float>), grid, 256, 0, stream, args);
+    else if(args.type == HIP_C_64F)
+        hipLaunchKernelGGL((hipblas_gemm3m_merge_kernel<double>), grid, 256, 0, stream, args);
+    else
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    return hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                           : HIPBLAS_STATUS_EXECUTION_FAILED;
+}
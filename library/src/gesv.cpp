@@ -0,0 +1,738 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "gesv_refinement.hpp"
+#include "device_scratch.hpp"
+#include "exceptions.hpp"
+#include "stream_pool.hpp"
+#include <cstring>
+#include <initializer_list>
+#include <type_traits>
+
+#ifdef __HIP_PLATFORM_SOLVER__
+
+static hipblasStatus_t
+    hipblasGesvGetrf(hipblasHandle_t handle, int n, float* A, int lda, int* ipiv, int* info)
+{
+    return hipblasSgetrf(handle, n, A, lda, ipiv, info);
+}
+
+static hipblasStatus_t
+    hipblasGesvGetrf(hipblasHandle_t handle, int n, double* A, int lda, int* ipiv, int* info)
+{
+    return hipblasDgetrf(handle, n, A, lda, ipiv, info);
+}
+
+static hipblasStatus_t
+    hipblasGesvGetrf(hipblasHandle_t handle, int n, hipComplex* A, int lda, int* ipiv, int* info)
+{
+    return hipblasCgetrf_v2(handle, n, A, lda, ipiv, info);
+}
+
+static hipblasStatus_t hipblasGesvGetrf(
+    hipblasHandle_t handle, int n, hipDoubleComplex* A, int lda, int* ipiv, int* info)
+{
+    return hipblasZgetrf_v2(handle, n, A, lda, ipiv, info);
+}
+
+static hipblasStatus_t hipblasGesvGetrs(hipblasHandle_t handle,
+                                        int             n,
+                                        int             nrhs,
+                                        float*          A,
+                                        int             lda,
+                                        const int*      ipiv,
+                                        float*          B,
+                                        int             ldb,
+                                        int*            info)
+{
+    return hipblasSgetrs(handle, HIPBLAS_OP_N, n, nrhs, A, lda, ipiv, B, ldb, info);
+}
+
+static hipblasStatus_t hipblasGesvGetrs(hipblasHandle_t handle,
+                                        int             n,
+                                        int             nrhs,
+                                        double*         A,
+                                        int             lda,
+                                        const int*      ipiv,
+                                        double*         B,
+                                        int             ldb,
+                                        int*            info)
+{
+    return hipblasDgetrs(handle, HIPBLAS_OP_N, n, nrhs, A, lda, ipiv, B, ldb, info);
+}
+
+static hipblasStatus_t hipblasGesvGetrs(hipblasHandle_t handle,
+                                        int             n,
+                                        int             nrhs,
+                                        hipComplex*     A,
+                                        int             lda,
+                                        const int*      ipiv,
+                                        hipComplex*     B,
+                                        int             ldb,
+                                        int*            info)
+{
+    return hipblasCgetrs_v2(handle, HIPBLAS_OP_N, n, nrhs, A, lda, ipiv, B, ldb, info);
+}
+
+static hipblasStatus_t hipblasGesvGetrs(hipblasHandle_t   handle,
+                                        int               n,
+                                        int               nrhs,
+                                        hipDoubleComplex* A,
+                                        int               lda,
+                                        const int*        ipiv,
+                                        hipDoubleComplex* B,
+                                        int               ldb,
+                                        int*              info)
+{
+    return hipblasZgetrs_v2(handle, HIPBLAS_OP_N, n, nrhs, A, lda, ipiv, B, ldb, info);
+}
+
+static hipblasStatus_t hipblasGesvResidual(hipblasHandle_t handle,
+                                           int             n,
+                                           int             nrhs,
+                                           const double*   A,
+                                           int             lda,
+                                           const double*   X,
+                                           int             ldx,
+                                           double*         R,
+                                           int             ldr)
+{
+    const double minus_one = -1, one = 1;
+    return hipblasDgemm(
+        handle, HIPBLAS_OP_N, HIPBLAS_OP_N, n, nrhs, n, &minus_one, A, lda, X, ldx, &one, R, ldr);
+}
+
+static hipblasStatus_t hipblasGesvResidual(hipblasHandle_t         handle,
+                                           int                     n,
+                                           int                     nrhs,
+                                           const hipDoubleComplex* A,
+                                           int                     lda,
+                                           const hipDoubleComplex* X,
+                                           int                     ldx,
+                                           hipDoubleComplex*       R,
+                                           int                     ldr)
+{
+    const hipDoubleComplex minus_one = make_hipDoubleComplex(-1, 0);
+    const hipDoubleComplex one       = make_hipDoubleComplex(1, 0);
+    return hipblasZgemm_v2(
+        handle, HIPBLAS_OP_N, HIPBLAS_OP_N, n, nrhs, n, &minus_one, A, lda, X, ldx, &one, R, ldr);
+}
+
+// hipblas_gesv_device on the stream of a handle. The work buffers are kept for the
+// problems of a batch and released with the device.
+template <typename T, typename L>
+class hipblas_gesv_gpu : public hipblas_gesv_device<T, L>
+{
+public:
+    hipblas_gesv_gpu(hipblasHandle_t handle, hipStream_t stream)
+        : m_handle(handle)
+        , m_stream(stream)
+        , m_memory(handle)
+    {
+    }
+
+    hipblas_gesv_gpu(const hipblas_gesv_gpu&) = delete;
+    hipblas_gesv_gpu& operator=(const hipblas_gesv_gpu&) = delete;
+
+    hipblasStatus_t prepare(int n, int nrhs) override
+    {
+        m_rhs_offset      = align(size_t(n) * n * sizeof(L));
+        m_residual_offset = m_rhs_offset + align(size_t(n) * nrhs * sizeof(L));
+        m_flags_offset    = m_residual_offset + align(size_t(n) * nrhs * sizeof(T));
+        return m_memory.reserve(m_flags_offset + sizeof(hipblas_gesv_flags));
+    }
+
+    L* low_matrix() override
+    {
+        return (L*)m_memory.data();
+    }
+
+    L* low_rhs() override
+    {
+        return (L*)((char*)m_memory.data() + m_rhs_offset);
+    }
+
+    T* residual() override
+    {
+        return (T*)((char*)m_memory.data() + m_residual_offset);
+    }
+
+    hipblasStatus_t
+        copy(T* dst, int ld_dst, const T* src, int ld_src, int rows, int cols) override
+    {
+        if(!rows || !cols)
+            return HIPBLAS_STATUS_SUCCESS;
+        return hipblas_hip_to_status(hipMemcpy2DAsync(dst,
+                                                      size_t(ld_dst) * sizeof(T),
+                                                      src,
+                                                      size_t(ld_src) * sizeof(T),
+                                                      size_t(rows) * sizeof(T),
+                                                      cols,
+                                                      hipMemcpyDeviceToDevice,
+                                                      m_stream));
+    }
+
+    hipblasStatus_t demote(
+        L* dst, int ld_dst, const T* src, int ld_src, int rows, int cols, bool& fits) override
+    {
+        hipblas_gesv_flags* flags  = this->flags();
+        hipblasStatus_t     status = clear(flags);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblas_launch_gesv_demote(
+                {complex, rows, cols, src, ld_src, dst, ld_dst, &flags->overflow}, m_stream);
+
+        hipblas_gesv_flags host;
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = fetch(host);
+        fits = !host.overflow;
+        return status;
+    }
+
+    hipblasStatus_t norm_inf(int n, const T* A, int lda, double& norm) override
+    {
+        hipblas_gesv_flags* flags  = this->flags();
+        hipblasStatus_t     status = clear(flags);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblas_launch_gesv_norm({complex, n, A, lda, &flags->norm}, m_stream);
+
+        hipblas_gesv_flags host;
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = fetch(host);
+        std::memcpy(&norm, &host.norm, sizeof(double));
+        return status;
+    }
+
+    hipblasStatus_t
+        update(T* X, int ldx, const L* D, int ldd, int rows, int cols, bool first) override
+    {
+        return hipblas_launch_gesv_update({complex, rows, cols, D, ldd, X, ldx, first}, m_stream);
+    }
+
+    hipblasStatus_t check(int      n,
+                          int      nrhs,
+                          const T* X,
+                          int      ldx,
+                          const T* R,
+                          int      ldr,
+                          double   cte,
+                          L*       low_R,
+                          int      ld_low,
+                          bool&    converged,
+                          bool&    fits) override
+    {
+        hipblas_gesv_flags* flags  = this->flags();
+        hipblasStatus_t     status = clear(flags);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblas_launch_gesv_check(
+                {complex, n, nrhs, X, ldx, R, ldr, cte, &flags->unconverged}, m_stream);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblas_launch_gesv_demote(
+                {complex, n, nrhs, R, ldr, low_R, ld_low, &flags->overflow}, m_stream);
+
+        hipblas_gesv_flags host;
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = fetch(host);
+        converged = !host.unconverged;
+        fits      = !host.overflow;
+        return status;
+    }
+
+    hipblasStatus_t getrf(int n, L* A, int lda, int* ipiv, int& info) override
+    {
+        return factor(n, A, lda, ipiv, info);
+    }
+
+    hipblasStatus_t getrf(int n, T* A, int lda, int* ipiv, int& info) override
+    {
+        return factor(n, A, lda, ipiv, info);
+    }
+
+    hipblasStatus_t
+        getrs(int n, int nrhs, const L* A, int lda, const int* ipiv, L* B, int ldb) override
+    {
+        int info;
+        return hipblasGesvGetrs(m_handle, n, nrhs, (L*)A, lda, ipiv, B, ldb, &info);
+    }
+
+    hipblasStatus_t
+        getrs(int n, int nrhs, const T* A, int lda, const int* ipiv, T* B, int ldb) override
+    {
+        int info;
+        return hipblasGesvGetrs(m_handle, n, nrhs, (T*)A, lda, ipiv, B, ldb, &info);
+    }
+
+    hipblasStatus_t residual(
+        int n, int nrhs, const T* A, int lda, const T* X, int ldx, T* R, int ldr) override
+    {
+        return hipblasGesvResidual(m_handle, n, nrhs, A, lda, X, ldx, R, ldr);
+    }
+
+private:
+    static constexpr bool complex = std::is_same<T, hipDoubleComplex>{};
+
+    // What the kernels report to the host, read back in one copy
+    struct hipblas_gesv_flags
+    {
+        int                info        = 0;
+        int                overflow    = 0;
+        int                unconverged = 0;
+        unsigned long long norm        = 0;
+    };
+
+    static size_t align(size_t bytes)
+    {
+        return (bytes + 255) / 256 * 256;
+    }
+
+    hipblas_gesv_flags* flags()
+    {
+        return (hipblas_gesv_flags*)((char*)m_memory.data() + m_flags_offset);
+    }
+
+    hipblasStatus_t clear(hipblas_gesv_flags* flags)
+    {
+        return hipblas_hip_to_status(
+            hipMemsetAsync(flags, 0, sizeof(hipblas_gesv_flags), m_stream));
+    }
+
+    hipblasStatus_t fetch(hipblas_gesv_flags& host)
+    {
+        return hipblas_handle_memcpy(
+            m_handle, &host, flags(), sizeof(hipblas_gesv_flags), hipMemcpyDeviceToHost);
+    }
+
+    // getrf with the info of the device copied to the host
+    template <typename U>
+    hipblasStatus_t factor(int n, U* A, int lda, int* ipiv, int& info)
+    {
+        int*            device_info = &flags()->info;
+        hipblasStatus_t status      = hipblasGesvGetrf(m_handle, n, A, lda, ipiv, device_info);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        return hipblas_handle_memcpy(
+            m_handle, &info, device_info, sizeof(int), hipMemcpyDeviceToHost);
+    }
+
+    hipblasHandle_t        m_handle;
+    hipStream_t            m_stream;
+    hipblas_device_scratch m_memory;
+    size_t                 m_rhs_offset      = 0;
+    size_t                 m_residual_offset = 0;
+    size_t                 m_flags_offset    = 0;
+};
+
+// Pointers of problem b of a gesv call
+template <typename T>
+struct hipblasGesvProblem
+{
+    T*       A;
+    int*     ipiv;
+    const T* B;
+    T*       X;
+};
+
+// Returns -i for the first argument i, counted after the handle, whose check fails, or 0
+static int hipblasGesvInfo(std::initializer_list<bool> invalid)
+{
+    int position = 1;
+    for(bool bad : invalid)
+    {
+        if(bad)
+            return -position;
+        position++;
+    }
+    return 0;
+}
+
+// Solves the batch_count problems given by problem(b) one after the other, with the
+// handle in host pointer mode for the residual gemms, and writes the info of the high
+// precision factorizations to deviceInfo
+template <typename T, typename L, typename Problem>
+static hipblasStatus_t hipblasGesvRun(hipblasHandle_t handle,
+                                      int             n,
+                                      int             nrhs,
+                                      int             lda,
+                                      int             ldb,
+                                      int             ldx,
+                                      int*            iter,
+                                      int*            deviceInfo,
+                                      int             batch_count,
+                                      Problem&&       problem)
+{
+    hipStream_t          stream;
+    hipblasPointerMode_t mode;
+    hipblasStatus_t      status = hipblasGetStream(handle, &stream);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasGetPointerMode(handle, &mode);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    hipblas_gesv_gpu<T, L> device(handle, stream);
+    std::vector<int>       infos(batch_count, 0);
+    for(int b = 0; b < batch_count && status == HIPBLAS_STATUS_SUCCESS; b++)
+    {
+        hipblasGesvProblem<T> p = problem(b);
+        status                  = hipblas_gesv_refine(
+            device, n, nrhs, p.A, lda, p.ipiv, p.B, ldb, p.X, ldx, iter[b], infos[b]);
+    }
+    if(status == HIPBLAS_STATUS_SUCCESS && batch_count > 0)
+        status = hipblas_handle_memcpy(
+            handle, deviceInfo, infos.data(), sizeof(int) * batch_count, hipMemcpyHostToDevice);
+
+    hipblasStatus_t restored = hipblasSetPointerMode(handle, mode);
+    return status == HIPBLAS_STATUS_SUCCESS ? restored : status;
+}
+
+#endif
+
+extern "C" {
+
+hipblasStatus_t hipblasDSgesv(hipblasHandle_t handle,
+                              const int       n,
+                              const int       nrhs,
+                              double*         A,
+                              const int       lda,
+                              int*            ipiv,
+                              double*         B,
+                              const int       ldb,
+                              double*         X,
+                              const int       ldx,
+                              int*            iter,
+                              int*            info,
+                              int*            deviceInfo)
+try
+{
+#ifdef __HIP_PLATFORM_SOLVER__
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!info)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    *info = hipblasGesvInfo({n < 0,
+                             nrhs < 0,
+                             !A && n,
+                             lda < std::max(1, n),
+                             !ipiv && n,
+                             !B && n && nrhs,
+                             ldb < std::max(1, n),
+                             !X && n && nrhs,
+                             ldx < std::max(1, n),
+                             !iter,
+                             false,
+                             !deviceInfo});
+    if(*info)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblasGesvRun<double, float>(
+        handle, n, nrhs, lda, ldb, ldx, iter, deviceInfo, 1, [&](int) {
+            return hipblasGesvProblem<double>{A, ipiv, B, X};
+        });
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDSgesvBatched(hipblasHandle_t handle,
+                                     const int       n,
+                                     const int       nrhs,
+                                     double* const   A[],
+                                     const int       lda,
+                                     int*            ipiv,
+                                     double* const   B[],
+                                     const int       ldb,
+                                     double* const   X[],
+                                     const int       ldx,
+                                     int*            iter,
+                                     int*            info,
+                                     int*            deviceInfo,
+                                     const int       batchCount)
+try
+{
+#ifdef __HIP_PLATFORM_SOLVER__
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!info)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    *info = hipblasGesvInfo({n < 0,
+                             nrhs < 0,
+                             !A && n && batchCount,
+                             lda < std::max(1, n),
+                             !ipiv && n && batchCount,
+                             !B && n && nrhs && batchCount,
+                             ldb < std::max(1, n),
+                             !X && n && nrhs && batchCount,
+                             ldx < std::max(1, n),
+                             !iter && batchCount,
+                             false,
+                             !deviceInfo && batchCount,
+                             batchCount < 0});
+    if(*info)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblas_batch_pointers<double> A_ptrs(handle, A, batchCount);
+    hipblas_batch_pointers<double> B_ptrs(handle, B, batchCount);
+    hipblas_batch_pointers<double> X_ptrs(handle, X, batchCount);
+    return hipblasGesvRun<double, float>(
+        handle, n, nrhs, lda, ldb, ldx, iter, deviceInfo, batchCount, [&](int b) {
+            return hipblasGesvProblem<double>{A_ptrs[b], ipiv + b * n, B_ptrs[b], X_ptrs[b]};
+        });
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDSgesvStridedBatched(hipblasHandle_t     handle,
+                                            const int           n,
+                                            const int           nrhs,
+                                            double*             A,
+                                            const int           lda,
+                                            const hipblasStride strideA,
+                                            int*                ipiv,
+                                            const hipblasStride strideP,
+                                            double*             B,
+                                            const int           ldb,
+                                            const hipblasStride strideB,
+                                            double*             X,
+                                            const int           ldx,
+                                            const hipblasStride strideX,
+                                            int*                iter,
+                                            int*                info,
+                                            int*                deviceInfo,
+                                            const int           batchCount)
+try
+{
+#ifdef __HIP_PLATFORM_SOLVER__
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!info)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    *info = hipblasGesvInfo({n < 0,
+                             nrhs < 0,
+                             !A && n && batchCount,
+                             lda < std::max(1, n),
+                             false,
+                             !ipiv && n && batchCount,
+                             false,
+                             !B && n && nrhs && batchCount,
+                             ldb < std::max(1, n),
+                             false,
+                             !X && n && nrhs && batchCount,
+                             ldx < std::max(1, n),
+                             false,
+                             !iter && batchCount,
+                             false,
+                             !deviceInfo && batchCount,
+                             batchCount < 0});
+    if(*info)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblasGesvRun<double, float>(
+        handle, n, nrhs, lda, ldb, ldx, iter, deviceInfo, batchCount, [&](int b) {
+            return hipblasGesvProblem<double>{
+                A + b * strideA, ipiv + b * strideP, B + b * strideB, X + b * strideX};
+        });
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZCgesv(hipblasHandle_t   handle,
+                              const int         n,
+                              const int         nrhs,
+                              hipDoubleComplex* A,
+                              const int         lda,
+                              int*              ipiv,
+                              hipDoubleComplex* B,
+                              const int         ldb,
+                              hipDoubleComplex* X,
+                              const int         ldx,
+                              int*              iter,
+                              int*              info,
+                              int*              deviceInfo)
+try
+{
+#ifdef __HIP_PLATFORM_SOLVER__
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!info)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    *info = hipblasGesvInfo({n < 0,
+                             nrhs < 0,
+                             !A && n,
+                             lda < std::max(1, n),
+                             !ipiv && n,
+                             !B && n && nrhs,
+                             ldb < std::max(1, n),
+                             !X && n && nrhs,
+                             ldx < std::max(1, n),
+                             !iter,
+                             false,
+                             !deviceInfo});
+    if(*info)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblasGesvRun<hipDoubleComplex, hipComplex>(
+        handle, n, nrhs, lda, ldb, ldx, iter, deviceInfo, 1, [&](int) {
+            return hipblasGesvProblem<hipDoubleComplex>{A, ipiv, B, X};
+        });
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZCgesvBatched(hipblasHandle_t         handle,
+                                     const int               n,
+                                     const int               nrhs,
+                                     hipDoubleComplex* const A[],
+                                     const int               lda,
+                                     int*                    ipiv,
+                                     hipDoubleComplex* const B[],
+                                     const int               ldb,
+                                     hipDoubleComplex* const X[],
+                                     const int               ldx,
+                                     int*                    iter,
+                                     int*                    info,
+                                     int*                    deviceInfo,
+                                     const int               batchCount)
+try
+{
+#ifdef __HIP_PLATFORM_SOLVER__
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!info)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    *info = hipblasGesvInfo({n < 0,
+                             nrhs < 0,
+                             !A && n && batchCount,
+                             lda < std::max(1, n),
+                             !ipiv && n && batchCount,
+                             !B && n && nrhs && batchCount,
+                             ldb < std::max(1, n),
+                             !X && n && nrhs && batchCount,
+                             ldx < std::max(1, n),
+                             !iter && batchCount,
+                             false,
+                             !deviceInfo && batchCount,
+                             batchCount < 0});
+    if(*info)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblas_batch_pointers<hipDoubleComplex> A_ptrs(handle, A, batchCount);
+    hipblas_batch_pointers<hipDoubleComplex> B_ptrs(handle, B, batchCount);
+    hipblas_batch_pointers<hipDoubleComplex> X_ptrs(handle, X, batchCount);
+    return hipblasGesvRun<hipDoubleComplex, hipComplex>(
+        handle, n, nrhs, lda, ldb, ldx, iter, deviceInfo, batchCount, [&](int b) {
+            return hipblasGesvProblem<hipDoubleComplex>{
+                A_ptrs[b], ipiv + b * n, B_ptrs[b], X_ptrs[b]};
+        });
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZCgesvStridedBatched(hipblasHandle_t     handle,
+                                            const int           n,
+                                            const int           nrhs,
+                                            hipDoubleComplex*   A,
+                                            const int           lda,
+                                            const hipblasStride strideA,
+                                            int*                ipiv,
+                                            const hipblasStride strideP,
+                                            hipDoubleComplex*   B,
+                                            const int           ldb,
+                                            const hipblasStride strideB,
+                                            hipDoubleComplex*   X,
+                                            const int           ldx,
+                                            const hipblasStride strideX,
+                                            int*                iter,
+                                            int*                info,
+                                            int*                deviceInfo,
+                                            const int           batchCount)
+try
+{
+#ifdef __HIP_PLATFORM_SOLVER__
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!info)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    *info = hipblasGesvInfo({n < 0,
+                             nrhs < 0,
+                             !A && n && batchCount,
+                             lda < std::max(1, n),
+                             false,
+                             !ipiv && n && batchCount,
+                             false,
+                             !B && n && nrhs && batchCount,
+                             ldb < std::max(1, n),
+                             false,
+                             !X && n && nrhs && batchCount,
+                             ldx < std::max(1, n),
+                             false,
+                             !iter && batchCount,
+                             false,
+                             !deviceInfo && batchCount,
+                             batchCount < 0});
+    if(*info)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblasGesvRun<hipDoubleComplex, hipComplex>(
+        handle, n, nrhs, lda, ldb, ldx, iter, deviceInfo, batchCount, [&](int b) {
+            return hipblasGesvProblem<hipDoubleComplex>{
+                A + b * strideA, ipiv + b * strideP, B + b * strideB, X + b * strideX};
+        });
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+} // extern "C"
@@ -0,0 +1,201 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "gesv_refinement.hpp"
+#include <algorithm>
+#include <cfloat>
+#include <hip/hip_runtime.h>
+
+// The complex matrices are read and written as pairs of reals, the real and imaginary
+// parts, so C is 2 for complex and 1 for real values
+
+template <int C, typename T>
+__device__ double hipblas_gesv_abs1(const T* x)
+{
+    double a = fabs(double(x[0]));
+    if(C == 2)
+        a += fabs(double(x[1]));
+    return a;
+}
+
+// The larger of m and v, or NaN when either is NaN
+__device__ double hipblas_gesv_max(double m, double v)
+{
+    return v > m || v != v ? v : m;
+}
+
+template <int C>
+__global__ void __launch_bounds__(256) hipblas_gesv_demote_kernel(hipblas_gesv_demote_args args)
+{
+    int64_t r = int64_t(blockIdx.x) * blockDim.x + threadIdx.x;
+    if(r >= args.rows)
+        return;
+
+    bool fits = true;
+    for(int64_t c = blockIdx.y; c < args.cols; c += gridDim.y)
+    {
+        const double* s = (const double*)args.src + C * (r + c * args.ld_src);
+        float*        d = (float*)args.dst + C * (r + c * args.ld_dst);
+        for(int k = 0; k < C; k++)
+            d[k] = float(s[k]);
+        fits = fits && hipblas_gesv_abs1<C>(s) <= FLT_MAX;
+    }
+    if(!fits)
+        *args.overflow = 1;
+}
+
+template <int C>
+__global__ void __launch_bounds__(256) hipblas_gesv_update_kernel(hipblas_gesv_update_args args)
+{
+    int64_t r = int64_t(blockIdx.x) * blockDim.x + threadIdx.x;
+    if(r >= args.rows)
+        return;
+
+    for(int64_t c = blockIdx.y; c < args.cols; c += gridDim.y)
+    {
+        const float* d = (const float*)args.D + C * (r + c * args.ldd);
+        double*      x = (double*)args.X + C * (r + c * args.ldx);
+        for(int k = 0; k < C; k++)
+            x[k] = args.first ? double(d[k]) : x[k] + double(d[k]);
+    }
+}
+
+// One thread per row; the threads of a block read consecutive rows of each column
+template <int C>
+__global__ void __launch_bounds__(256) hipblas_gesv_norm_kernel(hipblas_gesv_norm_args args)
+{
+    int64_t r = int64_t(blockIdx.x) * blockDim.x + threadIdx.x;
+    if(r >= args.n)
+        return;
+
+    const double* A   = (const double*)args.A;
+    double        sum = 0;
+    for(int64_t c = 0; c < args.n; c++)
+        sum += hipblas_gesv_abs1<C>(A + C * (r + c * args.lda));
+
+    // Non-negative doubles and NaN order as their bits
+    atomicMax(args.norm, (unsigned long long)__double_as_longlong(sum));
+}
+
+// One block per column, reducing the column maxima of |x| and |r| in shared memory
+template <int C>
+__global__ void __launch_bounds__(256) hipblas_gesv_check_kernel(hipblas_gesv_check_args args)
+{
+    __shared__ double xs[256];
+    __shared__ double rs[256];
+
+    for(int64_t c = blockIdx.x; c < args.nrhs; c += gridDim.x)
+    {
+        const double* X    = (const double*)args.X + C * c * args.ldx;
+        const double* R    = (const double*)args.R + C * c * args.ldr;
+        double        xnrm = 0, rnrm = 0;
+        for(int64_t i = threadIdx.x; i < args.n; i += blockDim.x)
+        {
+            xnrm = hipblas_gesv_max(xnrm, hipblas_gesv_abs1<C>(X + C * i));
+            rnrm = hipblas_gesv_max(rnrm, hipblas_gesv_abs1<C>(R + C * i));
+        }
+        xs[threadIdx.x] = xnrm;
+        rs[threadIdx.x] = rnrm;
+        __syncthreads();
+
+        for(unsigned half = blockDim.x / 2; half > 0; half /= 2)
+        {
+            if(threadIdx.x < half)
+            {
+                xs[threadIdx.x] = hipblas_gesv_max(xs[threadIdx.x], xs[threadIdx.x + half]);
+                rs[threadIdx.x] = hipblas_gesv_max(rs[threadIdx.x], rs[threadIdx.x + half]);
+            }
+            __syncthreads();
+        }
+
+        if(threadIdx.x == 0 && !(rs[0] <= xs[0] * args.cte))
+            *args.unconverged = 1;
+        __syncthreads();
+    }
+}
+
+static dim3 hipblas_gesv_grid(int64_t rows, int64_t cols)
+{
+    return dim3((rows + 255) / 256, std::min<int64_t>(cols, 65535));
+}
+
+static hipblasStatus_t hipblas_gesv_launched()
+{
+    return hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                           : HIPBLAS_STATUS_EXECUTION_FAILED;
+}
+
+hipblasStatus_t hipblas_launch_gesv_demote(const hipblas_gesv_demote_args& args,
+                                           hipStream_t                     stream)
+{
+    if(args.rows <= 0 || args.cols <= 0)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    dim3 grid = hipblas_gesv_grid(args.rows, args.cols);
+    if(args.complex)
+        hipLaunchKernelGGL((hipblas_gesv_demote_kernel<2>), grid, 256, 0, stream, args);
+    else
+        hipLaunchKernelGGL((hipblas_gesv_demote_kernel<1>), grid, 256, 0, stream, args);
+    return hipblas_gesv_launched();
+}
+
+hipblasStatus_t hipblas_launch_gesv_update(const hipblas_gesv_update_args& args,
+                                           hipStream_t                     stream)
+{
+    if(args.rows <= 0 || args.cols <= 0)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    dim3 grid = hipblas_gesv_grid(args.rows, args.cols);
+    if(args.complex)
+        hipLaunchKernelGGL((hipblas_gesv_update_kernel<2>), grid, 256, 0, stream, args);
+    else
+        hipLaunchKernelGGL((hipblas_gesv_update_kernel<1>), grid, 256, 0, stream, args);
+    return hipblas_gesv_launched();
+}
+
+hipblasStatus_t hipblas_launch_gesv_norm(const hipblas_gesv_norm_args& args, hipStream_t stream)
+{
+    if(args.n <= 0)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    dim3 grid = hipblas_gesv_grid(args.n, 1);
+    if(args.complex)
+        hipLaunchKernelGGL((hipblas_gesv_norm_kernel<2>), grid, 256, 0, stream, args);
+    else
+        hipLaunchKernelGGL((hipblas_gesv_norm_kernel<1>), grid, 256, 0, stream, args);
+    return hipblas_gesv_launched();
+}
+
+hipblasStatus_t hipblas_launch_gesv_check(const hipblas_gesv_check_args& args,
+                                          hipStream_t                    stream)
+{
+    if(args.n <= 0 || args.nrhs <= 0)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    dim3 grid(std::min<int64_t>(args.nrhs, 65535));
+    if(args.complex)
+        hipLaunchKernelGGL((hipblas_gesv_check_kernel<2>), grid, 256, 0, stream, args);
+    else
+        hipLaunchKernelGGL((hipblas_gesv_check_kernel<1>), grid, 256, 0, stream, args);
+    return hipblas_gesv_launched();
+}
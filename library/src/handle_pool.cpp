@@ -0,0 +1,229 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "handle_pool.hpp"
+#include "exceptions.hpp"
+#include "stream_pool.hpp"
+#include <memory>
+
+// Handles and workspaces of a hipblasHandlePool_t on the devices. A workspace goes
+// from a handle on one stream to a handle on another with an event, recorded on the
+// stream of the release and waited for by the stream of the next acquire.
+class hipblas_handle_pool_gpu_backend : public hipblas_handle_pool_backend
+{
+public:
+    explicit hipblas_handle_pool_gpu_backend(size_t workspace_size)
+        : m_workspace_size(workspace_size)
+    {
+    }
+
+    // Handles are created on the current device, which is the one acquired for
+    hipblasStatus_t create_handle(int, hipblasHandle_t* handle) override
+    {
+        return hipblasCreate(handle);
+    }
+
+    void destroy_handle(int device, hipblasHandle_t handle) override
+    {
+        on_device(device, [&] { (void)hipblasDestroy(handle); });
+    }
+
+    hipblasStatus_t create_workspace(int, void** workspace) override
+    {
+        auto       memory = std::make_unique<device_workspace>();
+        hipError_t error  = hipMalloc(&memory->memory, m_workspace_size);
+        if(error != hipSuccess)
+            return hipblas_hip_to_status(error);
+        error = hipEventCreateWithFlags(&memory->released, hipEventDisableTiming);
+        if(error != hipSuccess)
+        {
+            (void)hipFree(memory->memory);
+            return hipblas_hip_to_status(error);
+        }
+        *workspace = memory.release();
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    void destroy_workspace(int device, void* workspace) override
+    {
+        auto* memory = (device_workspace*)workspace;
+        on_device(device, [&] {
+            (void)hipEventDestroy(memory->released);
+            (void)hipFree(memory->memory);
+        });
+        delete memory;
+    }
+
+    hipblasStatus_t bind(hipblasHandle_t handle, hipStream_t stream, void* workspace) override
+    {
+        hipblasStatus_t status = hipblasSetStream(handle, stream);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+        if(status != HIPBLAS_STATUS_SUCCESS || !workspace)
+            return status;
+
+        auto* memory = (device_workspace*)workspace;
+        if(memory->used && memory->stream != stream)
+        {
+            hipError_t error = hipStreamWaitEvent(stream, memory->released, 0);
+            if(error != hipSuccess)
+                return hipblas_hip_to_status(error);
+        }
+        memory->stream = stream;
+        return hipblasSetWorkspace(handle, memory->memory, m_workspace_size);
+    }
+
+    hipblasStatus_t unbind(hipblasHandle_t, void* workspace) override
+    {
+        if(!workspace)
+            return HIPBLAS_STATUS_SUCCESS;
+
+        auto* memory = (device_workspace*)workspace;
+        memory->used = true;
+        return hipblas_hip_to_status(hipEventRecord(memory->released, memory->stream));
+    }
+
+private:
+    struct device_workspace
+    {
+        void*       memory   = nullptr;
+        hipEvent_t  released = nullptr;
+        hipStream_t stream   = nullptr; // stream of the last handle given the workspace
+        bool        used     = false;
+    };
+
+    template <typename F>
+    static void on_device(int device, F&& f)
+    {
+        int current;
+        if(hipGetDevice(&current) != hipSuccess)
+            return;
+        (void)hipSetDevice(device);
+        f();
+        (void)hipSetDevice(current);
+    }
+
+    size_t m_workspace_size;
+};
+
+struct hipblasHandlePoolContext
+{
+    hipblasHandlePoolContext(int max_handles, size_t workspace_size)
+        : pool(std::make_unique<hipblas_handle_pool_gpu_backend>(workspace_size),
+               max_handles,
+               workspace_size > 0)
+    {
+    }
+
+    hipblas_handle_pool pool;
+};
+
+extern "C" {
+
+hipblasStatus_t hipblasHandlePoolCreate(hipblasHandlePool_t* pool,
+                                        int                  maxHandlesPerDevice,
+                                        size_t               workspaceSizeInBytes)
+try
+{
+    if(!pool || maxHandlesPerDevice <= 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    *pool = new hipblasHandlePoolContext(maxHandlesPerDevice, workspaceSizeInBytes);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasHandlePoolDestroy(hipblasHandlePool_t pool)
+try
+{
+    if(!pool)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(pool->pool.in_use())
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    delete pool;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t
+    hipblasHandlePoolAcquire(hipblasHandlePool_t pool, hipStream_t stream, hipblasHandle_t* handle)
+try
+{
+    if(!pool)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!handle)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    int device;
+    if(hipGetDevice(&device) != hipSuccess)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+    return pool->pool.acquire(device, stream, handle);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasHandlePoolRelease(hipblasHandlePool_t pool, hipblasHandle_t handle)
+try
+{
+    if(!pool)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    return pool->pool.release(handle);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasHandlePoolGetStats(hipblasHandlePool_t pool,
+                                          uint64_t*           handlesCreated,
+                                          uint64_t*           acquires,
+                                          uint64_t*           waits,
+                                          double*             waitSeconds)
+try
+{
+    if(!pool)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!handlesCreated || !acquires || !waits || !waitSeconds)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblas_handle_pool::stats stats = pool->pool.get_stats();
+    *handlesCreated                  = stats.handles_created;
+    *acquires                        = stats.acquires;
+    *waits                           = stats.waits;
+    *waitSeconds                     = stats.wait_seconds;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+} // extern "C"
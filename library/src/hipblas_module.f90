@@ -25665,4 +25665,681 @@ module hipblas
         end function hipblasZgelsStridedBatched
     end interface
 
+    ! potrf
+    interface
+        function hipblasSpotrf(handle, uplo, n, A, lda, info) &
+            bind(c, name='hipblasSpotrf')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSpotrf
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: info
+        end function hipblasSpotrf
+    end interface
+
+    interface
+        function hipblasDpotrf(handle, uplo, n, A, lda, info) &
+            bind(c, name='hipblasDpotrf')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDpotrf
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: info
+        end function hipblasDpotrf
+    end interface
+
+    interface
+        function hipblasCpotrf(handle, uplo, n, A, lda, info) &
+            bind(c, name='hipblasCpotrf')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCpotrf
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: info
+        end function hipblasCpotrf
+    end interface
+
+    interface
+        function hipblasZpotrf(handle, uplo, n, A, lda, info) &
+            bind(c, name='hipblasZpotrf')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZpotrf
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: info
+        end function hipblasZpotrf
+    end interface
+
+    ! potrf_batched
+    interface
+        function hipblasSpotrfBatched(handle, uplo, n, A, lda, info, batchCount) &
+            bind(c, name='hipblasSpotrfBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSpotrfBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasSpotrfBatched
+    end interface
+
+    interface
+        function hipblasDpotrfBatched(handle, uplo, n, A, lda, info, batchCount) &
+            bind(c, name='hipblasDpotrfBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDpotrfBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasDpotrfBatched
+    end interface
+
+    interface
+        function hipblasCpotrfBatched(handle, uplo, n, A, lda, info, batchCount) &
+            bind(c, name='hipblasCpotrfBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCpotrfBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasCpotrfBatched
+    end interface
+
+    interface
+        function hipblasZpotrfBatched(handle, uplo, n, A, lda, info, batchCount) &
+            bind(c, name='hipblasZpotrfBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZpotrfBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasZpotrfBatched
+    end interface
+
+    ! potrf_strided_batched
+    interface
+        function hipblasSpotrfStridedBatched(handle, uplo, n, A, lda, strideA, info, &
+                                             batchCount) &
+            bind(c, name='hipblasSpotrfStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSpotrfStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasSpotrfStridedBatched
+    end interface
+
+    interface
+        function hipblasDpotrfStridedBatched(handle, uplo, n, A, lda, strideA, info, &
+                                             batchCount) &
+            bind(c, name='hipblasDpotrfStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDpotrfStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasDpotrfStridedBatched
+    end interface
+
+    interface
+        function hipblasCpotrfStridedBatched(handle, uplo, n, A, lda, strideA, info, &
+                                             batchCount) &
+            bind(c, name='hipblasCpotrfStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCpotrfStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasCpotrfStridedBatched
+    end interface
+
+    interface
+        function hipblasZpotrfStridedBatched(handle, uplo, n, A, lda, strideA, info, &
+                                             batchCount) &
+            bind(c, name='hipblasZpotrfStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZpotrfStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasZpotrfStridedBatched
+    end interface
+
+    ! potrs
+    interface
+        function hipblasSpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, info) &
+            bind(c, name='hipblasSpotrs')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSpotrs
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+        end function hipblasSpotrs
+    end interface
+
+    interface
+        function hipblasDpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, info) &
+            bind(c, name='hipblasDpotrs')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDpotrs
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+        end function hipblasDpotrs
+    end interface
+
+    interface
+        function hipblasCpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, info) &
+            bind(c, name='hipblasCpotrs')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCpotrs
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+        end function hipblasCpotrs
+    end interface
+
+    interface
+        function hipblasZpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, info) &
+            bind(c, name='hipblasZpotrs')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZpotrs
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+        end function hipblasZpotrs
+    end interface
+
+    ! potrs_batched
+    interface
+        function hipblasSpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, info, &
+                                      batchCount) &
+            bind(c, name='hipblasSpotrsBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSpotrsBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasSpotrsBatched
+    end interface
+
+    interface
+        function hipblasDpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, info, &
+                                      batchCount) &
+            bind(c, name='hipblasDpotrsBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDpotrsBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasDpotrsBatched
+    end interface
+
+    interface
+        function hipblasCpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, info, &
+                                      batchCount) &
+            bind(c, name='hipblasCpotrsBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCpotrsBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasCpotrsBatched
+    end interface
+
+    interface
+        function hipblasZpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, info, &
+                                      batchCount) &
+            bind(c, name='hipblasZpotrsBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZpotrsBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasZpotrsBatched
+    end interface
+
+    ! potrs_strided_batched
+    interface
+        function hipblasSpotrsStridedBatched(handle, uplo, n, nrhs, A, lda, strideA, B, &
+                                             ldb, strideB, info, batchCount) &
+            bind(c, name='hipblasSpotrsStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSpotrsStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int64_t), value :: strideB
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasSpotrsStridedBatched
+    end interface
+
+    interface
+        function hipblasDpotrsStridedBatched(handle, uplo, n, nrhs, A, lda, strideA, B, &
+                                             ldb, strideB, info, batchCount) &
+            bind(c, name='hipblasDpotrsStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDpotrsStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int64_t), value :: strideB
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasDpotrsStridedBatched
+    end interface
+
+    interface
+        function hipblasCpotrsStridedBatched(handle, uplo, n, nrhs, A, lda, strideA, B, &
+                                             ldb, strideB, info, batchCount) &
+            bind(c, name='hipblasCpotrsStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCpotrsStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int64_t), value :: strideB
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasCpotrsStridedBatched
+    end interface
+
+    interface
+        function hipblasZpotrsStridedBatched(handle, uplo, n, nrhs, A, lda, strideA, B, &
+                                             ldb, strideB, info, batchCount) &
+            bind(c, name='hipblasZpotrsStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZpotrsStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int64_t), value :: strideB
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasZpotrsStridedBatched
+    end interface
+
+    ! potri
+    interface
+        function hipblasSpotri(handle, uplo, n, A, lda, info) &
+            bind(c, name='hipblasSpotri')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSpotri
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: info
+        end function hipblasSpotri
+    end interface
+
+    interface
+        function hipblasDpotri(handle, uplo, n, A, lda, info) &
+            bind(c, name='hipblasDpotri')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDpotri
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: info
+        end function hipblasDpotri
+    end interface
+
+    interface
+        function hipblasCpotri(handle, uplo, n, A, lda, info) &
+            bind(c, name='hipblasCpotri')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCpotri
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: info
+        end function hipblasCpotri
+    end interface
+
+    interface
+        function hipblasZpotri(handle, uplo, n, A, lda, info) &
+            bind(c, name='hipblasZpotri')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZpotri
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: info
+        end function hipblasZpotri
+    end interface
+
+    ! potri_batched
+    interface
+        function hipblasSpotriBatched(handle, uplo, n, A, lda, info, batchCount) &
+            bind(c, name='hipblasSpotriBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSpotriBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasSpotriBatched
+    end interface
+
+    interface
+        function hipblasDpotriBatched(handle, uplo, n, A, lda, info, batchCount) &
+            bind(c, name='hipblasDpotriBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDpotriBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasDpotriBatched
+    end interface
+
+    interface
+        function hipblasCpotriBatched(handle, uplo, n, A, lda, info, batchCount) &
+            bind(c, name='hipblasCpotriBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCpotriBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasCpotriBatched
+    end interface
+
+    interface
+        function hipblasZpotriBatched(handle, uplo, n, A, lda, info, batchCount) &
+            bind(c, name='hipblasZpotriBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZpotriBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasZpotriBatched
+    end interface
+
+    ! potri_strided_batched
+    interface
+        function hipblasSpotriStridedBatched(handle, uplo, n, A, lda, strideA, info, &
+                                             batchCount) &
+            bind(c, name='hipblasSpotriStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSpotriStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasSpotriStridedBatched
+    end interface
+
+    interface
+        function hipblasDpotriStridedBatched(handle, uplo, n, A, lda, strideA, info, &
+                                             batchCount) &
+            bind(c, name='hipblasDpotriStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDpotriStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasDpotriStridedBatched
+    end interface
+
+    interface
+        function hipblasCpotriStridedBatched(handle, uplo, n, A, lda, strideA, info, &
+                                             batchCount) &
+            bind(c, name='hipblasCpotriStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCpotriStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasCpotriStridedBatched
+    end interface
+
+    interface
+        function hipblasZpotriStridedBatched(handle, uplo, n, A, lda, strideA, info, &
+                                             batchCount) &
+            bind(c, name='hipblasZpotriStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZpotriStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasZpotriStridedBatched
+    end interface
+
 end module hipblas
@@ -0,0 +1,166 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+
+#include "hipblas.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+// Number of streams the problems of an emulated batched call are spread over
+constexpr int hipblas_emulation_max_streams = 4;
+
+// Runs call(b) for every problem b of a batch, for backends that only provide the
+// non-batched routine. With more than one problem the batch is forked over up to
+// hipblas_emulation_max_streams streams, round robin, and joined back, so that to
+// the caller's stream the whole batch is still a single operation.
+//
+// streams provides fork(count), which makes count streams wait for the caller's
+// stream; select(index), which makes the handle use stream index, or the caller's
+// stream for -1; and join(count), which makes the caller's stream wait for them.
+// All three return hipblasStatus_t. The caller's stream is always restored and
+// joined, and the first failure is returned.
+template <typename Streams, typename Call>
+hipblasStatus_t hipblas_fan_out_batch(Streams& streams, int batch_count, Call&& call)
+{
+    if(batch_count < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    int count = std::min(batch_count, hipblas_emulation_max_streams);
+    if(count <= 1)
+    {
+        for(int b = 0; b < batch_count; b++)
+        {
+            hipblasStatus_t status = call(b);
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+        }
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    hipblasStatus_t status = streams.fork(count);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    for(int b = 0; b < batch_count && status == HIPBLAS_STATUS_SUCCESS; b++)
+    {
+        status = streams.select(b % count);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = call(b);
+    }
+
+    hipblasStatus_t restore = streams.select(-1);
+    hipblasStatus_t join    = streams.join(count);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    return restore != HIPBLAS_STATUS_SUCCESS ? restore : join;
+}
+
+// Element sizes for the type-erased _ex routines, 0 for unknown types
+inline size_t hipblas_datatype_size(hipDataType type)
+{
+    switch(type)
+    {
+    case HIP_R_8I:
+    case HIP_R_8U:
+        return 1;
+    case HIP_R_16F:
+    case HIP_R_16BF:
+    case HIP_C_8I:
+    case HIP_C_8U:
+        return 2;
+    case HIP_R_32F:
+    case HIP_R_32I:
+    case HIP_R_32U:
+    case HIP_C_16F:
+    case HIP_C_16BF:
+        return 4;
+    case HIP_R_64F:
+    case HIP_C_32F:
+    case HIP_C_32I:
+    case HIP_C_32U:
+        return 8;
+    case HIP_C_64F:
+        return 16;
+    default:
+        return 0;
+    }
+}
+
+#ifndef HIPBLAS_V2
+inline size_t hipblas_datatype_size(hipblasDatatype_t type)
+{
+    switch(type)
+    {
+    case HIPBLAS_R_8I:
+    case HIPBLAS_R_8U:
+        return 1;
+    case HIPBLAS_R_16F:
+    case HIPBLAS_R_16B:
+    case HIPBLAS_C_8I:
+    case HIPBLAS_C_8U:
+        return 2;
+    case HIPBLAS_R_32F:
+    case HIPBLAS_R_32I:
+    case HIPBLAS_R_32U:
+    case HIPBLAS_C_16F:
+    case HIPBLAS_C_16B:
+        return 4;
+    case HIPBLAS_R_64F:
+    case HIPBLAS_C_32F:
+    case HIPBLAS_C_32I:
+    case HIPBLAS_C_32U:
+        return 8;
+    case HIPBLAS_C_64F:
+        return 16;
+    default:
+        return 0;
+    }
+}
+#endif
+
+// Address of element offset of a type-erased array
+template <typename Type>
+const void* hipblas_batch_offset(const void* ptr, int64_t offset, Type type)
+{
+    return ptr ? static_cast<const char*>(ptr) + offset * hipblas_datatype_size(type) : nullptr;
+}
+
+template <typename Type>
+void* hipblas_batch_offset(void* ptr, int64_t offset, Type type)
+{
+    return ptr ? static_cast<char*>(ptr) + offset * hipblas_datatype_size(type) : nullptr;
+}
+
+// Pointer array of a type-erased batched call from problem offset on
+inline const void* hipblas_batch_array_offset(const void* array, int64_t offset)
+{
+    return array ? static_cast<const void* const*>(array) + offset : nullptr;
+}
+
+inline void* hipblas_batch_array_offset(void* array, int64_t offset)
+{
+    return array ? static_cast<void**>(array) + offset : nullptr;
+}
@@ -0,0 +1,274 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Recording of hipBLAS calls for hipblasBeginCapture and hipblasEndCapture. A call is
+// recorded as the entry point with its arguments; pointer arguments are kept in slots
+// which hipblasGraphUpdatePointer can rebind, and scalars given in host pointer mode
+// are copied into a block of the graph, which replays pass in device memory. Nothing
+// here depends on a device, so recording and replay can be tested on the host.
+
+// A scalar argument of a recorded call, which is a snapshot of *value when the handle
+// is in host pointer mode, and the device pointer value otherwise
+template <typename T>
+struct hipblas_capture_scalar_arg
+{
+    const T* value;
+    bool     device;
+};
+
+template <typename T>
+hipblas_capture_scalar_arg<T> hipblas_capture_scalar(hipblasHandle_t handle, const T* value)
+{
+    hipblasPointerMode_t mode;
+    hipblasStatus_t      status = hipblasGetPointerMode(handle, &mode);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        throw status;
+    return {value, mode == HIPBLAS_POINTER_MODE_DEVICE};
+}
+
+class hipblas_capture_graph
+{
+public:
+    // Calls the entry point on handle with the values of the argument slots
+    using replay_function = std::function<hipblasStatus_t(hipblasHandle_t, const void* const*)>;
+
+    // Records fn(handle, args...). The handle is not kept: replays give their own.
+    template <typename... Params, typename... Args>
+    hipblasStatus_t record(const char* routine,
+                           hipblasStatus_t (*fn)(hipblasHandle_t, Params...),
+                           hipblasHandle_t,
+                           Args... args)
+    {
+        static_assert(sizeof...(Params) == sizeof...(Args), "wrong number of arguments");
+
+        node call;
+        call.routine = routine;
+        for(bool valid : {check(args)...})
+            if(!valid)
+                return HIPBLAS_STATUS_INVALID_VALUE;
+
+        auto stored = std::make_tuple(store(call, args)...);
+        call.replay = [fn, stored](hipblasHandle_t handle, const void* const* slots) {
+            return std::apply(
+                [&](auto... values) { return fn(handle, load<Params>(values, slots)...); },
+                stored);
+        };
+        m_nodes.push_back(std::move(call));
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    size_t size() const
+    {
+        return m_nodes.size();
+    }
+
+    const char* routine(size_t node) const
+    {
+        return m_nodes[node].routine;
+    }
+
+    // Rebinds every pointer argument equal to from, including device scalars, and
+    // returns the number of arguments rebound
+    size_t update_pointer(const void* from, const void* to)
+    {
+        size_t count = 0;
+        for(node& call : m_nodes)
+            for(slot& arg : call.slots)
+                if(!arg.size && arg.pointer == from)
+                {
+                    arg.pointer = to;
+                    count++;
+                }
+        if(count)
+            m_version++;
+        return count;
+    }
+
+    // Sets scalar argument index (0 for alpha, 1 for beta) of a call to *value. Returns
+    // false if there is no such scalar, or if it was recorded as a device pointer.
+    bool update_scalar(size_t node, size_t index, const void* value)
+    {
+        if(node >= m_nodes.size())
+            return false;
+
+        for(slot& arg : m_nodes[node].slots)
+            if(arg.scalar && !index--)
+            {
+                if(!arg.size)
+                    return false;
+                std::memcpy(m_scalars.data() + arg.offset, value, arg.size);
+                m_scalars_changed = true;
+                return true;
+            }
+        return false;
+    }
+
+    // The host values of the scalars, which replays are given a copy of
+    const std::vector<char>& scalars() const
+    {
+        return m_scalars;
+    }
+
+    // Whether scalars have been set since the last call to take_scalars_changed
+    bool take_scalars_changed()
+    {
+        return std::exchange(m_scalars_changed, false);
+    }
+
+    // Incremented when a pointer argument is rebound
+    uint64_t version() const
+    {
+        return m_version;
+    }
+
+    // Issues the calls in order on handle, which must be in device pointer mode, with
+    // a copy of scalars() at scalars. Stops at the first call that fails.
+    hipblasStatus_t replay(hipblasHandle_t handle, const void* scalars) const
+    {
+        std::vector<const void*> slots;
+        for(const node& call : m_nodes)
+        {
+            slots.clear();
+            for(const slot& arg : call.slots)
+                slots.push_back(arg.size ? (const char*)scalars + arg.offset : arg.pointer);
+
+            hipblasStatus_t status = call.replay(handle, slots.data());
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+        }
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+private:
+    // Scalars are aligned for the largest scalar type, hipDoubleComplex
+    static constexpr size_t scalar_alignment = 16;
+
+    struct slot
+    {
+        const void* pointer = nullptr;
+        size_t      offset  = 0;
+        size_t      size    = 0; // size of a host scalar snapshot, 0 for pointers
+        bool        scalar  = false;
+    };
+
+    struct node
+    {
+        const char*       routine = nullptr;
+        std::vector<slot> slots;
+        replay_function   replay;
+    };
+
+    // Index of the slot of an argument, in place of the argument in a stored call
+    template <typename T>
+    struct slot_index
+    {
+        size_t index;
+    };
+
+    template <typename T>
+    static bool check(const T&)
+    {
+        return true;
+    }
+
+    template <typename T>
+    static bool check(const hipblas_capture_scalar_arg<T>& arg)
+    {
+        return arg.device || arg.value;
+    }
+
+    template <typename T>
+    T store(node&, T value)
+    {
+        return value;
+    }
+
+    template <typename T>
+    slot_index<T*> store(node& call, T* pointer)
+    {
+        slot arg;
+        arg.pointer = pointer;
+        call.slots.push_back(arg);
+        return {call.slots.size() - 1};
+    }
+
+    template <typename T>
+    slot_index<const T*> store(node& call, hipblas_capture_scalar_arg<T> scalar)
+    {
+        slot arg;
+        arg.scalar = true;
+        if(scalar.device)
+            arg.pointer = scalar.value;
+        else
+        {
+            arg.offset = (m_scalars.size() + scalar_alignment - 1) / scalar_alignment
+                         * scalar_alignment;
+            arg.size   = sizeof(T);
+            m_scalars.resize(arg.offset + arg.size);
+            std::memcpy(m_scalars.data() + arg.offset, scalar.value, arg.size);
+            m_scalars_changed = true;
+        }
+        call.slots.push_back(arg);
+        return {call.slots.size() - 1};
+    }
+
+    template <typename P, typename T>
+    static P load(const T& value, const void* const*)
+    {
+        return value;
+    }
+
+    template <typename P, typename T>
+    static P load(const slot_index<T>& arg, const void* const* slots)
+    {
+        return (P)slots[arg.index];
+    }
+
+    std::vector<node> m_nodes;
+    std::vector<char> m_scalars;
+    bool              m_scalars_changed = false;
+    uint64_t          m_version         = 0;
+};
+
+// Returns the graph handle is recording into, or nullptr if it is not capturing
+hipblas_capture_graph* hipblas_capturing(hipblasHandle_t handle);
+
+// Records the call of the entry point it is used in, when its handle is capturing.
+// Scalars are wrapped with hipblas_capture_scalar.
+#define HIPBLAS_CAPTURE(fn_, ...)                                                  \
+    do                                                                             \
+    {                                                                              \
+        if(hipblas_capture_graph* capture__ = hipblas_capturing(handle))           \
+            return capture__->record(__func__, fn_, handle, __VA_ARGS__);          \
+    } while(0)
@@ -0,0 +1,303 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+// Blocked Cholesky factorization, solve and inversion for backends without potrf,
+// potrs and potri. The nb x nb diagonal blocks of potrf are factored on the host,
+// and the rest of the matrix is updated on the device with trsm and syrk/herk, as in
+// LAPACK. potrs is two triangular solves, and potri inverts the factor with trsm into
+// a workspace W and forms inv(A) = inv(L)^H * inv(L) (or inv(U) * inv(U)^H) with
+// syrk/herk, which only writes the uplo triangle of A.
+
+constexpr int hipblas_cholesky_block = 128;
+
+// Host type the diagonal blocks of a device type T are factored in, of the same layout
+template <typename T>
+struct hipblas_cholesky_host
+{
+    using type = T;
+    using real = T;
+};
+
+template <>
+struct hipblas_cholesky_host<hipComplex>
+{
+    using type = std::complex<float>;
+    using real = float;
+};
+
+template <>
+struct hipblas_cholesky_host<hipDoubleComplex>
+{
+    using type = std::complex<double>;
+    using real = double;
+};
+
+// The operations the drivers need from a device. Matrices in device memory are
+// column major. Downloads are complete when they return.
+template <typename T>
+class hipblas_cholesky_device
+{
+public:
+    using real = typename hipblas_cholesky_host<T>::real;
+
+    virtual ~hipblas_cholesky_device() = default;
+
+    virtual hipblasStatus_t upload(T* dst, int ld_dst, const T* src, int ld_src, int rows, int cols)
+        = 0;
+    virtual hipblasStatus_t
+        download(T* dst, int ld_dst, const T* src, int ld_src, int rows, int cols)
+        = 0;
+
+    // Sets a rows x cols block in device memory to zero
+    virtual hipblasStatus_t zero(T* dst, int ld_dst, int rows, int cols) = 0;
+
+    // B = op(A)^-1 * B for the left side, B * op(A)^-1 for the right, with a
+    // non-unit triangular A
+    virtual hipblasStatus_t trsm(hipblasSideMode_t  side,
+                                 hipblasFillMode_t  uplo,
+                                 hipblasOperation_t trans,
+                                 int                m,
+                                 int                n,
+                                 const T*           A,
+                                 int                lda,
+                                 T*                 B,
+                                 int                ldb)
+        = 0;
+
+    // C = alpha * op(A) * op(A)^H + beta * C on the uplo triangle of C
+    virtual hipblasStatus_t herk(hipblasFillMode_t  uplo,
+                                 hipblasOperation_t trans,
+                                 int                n,
+                                 int                k,
+                                 real               alpha,
+                                 const T*           A,
+                                 int                lda,
+                                 real               beta,
+                                 T*                 C,
+                                 int                ldc)
+        = 0;
+};
+
+// The adjoint operation of T: transpose for real types, conjugate transpose otherwise
+template <typename T>
+constexpr hipblasOperation_t hipblas_cholesky_adjoint()
+{
+    using host = typename hipblas_cholesky_host<T>::type;
+    return std::is_same<host, typename hipblas_cholesky_host<T>::real>::value ? HIPBLAS_OP_T
+                                                                                : HIPBLAS_OP_C;
+}
+
+inline float hipblas_cholesky_conj(float x)
+{
+    return x;
+}
+
+inline double hipblas_cholesky_conj(double x)
+{
+    return x;
+}
+
+template <typename R>
+std::complex<R> hipblas_cholesky_conj(const std::complex<R>& x)
+{
+    return std::conj(x);
+}
+
+// Unblocked Cholesky factorization of an n x n matrix in host memory. Returns 0, or
+// the column j (from 1) whose diagonal is not positive, in which case the columns
+// before j hold the factor as far as it was computed.
+template <typename H>
+int hipblas_potrf_host(hipblasFillMode_t uplo, int n, H* A, int lda)
+{
+    // Element (i, k) of the lower factor L, which for uplo upper is stored as U = L^H
+    bool lower = uplo == HIPBLAS_FILL_MODE_LOWER;
+    auto at    = [&](int64_t i, int64_t k) -> H& {
+        return lower ? A[i + k * lda] : A[k + i * lda];
+    };
+    auto get = [&](int64_t i, int64_t k) {
+        return lower ? at(i, k) : hipblas_cholesky_conj(at(i, k));
+    };
+
+    for(int64_t j = 0; j < n; j++)
+    {
+        auto d = std::real(at(j, j));
+        for(int64_t k = 0; k < j; k++)
+            d -= std::norm(at(j, k));
+        if(!(d > 0))
+            return int(j + 1);
+
+        d        = std::sqrt(d);
+        at(j, j) = d;
+        for(int64_t i = j + 1; i < n; i++)
+        {
+            H sum = get(i, j);
+            for(int64_t k = 0; k < j; k++)
+                sum -= get(i, k) * hipblas_cholesky_conj(get(j, k));
+            sum /= d;
+            at(i, j) = lower ? sum : hipblas_cholesky_conj(sum);
+        }
+    }
+    return 0;
+}
+
+// Factors the n x n matrix A in device memory. info is 0, or the order of the leading
+// minor that is not positive definite, as in LAPACK potrf.
+template <typename T>
+hipblasStatus_t hipblas_potrf_blocked(
+    hipblas_cholesky_device<T>& device, hipblasFillMode_t uplo, int n, T* A, int lda, int& info)
+{
+    using host = typename hipblas_cholesky_host<T>::type;
+    static_assert(sizeof(host) == sizeof(T), "host and device types must share a layout");
+
+    const hipblasOperation_t adjoint = hipblas_cholesky_adjoint<T>();
+    const bool               lower   = uplo == HIPBLAS_FILL_MODE_LOWER;
+    const int                nb      = std::min(n, hipblas_cholesky_block);
+
+    std::vector<host> block(size_t(nb) * nb);
+    info = 0;
+    for(int j = 0; j < n; j += nb)
+    {
+        int jb   = std::min(nb, n - j);
+        int rest = n - j - jb;
+        T*  Ajj  = A + j + int64_t(j) * lda;
+
+        hipblasStatus_t status = device.download((T*)block.data(), jb, Ajj, lda, jb, jb);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        int block_info = hipblas_potrf_host(uplo, jb, block.data(), jb);
+        status         = device.upload(Ajj, lda, (T*)block.data(), jb, jb, jb);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        if(block_info)
+        {
+            info = j + block_info;
+            return HIPBLAS_STATUS_SUCCESS;
+        }
+        if(!rest)
+            break;
+
+        // The panel beside the diagonal block, and the trailing matrix it updates
+        T* panel    = lower ? Ajj + jb : Ajj + int64_t(jb) * lda;
+        T* trailing = Ajj + jb + int64_t(jb) * lda;
+        if(lower)
+            status = device.trsm(
+                HIPBLAS_SIDE_RIGHT, uplo, adjoint, rest, jb, Ajj, lda, panel, lda);
+        else
+            status = device.trsm(
+                HIPBLAS_SIDE_LEFT, uplo, adjoint, jb, rest, Ajj, lda, panel, lda);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = device.herk(uplo,
+                                 lower ? HIPBLAS_OP_N : adjoint,
+                                 rest,
+                                 jb,
+                                 -1,
+                                 panel,
+                                 lda,
+                                 1,
+                                 trailing,
+                                 lda);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+    }
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+// Solves A * X = B in place of B, with A factored by potrf
+template <typename T>
+hipblasStatus_t hipblas_potrs_blocked(hipblas_cholesky_device<T>& device,
+                                      hipblasFillMode_t           uplo,
+                                      int                         n,
+                                      int                         nrhs,
+                                      const T*                    A,
+                                      int                         lda,
+                                      T*                          B,
+                                      int                         ldb)
+{
+    if(!n || !nrhs)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    // L * L^H * X = B, or U^H * U * X = B
+    const hipblasOperation_t adjoint = hipblas_cholesky_adjoint<T>();
+    const bool               lower   = uplo == HIPBLAS_FILL_MODE_LOWER;
+    hipblasStatus_t          status  = device.trsm(
+        HIPBLAS_SIDE_LEFT, uplo, lower ? HIPBLAS_OP_N : adjoint, n, nrhs, A, lda, B, ldb);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    return device.trsm(
+        HIPBLAS_SIDE_LEFT, uplo, lower ? adjoint : HIPBLAS_OP_N, n, nrhs, A, lda, B, ldb);
+}
+
+// Replaces the uplo triangle of A, factored by potrf, with that of inv(A). W is an
+// n x n workspace in device memory. info is 0, or the index (from 1) of a zero
+// diagonal element of the factor, as in LAPACK potri.
+template <typename T>
+hipblasStatus_t hipblas_potri_blocked(hipblas_cholesky_device<T>& device,
+                                      hipblasFillMode_t           uplo,
+                                      int                         n,
+                                      T*                          A,
+                                      int                         lda,
+                                      T*                          W,
+                                      int&                        info)
+{
+    using host = typename hipblas_cholesky_host<T>::type;
+
+    info = 0;
+    if(!n)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    // The diagonal of A is a 1 x n block with leading dimension lda + 1
+    std::vector<host> diagonal(n);
+    hipblasStatus_t   status = device.download((T*)diagonal.data(), 1, A, lda + 1, 1, n);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    for(int i = 0; i < n; i++)
+        if(diagonal[i] == host(0))
+        {
+            info = i + 1;
+            return HIPBLAS_STATUS_SUCCESS;
+        }
+
+    // W = I, then W = inv(L) or inv(U)
+    std::fill(diagonal.begin(), diagonal.end(), host(1));
+    status = device.zero(W, n, n, n);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = device.upload(W, n + 1, (T*)diagonal.data(), 1, 1, n);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = device.trsm(HIPBLAS_SIDE_LEFT, uplo, HIPBLAS_OP_N, n, n, A, lda, W, n);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    const hipblasOperation_t adjoint = hipblas_cholesky_adjoint<T>();
+    const bool               lower   = uplo == HIPBLAS_FILL_MODE_LOWER;
+    return device.herk(uplo, lower ? adjoint : HIPBLAS_OP_N, n, n, 1, W, n, 0, A, lda);
+}
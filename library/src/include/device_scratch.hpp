@@ -0,0 +1,148 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "handle_state.hpp"
+#include "hipblas.h"
+#include <hip/hip_runtime.h>
+
+// Alignment of hipblasSetWorkspace memory and of the blocks taken from it
+constexpr size_t hipblas_workspace_alignment = 256;
+
+// Gives the backend handle the device workspace memory[0, size), or returns it to the
+// memory the backend manages itself if memory is nullptr and size is 0. Defined by
+// each backend.
+hipblasStatus_t hipblas_set_backend_workspace(hipblasHandle_t handle, void* memory, size_t size);
+
+// Size of the user workspace the backend has while hipblas_device_scratch holds the
+// last workspace.used bytes of its aligned part
+inline size_t hipblas_backend_workspace_size(const hipblas_user_workspace& workspace)
+{
+    size_t usable = workspace.size / hipblas_workspace_alignment * hipblas_workspace_alignment;
+    return workspace.used ? usable - workspace.used : workspace.size;
+}
+
+// Device memory the library needs for itself during a call on handle, such as the
+// work buffers of emulated routines. It is allocated with hipMalloc, unless the handle
+// has a user workspace, in which case it is taken from the end of the workspace and
+// the backend is given the rest until the scratch is released. Blocks are taken and
+// released in LIFO order, and a workspace too small fails with
+// HIPBLAS_STATUS_ALLOC_FAILED instead of allocating.
+class hipblas_device_scratch
+{
+public:
+    explicit hipblas_device_scratch(hipblasHandle_t handle)
+        : m_handle(handle)
+    {
+    }
+
+    hipblas_device_scratch(const hipblas_device_scratch&) = delete;
+    hipblas_device_scratch& operator=(const hipblas_device_scratch&) = delete;
+
+    ~hipblas_device_scratch()
+    {
+        release();
+    }
+
+    // Makes at least size bytes available. The contents are not kept when the
+    // scratch grows.
+    hipblasStatus_t reserve(size_t size)
+    {
+        if(size <= m_size)
+            return HIPBLAS_STATUS_SUCCESS;
+
+        hipblas_user_workspace& workspace = hipblas_get_handle_state(m_handle).user_workspace;
+        if(!workspace.set)
+        {
+            release();
+            hipError_t error = hipMalloc(&m_memory, size);
+            if(error != hipSuccess)
+            {
+                m_memory = nullptr;
+                return hipblas_hip_to_status(error);
+            }
+            m_size = size;
+            return HIPBLAS_STATUS_SUCCESS;
+        }
+
+        // Only the block taken last can grow
+        if(m_size && workspace.used != m_base + m_size)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+        if(!m_size)
+            m_base = workspace.used;
+
+        size_t usable = workspace.size / hipblas_workspace_alignment * hipblas_workspace_alignment;
+        size_t bytes  = (size + hipblas_workspace_alignment - 1) / hipblas_workspace_alignment
+                       * hipblas_workspace_alignment;
+        if(bytes > usable - m_base)
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+
+        size_t used = m_base + bytes;
+        hipblasStatus_t status
+            = hipblas_set_backend_workspace(m_handle, workspace.memory, usable - used);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        workspace.used = used;
+        m_memory       = (char*)workspace.memory + usable - used;
+        m_size         = bytes;
+        m_borrowed     = true;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    void* data() const
+    {
+        return m_memory;
+    }
+
+    size_t size() const
+    {
+        return m_size;
+    }
+
+private:
+    void release()
+    {
+        if(m_borrowed)
+        {
+            hipblas_user_workspace& workspace
+                = hipblas_get_handle_state(m_handle).user_workspace;
+            workspace.used = m_base;
+            (void)hipblas_set_backend_workspace(
+                m_handle, workspace.memory, hipblas_backend_workspace_size(workspace));
+        }
+        else if(m_memory)
+            (void)hipFree(m_memory);
+
+        m_memory   = nullptr;
+        m_size     = 0;
+        m_borrowed = false;
+    }
+
+    hipblasHandle_t m_handle;
+    void*           m_memory   = nullptr;
+    size_t          m_size     = 0;
+    size_t          m_base     = 0;
+    bool            m_borrowed = false;
+};
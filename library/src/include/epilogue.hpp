@@ -0,0 +1,52 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+#include <cstdint>
+#include <hip/hip_runtime_api.h>
+
+// The epilogue of hipblasGemmExWithEpilogue, applied to C after the product by one
+// kernel. Without D, C already holds alpha*op(A)*op(B) + beta*C. With D, D holds
+// op(A)*op(B) and C is set to alpha[j]*D + beta[j]*C column by column, C being read
+// only where beta[j] is not zero.
+struct hipblas_epilogue_args
+{
+    hipDataType type; // of C, D, bias and aux: HIP_R_16F, HIP_R_16BF, HIP_R_32F or HIP_R_64F
+    int64_t     m;
+    int64_t     n;
+    void*       C;
+    int64_t     ldc;
+    const void* D          = nullptr;
+    int64_t     ldd        = 0;
+    const void* alpha      = nullptr; // n values, double for HIP_R_64F and float otherwise
+    const void* beta       = nullptr;
+    const void* bias       = nullptr;
+    void*       aux        = nullptr;
+    int64_t     ldaux      = 0;
+    int         activation = HIPBLAS_EPILOGUE_ACTIVATION_NONE;
+};
+
+// Launches the epilogue on stream; defined with the device code in epilogue_kernels.cpp
+hipblasStatus_t hipblas_launch_epilogue(const hipblas_epilogue_args& args, hipStream_t stream);
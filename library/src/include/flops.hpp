@@ -25,6 +25,8 @@
 #define _HIPBLAS_FLOPS_H_
 
 #include "hipblas.h"
+#include <algorithm>
+#include <cstdint>
 
 /*!\file
  * \brief provides Floating point counts of Basic Linear Algebra Subprograms (BLAS) of Level 1, 2,
@@ -812,7 +814,7 @@ constexpr double geqrf_gflop_count(int64_t n, int64_t m)
 {
     // Calculation is for m == n, using max of m, n for now
     int64_t k = std::max(m, n);
-    return ((4.0 / 3.0) * k * k * k);
+    return ((4.0 / 3.0) * k * k * k) / 1e9;
 }
 
 template <>
@@ -905,4 +907,61 @@ constexpr double gels_gflop_count<hipblasDoubleComplex>(int64_t m, int64_t n)
     return 4 * gels_gflop_count<float>(m, n);
 }
 
+/* \brief floating point counts of POTRF */
+template <typename T>
+constexpr double potrf_gflop_count(int64_t n)
+{
+    return (n * n * n / 3.0) / 1e9;
+}
+
+template <>
+constexpr double potrf_gflop_count<hipblasComplex>(int64_t n)
+{
+    return 4.0 * potrf_gflop_count<float>(n);
+}
+
+template <>
+constexpr double potrf_gflop_count<hipblasDoubleComplex>(int64_t n)
+{
+    return 4.0 * potrf_gflop_count<float>(n);
+}
+
+/* \brief floating point counts of POTRS */
+template <typename T>
+constexpr double potrs_gflop_count(int64_t n, int64_t nrhs)
+{
+    return (2.0 * n * n * nrhs) / 1e9;
+}
+
+template <>
+constexpr double potrs_gflop_count<hipblasComplex>(int64_t n, int64_t nrhs)
+{
+    return 4.0 * potrs_gflop_count<float>(n, nrhs);
+}
+
+template <>
+constexpr double potrs_gflop_count<hipblasDoubleComplex>(int64_t n, int64_t nrhs)
+{
+    return 4.0 * potrs_gflop_count<float>(n, nrhs);
+}
+
+/* \brief floating point counts of POTRI */
+template <typename T>
+constexpr double potri_gflop_count(int64_t n)
+{
+    return ((2.0 / 3.0) * n * n * n) / 1e9;
+}
+
+template <>
+constexpr double potri_gflop_count<hipblasComplex>(int64_t n)
+{
+    return 4.0 * potri_gflop_count<float>(n);
+}
+
+template <>
+constexpr double potri_gflop_count<hipblasDoubleComplex>(int64_t n)
+{
+    return 4.0 * potri_gflop_count<float>(n);
+}
+
 #endif /* _HIPBLAS_FLOPS_H_ */
@@ -0,0 +1,96 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+#include <cstdint>
+#include <hip/hip_runtime_api.h>
+
+// Splits the rows by cols complex matrices A of a batch into three real planes, of the real
+// parts, the imaginary parts and their sums, each holding the matrices of the batch one after
+// the other with a leading dimension of rows. The imaginary parts are negated when conjugate.
+struct hipblas_gemm3m_split_args
+{
+    hipDataType type; // HIP_C_32F or HIP_C_64F
+    int64_t     rows;
+    int64_t     cols;
+    const void* A; // the first matrix, or a device array of the matrices when batched
+    bool        batched;
+    int64_t     lda;
+    int64_t     stride; // between the matrices of A when not batched
+    void*       D; // 3 * rows * cols * batch_count real values
+    int64_t     batch_count;
+    bool        conjugate;
+};
+
+// Sets the m by n complex matrices of C of a batch to alpha*P + beta*C, where P is formed from
+// the real planes T1, T2 and T3 of P as (T1 - T2) + i*(T3 - T1 - T2), laid out as in the split.
+// alpha and beta are read from alpha_ptr and beta_ptr when they are given, and C is only read
+// where beta is not zero.
+struct hipblas_gemm3m_merge_args
+{
+    hipDataType type; // HIP_C_32F or HIP_C_64F
+    int64_t     m;
+    int64_t     n;
+    const void* P;
+    void*       C; // the first matrix, or a device array of the matrices when batched
+    bool        batched;
+    int64_t     ldc;
+    int64_t     stride;
+    int64_t     batch_count;
+    double      alpha[2]  = {1, 0};
+    double      beta[2]   = {0, 0};
+    const void* alpha_ptr = nullptr;
+    const void* beta_ptr  = nullptr;
+};
+
+// Defined with the device code in gemm3m_kernels.cpp
+hipblasStatus_t hipblas_launch_gemm3m_split(const hipblas_gemm3m_split_args& args,
+                                            hipStream_t                      stream);
+hipblasStatus_t hipblas_launch_gemm3m_merge(const hipblas_gemm3m_merge_args& args,
+                                            hipStream_t                      stream);
+
+// Complex gemm with three real gemms of the backend, for the gemm3m functions the backend does
+// not have. A, B and C are device arrays of the matrices when batched, and the first matrices
+// of strided batches otherwise; alpha and beta follow the pointer mode of the handle.
+hipblasStatus_t hipblas_gemm3m(hipblasHandle_t    handle,
+                               hipDataType        type,
+                               hipblasOperation_t transA,
+                               hipblasOperation_t transB,
+                               int                m,
+                               int                n,
+                               int                k,
+                               const void*        alpha,
+                               const void*        A,
+                               int                lda,
+                               int64_t            strideA,
+                               const void*        B,
+                               int                ldb,
+                               int64_t            strideB,
+                               const void*        beta,
+                               void*              C,
+                               int                ldc,
+                               int64_t            strideC,
+                               int                batchCount,
+                               bool               batched);
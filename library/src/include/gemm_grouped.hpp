@@ -0,0 +1,155 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+// One backend gemm_batched_ex call made for hipblasGemmGroupedBatchedEx. offset is
+// the index of the first problem in the A, B and C pointer arrays.
+struct hipblas_gemm_grouped_launch
+{
+    hipblasOperation_t transa;
+    hipblasOperation_t transb;
+    int                m;
+    int                n;
+    int                k;
+    int                lda;
+    int                ldb;
+    int                ldc;
+    const void*        alpha;
+    const void*        beta;
+    int64_t            offset;
+    int                batch_count;
+};
+
+// Size in bytes of alpha and beta for the given compute type and matrix type
+inline size_t hipblas_gemm_scalar_size(hipblasComputeType_t compute_type, hipDataType a_type)
+{
+    bool complex = a_type == HIP_C_16F || a_type == HIP_C_32F || a_type == HIP_C_64F
+                   || a_type == HIP_C_16BF;
+    size_t size;
+    switch(compute_type)
+    {
+    case HIPBLAS_COMPUTE_16F:
+    case HIPBLAS_COMPUTE_16F_PEDANTIC:
+        size = 2;
+        break;
+    case HIPBLAS_COMPUTE_64F:
+    case HIPBLAS_COMPUTE_64F_PEDANTIC:
+        size = 8;
+        break;
+    default:
+        size = 4;
+        break;
+    }
+    return complex ? 2 * size : size;
+}
+
+// Validates the groups of a grouped GEMM and plans the fewest backend calls for them.
+// Every group is uniform, so each becomes one batched call, and adjacent groups with
+// identical parameters are merged into a single call as long as the merged batch
+// count fits in an int. Scalars are compared by value when host_scalars is true and
+// by address otherwise. Groups with no work are skipped.
+inline hipblasStatus_t
+    hipblas_plan_gemm_grouped(const hipblasOperation_t                  transa_array[],
+                              const hipblasOperation_t                  transb_array[],
+                              const int                                 m_array[],
+                              const int                                 n_array[],
+                              const int                                 k_array[],
+                              const void*                               alpha_array,
+                              const int                                 lda_array[],
+                              const int                                 ldb_array[],
+                              const void*                               beta_array,
+                              const int                                 ldc_array[],
+                              int                                       group_count,
+                              const int                                 group_size[],
+                              size_t                                    scalar_size,
+                              bool                                      host_scalars,
+                              std::vector<hipblas_gemm_grouped_launch>& launches)
+{
+    launches.clear();
+    if(group_count < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(group_count == 0)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!transa_array || !transb_array || !m_array || !n_array || !k_array || !alpha_array
+       || !lda_array || !ldb_array || !beta_array || !ldc_array || !group_size)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    auto same_scalar = [&](const void* a, const void* b) {
+        return a == b || (host_scalars && std::memcmp(a, b, scalar_size) == 0);
+    };
+
+    int64_t offset = 0;
+    for(int g = 0; g < group_count; g++)
+    {
+        hipblas_gemm_grouped_launch group;
+        group.transa      = transa_array[g];
+        group.transb      = transb_array[g];
+        group.m           = m_array[g];
+        group.n           = n_array[g];
+        group.k           = k_array[g];
+        group.lda         = lda_array[g];
+        group.ldb         = ldb_array[g];
+        group.ldc         = ldc_array[g];
+        group.alpha       = static_cast<const char*>(alpha_array) + g * scalar_size;
+        group.beta        = static_cast<const char*>(beta_array) + g * scalar_size;
+        group.offset      = offset;
+        group.batch_count = group_size[g];
+
+        int a_rows = group.transa == HIPBLAS_OP_N ? group.m : group.k;
+        int b_rows = group.transb == HIPBLAS_OP_N ? group.k : group.n;
+        if(group.m < 0 || group.n < 0 || group.k < 0 || group.batch_count < 0
+           || group.lda < std::max(1, a_rows) || group.ldb < std::max(1, b_rows)
+           || group.ldc < std::max(1, group.m))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        offset += group.batch_count;
+        if(!group.m || !group.n || !group.batch_count)
+            continue;
+
+        if(!launches.empty())
+        {
+            hipblas_gemm_grouped_launch& last = launches.back();
+            if(last.offset + last.batch_count == group.offset
+               && last.batch_count <= std::numeric_limits<int>::max() - group.batch_count
+               && last.transa == group.transa && last.transb == group.transb
+               && last.m == group.m && last.n == group.n && last.k == group.k
+               && last.lda == group.lda && last.ldb == group.ldb && last.ldc == group.ldc
+               && same_scalar(last.alpha, group.alpha) && same_scalar(last.beta, group.beta))
+            {
+                last.batch_count += group.batch_count;
+                continue;
+            }
+        }
+        launches.push_back(group);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,240 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+// A GEMM problem as seen by the tuner. Types and operations are stored as the
+// backend's integer enum values, and arch identifies the device the solution
+// index was measured on.
+struct hipblas_gemm_tuning_key
+{
+    std::string arch;
+    int32_t     trans_a      = 0;
+    int32_t     trans_b      = 0;
+    int64_t     m            = 0;
+    int64_t     n            = 0;
+    int64_t     k            = 0;
+    int32_t     a_type       = 0;
+    int32_t     b_type       = 0;
+    int32_t     c_type       = 0;
+    int32_t     compute_type = 0;
+    int32_t     flags        = 0;
+
+    auto tie() const
+    {
+        return std::tie(
+            arch, trans_a, trans_b, m, n, k, a_type, b_type, c_type, compute_type, flags);
+    }
+
+    bool operator<(const hipblas_gemm_tuning_key& rhs) const
+    {
+        return tie() < rhs.tie();
+    }
+};
+
+// Remembers the fastest solution index for each GEMM problem. The solutions to try
+// and the way to time them are supplied by the caller, so the cache itself does not
+// depend on a backend or a device.
+class hipblas_gemm_tuning_cache
+{
+public:
+    // Returns the candidate solution indices for the problem being tuned
+    using solutions_fn = std::function<std::vector<int32_t>()>;
+
+    // Returns the time taken by one solution index, or a negative value if it failed
+    using timer_fn = std::function<double(int32_t)>;
+
+    // The version string identifies the backend build the solution indices belong to;
+    // entries saved by a different version are not loaded.
+    explicit hipblas_gemm_tuning_cache(std::string version = "")
+        : m_version(std::move(version))
+    {
+    }
+
+    // Returns true and sets solution if the problem has already been tuned
+    bool lookup(const hipblas_gemm_tuning_key& key, int32_t& solution) const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        auto it = m_solutions.find(key);
+        if(it == m_solutions.end())
+            return false;
+
+        solution = it->second;
+        return true;
+    }
+
+    // Times every candidate and remembers the fastest. Solution 0, the backend's own
+    // heuristic choice, is always a candidate so tuning never picks something slower.
+    int32_t tune(const hipblas_gemm_tuning_key& key,
+                 const solutions_fn&            solutions,
+                 const timer_fn&                timer)
+    {
+        std::vector<int32_t> candidates = solutions();
+        candidates.insert(candidates.begin(), 0);
+
+        int32_t best      = 0;
+        double  best_time = std::numeric_limits<double>::max();
+        for(int32_t candidate : candidates)
+        {
+            double time = timer(candidate);
+            if(time >= 0 && time < best_time)
+            {
+                best      = candidate;
+                best_time = time;
+            }
+        }
+
+        insert(key, best);
+        m_tuned++;
+        return best;
+    }
+
+    void insert(const hipblas_gemm_tuning_key& key, int32_t solution)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_solutions[key] = solution;
+    }
+
+    size_t size() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_solutions.size();
+    }
+
+    // Number of problems tuned by this cache, as opposed to loaded from a file
+    size_t tuned() const
+    {
+        return m_tuned;
+    }
+
+    // Loads entries saved by save(). Returns false if the file could not be read or was
+    // written for another version, in which case the cache is left unchanged.
+    bool load(const std::string& path)
+    {
+        std::ifstream file(path);
+        if(!file)
+            return false;
+
+        std::string line;
+        if(!std::getline(file, line) || line != header())
+            return false;
+
+        std::map<hipblas_gemm_tuning_key, int32_t> solutions;
+        while(std::getline(file, line))
+        {
+            std::istringstream      fields(line);
+            hipblas_gemm_tuning_key key;
+            int32_t                 solution;
+            if(fields >> key.arch >> key.trans_a >> key.trans_b >> key.m >> key.n >> key.k
+               >> key.a_type >> key.b_type >> key.c_type >> key.compute_type >> key.flags
+               >> solution)
+                solutions[key] = solution;
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for(auto& entry : solutions)
+            m_solutions.insert(entry);
+        return true;
+    }
+
+    // Writes all entries to path. The file is written to a temporary named after the
+    // process and a per-process count, then renamed over path, so that concurrent savers
+    // never share a temporary and readers never see a partially written file. On Windows,
+    // rename does not replace an existing file, so path is removed first and a reader may
+    // briefly find no file there.
+    bool save(const std::string& path) const
+    {
+        static std::atomic<unsigned> saves{0};
+#ifdef _WIN32
+        long pid = long(_getpid());
+#else
+        long pid = long(getpid());
+#endif
+        std::string tmp_path
+            = path + "." + std::to_string(pid) + "." + std::to_string(saves++) + ".tmp";
+        bool written;
+        {
+            std::ofstream file(tmp_path, std::ios::trunc);
+            if(!file)
+                return false;
+
+            file << header() << '\n';
+
+            std::lock_guard<std::mutex> lock(m_mutex);
+            for(auto& entry : m_solutions)
+            {
+                const hipblas_gemm_tuning_key& key = entry.first;
+                file << key.arch << ' ' << key.trans_a << ' ' << key.trans_b << ' ' << key.m
+                     << ' ' << key.n << ' ' << key.k << ' ' << key.a_type << ' ' << key.b_type
+                     << ' ' << key.c_type << ' ' << key.compute_type << ' ' << key.flags << ' '
+                     << entry.second << '\n';
+            }
+
+            file.close();
+            written = bool(file);
+        }
+        if(written)
+        {
+            if(std::rename(tmp_path.c_str(), path.c_str()) == 0)
+                return true;
+#ifdef _WIN32
+            std::remove(path.c_str());
+            if(std::rename(tmp_path.c_str(), path.c_str()) == 0)
+                return true;
+#endif
+        }
+        std::remove(tmp_path.c_str());
+        return false;
+    }
+
+private:
+    std::string header() const
+    {
+        return "hipblas_gemm_tuning 1 " + m_version;
+    }
+
+    std::string                                m_version;
+    mutable std::mutex                         m_mutex;
+    std::map<hipblas_gemm_tuning_key, int32_t> m_solutions;
+    std::atomic<size_t>                        m_tuned{0};
+};
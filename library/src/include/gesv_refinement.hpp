@@ -0,0 +1,318 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+#include <cmath>
+#include <cstdint>
+#include <hip/hip_runtime_api.h>
+#include <limits>
+
+// Mixed precision iterative refinement behind the DSgesv and ZCgesv functions,
+// following LAPACK dsgesv and zcgesv. A is factored in the low precision L, and the
+// solution is refined in the high precision T until the residual of every right hand
+// side is below sqrt(n) * eps * ||A||_inf * ||x||_inf. When refinement does not
+// converge within hipblas_gesv_max_iterations steps, or A does not fit the low
+// precision, A is factored in T instead. The matrices stay on the device: conversions,
+// updates and tests run in the kernels of gesv_kernels.cpp, and only their flags and
+// norms are copied to the host.
+
+constexpr int hipblas_gesv_max_iterations = 30;
+
+// Values of iter when the solution was not found by refinement, as in LAPACK
+constexpr int hipblas_gesv_overflow       = -2; // A or a residual overflows L
+constexpr int hipblas_gesv_singular_low   = -3; // the low precision factorization failed
+constexpr int hipblas_gesv_not_converged  = -(hipblas_gesv_max_iterations + 1);
+
+// The operations the solver needs from a device, for high precision T and low
+// precision L. Matrices in device memory are column major; the work buffers are
+// n x n (low_matrix) and n x nrhs (low_rhs, residual) with leading dimension n.
+// Results set on the host are complete when the operations return.
+template <typename T, typename L>
+class hipblas_gesv_device
+{
+public:
+    virtual ~hipblas_gesv_device() = default;
+
+    virtual hipblasStatus_t prepare(int n, int nrhs) = 0;
+
+    virtual L* low_matrix() = 0;
+    virtual L* low_rhs()    = 0;
+    virtual T* residual()   = 0;
+
+    // Device to device copy
+    virtual hipblasStatus_t copy(T* dst, int ld_dst, const T* src, int ld_src, int rows, int cols)
+        = 0;
+
+    // Rounds src to the low precision in dst; fits is set on the host to false when a
+    // value does not fit
+    virtual hipblasStatus_t
+        demote(L* dst, int ld_dst, const T* src, int ld_src, int rows, int cols, bool& fits)
+        = 0;
+
+    // norm is set on the host to max_i sum_j |a_ij|, with |re| + |im| magnitudes
+    virtual hipblasStatus_t norm_inf(int n, const T* A, int lda, double& norm) = 0;
+
+    // X = D when first, X = X + D otherwise
+    virtual hipblasStatus_t
+        update(T* X, int ldx, const L* D, int ldd, int rows, int cols, bool first)
+        = 0;
+
+    // converged is set on the host to whether max_i |r_ij| <= max_i |x_ij| * cte for
+    // every column j, and R is demoted to low_R as by demote in the same round trip
+    virtual hipblasStatus_t check(int      n,
+                                  int      nrhs,
+                                  const T* X,
+                                  int      ldx,
+                                  const T* R,
+                                  int      ldr,
+                                  double   cte,
+                                  L*       low_R,
+                                  int      ld_low,
+                                  bool&    converged,
+                                  bool&    fits)
+        = 0;
+
+    // LU factorization with partial pivoting; info is set on the host as by getrf
+    virtual hipblasStatus_t getrf(int n, L* A, int lda, int* ipiv, int& info) = 0;
+    virtual hipblasStatus_t getrf(int n, T* A, int lda, int* ipiv, int& info) = 0;
+
+    virtual hipblasStatus_t
+        getrs(int n, int nrhs, const L* A, int lda, const int* ipiv, L* B, int ldb)
+        = 0;
+    virtual hipblasStatus_t
+        getrs(int n, int nrhs, const T* A, int lda, const int* ipiv, T* B, int ldb)
+        = 0;
+
+    // R = R - A * X for an n x n matrix A
+    virtual hipblasStatus_t
+        residual(int n, int nrhs, const T* A, int lda, const T* X, int ldx, T* R, int ldr)
+        = 0;
+};
+
+template <typename T>
+struct hipblas_gesv_real
+{
+    using type = T;
+};
+
+template <>
+struct hipblas_gesv_real<hipFloatComplex>
+{
+    using type = float;
+};
+
+template <>
+struct hipblas_gesv_real<hipDoubleComplex>
+{
+    using type = double;
+};
+
+// The kernels of the device operations, for double and float or, when complex,
+// hipDoubleComplex and hipFloatComplex. Flags are device ints the kernels only set to
+// 1, and norms are the bits of non-negative doubles the kernels only raise, so the
+// caller clears them before a launch.
+
+// dst = src rounded to float; overflow is set when a value does not fit
+struct hipblas_gesv_demote_args
+{
+    bool        complex;
+    int64_t     rows;
+    int64_t     cols;
+    const void* src;
+    int64_t     ld_src;
+    void*       dst;
+    int64_t     ld_dst;
+    int*        overflow;
+};
+
+// X = D when first, X = X + D otherwise, for float D
+struct hipblas_gesv_update_args
+{
+    bool        complex;
+    int64_t     rows;
+    int64_t     cols;
+    const void* D;
+    int64_t     ldd;
+    void*       X;
+    int64_t     ldx;
+    bool        first;
+};
+
+// norm = max_i sum_j |a_ij| for an n x n matrix A
+struct hipblas_gesv_norm_args
+{
+    bool                complex;
+    int64_t             n;
+    const void*         A;
+    int64_t             lda;
+    unsigned long long* norm;
+};
+
+// unconverged is set when max_i |r_ij| > max_i |x_ij| * cte for a column j, or the
+// column has a NaN
+struct hipblas_gesv_check_args
+{
+    bool        complex;
+    int64_t     n;
+    int64_t     nrhs;
+    const void* X;
+    int64_t     ldx;
+    const void* R;
+    int64_t     ldr;
+    double      cte;
+    int*        unconverged;
+};
+
+// Defined with the device code in gesv_kernels.cpp
+hipblasStatus_t hipblas_launch_gesv_demote(const hipblas_gesv_demote_args& args,
+                                           hipStream_t                     stream);
+hipblasStatus_t hipblas_launch_gesv_update(const hipblas_gesv_update_args& args,
+                                           hipStream_t                     stream);
+hipblasStatus_t hipblas_launch_gesv_norm(const hipblas_gesv_norm_args& args, hipStream_t stream);
+hipblasStatus_t hipblas_launch_gesv_check(const hipblas_gesv_check_args& args,
+                                          hipStream_t                    stream);
+
+// Solves A * X = B for one n x n problem in device memory. B is not changed; A is only
+// changed when it is factored in the high precision, and ipiv holds the pivots of the
+// last factorization. iter is set to the number of refinement steps, or to one of the
+// negative values above when A was factored in the high precision, in which case info
+// is the info of that factorization.
+template <typename T, typename L>
+hipblasStatus_t hipblas_gesv_refine(hipblas_gesv_device<T, L>& device,
+                                    int                        n,
+                                    int                        nrhs,
+                                    T*                         A,
+                                    int                        lda,
+                                    int*                       ipiv,
+                                    const T*                   B,
+                                    int                        ldb,
+                                    T*                         X,
+                                    int                        ldx,
+                                    int&                       iter,
+                                    int&                       info)
+{
+    using real = typename hipblas_gesv_real<T>::type;
+
+    iter = 0;
+    info = 0;
+    if(!n || !nrhs)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    hipblasStatus_t status = device.prepare(n, nrhs);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    L* low_A = device.low_matrix();
+    L* low_R = device.low_rhs();
+    T* R     = device.residual();
+
+    // Solves low_A * D = low_R in the low precision and sets X = D or adds D to X
+    auto correct = [&](bool first) {
+        hipblasStatus_t status = device.getrs(n, nrhs, low_A, n, ipiv, low_R, n);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = device.update(X, ldx, low_R, n, n, nrhs, first);
+        return status;
+    };
+
+    // R = B - A * X
+    auto residual = [&]() {
+        hipblasStatus_t status = device.copy(R, n, B, ldb, n, nrhs);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = device.residual(n, nrhs, A, lda, X, ldx, R, n);
+        return status;
+    };
+
+    double norm = 0;
+    bool   fits = true;
+    status      = device.norm_inf(n, A, lda, norm);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = device.demote(low_A, n, A, lda, n, n, fits);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    double eps  = std::numeric_limits<real>::epsilon() / 2;
+    double cte  = norm * eps * std::sqrt(double(n));
+    int    fail = fits ? 0 : hipblas_gesv_overflow;
+    if(!fail)
+    {
+        int low_info = 0;
+        status       = device.getrf(n, low_A, n, ipiv, low_info);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        if(low_info > 0)
+            fail = hipblas_gesv_singular_low;
+    }
+    if(!fail)
+    {
+        status = device.demote(low_R, n, B, ldb, n, nrhs, fits);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        if(!fits)
+            fail = hipblas_gesv_overflow;
+    }
+    if(!fail)
+    {
+        status = correct(true);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = residual();
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        for(int step = 1; !fail; step++)
+        {
+            bool converged = false;
+            status         = device.check(n, nrhs, X, ldx, R, n, cte, low_R, n, converged, fits);
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+            if(converged)
+            {
+                iter = step - 1;
+                return HIPBLAS_STATUS_SUCCESS;
+            }
+            if(step > hipblas_gesv_max_iterations)
+                fail = hipblas_gesv_not_converged;
+            else if(!fits)
+                fail = hipblas_gesv_overflow;
+            else
+            {
+                status = correct(false);
+                if(status == HIPBLAS_STATUS_SUCCESS)
+                    status = residual();
+                if(status != HIPBLAS_STATUS_SUCCESS)
+                    return status;
+            }
+        }
+    }
+
+    // Factor and solve in the high precision
+    iter   = fail;
+    status = device.getrf(n, A, lda, ipiv, info);
+    if(status != HIPBLAS_STATUS_SUCCESS || info > 0)
+        return status;
+    status = device.copy(X, ldx, B, ldb, n, nrhs);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = device.getrs(n, nrhs, A, lda, ipiv, X, ldx);
+    return status;
+}
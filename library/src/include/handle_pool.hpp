@@ -0,0 +1,294 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Pool of handles behind hipblasHandlePoolAcquire and hipblasHandlePoolRelease. A
+// handle is created for the (thread, device, stream) that first needs one and is
+// given back to the same thread and stream when it asks again, so that threads keep
+// warm handles. At most max_handles handles are created per device; past that an
+// idle handle of the device is moved to the new thread and stream, and when none is
+// idle the caller waits for a release. Workspaces are held by the handles in use
+// only, so handles which never run at the same time share them. Nothing here
+// depends on the backend, which lets the pool be tested without a device.
+class hipblas_handle_pool_backend
+{
+public:
+    virtual ~hipblas_handle_pool_backend() = default;
+
+    virtual hipblasStatus_t create_handle(int device, hipblasHandle_t* handle) = 0;
+    virtual void            destroy_handle(int device, hipblasHandle_t handle)  = 0;
+
+    // Workspaces are opaque to the pool
+    virtual hipblasStatus_t create_workspace(int device, void** workspace) = 0;
+    virtual void            destroy_workspace(int device, void* workspace)  = 0;
+
+    // Prepares handle for a new user on stream, with workspace or, if it is nullptr, the
+    // memory managed by the backend. The workspace may have been used by another handle
+    // on another stream, whose work can still be running.
+    virtual hipblasStatus_t bind(hipblasHandle_t handle, hipStream_t stream, void* workspace) = 0;
+
+    // Called when the user of handle releases it, with work it queued possibly running
+    virtual hipblasStatus_t unbind(hipblasHandle_t handle, void* workspace) = 0;
+};
+
+class hipblas_handle_pool
+{
+public:
+    struct stats
+    {
+        uint64_t handles_created = 0;
+        uint64_t acquires        = 0;
+        uint64_t waits           = 0;
+        double   wait_seconds    = 0;
+    };
+
+    // With shared_workspaces false, handles use the memory managed by the backend
+    hipblas_handle_pool(std::unique_ptr<hipblas_handle_pool_backend> backend,
+                        int                                          max_handles,
+                        bool                                         shared_workspaces)
+        : m_backend(std::move(backend))
+        , m_max_handles(max_handles)
+        , m_shared_workspaces(shared_workspaces)
+    {
+    }
+
+    hipblas_handle_pool(const hipblas_handle_pool&) = delete;
+    hipblas_handle_pool& operator=(const hipblas_handle_pool&) = delete;
+
+    ~hipblas_handle_pool()
+    {
+        for(entry& handle : m_handles)
+            m_backend->destroy_handle(handle.device, handle.handle);
+        for(workspace& memory : m_workspaces)
+            m_backend->destroy_workspace(memory.device, memory.memory);
+    }
+
+    hipblasStatus_t acquire(int device, hipStream_t stream, hipblasHandle_t* handle)
+    {
+        std::thread::id              thread = std::this_thread::get_id();
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        std::chrono::steady_clock::time_point start;
+        bool                                  waited = false;
+        size_t                                index;
+        while(!find(device, thread, stream, index))
+        {
+            if(count(device) < m_max_handles)
+            {
+                // Handles are created without holding the lock, as creation is slow
+                m_creating.push_back(device);
+                lock.unlock();
+                hipblasHandle_t new_handle = nullptr;
+                hipblasStatus_t created    = m_backend->create_handle(device, &new_handle);
+                lock.lock();
+                m_creating.erase(std::find(m_creating.begin(), m_creating.end(), device));
+                if(created != HIPBLAS_STATUS_SUCCESS)
+                {
+                    m_released.notify_all();
+                    return created;
+                }
+                m_handles.push_back({new_handle, device, thread, stream});
+                m_stats.handles_created++;
+                index = m_handles.size() - 1;
+                break;
+            }
+
+            if(!waited)
+                start = std::chrono::steady_clock::now();
+            waited = true;
+            m_released.wait(lock);
+        }
+
+        entry& found = m_handles[index];
+        found.thread = thread;
+        found.stream = stream;
+        found.in_use = true;
+
+        hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+        if(m_shared_workspaces)
+            status = take_workspace(device, found.workspace);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = m_backend->bind(found.handle,
+                                     stream,
+                                     found.workspace < 0 ? nullptr
+                                                         : m_workspaces[found.workspace].memory);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            give_back(found);
+            return status;
+        }
+
+        if(waited)
+        {
+            m_stats.waits++;
+            m_stats.wait_seconds
+                += std::chrono::duration<double>(std::chrono::steady_clock::now() - start)
+                       .count();
+        }
+        m_stats.acquires++;
+        *handle = found.handle;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    hipblasStatus_t release(hipblasHandle_t handle)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for(entry& found : m_handles)
+            if(found.handle == handle && found.in_use)
+            {
+                hipblasStatus_t status = m_backend->unbind(
+                    handle,
+                    found.workspace < 0 ? nullptr : m_workspaces[found.workspace].memory);
+                give_back(found);
+                return status;
+            }
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    bool in_use() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for(const entry& handle : m_handles)
+            if(handle.in_use)
+                return true;
+        return !m_creating.empty();
+    }
+
+    stats get_stats() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_stats;
+    }
+
+    size_t workspace_count() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_workspaces.size();
+    }
+
+private:
+    struct entry
+    {
+        hipblasHandle_t handle;
+        int             device;
+        std::thread::id thread;
+        hipStream_t     stream;
+        bool            in_use    = false;
+        uint64_t        last_used = 0;
+        int             workspace = -1;
+    };
+
+    struct workspace
+    {
+        int   device;
+        void* memory;
+        bool  in_use;
+    };
+
+    int count(int device) const
+    {
+        int handles = 0;
+        for(const entry& handle : m_handles)
+            handles += handle.device == device;
+        for(int creating : m_creating)
+            handles += creating == device;
+        return handles;
+    }
+
+    // An idle handle of device: the one last used by thread on stream, else, once
+    // there are as many handles as allowed, the least recently used
+    bool find(int device, std::thread::id thread, hipStream_t stream, size_t& index) const
+    {
+        const entry* best = nullptr;
+        for(const entry& handle : m_handles)
+        {
+            if(handle.device != device || handle.in_use)
+                continue;
+            if(handle.thread == thread && handle.stream == stream)
+            {
+                best = &handle;
+                break;
+            }
+            if(!best || handle.last_used < best->last_used)
+                best = &handle;
+        }
+
+        if(!best || (count(device) < m_max_handles
+                     && !(best->thread == thread && best->stream == stream)))
+            return false;
+        index = best - m_handles.data();
+        return true;
+    }
+
+    hipblasStatus_t take_workspace(int device, int& index)
+    {
+        for(size_t i = 0; i < m_workspaces.size(); i++)
+            if(m_workspaces[i].device == device && !m_workspaces[i].in_use)
+            {
+                m_workspaces[i].in_use = true;
+                index                  = int(i);
+                return HIPBLAS_STATUS_SUCCESS;
+            }
+
+        void*           memory = nullptr;
+        hipblasStatus_t status = m_backend->create_workspace(device, &memory);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        m_workspaces.push_back({device, memory, true});
+        index = int(m_workspaces.size() - 1);
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    void give_back(entry& handle)
+    {
+        if(handle.workspace >= 0)
+            m_workspaces[handle.workspace].in_use = false;
+        handle.workspace = -1;
+        handle.in_use    = false;
+        handle.last_used = ++m_clock;
+        m_released.notify_all();
+    }
+
+    std::unique_ptr<hipblas_handle_pool_backend> m_backend;
+    int                                          m_max_handles;
+    bool                                         m_shared_workspaces;
+
+    mutable std::mutex      m_mutex;
+    std::condition_variable m_released;
+    std::vector<entry>      m_handles;
+    std::vector<workspace>  m_workspaces;
+    std::vector<int>        m_creating; // devices of the handles being created
+    uint64_t                m_clock = 0;
+    stats                   m_stats;
+};
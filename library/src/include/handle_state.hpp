@@ -0,0 +1,133 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "capture.hpp"
+#include "prefetch.hpp"
+#include "stats.hpp"
+#include "stream_pool.hpp"
+#include "workspace_cache.hpp"
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+// Settings of the out-of-core gemm functions. A budget of 0 means a share of the
+// device memory free when the function is called.
+struct hipblas_out_of_core_settings
+{
+    size_t                     budget    = 0;
+    hipblasOutOfCoreProgress_t progress  = nullptr;
+    void*                      user_data = nullptr;
+};
+
+// A device workspace set with hipblasSetWorkspace. While one is set no call may
+// allocate device memory: the backend runs in its user-managed memory mode, and
+// hipblas_device_scratch takes the memory the library needs for itself from the end
+// of the workspace. used is the number of bytes taken that way.
+struct hipblas_user_workspace
+{
+    void*  memory = nullptr;
+    size_t size   = 0;
+    size_t used   = 0;
+    bool   set    = false;
+};
+
+// A capture started with hipblasBeginCapture. The handle's stream is replaced by a
+// stream in HIP capture mode until hipblasEndCapture, so that routines which are not
+// recorded leave work on it instead of running, and are reported there.
+struct hipblas_capture_session
+{
+    hipblas_capture_session();
+    ~hipblas_capture_session();
+
+    hipblas_capture_graph calls;
+    hipStream_t           stream = nullptr; // the handle's stream before the capture
+    hipStream_t           guard  = nullptr;
+};
+
+// hipblasHandle_t is the backend handle itself, so any state hipBLAS keeps for a
+// handle lives in this side table, keyed by the handle and released by hipblasDestroy.
+struct hipblas_handle_state
+{
+    hipblas_workspace_cache      workspace_cache;
+    hipblas_stream_pool          stream_pool;
+    hipblas_out_of_core_settings out_of_core;
+    hipblas_user_workspace       user_workspace;
+
+    std::unique_ptr<hipblas_capture_session> capture;
+    std::unique_ptr<hipblas_handle_stats>    stats;
+    std::unique_ptr<hipblas_handle_prefetch> prefetch;
+};
+
+class hipblas_handle_state_table
+{
+public:
+    static hipblas_handle_state_table& instance()
+    {
+        static hipblas_handle_state_table table;
+        return table;
+    }
+
+    // Returns the state for handle, creating it on first use
+    hipblas_handle_state& get(const void* handle)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        std::unique_ptr<hipblas_handle_state>& state = m_states[handle];
+        if(!state)
+            state = std::make_unique<hipblas_handle_state>();
+        return *state;
+    }
+
+    void release(const void* handle)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_states.erase(handle);
+    }
+
+private:
+    hipblas_handle_state_table() = default;
+
+    std::mutex                                                             m_mutex;
+    std::unordered_map<const void*, std::unique_ptr<hipblas_handle_state>> m_states;
+};
+
+inline hipblas_handle_state& hipblas_get_handle_state(const void* handle)
+{
+    return hipblas_handle_state_table::instance().get(handle);
+}
+
+inline void hipblas_release_handle_state(const void* handle)
+{
+    hipblas_handle_state_table::instance().release(handle);
+}
+
+// Runs call(b) for every problem of a batch over handle's stream pool, for batched
+// routines the backend does not provide. See hipblas_fan_out_batch.
+template <typename Call>
+hipblasStatus_t hipblas_emulate_batched(hipblasHandle_t handle, int batch_count, Call&& call)
+{
+    hipblas_handle_streams streams(handle, hipblas_get_handle_state(handle).stream_pool);
+    return hipblas_fan_out_batch(streams, batch_count, call);
+}
@@ -0,0 +1,354 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+// Largest size, increment or leading dimension the 32-bit API takes
+constexpr int64_t hipblas_int32_max = std::numeric_limits<int32_t>::max();
+
+inline bool hipblas_fits_int32(int64_t value)
+{
+    return value >= std::numeric_limits<int32_t>::min() && value <= hipblas_int32_max;
+}
+
+template <typename... Ts>
+bool hipblas_fits_int32(int64_t value, Ts... values)
+{
+    return hipblas_fits_int32(value) && hipblas_fits_int32(values...);
+}
+
+// Runs call(start, count) for consecutive chunks of at most max_chunk of [0, total),
+// back to back, and returns the first failure. A total that needs no splitting,
+// including one the routine will reject, is passed through as a single chunk so that
+// the 32-bit routine still does the argument checking.
+template <typename Call>
+hipblasStatus_t hipblas_for_each_chunk(int64_t total, int64_t max_chunk, Call&& call)
+{
+    if(total <= max_chunk)
+        return call(int64_t(0), int(std::max<int64_t>(total, -hipblas_int32_max)));
+
+    for(int64_t start = 0; start < total; start += max_chunk)
+    {
+        hipblasStatus_t status = call(start, int(std::min(max_chunk, total - start)));
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+    }
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+// One int-sized chunk of a 64-bit vector operation. start is the index of its first
+// element, and offset_x and offset_y are where the chunk starts in memory, which for
+// a negative increment is at its last element.
+struct hipblas_vector_chunk
+{
+    int64_t start;
+    int     n;
+    int64_t offset_x;
+    int     incx;
+    int64_t offset_y;
+    int     incy;
+};
+
+// Memory offset of elements [start, start + count) of a vector of n elements
+inline int64_t hipblas_vector_chunk_offset(int64_t n, int64_t inc, int64_t start, int64_t count)
+{
+    return inc >= 0 ? start * inc : (n - start - count) * -inc;
+}
+
+// Runs call(chunk) over int-sized chunks of vectors x and y of n elements. An
+// increment that does not fit in an int leaves single element chunks, for which
+// only its sign is passed on.
+template <typename Call>
+hipblasStatus_t hipblas_for_each_vector_chunk(int64_t n, int64_t incx, int64_t incy, Call&& call)
+{
+    auto chunk_inc = [](int64_t inc) {
+        return hipblas_fits_int32(inc) ? int(inc) : inc < 0 ? -1 : 1;
+    };
+
+    int64_t max_chunk = hipblas_fits_int32(incx, incy) ? hipblas_int32_max : 1;
+    return hipblas_for_each_chunk(n, max_chunk, [&](int64_t start, int count) {
+        hipblas_vector_chunk chunk;
+        chunk.start    = start;
+        chunk.n        = count;
+        chunk.offset_x = hipblas_vector_chunk_offset(n, incx, start, count);
+        chunk.incx     = chunk_inc(incx);
+        chunk.offset_y = hipblas_vector_chunk_offset(n, incy, start, count);
+        chunk.incy     = chunk_inc(incy);
+        return call(chunk);
+    });
+}
+
+template <typename Call>
+hipblasStatus_t hipblas_for_each_vector_chunk(int64_t n, int64_t incx, Call&& call)
+{
+    return hipblas_for_each_vector_chunk(n, incx, incx, call);
+}
+
+// One int-sized tile of the m by n result of a 64-bit matrix operation
+struct hipblas_matrix_tile
+{
+    int64_t row;
+    int64_t col;
+    int     m;
+    int     n;
+};
+
+template <typename Call>
+hipblasStatus_t hipblas_for_each_tile(
+    int64_t m, int64_t n, int64_t max_rows, int64_t max_cols, Call&& call)
+{
+    return hipblas_for_each_chunk(n, max_cols, [&](int64_t col, int cols) {
+        return hipblas_for_each_chunk(m, max_rows, [&](int64_t row, int rows) {
+            return call(hipblas_matrix_tile{row, col, rows, cols});
+        });
+    });
+}
+
+// Offset of element (row, col) of op(A), for a column major A
+inline int64_t
+    hipblas_matrix_offset(hipblasOperation_t trans, int64_t row, int64_t col, int64_t ld)
+{
+    return trans == HIPBLAS_OP_N ? row + col * ld : col + row * ld;
+}
+
+// Leading dimension to pass for a tile that uses a single column of a matrix whose
+// leading dimension does not fit in an int, where it is never used. An invalid
+// leading dimension is still passed on as one.
+inline int hipblas_tile_ld(int64_t ld, int rows)
+{
+    return hipblas_fits_int32(ld) ? int(ld) : ld < 0 ? -1 : std::max(1, rows);
+}
+
+// Tile limits for running a 64-bit gemm as int-sized gemms, or false if it cannot
+// be. Only m and n are split, since splitting k would need beta applied only once. A
+// leading dimension that does not fit in an int is avoided with tiles that use one
+// column of that matrix, so it is only unsupported when that column has k elements.
+inline bool hipblas_gemm_tile_limits(hipblasOperation_t transA,
+                                     hipblasOperation_t transB,
+                                     int64_t            k,
+                                     int64_t            lda,
+                                     int64_t            ldb,
+                                     int64_t            ldc,
+                                     int64_t&           max_rows,
+                                     int64_t&           max_cols)
+{
+    max_rows = hipblas_int32_max;
+    max_cols = hipblas_int32_max;
+    if(!hipblas_fits_int32(k))
+        return false;
+
+    if(!hipblas_fits_int32(lda))
+    {
+        if(transA == HIPBLAS_OP_N && k > 1)
+            return false;
+        if(transA != HIPBLAS_OP_N)
+            max_rows = 1;
+    }
+    if(!hipblas_fits_int32(ldb))
+    {
+        if(transB != HIPBLAS_OP_N && k > 1)
+            return false;
+        if(transB == HIPBLAS_OP_N)
+            max_cols = 1;
+    }
+    if(!hipblas_fits_int32(ldc))
+        max_cols = 1;
+    return true;
+}
+
+// Real type of the components of a real or complex type
+template <typename T>
+using hipblas_real_t = std::conditional_t<std::is_floating_point<T>{},
+                                          T,
+                                          std::conditional_t<sizeof(T) == 8, float, double>>;
+
+// Combines the partial results of chunks of dot and asum, adding the components in
+// double precision
+template <typename T>
+class hipblas_sum_accumulator
+{
+public:
+    void add(const T& partial)
+    {
+        hipblas_real_t<T> parts[components];
+        std::memcpy(parts, &partial, sizeof(T));
+        for(int i = 0; i < components; i++)
+            m_sum[i] += parts[i];
+    }
+
+    T result() const
+    {
+        hipblas_real_t<T> parts[components];
+        for(int i = 0; i < components; i++)
+            parts[i] = hipblas_real_t<T>(m_sum[i]);
+
+        T result;
+        std::memcpy(&result, parts, sizeof(T));
+        return result;
+    }
+
+private:
+    static constexpr int components = sizeof(T) / sizeof(hipblas_real_t<T>);
+
+    double m_sum[2] = {};
+};
+
+// Combines the norms of chunks of nrm2 as the norm of the vector of norms, scaled as
+// LAPACK's lassq is so that the squares cannot overflow
+template <typename Treal>
+class hipblas_nrm2_accumulator
+{
+public:
+    void add(Treal norm)
+    {
+        double value = std::abs(double(norm));
+        if(std::isnan(value))
+            m_nan = true;
+        else if(std::isinf(value))
+            m_inf = true;
+        else if(value > m_scale)
+        {
+            m_ssq   = 1 + m_ssq * (m_scale / value) * (m_scale / value);
+            m_scale = value;
+        }
+        else if(value > 0)
+            m_ssq += (value / m_scale) * (value / m_scale);
+    }
+
+    Treal result() const
+    {
+        if(m_nan)
+            return std::numeric_limits<Treal>::quiet_NaN();
+        if(m_inf)
+            return std::numeric_limits<Treal>::infinity();
+        return Treal(m_scale * std::sqrt(m_ssq));
+    }
+
+private:
+    double m_scale = 0;
+    double m_ssq   = 0;
+    bool   m_nan   = false;
+    bool   m_inf   = false;
+};
+
+// Combines the results of chunks of iamax, or iamin, into the 1-based index of the
+// first element of largest, or smallest, magnitude. Ties go to the earlier chunk, as
+// they go to the lower index within one.
+class hipblas_amax_accumulator
+{
+public:
+    explicit hipblas_amax_accumulator(bool max)
+        : m_max(max)
+    {
+    }
+
+    // index is the chunk's result, 0 for an empty chunk, and magnitude that of the
+    // element it names
+    void add(int64_t start, int64_t index, double magnitude)
+    {
+        if(index <= 0)
+            return;
+        if(!m_index || (m_max ? magnitude > m_magnitude : magnitude < m_magnitude))
+        {
+            m_index     = start + index;
+            m_magnitude = magnitude;
+        }
+    }
+
+    int64_t result() const
+    {
+        return m_index;
+    }
+
+private:
+    bool    m_max;
+    int64_t m_index     = 0;
+    double  m_magnitude = 0;
+};
+
+// Magnitude iamax compares elements by, |re| + |im| for complex types
+template <typename T>
+double hipblas_amax_magnitude(const T& element)
+{
+    hipblas_real_t<T> parts[sizeof(T) / sizeof(hipblas_real_t<T>)];
+    std::memcpy(parts, &element, sizeof(T));
+
+    double magnitude = 0;
+    for(auto part : parts)
+        magnitude += std::abs(double(part));
+    return magnitude;
+}
+
+// Result types the chunks of the _ex reductions can be combined in
+enum class hipblas_ilp64_result_type
+{
+    f32_r,
+    f64_r,
+    f32_c,
+    f64_c,
+    unsupported
+};
+
+inline hipblas_ilp64_result_type hipblas_ilp64_result_type_of(hipDataType type)
+{
+    switch(type)
+    {
+    case HIP_R_32F:
+        return hipblas_ilp64_result_type::f32_r;
+    case HIP_R_64F:
+        return hipblas_ilp64_result_type::f64_r;
+    case HIP_C_32F:
+        return hipblas_ilp64_result_type::f32_c;
+    case HIP_C_64F:
+        return hipblas_ilp64_result_type::f64_c;
+    default:
+        return hipblas_ilp64_result_type::unsupported;
+    }
+}
+
+#ifndef HIPBLAS_V2
+inline hipblas_ilp64_result_type hipblas_ilp64_result_type_of(hipblasDatatype_t type)
+{
+    switch(type)
+    {
+    case HIPBLAS_R_32F:
+        return hipblas_ilp64_result_type::f32_r;
+    case HIPBLAS_R_64F:
+        return hipblas_ilp64_result_type::f64_r;
+    case HIPBLAS_C_32F:
+        return hipblas_ilp64_result_type::f32_c;
+    case HIPBLAS_C_64F:
+        return hipblas_ilp64_result_type::f64_c;
+    default:
+        return hipblas_ilp64_result_type::unsupported;
+    }
+}
+#endif
@@ -0,0 +1,229 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "ilp64_emulation.hpp"
+#include "stream_pool.hpp"
+
+// Runs reduce(value) with the handle in host pointer mode, so that the chunks of a
+// 64-bit reduction return their partial results to the host to be combined, then
+// stores value to result in the caller's pointer mode.
+template <typename T, typename Reduce>
+hipblasStatus_t hipblas_reduce_on_host(hipblasHandle_t handle, void* result, Reduce&& reduce)
+{
+    hipblasPointerMode_t mode;
+    hipblasStatus_t      status = hipblasGetPointerMode(handle, &mode);
+    if(status == HIPBLAS_STATUS_SUCCESS && mode != HIPBLAS_POINTER_MODE_HOST)
+        status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    T value{};
+    status = reduce(value);
+
+    if(mode != HIPBLAS_POINTER_MODE_HOST)
+    {
+        hipblasStatus_t restore = hipblasSetPointerMode(handle, mode);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = restore;
+    }
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    if(mode == HIPBLAS_POINTER_MODE_HOST)
+    {
+        std::memcpy(result, &value, sizeof(T));
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+    return hipblas_handle_memcpy(handle, result, &value, sizeof(T), hipMemcpyHostToDevice);
+}
+
+// dot, dotc and asum of 64-bit vectors with the 32-bit routine. call(chunk, partial)
+// runs it on one chunk, writing the chunk's result to partial.
+template <typename T, typename Call>
+hipblasStatus_t hipblas_chunked_sum(
+    hipblasHandle_t handle, int64_t n, int64_t incx, int64_t incy, T* result, Call&& call)
+{
+    if(hipblas_fits_int32(n, incx, incy))
+        return hipblas_for_each_vector_chunk(
+            n, incx, incy, [&](const hipblas_vector_chunk& chunk) { return call(chunk, result); });
+
+    return hipblas_reduce_on_host<T>(handle, result, [&](T& value) {
+        hipblas_sum_accumulator<T> sum;
+        hipblasStatus_t status
+            = hipblas_for_each_vector_chunk(n, incx, incy, [&](const hipblas_vector_chunk& chunk) {
+                  T               partial{};
+                  hipblasStatus_t chunk_status = call(chunk, &partial);
+                  sum.add(partial);
+                  return chunk_status;
+              });
+        value = sum.result();
+        return status;
+    });
+}
+
+template <typename T, typename Call>
+hipblasStatus_t
+    hipblas_chunked_sum(hipblasHandle_t handle, int64_t n, int64_t incx, T* result, Call&& call)
+{
+    return hipblas_chunked_sum(handle, n, incx, incx, result, call);
+}
+
+template <typename Treal, typename Call>
+hipblasStatus_t hipblas_chunked_nrm2(
+    hipblasHandle_t handle, int64_t n, int64_t incx, Treal* result, Call&& call)
+{
+    if(hipblas_fits_int32(n, incx))
+        return hipblas_for_each_vector_chunk(
+            n, incx, [&](const hipblas_vector_chunk& chunk) { return call(chunk, result); });
+
+    return hipblas_reduce_on_host<Treal>(handle, result, [&](Treal& value) {
+        hipblas_nrm2_accumulator<Treal> norm;
+        hipblasStatus_t                 status
+            = hipblas_for_each_vector_chunk(n, incx, [&](const hipblas_vector_chunk& chunk) {
+                  Treal           partial{};
+                  hipblasStatus_t chunk_status = call(chunk, &partial);
+                  norm.add(partial);
+                  return chunk_status;
+              });
+        value = norm.result();
+        return status;
+    });
+}
+
+// iamax, or iamin, of a 64-bit vector x with the 32-bit routine, whose int result is
+// widened to the int64_t the _64 API returns. Combining chunks needs the element each
+// one names, which is read back from x.
+template <typename T, typename Call>
+hipblasStatus_t hipblas_chunked_amax(hipblasHandle_t handle,
+                                     int64_t         n,
+                                     const T*        x,
+                                     int64_t         incx,
+                                     bool            max,
+                                     int64_t*        result,
+                                     Call&&          call)
+{
+    if(hipblas_fits_int32(n, incx))
+    {
+        hipblasPointerMode_t mode;
+        hipblasStatus_t      status = hipblasGetPointerMode(handle, &mode);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        if(mode == HIPBLAS_POINTER_MODE_HOST)
+        {
+            int index = 0;
+            status    = hipblas_for_each_vector_chunk(
+                n, incx, [&](const hipblas_vector_chunk& chunk) { return call(chunk, &index); });
+            *result = index;
+            return status;
+        }
+
+        // The index is never negative, so on the little-endian devices it is widened in
+        // place by clearing the upper half of result after the routine writes the lower
+        status = hipblas_for_each_vector_chunk(n, incx, [&](const hipblas_vector_chunk& chunk) {
+            return call(chunk, reinterpret_cast<int*>(result));
+        });
+        hipStream_t stream;
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasGetStream(handle, &stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        return hipblas_hip_to_status(
+            hipMemsetAsync(reinterpret_cast<int*>(result) + 1, 0, sizeof(int), stream));
+    }
+
+    return hipblas_reduce_on_host<int64_t>(handle, result, [&](int64_t& value) {
+        hipblas_amax_accumulator amax(max);
+        hipblasStatus_t          status
+            = hipblas_for_each_vector_chunk(n, incx, [&](const hipblas_vector_chunk& chunk) {
+                  int             index        = 0;
+                  hipblasStatus_t chunk_status = call(chunk, &index);
+                  if(chunk_status != HIPBLAS_STATUS_SUCCESS || index <= 0)
+                      return chunk_status;
+
+                  // A chunk with a result has a positive increment
+                  const T* named = x + chunk.offset_x + int64_t(index - 1) * chunk.incx;
+                  T        element;
+                  chunk_status = hipblas_handle_memcpy(
+                      handle, &element, named, sizeof(T), hipMemcpyDeviceToHost);
+                  if(chunk_status == HIPBLAS_STATUS_SUCCESS)
+                      amax.add(chunk.start, index, hipblas_amax_magnitude(element));
+                  return chunk_status;
+              });
+        value = amax.result();
+        return status;
+    });
+}
+
+// dot_ex and dotc_ex, for the result types the partial results can be combined in
+template <typename Type, typename Call>
+hipblasStatus_t hipblas_chunked_sum_ex(hipblasHandle_t handle,
+                                       int64_t         n,
+                                       int64_t         incx,
+                                       int64_t         incy,
+                                       void*           result,
+                                       Type            result_type,
+                                       Call&&          call)
+{
+    if(hipblas_fits_int32(n, incx, incy))
+        return hipblas_for_each_vector_chunk(
+            n, incx, incy, [&](const hipblas_vector_chunk& chunk) { return call(chunk, result); });
+
+    switch(hipblas_ilp64_result_type_of(result_type))
+    {
+    case hipblas_ilp64_result_type::f32_r:
+        return hipblas_chunked_sum(handle, n, incx, incy, static_cast<float*>(result), call);
+    case hipblas_ilp64_result_type::f64_r:
+        return hipblas_chunked_sum(handle, n, incx, incy, static_cast<double*>(result), call);
+    case hipblas_ilp64_result_type::f32_c:
+        return hipblas_chunked_sum(
+            handle, n, incx, incy, static_cast<hipblasComplex*>(result), call);
+    case hipblas_ilp64_result_type::f64_c:
+        return hipblas_chunked_sum(
+            handle, n, incx, incy, static_cast<hipblasDoubleComplex*>(result), call);
+    default:
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+}
+
+// nrm2_ex, for the result types the partial results can be combined in
+template <typename Type, typename Call>
+hipblasStatus_t hipblas_chunked_nrm2_ex(
+    hipblasHandle_t handle, int64_t n, int64_t incx, void* result, Type result_type, Call&& call)
+{
+    if(hipblas_fits_int32(n, incx))
+        return hipblas_for_each_vector_chunk(
+            n, incx, [&](const hipblas_vector_chunk& chunk) { return call(chunk, result); });
+
+    switch(hipblas_ilp64_result_type_of(result_type))
+    {
+    case hipblas_ilp64_result_type::f32_r:
+        return hipblas_chunked_nrm2(handle, n, incx, static_cast<float*>(result), call);
+    case hipblas_ilp64_result_type::f64_r:
+        return hipblas_chunked_nrm2(handle, n, incx, static_cast<double*>(result), call);
+    default:
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+}
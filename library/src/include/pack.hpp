@@ -0,0 +1,43 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+#include <cstdint>
+#include <hip/hip_runtime_api.h>
+
+// Packs op(A), m by k, into P, k by m with leading dimension ldp, so that column i of P
+// holds row i of op(A). Elements of size bytes are copied as they are, except with
+// conjugate, where they are complex numbers of two floats (size 8) or two doubles
+// (size 16) and are conjugated. Defined with the device code in pack_kernels.cpp.
+hipblasStatus_t hipblas_launch_pack(hipblasOperation_t trans,
+                                    int64_t            m,
+                                    int64_t            k,
+                                    const void*        A,
+                                    int64_t            lda,
+                                    void*              P,
+                                    int64_t            ldp,
+                                    size_t             size,
+                                    bool               conjugate,
+                                    hipStream_t        stream);
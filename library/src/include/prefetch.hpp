@@ -0,0 +1,266 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "batched_emulation.hpp"
+#include "hipblas.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <map>
+#include <mutex>
+
+// Memory a call reads or writes
+struct hipblas_prefetch_range
+{
+    const void* ptr   = nullptr;
+    size_t      bytes = 0;
+};
+
+// Memory spanned by n elements of size bytes, inc elements apart. A negative inc
+// walks the same memory from its end.
+inline hipblas_prefetch_range
+    hipblas_prefetch_footprint(const void* x, int64_t n, int64_t inc, size_t size)
+{
+    if(!x || n <= 0 || !size)
+        return {};
+    int64_t step = inc < 0 ? -inc : inc;
+    return {x, size_t((n - 1) * step + 1) * size};
+}
+
+// Memory spanned by batch_count rows x cols matrices of size bytes elements with
+// leading dimension ld, stride elements apart
+inline hipblas_prefetch_range hipblas_prefetch_footprint(const void* A,
+                                                         int64_t     rows,
+                                                         int64_t     cols,
+                                                         int64_t     ld,
+                                                         int64_t     stride,
+                                                         int64_t     batch_count,
+                                                         size_t      size)
+{
+    if(!A || rows <= 0 || cols <= 0 || batch_count <= 0 || !size)
+        return {};
+    int64_t elements = (cols - 1) * ld + rows;
+    if(stride > 0)
+        elements += (batch_count - 1) * stride;
+    return {A, size_t(elements) * size};
+}
+
+template <typename T>
+hipblas_prefetch_range hipblas_prefetch_vector(const T* x, int64_t n, int64_t inc)
+{
+    return hipblas_prefetch_footprint(x, n, inc, sizeof(T));
+}
+
+template <typename T>
+hipblas_prefetch_range hipblas_prefetch_matrix(
+    const T* A, int64_t rows, int64_t cols, int64_t ld, int64_t stride = 0, int64_t batch_count = 1)
+{
+    return hipblas_prefetch_footprint(A, rows, cols, ld, stride, batch_count, sizeof(T));
+}
+
+// A matrix used as op(A), which is rows x cols
+template <typename T>
+hipblas_prefetch_range hipblas_prefetch_matrix(hipblasOperation_t trans,
+                                               const T*           A,
+                                               int64_t            rows,
+                                               int64_t            cols,
+                                               int64_t            ld,
+                                               int64_t            stride      = 0,
+                                               int64_t            batch_count = 1)
+{
+    return trans == HIPBLAS_OP_N ? hipblas_prefetch_matrix(A, rows, cols, ld, stride, batch_count)
+                                 : hipblas_prefetch_matrix(A, cols, rows, ld, stride, batch_count);
+}
+
+// A matrix of a type-erased _ex routine used as op(A)
+template <typename Type>
+hipblas_prefetch_range hipblas_prefetch_ex_matrix(hipblasOperation_t trans,
+                                                  const void*        A,
+                                                  Type               type,
+                                                  int64_t            rows,
+                                                  int64_t            cols,
+                                                  int64_t            ld,
+                                                  int64_t            stride      = 0,
+                                                  int64_t            batch_count = 1)
+{
+    size_t size = hipblas_datatype_size(type);
+    return trans == HIPBLAS_OP_N
+               ? hipblas_prefetch_footprint(A, rows, cols, ld, stride, batch_count, size)
+               : hipblas_prefetch_footprint(A, cols, rows, ld, stride, batch_count, size);
+}
+
+// The allocation holding a pointer: its range, and whether it is managed memory
+struct hipblas_allocation
+{
+    uintptr_t base    = 0;
+    size_t    size    = 0;
+    bool      managed = false;
+};
+
+// Remembers which allocations are managed memory, so that pointers into an allocation
+// seen before are classified without asking the runtime again. An allocation freed and
+// replaced by another at the same address keeps its entry until a prefetch into it
+// fails, or until the new allocation extends past the old one.
+class hipblas_allocation_cache
+{
+public:
+    // Entries kept before the cache is cleared
+    static constexpr size_t max_entries = 4096;
+
+    // Returns whether [ptr, ptr + bytes) lies in managed memory. query(ptr, bytes)
+    // returns the hipblas_allocation holding the range when it is not known yet.
+    template <typename Query>
+    bool managed(const void* ptr, size_t bytes, Query&& query)
+    {
+        uintptr_t begin = reinterpret_cast<uintptr_t>(ptr);
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            auto                        it = m_allocations.upper_bound(begin);
+            if(it != m_allocations.begin() && begin + bytes <= (--it)->second.end)
+            {
+                m_hits++;
+                return it->second.managed;
+            }
+        }
+
+        // Query without holding the lock, the runtime call is the slow part
+        hipblas_allocation allocation = query(ptr, bytes);
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_misses++;
+        // A range which does not fit its allocation is not remembered
+        if(allocation.base <= begin && begin + bytes <= allocation.base + allocation.size)
+            insert(allocation);
+        return allocation.managed;
+    }
+
+    // Drops the allocation holding ptr, which is no longer what it was
+    void forget(const void* ptr)
+    {
+        uintptr_t                   begin = reinterpret_cast<uintptr_t>(ptr);
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto                        it = m_allocations.upper_bound(begin);
+        if(it != m_allocations.begin() && begin < (--it)->second.end)
+            m_allocations.erase(it);
+    }
+
+    size_t size() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_allocations.size();
+    }
+
+    uint64_t hits() const
+    {
+        return m_hits.load(std::memory_order_relaxed);
+    }
+
+    uint64_t misses() const
+    {
+        return m_misses.load(std::memory_order_relaxed);
+    }
+
+private:
+    struct entry
+    {
+        uintptr_t end;
+        bool      managed;
+    };
+
+    // Replaces the entries the allocation overlaps, which are stale
+    void insert(const hipblas_allocation& allocation)
+    {
+        uintptr_t end = allocation.base + allocation.size;
+        auto      it  = m_allocations.lower_bound(allocation.base);
+        if(it != m_allocations.begin() && std::prev(it)->second.end > allocation.base)
+            --it;
+        while(it != m_allocations.end() && it->first < end)
+            it = m_allocations.erase(it);
+
+        if(m_allocations.size() >= max_entries)
+            m_allocations.clear();
+        m_allocations.emplace(allocation.base, entry{end, allocation.managed});
+    }
+
+    mutable std::mutex         m_mutex;
+    std::map<uintptr_t, entry> m_allocations;
+    std::atomic<uint64_t>      m_hits{0};
+    std::atomic<uint64_t>      m_misses{0};
+};
+
+// Prefetching state of a handle, created by hipblasSetPrefetchMode
+class hipblas_handle_prefetch
+{
+public:
+    hipblas_handle_prefetch();
+    ~hipblas_handle_prefetch();
+
+    hipblasPrefetchMode_t mode() const
+    {
+        return m_mode.load(std::memory_order_relaxed);
+    }
+
+    void set_mode(hipblasPrefetchMode_t mode);
+
+    // Prefetches the ranges in managed memory to the current device on the handle's
+    // stream. Failures are ignored, the call runs regardless.
+    void prefetch(hipblasHandle_t handle, std::initializer_list<hipblas_prefetch_range> ranges);
+
+    uint64_t prefetches() const
+    {
+        return m_prefetches.load(std::memory_order_relaxed);
+    }
+
+    uint64_t bytes() const
+    {
+        return m_bytes.load(std::memory_order_relaxed);
+    }
+
+    const hipblas_allocation_cache& allocations() const
+    {
+        return m_allocations;
+    }
+
+private:
+    std::atomic<hipblasPrefetchMode_t> m_mode{HIPBLAS_PREFETCH_MODE_OFF};
+    hipblas_allocation_cache           m_allocations;
+    std::atomic<uint64_t>              m_prefetches{0};
+    std::atomic<uint64_t>              m_bytes{0};
+};
+
+// Returns the prefetching state of handle, or nullptr if it does not prefetch
+hipblas_handle_prefetch* hipblas_prefetching(hipblasHandle_t handle);
+
+// Prefetches the operands of the entry point it is used in, given as
+// hipblas_prefetch_range, when its handle prefetches managed memory. The operands are
+// only evaluated then.
+#define HIPBLAS_PREFETCH(...)                                                 \
+    do                                                                        \
+    {                                                                         \
+        if(hipblas_handle_prefetch* prefetch__ = hipblas_prefetching(handle)) \
+            prefetch__->prefetch(handle, {__VA_ARGS__});                      \
+    } while(0)
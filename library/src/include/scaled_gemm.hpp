@@ -0,0 +1,73 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+#include <cstdint>
+#include <hip/hip_runtime_api.h>
+
+// Decodes the rows by cols 8-bit floating point matrices A of a batch to float, into the
+// matrices of D which have a leading dimension of rows and follow each other. With a scale,
+// the values are multiplied by scale[0], or by scale[r] in row r or scale[c] in column c
+// with a vector scale.
+struct hipblas_fp8_decode_args
+{
+    hipDataType  type; // HIPBLAS_R_8F_E4M3, HIPBLAS_R_8F_E5M2 or their FNUZ variants
+    int64_t      rows;
+    int64_t      cols;
+    const void*  A; // the first matrix, or a device array of the matrices when batched
+    bool         batched;
+    int64_t      lda;
+    int64_t      stride; // between the matrices of A when not batched
+    float*       D;
+    int64_t      batch_count;
+    const float* scale  = nullptr;
+    bool         vector = false;
+    bool         by_row = false;
+};
+
+// Sets the m by n matrices of C of a batch to alpha*D + beta*C, where the matrices of D have
+// a leading dimension of m and follow each other. alpha and beta are read from alpha_ptr and
+// beta_ptr when they are given, and C is only read where beta is not zero.
+struct hipblas_scaled_output_args
+{
+    hipDataType  type; // of C: HIP_R_32F, HIP_R_16F or HIP_R_16BF
+    int64_t      m;
+    int64_t      n;
+    const float* D;
+    void*        C; // the first matrix, or a device array of the matrices when batched
+    bool         batched;
+    int64_t      ldc;
+    int64_t      stride;
+    int64_t      batch_count;
+    float        alpha     = 1;
+    float        beta      = 0;
+    const float* alpha_ptr = nullptr;
+    const float* beta_ptr  = nullptr;
+};
+
+// Defined with the device code in scaled_gemm_kernels.cpp
+hipblasStatus_t hipblas_launch_fp8_decode(const hipblas_fp8_decode_args& args, hipStream_t stream);
+hipblasStatus_t hipblas_launch_scaled_output(const hipblas_scaled_output_args& args,
+                                             hipStream_t                       stream);
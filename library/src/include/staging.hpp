@@ -0,0 +1,139 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "ilp64_emulation.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+// Pinned staging of host <-> device matrix and vector copies. The host side of
+// hipblasSetMatrix and friends is often pageable memory, which the runtime copies
+// through its own small bounce buffers, one column at a time when the matrix is
+// strided. The staging engine instead packs the columns into large pinned chunks on
+// the CPU and overlaps the packing of one chunk with the DMA of the previous one.
+// A vector is staged as a matrix with one row, whose leading dimensions are the
+// increments.
+
+// Tile shape for staging a rows x cols matrix through chunks of chunk_bytes: whole
+// columns when a column fits in a chunk, otherwise pieces of a single column
+inline void hipblas_staging_tile_shape(int64_t  rows,
+                                       int      elem_size,
+                                       size_t   chunk_bytes,
+                                       int64_t& tile_rows,
+                                       int64_t& tile_cols)
+{
+    int64_t chunk_elems = std::max<int64_t>(1, int64_t(chunk_bytes) / elem_size);
+    tile_rows           = std::min(rows, chunk_elems);
+    tile_cols           = std::max<int64_t>(1, chunk_elems / std::max<int64_t>(1, rows));
+}
+
+// Runs call(first, count) over [0, total) split into at most workers pieces, each on
+// its own thread
+template <typename Call>
+void hipblas_parallel_chunks(int64_t total, int64_t workers, Call&& call)
+{
+    workers       = std::max<int64_t>(1, std::min(workers, total));
+    int64_t piece = (total + workers - 1) / workers;
+
+    std::vector<std::thread> pool;
+    for(int64_t first = piece; first < total; first += piece)
+        pool.emplace_back(call, first, std::min(piece, total - first));
+    call(int64_t(0), std::min(piece, total));
+    for(auto& thread : pool)
+        thread.join();
+}
+
+// Copies cols columns of rows elements each between matrices with leading dimensions
+// ld_dst and ld_src, splitting the work over up to threads threads. Threads are only
+// started when each gets at least min_bytes_per_thread to copy.
+inline void hipblas_copy_columns(void*       dst,
+                                 int64_t     ld_dst,
+                                 const void* src,
+                                 int64_t     ld_src,
+                                 int64_t     rows,
+                                 int64_t     cols,
+                                 int         elem_size,
+                                 int         threads,
+                                 size_t      min_bytes_per_thread = size_t(1) << 18)
+{
+    const size_t column_bytes = size_t(rows) * elem_size;
+    const size_t total_bytes  = column_bytes * cols;
+    int64_t      workers
+        = std::min<int64_t>(threads, total_bytes / std::max<size_t>(1, min_bytes_per_thread));
+
+    if((ld_dst == rows && ld_src == rows) || cols == 1)
+    {
+        // A single contiguous block, split into byte ranges
+        int64_t bytes = cols == 1 ? column_bytes : total_bytes;
+        hipblas_parallel_chunks(bytes, workers, [&](int64_t first, int64_t count) {
+            std::memcpy((char*)dst + first, (const char*)src + first, count);
+        });
+        return;
+    }
+
+    hipblas_parallel_chunks(cols, workers, [&](int64_t first, int64_t count) {
+        const char* s = (const char*)src + first * ld_src * elem_size;
+        char*       d = (char*)dst + first * ld_dst * elem_size;
+        for(int64_t j = 0; j < count; j++)
+            std::memcpy(d + j * ld_dst * elem_size, s + j * ld_src * elem_size, column_bytes);
+    });
+}
+
+// Whether a copy with these arguments goes through the staging engine: the backend
+// keeps invalid arguments, empty or small copies and host memory that is already
+// pinned. host is the host side of the copy.
+bool hipblas_use_staging(int64_t     rows,
+                         int64_t     cols,
+                         int         elem_size,
+                         const void* host,
+                         int64_t     ld_host,
+                         const void* device,
+                         int64_t     ld_device);
+
+// Copy a rows x cols host matrix A to device matrix B, or device matrix A to host
+// matrix B, through the staging engine. When async is false the copy is complete on
+// return. Otherwise set returns once the last chunk is packed and its DMA queued on
+// stream. Get always returns once B is written, as B is unpacked on the host.
+hipblasStatus_t hipblas_staged_set_matrix(int64_t     rows,
+                                          int64_t     cols,
+                                          int         elem_size,
+                                          const void* A,
+                                          int64_t     lda,
+                                          void*       B,
+                                          int64_t     ldb,
+                                          hipStream_t stream,
+                                          bool        async);
+
+hipblasStatus_t hipblas_staged_get_matrix(int64_t     rows,
+                                          int64_t     cols,
+                                          int         elem_size,
+                                          const void* A,
+                                          int64_t     lda,
+                                          void*       B,
+                                          int64_t     ldb,
+                                          hipStream_t stream);
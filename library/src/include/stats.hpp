@@ -0,0 +1,540 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "bytes.hpp"
+#include "flops.hpp"
+#include "hipblas.h"
+#include "trace.hpp"
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+// Routine families of hipblasGetStats, sorted by name
+// clang-format off
+#define HIPBLAS_STATS_FAMILIES(X)                                                       \
+    X(asum) X(axpy) X(copy) X(dgmm) X(dot) X(dotc) X(gbmv) X(geam) X(gels) X(gemm)      \
+    X(gemm3m) X(gemm_grouped) X(gemv) X(geqrf) X(ger) X(gerc) X(geru) X(getrf) X(getri) \
+    X(getrs) X(hbmv) X(hemm) X(hemv) X(her) X(her2) X(her2k) X(herk) X(herkx) X(hpmv)   \
+    X(hpr) X(hpr2) X(iamax) X(iamin) X(nrm2) X(potrf) X(potri) X(potrs) X(rot) X(rotg)  \
+    X(rotm) X(rotmg) X(sbmv) X(scal) X(spmv) X(spr) X(spr2) X(swap) X(symm) X(symv)     \
+    X(syr) X(syr2) X(syr2k) X(syrk) X(syrkx) X(tbmv) X(tbsv) X(tpmv) X(tpsv) X(trmm)    \
+    X(trmv) X(trsm) X(trsv) X(trtri)
+// clang-format on
+
+enum hipblas_stats_family
+{
+#define HIPBLAS_STATS_FAMILY_ENUM(name_) hipblas_stats_##name_,
+    HIPBLAS_STATS_FAMILIES(HIPBLAS_STATS_FAMILY_ENUM)
+#undef HIPBLAS_STATS_FAMILY_ENUM
+        hipblas_stats_family_count
+};
+
+inline const char* hipblas_stats_family_name(int family)
+{
+    static const char* const names[] = {
+#define HIPBLAS_STATS_FAMILY_NAME(name_) #name_,
+        HIPBLAS_STATS_FAMILIES(HIPBLAS_STATS_FAMILY_NAME)
+#undef HIPBLAS_STATS_FAMILY_NAME
+    };
+    return names[family];
+}
+
+// Family of hipblas-bench function `function`, or -1 if it is not counted. The
+// _batched, _strided_batched and _ex variants of a routine are one family.
+inline int hipblas_stats_family_of(const char* function)
+{
+    if(!function)
+        return -1;
+
+    size_t length = std::strlen(function);
+    auto   strip  = [&](const char* suffix) {
+        size_t n = std::strlen(suffix);
+        if(length > n && !std::strncmp(function + length - n, suffix, n))
+            length -= n;
+    };
+    strip("_ex");
+    strip("_strided_batched");
+    strip("_batched");
+
+    int lo = 0, hi = hipblas_stats_family_count;
+    while(lo < hi)
+    {
+        int         mid    = (lo + hi) / 2;
+        const char* family = hipblas_stats_family_name(mid);
+        int         order  = std::strncmp(family, function, length);
+        if(!order && family[length])
+            order = 1;
+        if(!order)
+            return mid;
+        if(order < 0)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return -1;
+}
+
+// Floating point operations and bytes of one call
+struct hipblas_stats_count
+{
+    double flops = 0;
+    double bytes = 0;
+};
+
+// The counts of hipblas-bench for the sizes in a trace record. T is the data type, Tr the
+// real type of the same precision. Real 16-bit types are counted as uint16_t, which gives
+// the same real formulas and sizes.
+template <typename T, typename Tr>
+hipblas_stats_count hipblas_stats_count_as(int family, const hipblas_trace_record& r)
+{
+    auto size = [](int64_t value) { return value == hipblas_trace_unset ? 0 : value; };
+
+    int64_t m     = size(r.m_);
+    int64_t n     = size(r.n_);
+    int64_t k     = size(r.k_);
+    int64_t batch = r.batch_count_ == hipblas_trace_unset ? 1 : r.batch_count_;
+
+    hipblasOperation_t trans_a = r.trans_a_ == 'T'   ? HIPBLAS_OP_T
+                                 : r.trans_a_ == 'C' ? HIPBLAS_OP_C
+                                                     : HIPBLAS_OP_N;
+
+    // Csscal and Zdscal take a real alpha, Csrot and Zdrot a real sine; the _ex
+    // routines give the type of the scalars
+    const char* routine = r.routine ? r.routine : "";
+    bool        real_scalar
+        = std::strstr(routine, "Csscal") || std::strstr(routine, "Zdscal")
+          || std::strstr(routine, "Csrot") || std::strstr(routine, "Zdrot")
+          || (family == hipblas_stats_scal && r.a_type && std::strstr(r.a_type, "_r"))
+          || (family == hipblas_stats_rot && r.c_type && std::strstr(r.c_type, "_r"));
+
+    double gflops = 0, gbytes = 0;
+    switch(family)
+    {
+    case hipblas_stats_asum:
+        gflops = asum_gflop_count<T>(n);
+        gbytes = asum_gbyte_count<T>(n);
+        break;
+    case hipblas_stats_axpy:
+        gflops = axpy_gflop_count<T>(n);
+        gbytes = axpy_gbyte_count<T>(n);
+        break;
+    case hipblas_stats_copy:
+        gflops = copy_gflop_count<T>(n);
+        gbytes = copy_gbyte_count<T>(n);
+        break;
+    case hipblas_stats_dot:
+        gflops = dot_gflop_count<false, T>(n);
+        gbytes = dot_gbyte_count<T>(n);
+        break;
+    case hipblas_stats_dotc:
+        gflops = dot_gflop_count<true, T>(n);
+        gbytes = dot_gbyte_count<T>(n);
+        break;
+    case hipblas_stats_iamax:
+    case hipblas_stats_iamin:
+        gflops = iamax_gflop_count<T>(n);
+        gbytes = iamax_gbyte_count<T>(n);
+        break;
+    case hipblas_stats_nrm2:
+        gflops = nrm2_gflop_count<T>(n);
+        gbytes = nrm2_gbyte_count<T>(n);
+        break;
+    case hipblas_stats_rot:
+        gflops = real_scalar ? rot_gflop_count<T, T, Tr, Tr>(n) : rot_gflop_count<T, T, Tr, T>(n);
+        gbytes = rot_gbyte_count<T>(n);
+        break;
+    case hipblas_stats_rotm:
+        // the flag is on the device or in param; count the case with the most work
+        gflops = rotm_gflop_count<double>(n, -1.0);
+        gbytes = rotm_gbyte_count<Tr>(n, Tr(-1));
+        break;
+    case hipblas_stats_scal:
+        gflops = real_scalar ? scal_gflop_count<T, Tr>(n) : scal_gflop_count<T, T>(n);
+        gbytes = scal_gbyte_count<T>(n);
+        break;
+    case hipblas_stats_swap:
+        gflops = swap_gflop_count<T>(n);
+        gbytes = swap_gbyte_count<T>(n);
+        break;
+
+    case hipblas_stats_gbmv:
+        gflops = gbmv_gflop_count<T>(trans_a, m, n, size(r.kl_), size(r.ku_));
+        gbytes = gbmv_gbyte_count<T>(trans_a, m, n, size(r.kl_), size(r.ku_));
+        break;
+    case hipblas_stats_gemv:
+        gflops = gemv_gflop_count<T>(trans_a, m, n);
+        gbytes = gemv_gbyte_count<T>(trans_a, m, n);
+        break;
+    case hipblas_stats_ger:
+    case hipblas_stats_gerc:
+    case hipblas_stats_geru:
+        gflops = ger_gflop_count<T>(m, n);
+        gbytes = ger_gbyte_count<T>(m, n);
+        break;
+    case hipblas_stats_hbmv:
+        gflops = hbmv_gflop_count<T>(n, k);
+        gbytes = hbmv_gbyte_count<T>(n, k);
+        break;
+    case hipblas_stats_hemv:
+        gflops = hemv_gflop_count<T>(n);
+        gbytes = hemv_gbyte_count<T>(n);
+        break;
+    case hipblas_stats_her:
+        gflops = her_gflop_count<T>(n);
+        gbytes = her_gbyte_count<T>(n);
+        break;
+    case hipblas_stats_her2:
+        gflops = her2_gflop_count<T>(n);
+        gbytes = her2_gbyte_count<T>(n);
+        break;
+    case hipblas_stats_hpmv:
+        gflops = hpmv_gflop_count<T>(n);
+        gbytes = hpmv_gbyte_count<T>(n);
+        break;
+    case hipblas_stats_hpr:
+        gflops = hpr_gflop_count<T>(n);
+        gbytes = hpr_gbyte_count<T>(n);
+        break;
+    case hipblas_stats_hpr2:
+        gflops = hpr2_gflop_count<T>(n);
+        gbytes = hpr2_gbyte_count<T>(n);
+        break;
+    case hipblas_stats_sbmv:
+        gflops = sbmv_gflop_count<T>(n, k);
+        gbytes = sbmv_gbyte_count<T>(n, k);
+        break;
+    case hipblas_stats_spmv:
+        gflops = spmv_gflop_count<T>(n);
+        gbytes = spmv_gbyte_count<T>(n);
+        break;
+    case hipblas_stats_spr:
+        gflops = spr_gflop_count<T>(n);
+        gbytes = spr_gbyte_count<T>(n);
+        break;
+    case hipblas_stats_spr2:
+        gflops = spr2_gflop_count<T>(n);
+        gbytes = spr2_gbyte_count<T>(n);
+        break;
+    case hipblas_stats_symv:
+        gflops = symv_gflop_count<T>(n);
+        gbytes = symv_gbyte_count<T>(n);
+        break;
+    case hipblas_stats_syr:
+        gflops = syr_gflop_count<T>(n);
+        gbytes = syr_gbyte_count<T>(n);
+        break;
+    case hipblas_stats_syr2:
+        gflops = syr2_gflop_count<T>(n);
+        gbytes = syr2_gbyte_count<T>(n);
+        break;
+    case hipblas_stats_tbmv:
+        gflops = tbmv_gflop_count<T>(n, k);
+        gbytes = tbmv_gbyte_count<T>(n, k);
+        break;
+    case hipblas_stats_tbsv:
+        gflops = tbsv_gflop_count<T>(n, k);
+        gbytes = tbsv_gbyte_count<T>(n, k);
+        break;
+    case hipblas_stats_tpmv:
+        gflops = tpmv_gflop_count<T>(n);
+        gbytes = tpmv_gbyte_count<T>(n);
+        break;
+    case hipblas_stats_tpsv:
+        gflops = tpsv_gflop_count<T>(n);
+        gbytes = tpsv_gbyte_count<T>(n);
+        break;
+    case hipblas_stats_trmv:
+        gflops = trmv_gflop_count<T>(n);
+        gbytes = trmv_gbyte_count<T>(n);
+        break;
+    case hipblas_stats_trsv:
+        gflops = trsv_gflop_count<T>(n);
+        gbytes = trsv_gbyte_count<T>(n);
+        break;
+
+    case hipblas_stats_dgmm:
+        gflops = dgmm_gflop_count<T>(m, n);
+        gbytes = dgmm_gbyte_count<T>(m, n, r.side_ == 'R' ? n : m);
+        break;
+    case hipblas_stats_geam:
+        gflops = geam_gflop_count<T>(m, n);
+        gbytes = geam_gbyte_count<T>(m, n);
+        break;
+    case hipblas_stats_gemm:
+    case hipblas_stats_gemm3m:
+        gflops = gemm_gflop_count<T>(m, n, k);
+        gbytes = gemm_gbyte_count<T>(m, n, k);
+        break;
+    case hipblas_stats_hemm:
+        // hemm names its sizes n and k
+        gflops = hemm_gflop_count<T>(n, k, r.side_ == 'L' ? n : k);
+        gbytes = hemm_gbyte_count<T>(n, k, r.side_ == 'L' ? n : k);
+        break;
+    case hipblas_stats_symm:
+        gflops = symm_gflop_count<T>(m, n, r.side_ == 'L' ? m : n);
+        gbytes = symm_gbyte_count<T>(m, n, r.side_ == 'L' ? m : n);
+        break;
+    case hipblas_stats_herk:
+        gflops = herk_gflop_count<T>(n, k);
+        gbytes = herk_gbyte_count<T>(n, k);
+        break;
+    case hipblas_stats_her2k:
+        gflops = her2k_gflop_count<T>(n, k);
+        gbytes = her2k_gbyte_count<T>(n, k);
+        break;
+    case hipblas_stats_herkx:
+        gflops = herkx_gflop_count<T>(n, k);
+        gbytes = herkx_gbyte_count<T>(n, k);
+        break;
+    case hipblas_stats_syrk:
+        gflops = syrk_gflop_count<T>(n, k);
+        gbytes = syrk_gbyte_count<T>(n, k);
+        break;
+    case hipblas_stats_syr2k:
+        gflops = syr2k_gflop_count<T>(n, k);
+        gbytes = syr2k_gbyte_count<T>(n, k);
+        break;
+    case hipblas_stats_syrkx:
+        gflops = syrkx_gflop_count<T>(n, k);
+        gbytes = syrkx_gbyte_count<T>(n, k);
+        break;
+    case hipblas_stats_trmm:
+        gflops = trmm_gflop_count<T>(m, n, r.side_ == 'L' ? m : n);
+        gbytes = trmm_gbyte_count<T>(m, n, r.side_ == 'L' ? m : n);
+        break;
+    case hipblas_stats_trsm:
+        gflops = trsm_gflop_count<T>(m, n, r.side_ == 'L' ? m : n);
+        gbytes = trsm_gbyte_count<T>(m, n, r.side_ == 'L' ? m : n);
+        break;
+    case hipblas_stats_trtri:
+        gflops = trtri_gflop_count<T>(n);
+        gbytes = trtri_gbyte_count<T>(n);
+        break;
+
+    // hipblas-bench reports no bytes for the solver functions
+    case hipblas_stats_geqrf:
+        gflops = geqrf_gflop_count<T>(n, m);
+        break;
+    case hipblas_stats_gels:
+        gflops = gels_gflop_count<T>(m, n);
+        break;
+    case hipblas_stats_getrf:
+        gflops = getrf_gflop_count<T>(n, n);
+        break;
+    case hipblas_stats_getri:
+        gflops = getri_gflop_count<T>(n);
+        break;
+    case hipblas_stats_getrs:
+        gflops = getrs_gflop_count<T>(n, k);
+        break;
+    case hipblas_stats_potrf:
+        gflops = potrf_gflop_count<T>(n);
+        break;
+    case hipblas_stats_potri:
+        gflops = potri_gflop_count<T>(n);
+        break;
+    case hipblas_stats_potrs:
+        gflops = potrs_gflop_count<T>(n, k);
+        break;
+
+    // no sizes are recorded for rotg, rotmg and the grouped gemm
+    default:
+        break;
+    }
+
+    return {gflops * 1e9 * batch, gbytes * 1e9 * batch};
+}
+
+inline hipblas_stats_count hipblas_stats_count_of(int family, const hipblas_trace_record& r)
+{
+    // scal_ex and axpy_ex give the type of alpha first
+    const char* type = r.precision ? r.precision
+                       : family == hipblas_stats_scal || family == hipblas_stats_axpy
+                           ? r.b_type
+                           : r.a_type;
+    if(!type)
+        return {};
+
+    if(!std::strcmp(type, "f32_r"))
+        return hipblas_stats_count_as<float, float>(family, r);
+    if(!std::strcmp(type, "f64_r"))
+        return hipblas_stats_count_as<double, double>(family, r);
+    if(!std::strcmp(type, "f16_r") || !std::strcmp(type, "bf16_r"))
+        return hipblas_stats_count_as<uint16_t, uint16_t>(family, r);
+    if(!std::strcmp(type, "f32_c"))
+        return hipblas_stats_count_as<hipblasComplex, float>(family, r);
+    if(!std::strcmp(type, "f64_c"))
+        return hipblas_stats_count_as<hipblasDoubleComplex, double>(family, r);
+    if(!std::strcmp(type, "i8_r"))
+        return hipblas_stats_count_as<int8_t, int8_t>(family, r);
+    return {};
+}
+
+// Counters of one routine family
+struct hipblas_stats_counters
+{
+    std::atomic<uint64_t> calls{0};
+    std::atomic<double>   flops{0};
+    std::atomic<double>   bytes{0};
+    std::atomic<uint64_t> device_ns{0};
+};
+
+// Counters of every family, in stripes so that threads counting the same family write
+// different cache lines. A thread always writes the same stripe, which other threads
+// rarely write, so the adds of doubles seldom retry; readers add the stripes up.
+class hipblas_stats_table
+{
+public:
+    static constexpr int stripes = 8;
+
+    void add(int family, const hipblas_stats_count& count)
+    {
+        hipblas_stats_counters& counters = m_stripes[stripe()].families[family];
+        counters.calls.fetch_add(1, std::memory_order_relaxed);
+        add(counters.flops, count.flops);
+        add(counters.bytes, count.bytes);
+    }
+
+    void add_device_time(int family, uint64_t ns)
+    {
+        m_stripes[stripe()].families[family].device_ns.fetch_add(ns, std::memory_order_relaxed);
+    }
+
+    hipblasRoutineStats_t read(int family) const
+    {
+        hipblasRoutineStats_t stats{hipblas_stats_family_name(family), 0, 0, 0, 0};
+        uint64_t              device_ns = 0;
+        for(const stripe_t& stripe : m_stripes)
+        {
+            const hipblas_stats_counters& counters = stripe.families[family];
+            stats.calls += counters.calls.load(std::memory_order_relaxed);
+            stats.flops += counters.flops.load(std::memory_order_relaxed);
+            stats.bytes += counters.bytes.load(std::memory_order_relaxed);
+            device_ns += counters.device_ns.load(std::memory_order_relaxed);
+        }
+        stats.deviceSeconds = device_ns * 1e-9;
+        return stats;
+    }
+
+    // Calls counted while the table is reset may be kept in part
+    void reset()
+    {
+        for(stripe_t& stripe : m_stripes)
+            for(hipblas_stats_counters& counters : stripe.families)
+            {
+                counters.calls.store(0, std::memory_order_relaxed);
+                counters.flops.store(0, std::memory_order_relaxed);
+                counters.bytes.store(0, std::memory_order_relaxed);
+                counters.device_ns.store(0, std::memory_order_relaxed);
+            }
+    }
+
+private:
+    struct alignas(64) stripe_t
+    {
+        hipblas_stats_counters families[hipblas_stats_family_count];
+    };
+
+    static void add(std::atomic<double>& counter, double value)
+    {
+        double old = counter.load(std::memory_order_relaxed);
+        while(!counter.compare_exchange_weak(old, old + value, std::memory_order_relaxed))
+            ;
+    }
+
+    static int stripe()
+    {
+        static std::atomic<int> next{0};
+        thread_local int        stripe = next.fetch_add(1, std::memory_order_relaxed) % stripes;
+        return stripe;
+    }
+
+    stripe_t m_stripes[stripes];
+};
+
+// Statistics of every handle that has kept statistics, including destroyed handles
+hipblas_stats_table& hipblas_process_stats();
+
+// Statistics of a handle, created by hipblasSetStatsMode and owned by the state of the
+// handle. Calls find them through a directory which is read without a lock.
+class hipblas_handle_stats
+{
+public:
+    explicit hipblas_handle_stats(hipblasHandle_t handle);
+    ~hipblas_handle_stats();
+
+    hipblas_handle_stats(const hipblas_handle_stats&) = delete;
+    hipblas_handle_stats& operator=(const hipblas_handle_stats&) = delete;
+
+    hipblasStatsMode_t mode() const
+    {
+        return m_mode.load(std::memory_order_relaxed);
+    }
+
+    void set_mode(hipblasStatsMode_t mode);
+
+    // Records an event on the stream of the handle before a timed call, and returns it
+    // and the stream; returns nullptr if the call is not timed
+    hipEvent_t start_timer(hipblasHandle_t handle, hipStream_t* stream);
+
+    // Counts the call described by record. event is the event returned by start_timer.
+    void add(const hipblas_trace_record& record, hipEvent_t event, hipStream_t stream);
+
+    // Waits for the timed calls and adds their device time
+    void collect();
+
+    void reset();
+
+    const hipblas_stats_table& table() const
+    {
+        return m_table;
+    }
+
+private:
+    struct timed_call
+    {
+        int        family;
+        hipEvent_t start;
+        hipEvent_t stop;
+    };
+
+    // Adds the device time of the completed timed calls, oldest first, or of all of them
+    // with wait. Called with m_mutex held.
+    void resolve(bool wait);
+
+    hipblasHandle_t                 m_handle;
+    std::atomic<hipblasStatsMode_t> m_mode{HIPBLAS_STATS_MODE_OFF};
+    hipblas_stats_table             m_table;
+
+    std::mutex              m_mutex; // guards the events of timed calls
+    std::deque<timed_call>  m_pending;
+    std::vector<hipEvent_t> m_events;
+};
+
+// Statistics of handle if it keeps any, without taking a lock
+hipblas_handle_stats* hipblas_find_handle_stats(hipblasHandle_t handle);
@@ -0,0 +1,236 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+
+#include "batched_emulation.hpp"
+#include "hipblas.h"
+#include <hip/hip_runtime.h>
+#include <vector>
+
+inline hipblasStatus_t hipblas_hip_to_status(hipError_t error)
+{
+    switch(error)
+    {
+    case hipSuccess:
+        return HIPBLAS_STATUS_SUCCESS;
+    case hipErrorOutOfMemory:
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+    default:
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+    }
+}
+
+// Synchronous copy between host and device memory ordered on the handle's stream, for
+// the few values emulated routines need on the host
+inline hipblasStatus_t hipblas_handle_memcpy(hipblasHandle_t handle,
+                                             void*           dst,
+                                             const void*     src,
+                                             size_t          size,
+                                             hipMemcpyKind   kind)
+{
+    hipStream_t     stream;
+    hipblasStatus_t status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    hipError_t error = hipMemcpyAsync(dst, src, size, kind, stream);
+    if(error == hipSuccess)
+        error = hipStreamSynchronize(stream);
+    return hipblas_hip_to_status(error);
+}
+
+// Streams and events a handle forks emulated batched calls over. They are created
+// on the current device the first time they are needed and destroyed with the
+// handle. A handle is not used by several threads at once, so there is no locking.
+class hipblas_stream_pool
+{
+public:
+    hipblas_stream_pool() = default;
+
+    hipblas_stream_pool(const hipblas_stream_pool&) = delete;
+    hipblas_stream_pool& operator=(const hipblas_stream_pool&) = delete;
+
+    ~hipblas_stream_pool()
+    {
+        for(hipStream_t stream : m_streams)
+            (void)hipStreamDestroy(stream);
+        for(hipEvent_t event : m_events)
+            (void)hipEventDestroy(event);
+        if(m_fork)
+            (void)hipEventDestroy(m_fork);
+    }
+
+    // Makes sure at least count streams exist
+    hipError_t reserve(int count)
+    {
+        if(!m_fork)
+        {
+            hipError_t error = hipEventCreateWithFlags(&m_fork, hipEventDisableTiming);
+            if(error != hipSuccess)
+            {
+                m_fork = nullptr;
+                return error;
+            }
+        }
+
+        while(int(m_streams.size()) < count)
+        {
+            hipStream_t stream;
+            hipEvent_t  event;
+            hipError_t  error = hipStreamCreateWithFlags(&stream, hipStreamNonBlocking);
+            if(error != hipSuccess)
+                return error;
+
+            error = hipEventCreateWithFlags(&event, hipEventDisableTiming);
+            if(error != hipSuccess)
+            {
+                (void)hipStreamDestroy(stream);
+                return error;
+            }
+
+            m_streams.push_back(stream);
+            m_events.push_back(event);
+        }
+        return hipSuccess;
+    }
+
+    hipStream_t stream(int index) const
+    {
+        return m_streams[index];
+    }
+
+    hipEvent_t event(int index) const
+    {
+        return m_events[index];
+    }
+
+    hipEvent_t fork_event() const
+    {
+        return m_fork;
+    }
+
+private:
+    std::vector<hipStream_t> m_streams;
+    std::vector<hipEvent_t>  m_events;
+    hipEvent_t               m_fork = nullptr;
+};
+
+// The streams argument of hipblas_fan_out_batch for a real handle. The handle is
+// moved between its own stream and the pool's with hipblasSetStream.
+class hipblas_handle_streams
+{
+public:
+    hipblas_handle_streams(hipblasHandle_t handle, hipblas_stream_pool& pool)
+        : m_handle(handle)
+        , m_pool(pool)
+    {
+    }
+
+    hipblasStatus_t fork(int count)
+    {
+        hipblasStatus_t status = hipblasGetStream(m_handle, &m_origin);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        hipError_t error = m_pool.reserve(count);
+        if(error == hipSuccess)
+            error = hipEventRecord(m_pool.fork_event(), m_origin);
+        for(int i = 0; i < count && error == hipSuccess; i++)
+            error = hipStreamWaitEvent(m_pool.stream(i), m_pool.fork_event(), 0);
+        return hipblas_hip_to_status(error);
+    }
+
+    hipblasStatus_t select(int index)
+    {
+        return hipblasSetStream(m_handle, index < 0 ? m_origin : m_pool.stream(index));
+    }
+
+    hipblasStatus_t join(int count)
+    {
+        hipError_t error = hipSuccess;
+        for(int i = 0; i < count && error == hipSuccess; i++)
+        {
+            error = hipEventRecord(m_pool.event(i), m_pool.stream(i));
+            if(error == hipSuccess)
+                error = hipStreamWaitEvent(m_origin, m_pool.event(i), 0);
+        }
+        return hipblas_hip_to_status(error);
+    }
+
+private:
+    hipblasHandle_t      m_handle;
+    hipblas_stream_pool& m_pool;
+    hipStream_t          m_origin = nullptr;
+};
+
+// Host copy of the per-problem pointers of a batched call. Arrays of vectors and
+// matrices are always in device memory; arrays of scalars, such as those of
+// rotg_batched, are in host memory in host pointer mode. Throws hipblasStatus_t.
+template <typename T>
+class hipblas_batch_pointers
+{
+public:
+    hipblas_batch_pointers(hipblasHandle_t handle,
+                           T* const*       array,
+                           int             batch_count,
+                           bool            scalars = false)
+        : m_pointers(std::max(batch_count, 0), nullptr)
+    {
+        if(!array || batch_count <= 0)
+            return;
+
+        if(scalars)
+        {
+            hipblasPointerMode_t mode;
+            hipblasStatus_t      status = hipblasGetPointerMode(handle, &mode);
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                throw status;
+            if(mode == HIPBLAS_POINTER_MODE_HOST)
+            {
+                std::copy(array, array + batch_count, m_pointers.begin());
+                return;
+            }
+        }
+
+        hipblasStatus_t status = hipblas_handle_memcpy(
+            handle, m_pointers.data(), array, sizeof(T*) * batch_count, hipMemcpyDeviceToHost);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            throw status;
+    }
+
+    // For the type-erased arrays of the _ex routines
+    hipblas_batch_pointers(hipblasHandle_t handle, const void* array, int batch_count)
+        : hipblas_batch_pointers(handle, static_cast<T* const*>(array), batch_count)
+    {
+    }
+
+    T* operator[](int b) const
+    {
+        return m_pointers[b];
+    }
+
+private:
+    std::vector<T*> m_pointers;
+};
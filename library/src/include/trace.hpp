@@ -0,0 +1,645 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Fields of a trace record that have not been set by the entry point
+constexpr int64_t hipblas_trace_unset = std::numeric_limits<int64_t>::min();
+
+// Precision of alpha and beta for gemm_ex. A datatype compute type is the scalar type
+// itself; a hipblasComputeType_t gives the precision and a_type gives real or complex.
+inline const char* hipblas_trace_gemm_scalar_type(const char* compute_type, const char* a_type)
+{
+    if(!compute_type || compute_type[0] != 'c')
+        return compute_type;
+
+    bool complex = a_type && std::strstr(a_type, "_c");
+    if(!std::strncmp(compute_type, "c16f", 4))
+        return complex ? "f16_c" : "f16_r";
+    if(!std::strncmp(compute_type, "c64f", 4))
+        return complex ? "f64_c" : "f64_r";
+    if(!std::strncmp(compute_type, "c32i", 4))
+        return "i32_r";
+    return complex ? "f32_c" : "f32_r";
+}
+
+// One traced API call. Records live in a preallocated ring buffer, so every string
+// is a pointer to static storage (__func__, literals or the name tables below) and
+// filling in a record never allocates.
+struct hipblas_trace_record
+{
+    uint64_t    timestamp_ns = 0;
+    uint32_t    thread       = 0;
+    const char* routine      = nullptr;
+    const char* function     = nullptr;
+    const char* precision    = nullptr;
+    const char* a_type       = nullptr;
+    const char* b_type       = nullptr;
+    const char* c_type       = nullptr;
+    const char* compute_type = nullptr;
+
+    char trans_a_ = 0;
+    char trans_b_ = 0;
+    char side_    = 0;
+    char uplo_    = 0;
+    char diag_    = 0;
+
+    int64_t m_           = hipblas_trace_unset;
+    int64_t n_           = hipblas_trace_unset;
+    int64_t k_           = hipblas_trace_unset;
+    int64_t kl_          = hipblas_trace_unset;
+    int64_t ku_          = hipblas_trace_unset;
+    int64_t lda_         = hipblas_trace_unset;
+    int64_t ldb_         = hipblas_trace_unset;
+    int64_t ldc_         = hipblas_trace_unset;
+    int64_t incx_        = hipblas_trace_unset;
+    int64_t incy_        = hipblas_trace_unset;
+    int64_t stride_a_    = hipblas_trace_unset;
+    int64_t stride_b_    = hipblas_trace_unset;
+    int64_t stride_c_    = hipblas_trace_unset;
+    int64_t stride_x_    = hipblas_trace_unset;
+    int64_t stride_y_    = hipblas_trace_unset;
+    int64_t batch_count_ = hipblas_trace_unset;
+
+    // Scalars are only read in host pointer mode; device scalars are not dereferenced
+    bool   has_alpha = false;
+    bool   has_beta  = false;
+    double alpha_[2] = {0, 0};
+    double beta_[2]  = {0, 0};
+
+    int         pointer_mode = -1;
+    const void* stream       = nullptr;
+    double      latency_us   = -1;
+
+    // Setters are chained onto HIPBLAS_TRACE so that their arguments are only
+    // evaluated when tracing is enabled.
+    hipblas_trace_record& trans_a(hipblasOperation_t op)
+    {
+        trans_a_ = hipblas_trace_record::op_char(op);
+        return *this;
+    }
+    hipblas_trace_record& trans_b(hipblasOperation_t op)
+    {
+        trans_b_ = hipblas_trace_record::op_char(op);
+        return *this;
+    }
+    hipblas_trace_record& side(hipblasSideMode_t value)
+    {
+        side_ = value == HIPBLAS_SIDE_LEFT ? 'L' : value == HIPBLAS_SIDE_RIGHT ? 'R' : 'B';
+        return *this;
+    }
+    hipblas_trace_record& uplo(hipblasFillMode_t value)
+    {
+        uplo_ = value == HIPBLAS_FILL_MODE_UPPER   ? 'U'
+                : value == HIPBLAS_FILL_MODE_LOWER ? 'L'
+                                                   : 'F';
+        return *this;
+    }
+    hipblas_trace_record& diag(hipblasDiagType_t value)
+    {
+        diag_ = value == HIPBLAS_DIAG_UNIT ? 'U' : 'N';
+        return *this;
+    }
+
+#define HIPBLAS_TRACE_INT_FIELD(name_)         \
+    hipblas_trace_record& name_(int64_t value) \
+    {                                          \
+        name_##_ = value;                      \
+        return *this;                          \
+    }
+
+    HIPBLAS_TRACE_INT_FIELD(m)
+    HIPBLAS_TRACE_INT_FIELD(n)
+    HIPBLAS_TRACE_INT_FIELD(k)
+    HIPBLAS_TRACE_INT_FIELD(kl)
+    HIPBLAS_TRACE_INT_FIELD(ku)
+    HIPBLAS_TRACE_INT_FIELD(lda)
+    HIPBLAS_TRACE_INT_FIELD(ldb)
+    HIPBLAS_TRACE_INT_FIELD(ldc)
+    HIPBLAS_TRACE_INT_FIELD(incx)
+    HIPBLAS_TRACE_INT_FIELD(incy)
+    HIPBLAS_TRACE_INT_FIELD(stride_a)
+    HIPBLAS_TRACE_INT_FIELD(stride_b)
+    HIPBLAS_TRACE_INT_FIELD(stride_c)
+    HIPBLAS_TRACE_INT_FIELD(stride_x)
+    HIPBLAS_TRACE_INT_FIELD(stride_y)
+    HIPBLAS_TRACE_INT_FIELD(batch_count)
+
+#undef HIPBLAS_TRACE_INT_FIELD
+
+    // type names the precision of the scalar, e.g. "f32_c"
+    hipblas_trace_record& alpha(const void* value, const char* type)
+    {
+        has_alpha = read_scalar(value, type, alpha_);
+        return *this;
+    }
+    hipblas_trace_record& beta(const void* value, const char* type)
+    {
+        has_beta = read_scalar(value, type, beta_);
+        return *this;
+    }
+
+    // Types of the _ex routines, named as hipblas-bench expects them
+    hipblas_trace_record& types(const char* a,
+                                const char* b       = nullptr,
+                                const char* c       = nullptr,
+                                const char* compute = nullptr)
+    {
+        a_type       = a;
+        b_type       = b;
+        c_type       = c;
+        compute_type = compute;
+        return *this;
+    }
+
+    // alpha and beta of gemm_ex, whose precision follows from the types set above
+    hipblas_trace_record& gemm_scalars(const void* alpha_value, const void* beta_value)
+    {
+        const char* type = hipblas_trace_gemm_scalar_type(compute_type, a_type);
+        return alpha(alpha_value, type).beta(beta_value, type);
+    }
+
+    static char op_char(hipblasOperation_t op)
+    {
+        return op == HIPBLAS_OP_N ? 'N' : op == HIPBLAS_OP_T ? 'T' : 'C';
+    }
+
+    static double half_to_double(uint16_t bits)
+    {
+        int    exponent = (bits >> 10) & 0x1f;
+        int    mantissa = bits & 0x3ff;
+        double value;
+        if(exponent == 0)
+            value = std::ldexp(double(mantissa), -24);
+        else if(exponent == 0x1f)
+            value = mantissa ? std::numeric_limits<double>::quiet_NaN()
+                             : std::numeric_limits<double>::infinity();
+        else
+            value = std::ldexp(double(mantissa | 0x400), exponent - 25);
+        return bits & 0x8000 ? -value : value;
+    }
+
+    bool read_scalar(const void* value, const char* type, double (&out)[2]) const
+    {
+        if(!value || !type || pointer_mode != HIPBLAS_POINTER_MODE_HOST)
+            return false;
+
+        out[1] = 0;
+        if(!std::strcmp(type, "f16_r"))
+            out[0] = half_to_double(*static_cast<const uint16_t*>(value));
+        else if(!std::strcmp(type, "bf16_r"))
+        {
+            uint32_t bits = uint32_t(*static_cast<const uint16_t*>(value)) << 16;
+            float    f;
+            std::memcpy(&f, &bits, sizeof(f));
+            out[0] = f;
+        }
+        else if(!std::strcmp(type, "f32_r"))
+            out[0] = *static_cast<const float*>(value);
+        else if(!std::strcmp(type, "f64_r"))
+            out[0] = *static_cast<const double*>(value);
+        else if(!std::strcmp(type, "i32_r"))
+            out[0] = *static_cast<const int32_t*>(value);
+        else if(!std::strcmp(type, "f32_c"))
+        {
+            out[0] = static_cast<const float*>(value)[0];
+            out[1] = static_cast<const float*>(value)[1];
+        }
+        else if(!std::strcmp(type, "f64_c"))
+        {
+            out[0] = static_cast<const double*>(value)[0];
+            out[1] = static_cast<const double*>(value)[1];
+        }
+        else
+            return false;
+        return true;
+    }
+};
+
+// Names of hipDataType and hipblasComputeType_t values, as accepted by hipblas-bench
+inline const char* hipblas_trace_type_name(hipDataType type)
+{
+    switch(type)
+    {
+    case HIP_R_16F:
+        return "f16_r";
+    case HIP_R_32F:
+        return "f32_r";
+    case HIP_R_64F:
+        return "f64_r";
+    case HIP_C_16F:
+        return "f16_c";
+    case HIP_C_32F:
+        return "f32_c";
+    case HIP_C_64F:
+        return "f64_c";
+    case HIP_R_8I:
+        return "i8_r";
+    case HIP_R_8U:
+        return "u8_r";
+    case HIP_R_32I:
+        return "i32_r";
+    case HIP_R_32U:
+        return "u32_r";
+    case HIP_C_8I:
+        return "i8_c";
+    case HIP_C_8U:
+        return "u8_c";
+    case HIP_C_32I:
+        return "i32_c";
+    case HIP_C_32U:
+        return "u32_c";
+    case HIP_R_16BF:
+        return "bf16_r";
+    case HIP_C_16BF:
+        return "bf16_c";
+    default:
+        return "invalid";
+    }
+}
+
+#ifndef HIPBLAS_V2
+inline const char* hipblas_trace_type_name(hipblasDatatype_t type)
+{
+    switch(type)
+    {
+    case HIPBLAS_R_16F:
+        return "f16_r";
+    case HIPBLAS_R_32F:
+        return "f32_r";
+    case HIPBLAS_R_64F:
+        return "f64_r";
+    case HIPBLAS_C_16F:
+        return "f16_c";
+    case HIPBLAS_C_32F:
+        return "f32_c";
+    case HIPBLAS_C_64F:
+        return "f64_c";
+    case HIPBLAS_R_8I:
+        return "i8_r";
+    case HIPBLAS_R_8U:
+        return "u8_r";
+    case HIPBLAS_R_32I:
+        return "i32_r";
+    case HIPBLAS_R_32U:
+        return "u32_r";
+    case HIPBLAS_C_8I:
+        return "i8_c";
+    case HIPBLAS_C_8U:
+        return "u8_c";
+    case HIPBLAS_C_32I:
+        return "i32_c";
+    case HIPBLAS_C_32U:
+        return "u32_c";
+    case HIPBLAS_R_16B:
+        return "bf16_r";
+    case HIPBLAS_C_16B:
+        return "bf16_c";
+    default:
+        return "invalid";
+    }
+}
+#endif
+
+inline const char* hipblas_trace_type_name(hipblasComputeType_t type)
+{
+    switch(type)
+    {
+    case HIPBLAS_COMPUTE_16F:
+        return "c16f";
+    case HIPBLAS_COMPUTE_16F_PEDANTIC:
+        return "c16f_pedantic";
+    case HIPBLAS_COMPUTE_32F:
+        return "c32f";
+    case HIPBLAS_COMPUTE_32F_PEDANTIC:
+        return "c32f_pedantic";
+    case HIPBLAS_COMPUTE_32F_FAST_16F:
+        return "c32f_fast_16f";
+    case HIPBLAS_COMPUTE_32F_FAST_16BF:
+        return "c32f_fast_16Bf";
+    case HIPBLAS_COMPUTE_32F_FAST_TF32:
+        return "c32f_fast_tf32";
+    case HIPBLAS_COMPUTE_64F:
+        return "c64f";
+    case HIPBLAS_COMPUTE_64F_PEDANTIC:
+        return "c64f_pedantic";
+    case HIPBLAS_COMPUTE_32I:
+        return "c32i";
+    case HIPBLAS_COMPUTE_32I_PEDANTIC:
+        return "c32i_pedantic";
+    default:
+        return "invalid";
+    }
+}
+
+// Single producer, single consumer ring of trace records. The owning thread fills
+// records in place and publishes them by advancing the head; the flush thread reads
+// up to the head and releases slots by advancing the tail. When the ring is full new
+// records are dropped and counted rather than blocking the caller.
+class hipblas_trace_ring
+{
+public:
+    explicit hipblas_trace_ring(uint32_t thread, size_t capacity = 4096)
+        : m_thread(thread)
+        , m_records(capacity)
+    {
+    }
+
+    // Returns the next free slot, or nullptr if the ring is full. A slot that is
+    // still reserved is not handed out again, so only the outermost of nested
+    // entry points is recorded.
+    hipblas_trace_record* reserve()
+    {
+        if(m_reserved)
+            return nullptr;
+
+        uint64_t head = m_head.load(std::memory_order_relaxed);
+        if(head - m_tail.load(std::memory_order_acquire) >= m_records.size())
+        {
+            m_dropped.fetch_add(1, std::memory_order_relaxed);
+            return nullptr;
+        }
+
+        hipblas_trace_record* record = &m_records[head % m_records.size()];
+        *record                      = hipblas_trace_record{};
+        record->thread               = m_thread;
+        m_reserved                   = true;
+        return record;
+    }
+
+    // Publishes the slot returned by the last reserve()
+    void commit()
+    {
+        m_reserved = false;
+        m_head.store(m_head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    // Passes every published record to f, oldest first, and returns how many there were
+    template <typename F>
+    size_t drain(F&& f)
+    {
+        uint64_t tail = m_tail.load(std::memory_order_relaxed);
+        uint64_t head = m_head.load(std::memory_order_acquire);
+        for(uint64_t i = tail; i != head; i++)
+            f(m_records[i % m_records.size()]);
+        m_tail.store(head, std::memory_order_release);
+        return head - tail;
+    }
+
+    uint64_t dropped() const
+    {
+        return m_dropped.load(std::memory_order_relaxed);
+    }
+
+private:
+    uint32_t                          m_thread;
+    std::vector<hipblas_trace_record> m_records;
+    bool                              m_reserved = false;
+    std::atomic<uint64_t>             m_head{0};
+    std::atomic<uint64_t>             m_tail{0};
+    std::atomic<uint64_t>             m_dropped{0};
+};
+
+// Command line that replays the call with hipblas-bench. Device pointer mode scalars
+// were not read, so the bench defaults are used for them.
+inline std::string hipblas_trace_bench_command(const hipblas_trace_record& r)
+{
+    std::ostringstream cmd;
+
+    std::string routine = r.routine ? r.routine : "";
+    bool        v2      = routine.find("_v2") != std::string::npos;
+    bool        api_64  = routine.size() > 3 && routine.compare(routine.size() - 3, 3, "_64") == 0;
+
+    cmd << (v2 ? "hipblas_v2-bench" : "hipblas-bench") << " -f " << r.function;
+    if(r.precision)
+        cmd << " -r " << r.precision;
+    if(r.a_type)
+        cmd << " --a_type " << r.a_type;
+    if(r.b_type)
+        cmd << " --b_type " << r.b_type;
+    if(r.c_type)
+        cmd << " --c_type " << r.c_type;
+    if(r.compute_type)
+        cmd << (r.compute_type[0] == 'c' ? " --compute_type_gemm " : " --compute_type ")
+            << r.compute_type;
+
+    auto opt_char = [&](const char* name, char value) {
+        if(value)
+            cmd << " --" << name << ' ' << value;
+    };
+    opt_char("transposeA", r.trans_a_);
+    opt_char("transposeB", r.trans_b_);
+    opt_char("side", r.side_);
+    opt_char("uplo", r.uplo_);
+    opt_char("diag", r.diag_);
+
+    auto opt_int = [&](const char* name, int64_t value) {
+        if(value != hipblas_trace_unset)
+            cmd << ' ' << name << ' ' << value;
+    };
+    opt_int("-m", r.m_);
+    opt_int("-n", r.n_);
+    opt_int("-k", r.k_);
+    opt_int("--kl", r.kl_);
+    opt_int("--ku", r.ku_);
+    opt_int("--lda", r.lda_);
+    opt_int("--ldb", r.ldb_);
+    opt_int("--ldc", r.ldc_);
+    opt_int("--incx", r.incx_);
+    opt_int("--incy", r.incy_);
+    opt_int("--stride_a", r.stride_a_);
+    opt_int("--stride_b", r.stride_b_);
+    opt_int("--stride_c", r.stride_c_);
+    opt_int("--stride_x", r.stride_x_);
+    opt_int("--stride_y", r.stride_y_);
+    opt_int("--batch_count", r.batch_count_);
+
+    if(r.has_alpha)
+        cmd << " --alpha " << r.alpha_[0] << " --alphai " << r.alpha_[1];
+    if(r.has_beta)
+        cmd << " --beta " << r.beta_[0] << " --betai " << r.beta_[1];
+    if(api_64)
+        cmd << " --api 1";
+
+    return cmd.str();
+}
+
+inline const char* hipblas_trace_csv_header()
+{
+    return "timestamp_ns,thread,routine,function,precision,a_type,b_type,c_type,compute_type,"
+           "transA,transB,side,uplo,diag,m,n,k,kl,ku,lda,ldb,ldc,incx,incy,stride_a,stride_b,"
+           "stride_c,stride_x,stride_y,batch_count,alpha,alphai,beta,betai,pointer_mode,stream,"
+           "latency_us,bench";
+}
+
+// Unset fields are left empty in CSV and omitted from JSON
+inline std::string hipblas_trace_format(const hipblas_trace_record& r, bool json)
+{
+    std::ostringstream out;
+    bool               first = true;
+
+    auto field = [&](const char* name, auto value, bool set) {
+        if(json)
+        {
+            if(!set)
+                return;
+            out << (first ? "{" : ", ") << '"' << name << "\": " << value;
+        }
+        else
+        {
+            if(!first)
+                out << ',';
+            if(set)
+                out << value;
+        }
+        first = false;
+    };
+    auto str = [&](const char* name, const char* value) {
+        if(json && value)
+            field(name, '"' + std::string(value) + '"', true);
+        else
+            field(name, value ? value : "", value != nullptr);
+    };
+    auto chr = [&](const char* name, char value) {
+        char text[2] = {value, 0};
+        str(name, value ? text : nullptr);
+    };
+    auto num = [&](const char* name, int64_t value) {
+        field(name, value, value != hipblas_trace_unset);
+    };
+
+    field("timestamp_ns", r.timestamp_ns, true);
+    field("thread", r.thread, true);
+    str("routine", r.routine);
+    str("function", r.function);
+    str("precision", r.precision);
+    str("a_type", r.a_type);
+    str("b_type", r.b_type);
+    str("c_type", r.c_type);
+    str("compute_type", r.compute_type);
+    chr("transA", r.trans_a_);
+    chr("transB", r.trans_b_);
+    chr("side", r.side_);
+    chr("uplo", r.uplo_);
+    chr("diag", r.diag_);
+    num("m", r.m_);
+    num("n", r.n_);
+    num("k", r.k_);
+    num("kl", r.kl_);
+    num("ku", r.ku_);
+    num("lda", r.lda_);
+    num("ldb", r.ldb_);
+    num("ldc", r.ldc_);
+    num("incx", r.incx_);
+    num("incy", r.incy_);
+    num("stride_a", r.stride_a_);
+    num("stride_b", r.stride_b_);
+    num("stride_c", r.stride_c_);
+    num("stride_x", r.stride_x_);
+    num("stride_y", r.stride_y_);
+    num("batch_count", r.batch_count_);
+    field("alpha", r.alpha_[0], r.has_alpha);
+    field("alphai", r.alpha_[1], r.has_alpha);
+    field("beta", r.beta_[0], r.has_beta);
+    field("betai", r.beta_[1], r.has_beta);
+    str("pointer_mode",
+        r.pointer_mode == HIPBLAS_POINTER_MODE_HOST
+            ? "host"
+            : r.pointer_mode == HIPBLAS_POINTER_MODE_DEVICE ? "device" : nullptr);
+    std::ostringstream stream;
+    stream << r.stream;
+    str("stream", stream.str().c_str());
+    field("latency_us", r.latency_us, r.latency_us >= 0);
+    str("bench", hipblas_trace_bench_command(r).c_str());
+
+    if(json)
+        out << '}';
+    return out.str();
+}
+
+// Set once when the library is loaded, from HIPBLAS_TRACE and HIPBLAS_TRACE_LATENCY
+extern const bool hipblas_trace_enabled;
+extern const bool hipblas_trace_latency_enabled;
+
+// Number of handles keeping statistics, see stats.hpp
+extern std::atomic<int> hipblas_stats_handles;
+
+class hipblas_handle_stats;
+
+// Fills one ring slot for the duration of an entry point and publishes it on exit, and
+// adds the call to the statistics of the handle. Default construction does nothing, so
+// the disabled path is the single test of HIPBLAS_TRACE.
+class hipblas_trace_scope
+{
+public:
+    hipblas_trace_scope() = default;
+
+    hipblas_trace_scope(const hipblas_trace_scope&) = delete;
+    hipblas_trace_scope& operator=(const hipblas_trace_scope&) = delete;
+
+    hipblas_trace_record& start(hipblasHandle_t handle,
+                                const char*     routine,
+                                const char*     function,
+                                const char*     precision);
+
+    ~hipblas_trace_scope()
+    {
+        if(m_ring || m_stats)
+            finish();
+    }
+
+private:
+    void finish();
+
+    hipblas_trace_ring*                   m_ring   = nullptr;
+    hipblas_handle_stats*                 m_stats  = nullptr;
+    hipblas_trace_record*                 m_record = nullptr;
+    hipEvent_t                            m_event  = nullptr;
+    hipStream_t                           m_stream = nullptr;
+    std::chrono::steady_clock::time_point m_start;
+};
+
+// Traces the enclosing entry point as hipblas-bench function `function` in
+// `precision`. Record fields are set by chaining setters onto the macro:
+//     HIPBLAS_TRACE("gemm", "f32_r").trans_a(transa).m(m).n(n).k(k);
+// The chained arguments are not evaluated unless tracing is enabled or a handle
+// keeps statistics. The test has an empty branch so that an else written after the
+// macro does not compile instead of attaching to it.
+#define HIPBLAS_TRACE(function, precision)                                                  \
+    hipblas_trace_scope hipblas_trace_scope__;                                              \
+    if(!(hipblas_trace_enabled || hipblas_stats_handles.load(std::memory_order_relaxed)))   \
+    {                                                                                       \
+    }                                                                                       \
+    else                                                                                    \
+        hipblas_trace_scope__.start(handle, __func__, function, precision)
@@ -0,0 +1,142 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+
+// Identifies a (routine, shape bucket) pair for which the backend workspace
+// requirement is remembered. routine is expected to be __func__ of the entry
+// point, so comparing the pointers is enough to compare routines.
+struct hipblas_workspace_key
+{
+    static constexpr size_t max_dims = 4;
+
+    const char*                   routine = nullptr;
+    std::array<int64_t, max_dims> bucket  = {};
+
+    bool operator==(const hipblas_workspace_key& rhs) const
+    {
+        return routine == rhs.routine && bucket == rhs.bucket;
+    }
+};
+
+struct hipblas_workspace_key_hash
+{
+    size_t operator()(const hipblas_workspace_key& key) const
+    {
+        size_t seed = std::hash<const void*>{}(key.routine);
+        for(int64_t dim : key.bucket)
+            seed ^= std::hash<int64_t>{}(dim) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+        return seed;
+    }
+};
+
+// Dimensions are rounded up to the next power of two so that nearby shapes
+// share an entry, and the entry keeps the largest size seen in the bucket.
+inline int64_t hipblas_workspace_bucket(int64_t dim)
+{
+    if(dim <= 0)
+        return 0;
+
+    int64_t bucket = 1;
+    while(bucket < dim && bucket < (int64_t(1) << 62))
+        bucket <<= 1;
+    return bucket;
+}
+
+template <typename... Ts>
+hipblas_workspace_key hipblas_make_workspace_key(const char* routine, Ts... dims)
+{
+    static_assert(sizeof...(Ts) <= hipblas_workspace_key::max_dims,
+                  "too many dimensions for hipblas_workspace_key");
+
+    hipblas_workspace_key key;
+    key.routine = routine;
+
+    size_t i = 0;
+    ((key.bucket[i++] = hipblas_workspace_bucket(int64_t(dims))), ...);
+    return key;
+}
+
+// Remembers how much backend workspace each (routine, shape bucket) needed, so that
+// the workspace can be grown ahead of the call instead of after a failed attempt.
+class hipblas_workspace_cache
+{
+public:
+    // Returns true and sets size if key has been seen before. A remembered size of 0
+    // means the call previously succeeded without growing the workspace.
+    bool lookup(const hipblas_workspace_key& key, size_t& size)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        auto it = m_sizes.find(key);
+        if(it == m_sizes.end())
+        {
+            m_misses++;
+            return false;
+        }
+
+        m_hits++;
+        size = it->second;
+        return true;
+    }
+
+    void record(const hipblas_workspace_key& key, size_t size)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        size_t& entry = m_sizes[key];
+        if(size > entry)
+            entry = size;
+    }
+
+    void get_stats(uint64_t* hits, uint64_t* misses) const
+    {
+        if(hits)
+            *hits = m_hits;
+        if(misses)
+            *misses = m_misses;
+    }
+
+    void reset()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        m_sizes.clear();
+        m_hits   = 0;
+        m_misses = 0;
+    }
+
+private:
+    std::mutex m_mutex;
+    std::unordered_map<hipblas_workspace_key, size_t, hipblas_workspace_key_hash> m_sizes;
+    std::atomic<uint64_t> m_hits{0};
+    std::atomic<uint64_t> m_misses{0};
+};
@@ -0,0 +1,882 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+#include "exceptions.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+// Tiled multi-device Level-3 engine behind the hipblasXt functions. The operands are
+// in host memory; each routine is split into tasks that produce one tile (or panel)
+// of the output, and the tasks are scheduled over a list of devices with work
+// stealing. Each device runs its tasks through two slots, each with its own stream
+// and device buffers, so that the uploads of one task overlap the compute of the
+// previous one and the download of the one before. Nothing here depends on the
+// backend: a device is anything that implements hipblas_xt_device, which lets the
+// tiling and scheduling be tested with a CPU device.
+
+// Rectangle of the output a task produces, in problem batch of a strided batch
+struct hipblas_xt_task
+{
+    int64_t row;
+    int64_t col;
+    int64_t rows;
+    int64_t cols;
+    int64_t batch = 0;
+};
+
+// Tasks for the nb x nb tiles of an m x n output, column by column. With a lower or
+// upper fill mode only the tiles that meet that triangle are kept.
+inline std::vector<hipblas_xt_task>
+    hipblas_xt_tiles(int64_t m, int64_t n, int64_t nb, hipblasFillMode_t fill)
+{
+    std::vector<hipblas_xt_task> tiles;
+    for(int64_t col = 0; col < n; col += nb)
+        for(int64_t row = 0; row < m; row += nb)
+        {
+            if((fill == HIPBLAS_FILL_MODE_LOWER && row < col)
+               || (fill == HIPBLAS_FILL_MODE_UPPER && row > col))
+                continue;
+            tiles.push_back({row, col, std::min(nb, m - row), std::min(nb, n - col)});
+        }
+    return tiles;
+}
+
+// Work stealing queues of tasks, one per device. Each device starts with a
+// contiguous range of tasks, which keeps the operand panels it loads close
+// together, and takes from the front of its own queue. A device whose queue is
+// empty steals from the back of the others.
+class hipblas_xt_scheduler
+{
+public:
+    hipblas_xt_scheduler(const std::vector<hipblas_xt_task>& tasks, int workers)
+        : m_queues(workers)
+    {
+        size_t count = tasks.size();
+        for(int w = 0; w < workers; w++)
+            m_queues[w].tasks.assign(tasks.begin() + count * w / workers,
+                                     tasks.begin() + count * (w + 1) / workers);
+    }
+
+    bool next(int worker, hipblas_xt_task& task)
+    {
+        int workers = int(m_queues.size());
+        for(int i = 0; i < workers; i++)
+        {
+            queue&                      victim = m_queues[(worker + i) % workers];
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if(victim.tasks.empty())
+                continue;
+
+            if(i == 0)
+            {
+                task = victim.tasks.front();
+                victim.tasks.pop_front();
+            }
+            else
+            {
+                task = victim.tasks.back();
+                victim.tasks.pop_back();
+                m_stolen++;
+            }
+            return true;
+        }
+        return false;
+    }
+
+    // Number of tasks run by another device than the one they were given to
+    uint64_t stolen() const
+    {
+        return m_stolen;
+    }
+
+private:
+    struct queue
+    {
+        std::mutex                  mutex;
+        std::deque<hipblas_xt_task> tasks;
+    };
+
+    std::vector<queue>    m_queues;
+    std::atomic<uint64_t> m_stolen{0};
+};
+
+// A device the engine runs tasks on. Work for a slot runs in order, and work for
+// different slots may overlap. Matrices in device memory are column major with the
+// given leading dimension. Every function is called from the one host thread that
+// drives the device.
+template <typename T>
+class hipblas_xt_device
+{
+public:
+    virtual ~hipblas_xt_device() = default;
+
+    // Called before the first task of a routine: makes the device current on the
+    // calling thread and makes sure each slot has memory for elements values
+    virtual hipblasStatus_t prepare(size_t elements) = 0;
+
+    virtual T* memory(int slot) = 0;
+
+    virtual hipblasStatus_t upload(int      slot,
+                                   T*       dst,
+                                   int64_t  ld_dst,
+                                   const T* src,
+                                   int64_t  ld_src,
+                                   int64_t  rows,
+                                   int64_t  cols)
+        = 0;
+
+    virtual hipblasStatus_t download(int      slot,
+                                     T*       dst,
+                                     int64_t  ld_dst,
+                                     const T* src,
+                                     int64_t  ld_src,
+                                     int64_t  rows,
+                                     int64_t  cols)
+        = 0;
+
+    virtual hipblasStatus_t gemm(int                slot,
+                                 hipblasOperation_t trans_a,
+                                 hipblasOperation_t trans_b,
+                                 int64_t            m,
+                                 int64_t            n,
+                                 int64_t            k,
+                                 T                  alpha,
+                                 const T*           A,
+                                 int64_t            lda,
+                                 const T*           B,
+                                 int64_t            ldb,
+                                 T                  beta,
+                                 T*                 C,
+                                 int64_t            ldc)
+        = 0;
+
+    virtual hipblasStatus_t trsm(int                slot,
+                                 hipblasSideMode_t  side,
+                                 hipblasFillMode_t  uplo,
+                                 hipblasOperation_t trans,
+                                 hipblasDiagType_t  diag,
+                                 int64_t            m,
+                                 int64_t            n,
+                                 T                  alpha,
+                                 const T*           A,
+                                 int64_t            lda,
+                                 T*                 B,
+                                 int64_t            ldb)
+        = 0;
+
+    // Waits for the work of a slot to finish
+    virtual hipblasStatus_t synchronize(int slot) = 0;
+};
+
+template <typename T>
+constexpr bool hipblas_xt_is_complex
+    = std::is_same<T, hipFloatComplex>{} || std::is_same<T, hipDoubleComplex>{};
+
+template <typename T>
+inline T hipblas_xt_real(double value)
+{
+    return T(value);
+}
+
+template <>
+inline hipFloatComplex hipblas_xt_real(double value)
+{
+    return make_hipFloatComplex(float(value), 0);
+}
+
+template <>
+inline hipDoubleComplex hipblas_xt_real(double value)
+{
+    return make_hipDoubleComplex(value, 0);
+}
+
+template <typename T>
+inline bool hipblas_xt_is_zero(const T& value)
+{
+    return value == T(0);
+}
+
+template <>
+inline bool hipblas_xt_is_zero(const hipFloatComplex& value)
+{
+    return value.x == 0 && value.y == 0;
+}
+
+template <>
+inline bool hipblas_xt_is_zero(const hipDoubleComplex& value)
+{
+    return value.x == 0 && value.y == 0;
+}
+
+// A host operand of a tiled product, used as op(data). A symmetric operand only has
+// its uplo triangle stored and is used as is. Problem b of a strided batch starts at
+// data + b * stride.
+template <typename T>
+struct hipblas_xt_operand
+{
+    const T*           data;
+    int64_t            ld;
+    hipblasOperation_t trans     = HIPBLAS_OP_N;
+    bool               symmetric = false;
+    hipblasFillMode_t  uplo      = HIPBLAS_FILL_MODE_FULL;
+    int64_t            stride    = 0;
+
+    hipblas_xt_operand in_batch(int64_t batch) const
+    {
+        hipblas_xt_operand x = *this;
+        x.data += batch * stride;
+        return x;
+    }
+};
+
+// Uploads the rows x cols block at (row, col) of an operand to dst. ld and op are
+// set to the leading dimension of the uploaded block and the operation to apply to
+// it. A diagonal block of a symmetric operand is made full in host before it is
+// uploaded, which needs rows * cols values of host memory.
+template <typename T>
+hipblasStatus_t hipblas_xt_load(hipblas_xt_device<T>&        device,
+                                int                          slot,
+                                const hipblas_xt_operand<T>& x,
+                                int64_t                      row,
+                                int64_t                      col,
+                                int64_t                      rows,
+                                int64_t                      cols,
+                                T*                           dst,
+                                T*                           host,
+                                int64_t&                     ld,
+                                hipblasOperation_t&          op)
+{
+    if(x.symmetric && row == col)
+    {
+        bool lower = x.uplo == HIPBLAS_FILL_MODE_LOWER;
+        for(int64_t j = 0; j < cols; j++)
+            for(int64_t i = 0; i < rows; i++)
+            {
+                bool stored        = lower ? i >= j : i <= j;
+                host[i + j * rows] = stored ? x.data[(row + i) + (col + j) * x.ld]
+                                            : x.data[(col + j) + (row + i) * x.ld];
+            }
+        ld = rows;
+        op = HIPBLAS_OP_N;
+        return device.upload(slot, dst, ld, host, rows, rows, cols);
+    }
+
+    bool direct = x.symmetric ? (x.uplo == HIPBLAS_FILL_MODE_LOWER) == (row > col)
+                              : x.trans == HIPBLAS_OP_N;
+    if(direct)
+    {
+        ld = rows;
+        op = HIPBLAS_OP_N;
+        return device.upload(slot, dst, ld, x.data + row + col * x.ld, x.ld, rows, cols);
+    }
+
+    ld = cols;
+    op = x.symmetric ? HIPBLAS_OP_T : x.trans;
+    return device.upload(slot, dst, ld, x.data + col + row * x.ld, x.ld, cols, rows);
+}
+
+// Task of gemm, syrk and symm: the tile of C = alpha * op(A) * op(B) + beta * C,
+// accumulated over blocks of k. When triangle is set the diagonal tiles are square
+// and only their uplo triangle is written back, through host memory.
+template <typename T>
+struct hipblas_xt_product
+{
+    hipblas_xt_operand<T> a;
+    hipblas_xt_operand<T> b;
+    int64_t               k;
+    T                     alpha;
+    T                     beta;
+    T*                    C;
+    int64_t               ldc;
+    int64_t               nb;
+    bool                  triangle = false;
+    hipblasFillMode_t     uplo     = HIPBLAS_FILL_MODE_FULL;
+    int64_t               stride_c = 0;
+
+    size_t device_elements() const
+    {
+        return 3 * size_t(nb) * nb;
+    }
+
+    size_t host_elements() const
+    {
+        return size_t(nb) * nb;
+    }
+
+    hipblasStatus_t operator()(hipblas_xt_device<T>&  device,
+                               int                    slot,
+                               const hipblas_xt_task& tile,
+                               T*                     host,
+                               std::function<void()>& finish) const
+    {
+        T* dC = device.memory(slot);
+        T* dA = dC + nb * nb;
+        T* dB = dA + nb * nb;
+        T* hC = C + tile.batch * stride_c + tile.row + tile.col * ldc;
+
+        hipblas_xt_operand<T> a_b = a.in_batch(tile.batch);
+        hipblas_xt_operand<T> b_b = b.in_batch(tile.batch);
+
+        hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+        if(!hipblas_xt_is_zero(beta))
+            status = device.upload(slot, dC, tile.rows, hC, ldc, tile.rows, tile.cols);
+
+        // With k == 0 a single gemm scales C by beta
+        for(int64_t k0 = 0; status == HIPBLAS_STATUS_SUCCESS && (k0 < k || k0 == 0); k0 += nb)
+        {
+            int64_t            kk   = std::min(nb, k - k0);
+            int64_t            ld_a = tile.rows;
+            int64_t            ld_b = 1;
+            hipblasOperation_t op_a = HIPBLAS_OP_N;
+            hipblasOperation_t op_b = HIPBLAS_OP_N;
+            if(kk > 0)
+            {
+                status = hipblas_xt_load(
+                    device, slot, a_b, tile.row, k0, tile.rows, kk, dA, host, ld_a, op_a);
+                if(status == HIPBLAS_STATUS_SUCCESS)
+                    status = hipblas_xt_load(
+                        device, slot, b_b, k0, tile.col, kk, tile.cols, dB, host, ld_b, op_b);
+            }
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = device.gemm(slot,
+                                     op_a,
+                                     op_b,
+                                     tile.rows,
+                                     tile.cols,
+                                     kk,
+                                     alpha,
+                                     dA,
+                                     ld_a,
+                                     dB,
+                                     ld_b,
+                                     k0 == 0 ? beta : hipblas_xt_real<T>(1),
+                                     dC,
+                                     tile.rows);
+        }
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        if(!triangle || tile.row != tile.col)
+            return device.download(slot, hC, ldc, dC, tile.rows, tile.rows, tile.cols);
+
+        status = device.download(slot, host, tile.rows, dC, tile.rows, tile.rows, tile.cols);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+        {
+            int64_t n     = tile.rows;
+            int64_t ld    = ldc;
+            bool    lower = uplo == HIPBLAS_FILL_MODE_LOWER;
+            finish        = [=]() {
+                for(int64_t j = 0; j < n; j++)
+                {
+                    int64_t first = lower ? j : 0;
+                    int64_t last  = lower ? n : j + 1;
+                    std::copy(host + first + j * n, host + last + j * n, hC + first + j * ld);
+                }
+            };
+        }
+        return status;
+    }
+};
+
+// Largest tile size for which both slots of a hipblas_xt_product of m x n x k
+// fit in budget bytes, rounded down to a multiple of 64 when it is at least 64 and
+// no larger than the problem. Returns 0 when not even 1 x 1 tiles fit.
+inline int64_t
+    hipblas_xt_product_block(size_t budget, size_t elem_size, int64_t m, int64_t n, int64_t k)
+{
+    int64_t nb = int64_t(std::sqrt(double(budget / (2 * 3 * elem_size))));
+    while(nb > 0 && 2 * 3 * size_t(nb) * nb * elem_size > budget)
+        nb--;
+    if(nb >= 64)
+        nb -= nb % 64;
+    return std::min(nb, std::max<int64_t>({1, m, n, k}));
+}
+
+// Task of trsm: a panel of whole columns of B (left side) or whole rows (right
+// side), solved one block of nb at a time. The panel stays on the device; the
+// blocks of op(A) needed to update it are streamed through one nb x nb buffer.
+template <typename T>
+struct hipblas_xt_trsm_panel
+{
+    hipblasSideMode_t  side;
+    hipblasFillMode_t  uplo;
+    hipblasOperation_t trans;
+    hipblasDiagType_t  diag;
+    int64_t            m;
+    int64_t            n;
+    T                  alpha;
+    const T*           A;
+    int64_t            lda;
+    T*                 B;
+    int64_t            ldb;
+    int64_t            nb;
+
+    size_t device_elements() const
+    {
+        return size_t(side == HIPBLAS_SIDE_LEFT ? m : n) * nb + size_t(nb) * nb;
+    }
+
+    size_t host_elements() const
+    {
+        return 0;
+    }
+
+    hipblasStatus_t operator()(hipblas_xt_device<T>&  device,
+                               int                    slot,
+                               const hipblas_xt_task& panel,
+                               T*                     host,
+                               std::function<void()>&) const
+    {
+        bool    left   = side == HIPBLAS_SIDE_LEFT;
+        int64_t len    = left ? m : n;
+        int64_t blocks = (len + nb - 1) / nb;
+        T*      dP     = device.memory(slot);
+        T*      dA     = dP + len * nb;
+        T*      hP     = B + panel.row + panel.col * ldb;
+
+        // The solve runs from the first block when op(A) is lower triangular on the
+        // left or upper triangular on the right, and from the last one otherwise
+        bool lower   = (uplo == HIPBLAS_FILL_MODE_LOWER) == (trans == HIPBLAS_OP_N);
+        bool forward = left == lower;
+
+        hipblas_xt_operand<T> op_A{A, lda, trans};
+        hipblasStatus_t       status
+            = device.upload(slot, dP, panel.rows, hP, ldb, panel.rows, panel.cols);
+        for(int64_t s = 0; s < blocks && status == HIPBLAS_STATUS_SUCCESS; s++)
+        {
+            int64_t i  = forward ? s : blocks - 1 - s;
+            int64_t i0 = i * nb;
+            int64_t ni = std::min(nb, len - i0);
+            T*      Xi = left ? dP + i0 : dP + i0 * panel.rows;
+
+            // Subtract the contribution of the blocks already solved; the first
+            // update also applies alpha
+            bool first = true;
+            for(int64_t t = 0; t < s && status == HIPBLAS_STATUS_SUCCESS; t++)
+            {
+                int64_t            j  = forward ? t : blocks - 1 - t;
+                int64_t            j0 = j * nb;
+                int64_t            nj = std::min(nb, len - j0);
+                int64_t            ld;
+                hipblasOperation_t op;
+                T                  beta = first ? alpha : hipblas_xt_real<T>(1);
+                first                   = false;
+
+                if(left)
+                {
+                    status = hipblas_xt_load(device, slot, op_A, i0, j0, ni, nj, dA, host, ld, op);
+                    if(status == HIPBLAS_STATUS_SUCCESS)
+                        status = device.gemm(slot,
+                                             op,
+                                             HIPBLAS_OP_N,
+                                             ni,
+                                             panel.cols,
+                                             nj,
+                                             hipblas_xt_real<T>(-1),
+                                             dA,
+                                             ld,
+                                             dP + j0,
+                                             panel.rows,
+                                             beta,
+                                             Xi,
+                                             panel.rows);
+                }
+                else
+                {
+                    status = hipblas_xt_load(device, slot, op_A, j0, i0, nj, ni, dA, host, ld, op);
+                    if(status == HIPBLAS_STATUS_SUCCESS)
+                        status = device.gemm(slot,
+                                             HIPBLAS_OP_N,
+                                             op,
+                                             panel.rows,
+                                             ni,
+                                             nj,
+                                             hipblas_xt_real<T>(-1),
+                                             dP + j0 * panel.rows,
+                                             panel.rows,
+                                             dA,
+                                             ld,
+                                             beta,
+                                             Xi,
+                                             panel.rows);
+                }
+            }
+
+            // The diagonal block is uploaded as stored; trsm applies uplo and trans
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = device.upload(slot, dA, ni, A + i0 + i0 * lda, lda, ni, ni);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = device.trsm(slot,
+                                     side,
+                                     uplo,
+                                     trans,
+                                     diag,
+                                     left ? ni : panel.rows,
+                                     left ? panel.cols : ni,
+                                     first ? alpha : hipblas_xt_real<T>(1),
+                                     dA,
+                                     ni,
+                                     Xi,
+                                     panel.rows);
+        }
+
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = device.download(slot, hP, ldb, dP, panel.rows, panel.rows, panel.cols);
+        return status;
+    }
+};
+
+// Called with the number of tasks done and the number of tasks, each time a task has
+// written its output back to host memory
+using hipblas_xt_progress = std::function<void(int64_t done, int64_t total)>;
+
+// Runs tasks over devices, one host thread per device. Task t of a device uses slot
+// t % 2; before a slot is reused its earlier work is waited for and the finish step
+// that task left, if any, is run. Progress calls are made one at a time, from the
+// thread of the device that finished the task.
+template <typename T, typename Task>
+hipblasStatus_t hipblas_xt_run(const std::vector<hipblas_xt_device<T>*>& devices,
+                               const std::vector<hipblas_xt_task>&       tasks,
+                               const Task&                               task,
+                               const hipblas_xt_progress&                progress = nullptr)
+{
+    int                          count = int(devices.size());
+    hipblas_xt_scheduler         scheduler(tasks, count);
+    std::atomic<bool>            failed{false};
+    std::vector<hipblasStatus_t> statuses(count, HIPBLAS_STATUS_SUCCESS);
+    std::mutex                   progress_mutex;
+    int64_t                      done = 0;
+
+    auto work = [&](int d) {
+        hipblas_xt_device<T>& device = *devices[d];
+        std::vector<T>        host[2];
+        std::function<void()> finish[2];
+        bool                  busy[2] = {};
+
+        auto retire = [&](int slot) {
+            hipblasStatus_t status = device.synchronize(slot);
+            if(status == HIPBLAS_STATUS_SUCCESS && finish[slot])
+                finish[slot]();
+            finish[slot] = nullptr;
+            if(status == HIPBLAS_STATUS_SUCCESS && busy[slot] && progress)
+            {
+                std::lock_guard<std::mutex> lock(progress_mutex);
+                progress(++done, int64_t(tasks.size()));
+            }
+            busy[slot] = false;
+            return status;
+        };
+
+        hipblasStatus_t status;
+        try
+        {
+            status = device.prepare(task.device_elements());
+            if(status == HIPBLAS_STATUS_SUCCESS)
+            {
+                for(int slot = 0; slot < 2; slot++)
+                    host[slot].resize(task.host_elements());
+
+                hipblas_xt_task next;
+                int             slot = 0;
+                while(status == HIPBLAS_STATUS_SUCCESS && !failed && scheduler.next(d, next))
+                {
+                    status = retire(slot);
+                    if(status == HIPBLAS_STATUS_SUCCESS)
+                        status = task(device, slot, next, host[slot].data(), finish[slot]);
+                    busy[slot] = true;
+                    slot ^= 1;
+                }
+                for(slot = 0; slot < 2; slot++)
+                {
+                    hipblasStatus_t retired = retire(slot);
+                    if(status == HIPBLAS_STATUS_SUCCESS)
+                        status = retired;
+                }
+            }
+        }
+        catch(...)
+        {
+            status = hipblas_exception_to_status();
+        }
+
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            failed = true;
+        statuses[d] = status;
+    };
+
+    std::vector<std::thread> threads;
+    for(int d = 0; d < count; d++)
+        threads.emplace_back(work, d);
+    for(auto& thread : threads)
+        thread.join();
+
+    for(hipblasStatus_t status : statuses)
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+inline bool hipblas_xt_valid(hipblasOperation_t trans)
+{
+    return trans == HIPBLAS_OP_N || trans == HIPBLAS_OP_T || trans == HIPBLAS_OP_C;
+}
+
+inline bool hipblas_xt_valid(hipblasFillMode_t uplo)
+{
+    return uplo == HIPBLAS_FILL_MODE_LOWER || uplo == HIPBLAS_FILL_MODE_UPPER;
+}
+
+inline bool hipblas_xt_valid(hipblasSideMode_t side)
+{
+    return side == HIPBLAS_SIDE_LEFT || side == HIPBLAS_SIDE_RIGHT;
+}
+
+inline bool hipblas_xt_valid(hipblasDiagType_t diag)
+{
+    return diag == HIPBLAS_DIAG_NON_UNIT || diag == HIPBLAS_DIAG_UNIT;
+}
+
+// C_b = alpha * op(A_b) * op(B_b) + beta * C_b for the batch_count problems of a
+// strided batch. The tiles of every problem are scheduled together.
+template <typename T>
+hipblasStatus_t
+    hipblas_xt_gemm_strided_batched(const std::vector<hipblas_xt_device<T>*>& devices,
+                                    int64_t                                   nb,
+                                    hipblasOperation_t                        trans_a,
+                                    hipblasOperation_t                        trans_b,
+                                    int64_t                                   m,
+                                    int64_t                                   n,
+                                    int64_t                                   k,
+                                    const T*                                  alpha,
+                                    const T*                                  A,
+                                    int64_t                                   lda,
+                                    int64_t                                   stride_a,
+                                    const T*                                  B,
+                                    int64_t                                   ldb,
+                                    int64_t                                   stride_b,
+                                    const T*                                  beta,
+                                    T*                                        C,
+                                    int64_t                                   ldc,
+                                    int64_t                                   stride_c,
+                                    int64_t                                   batch_count,
+                                    const hipblas_xt_progress&                progress = nullptr)
+{
+    if(!hipblas_xt_valid(trans_a) || !hipblas_xt_valid(trans_b))
+        return HIPBLAS_STATUS_INVALID_ENUM;
+    if(m < 0 || n < 0 || k < 0 || lda < std::max<int64_t>(1, trans_a == HIPBLAS_OP_N ? m : k)
+       || ldb < std::max<int64_t>(1, trans_b == HIPBLAS_OP_N ? k : n)
+       || ldc < std::max<int64_t>(1, m) || batch_count < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!m || !n || !batch_count)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!alpha || !beta)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(nb <= 0)
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+
+    if(hipblas_xt_is_zero(*alpha))
+        k = 0;
+    if(!C || (k && (!A || !B)))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblas_xt_operand<T> a{A, lda, trans_a};
+    hipblas_xt_operand<T> b{B, ldb, trans_b};
+    a.stride = stride_a;
+    b.stride = stride_b;
+
+    hipblas_xt_product<T> task{a, b, k, *alpha, *beta, C, ldc, nb};
+    task.stride_c = stride_c;
+
+    std::vector<hipblas_xt_task> tiles = hipblas_xt_tiles(m, n, nb, HIPBLAS_FILL_MODE_FULL);
+    std::vector<hipblas_xt_task> tasks;
+    tasks.reserve(tiles.size() * batch_count);
+    for(int64_t batch = 0; batch < batch_count; batch++)
+        for(hipblas_xt_task tile : tiles)
+        {
+            tile.batch = batch;
+            tasks.push_back(tile);
+        }
+    return hipblas_xt_run(devices, tasks, task, progress);
+}
+
+// C = alpha * op(A) * op(B) + beta * C
+template <typename T>
+hipblasStatus_t hipblas_xt_gemm(const std::vector<hipblas_xt_device<T>*>& devices,
+                                int64_t                                   nb,
+                                hipblasOperation_t                        trans_a,
+                                hipblasOperation_t                        trans_b,
+                                int64_t                                   m,
+                                int64_t                                   n,
+                                int64_t                                   k,
+                                const T*                                  alpha,
+                                const T*                                  A,
+                                int64_t                                   lda,
+                                const T*                                  B,
+                                int64_t                                   ldb,
+                                const T*                                  beta,
+                                T*                                        C,
+                                int64_t                                   ldc)
+{
+    return hipblas_xt_gemm_strided_batched(
+        devices, nb, trans_a, trans_b, m, n, k, alpha, A, lda, 0, B, ldb, 0, beta, C, ldc, 0, 1);
+}
+
+// The uplo triangle of C = alpha * op(A) * op(A)^T + beta * C. Only the tiles that
+// meet the triangle are computed.
+template <typename T>
+hipblasStatus_t hipblas_xt_syrk(const std::vector<hipblas_xt_device<T>*>& devices,
+                                int64_t                                   nb,
+                                hipblasFillMode_t                         uplo,
+                                hipblasOperation_t                        trans,
+                                int64_t                                   n,
+                                int64_t                                   k,
+                                const T*                                  alpha,
+                                const T*                                  A,
+                                int64_t                                   lda,
+                                const T*                                  beta,
+                                T*                                        C,
+                                int64_t                                   ldc)
+{
+    if(!hipblas_xt_valid(uplo) || !hipblas_xt_valid(trans))
+        return HIPBLAS_STATUS_INVALID_ENUM;
+    if(trans == HIPBLAS_OP_C && hipblas_xt_is_complex<T>)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(n < 0 || k < 0 || lda < std::max<int64_t>(1, trans == HIPBLAS_OP_N ? n : k)
+       || ldc < std::max<int64_t>(1, n))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!n)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!alpha || !beta)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    if(hipblas_xt_is_zero(*alpha))
+        k = 0;
+    if(!C || (k && !A))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    // op(A)^T is op'(A) with the other operation
+    hipblasOperation_t op   = trans == HIPBLAS_OP_N ? HIPBLAS_OP_N : HIPBLAS_OP_T;
+    hipblasOperation_t op_t = trans == HIPBLAS_OP_N ? HIPBLAS_OP_T : HIPBLAS_OP_N;
+
+    hipblas_xt_product<T> task{{A, lda, op}, {A, lda, op_t}, k, *alpha, *beta, C, ldc, nb};
+    task.triangle = true;
+    task.uplo     = uplo;
+    return hipblas_xt_run(devices, hipblas_xt_tiles(n, n, nb, uplo), task);
+}
+
+// C = alpha * A * B + beta * C (left side) or C = alpha * B * A + beta * C (right
+// side), where only the uplo triangle of the symmetric matrix A is stored
+template <typename T>
+hipblasStatus_t hipblas_xt_symm(const std::vector<hipblas_xt_device<T>*>& devices,
+                                int64_t                                   nb,
+                                hipblasSideMode_t                         side,
+                                hipblasFillMode_t                         uplo,
+                                int64_t                                   m,
+                                int64_t                                   n,
+                                const T*                                  alpha,
+                                const T*                                  A,
+                                int64_t                                   lda,
+                                const T*                                  B,
+                                int64_t                                   ldb,
+                                const T*                                  beta,
+                                T*                                        C,
+                                int64_t                                   ldc)
+{
+    if(!hipblas_xt_valid(side) || !hipblas_xt_valid(uplo))
+        return HIPBLAS_STATUS_INVALID_ENUM;
+
+    bool    left = side == HIPBLAS_SIDE_LEFT;
+    int64_t k    = left ? m : n;
+    if(m < 0 || n < 0 || lda < std::max<int64_t>(1, k) || ldb < std::max<int64_t>(1, m)
+       || ldc < std::max<int64_t>(1, m))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!m || !n)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!alpha || !beta)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    if(hipblas_xt_is_zero(*alpha))
+        k = 0;
+    if(!C || (k && (!A || !B)))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblas_xt_operand<T> sym{A, lda, HIPBLAS_OP_N, true, uplo};
+    hipblas_xt_operand<T> gen{B, ldb, HIPBLAS_OP_N};
+
+    hipblas_xt_product<T> task{left ? sym : gen, left ? gen : sym, k, *alpha, *beta, C, ldc, nb};
+    return hipblas_xt_run(devices, hipblas_xt_tiles(m, n, nb, HIPBLAS_FILL_MODE_FULL), task);
+}
+
+// Solves op(A) * X = alpha * B (left side) or X * op(A) = alpha * B (right side),
+// overwriting B with X. Panels of whole columns (left) or rows (right) of B are
+// independent and are scheduled over the devices.
+template <typename T>
+hipblasStatus_t hipblas_xt_trsm(const std::vector<hipblas_xt_device<T>*>& devices,
+                                int64_t                                   nb,
+                                hipblasSideMode_t                         side,
+                                hipblasFillMode_t                         uplo,
+                                hipblasOperation_t                        trans,
+                                hipblasDiagType_t                         diag,
+                                int64_t                                   m,
+                                int64_t                                   n,
+                                const T*                                  alpha,
+                                const T*                                  A,
+                                int64_t                                   lda,
+                                T*                                        B,
+                                int64_t                                   ldb)
+{
+    if(!hipblas_xt_valid(side) || !hipblas_xt_valid(uplo) || !hipblas_xt_valid(trans)
+       || !hipblas_xt_valid(diag))
+        return HIPBLAS_STATUS_INVALID_ENUM;
+
+    bool left = side == HIPBLAS_SIDE_LEFT;
+    if(m < 0 || n < 0 || lda < std::max<int64_t>(1, left ? m : n)
+       || ldb < std::max<int64_t>(1, m))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!m || !n)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!alpha || !A || !B)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    std::vector<hipblas_xt_task> panels;
+    if(left)
+        for(int64_t col = 0; col < n; col += nb)
+            panels.push_back({0, col, m, std::min(nb, n - col)});
+    else
+        for(int64_t row = 0; row < m; row += nb)
+            panels.push_back({row, 0, std::min(nb, m - row), n});
+
+    hipblas_xt_trsm_panel<T> task{side, uplo, trans, diag, m, n, *alpha, A, lda, B, ldb, nb};
+    return hipblas_xt_run(devices, panels, task);
+}
@@ -0,0 +1,1790 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+// potrf, potrs and potri for the cuBLAS backend. cuBLAS has no Cholesky routines, so
+// the drivers in cholesky.hpp factor the diagonal blocks on the host and do the rest
+// of the work with trsm and syrk or herk on the stream of the handle.
+
+#include "cholesky.hpp"
+#include "device_scratch.hpp"
+#include "exceptions.hpp"
+#include "stream_pool.hpp"
+#include "trace.hpp"
+#include <hip/hip_runtime.h>
+#include <initializer_list>
+
+#ifdef __HIP_PLATFORM_SOLVER__
+
+static hipblasStatus_t hipblasCholeskyTrsm(hipblasHandle_t    handle,
+                                           hipblasSideMode_t  side,
+                                           hipblasFillMode_t  uplo,
+                                           hipblasOperation_t trans,
+                                           int                m,
+                                           int                n,
+                                           const float*       A,
+                                           int                lda,
+                                           float*             B,
+                                           int                ldb)
+{
+    const float one = 1;
+    return hipblasStrsm(
+        handle, side, uplo, trans, HIPBLAS_DIAG_NON_UNIT, m, n, &one, A, lda, B, ldb);
+}
+
+static hipblasStatus_t hipblasCholeskyTrsm(hipblasHandle_t    handle,
+                                           hipblasSideMode_t  side,
+                                           hipblasFillMode_t  uplo,
+                                           hipblasOperation_t trans,
+                                           int                m,
+                                           int                n,
+                                           const double*      A,
+                                           int                lda,
+                                           double*            B,
+                                           int                ldb)
+{
+    const double one = 1;
+    return hipblasDtrsm(
+        handle, side, uplo, trans, HIPBLAS_DIAG_NON_UNIT, m, n, &one, A, lda, B, ldb);
+}
+
+static hipblasStatus_t hipblasCholeskyTrsm(hipblasHandle_t    handle,
+                                           hipblasSideMode_t  side,
+                                           hipblasFillMode_t  uplo,
+                                           hipblasOperation_t trans,
+                                           int                m,
+                                           int                n,
+                                           const hipComplex*  A,
+                                           int                lda,
+                                           hipComplex*        B,
+                                           int                ldb)
+{
+    const hipComplex one = make_hipFloatComplex(1, 0);
+    return hipblasCtrsm_v2(
+        handle, side, uplo, trans, HIPBLAS_DIAG_NON_UNIT, m, n, &one, A, lda, B, ldb);
+}
+
+static hipblasStatus_t hipblasCholeskyTrsm(hipblasHandle_t         handle,
+                                           hipblasSideMode_t       side,
+                                           hipblasFillMode_t       uplo,
+                                           hipblasOperation_t      trans,
+                                           int                     m,
+                                           int                     n,
+                                           const hipDoubleComplex* A,
+                                           int                     lda,
+                                           hipDoubleComplex*       B,
+                                           int                     ldb)
+{
+    const hipDoubleComplex one = make_hipDoubleComplex(1, 0);
+    return hipblasZtrsm_v2(
+        handle, side, uplo, trans, HIPBLAS_DIAG_NON_UNIT, m, n, &one, A, lda, B, ldb);
+}
+
+static hipblasStatus_t hipblasCholeskyHerk(hipblasHandle_t    handle,
+                                           hipblasFillMode_t  uplo,
+                                           hipblasOperation_t trans,
+                                           int                n,
+                                           int                k,
+                                           float              alpha,
+                                           const float*       A,
+                                           int                lda,
+                                           float              beta,
+                                           float*             C,
+                                           int                ldc)
+{
+    return hipblasSsyrk(handle, uplo, trans, n, k, &alpha, A, lda, &beta, C, ldc);
+}
+
+static hipblasStatus_t hipblasCholeskyHerk(hipblasHandle_t    handle,
+                                           hipblasFillMode_t  uplo,
+                                           hipblasOperation_t trans,
+                                           int                n,
+                                           int                k,
+                                           double             alpha,
+                                           const double*      A,
+                                           int                lda,
+                                           double             beta,
+                                           double*            C,
+                                           int                ldc)
+{
+    return hipblasDsyrk(handle, uplo, trans, n, k, &alpha, A, lda, &beta, C, ldc);
+}
+
+static hipblasStatus_t hipblasCholeskyHerk(hipblasHandle_t    handle,
+                                           hipblasFillMode_t  uplo,
+                                           hipblasOperation_t trans,
+                                           int                n,
+                                           int                k,
+                                           float              alpha,
+                                           const hipComplex*  A,
+                                           int                lda,
+                                           float              beta,
+                                           hipComplex*        C,
+                                           int                ldc)
+{
+    return hipblasCherk_v2(handle, uplo, trans, n, k, &alpha, A, lda, &beta, C, ldc);
+}
+
+static hipblasStatus_t hipblasCholeskyHerk(hipblasHandle_t         handle,
+                                           hipblasFillMode_t       uplo,
+                                           hipblasOperation_t      trans,
+                                           int                     n,
+                                           int                     k,
+                                           double                  alpha,
+                                           const hipDoubleComplex* A,
+                                           int                     lda,
+                                           double                  beta,
+                                           hipDoubleComplex*       C,
+                                           int                     ldc)
+{
+    return hipblasZherk_v2(handle, uplo, trans, n, k, &alpha, A, lda, &beta, C, ldc);
+}
+
+// hipblas_cholesky_device on the stream of a handle in host pointer mode. The potri
+// workspace is kept for the problems of a batch and freed with the device.
+template <typename T>
+class hipblas_cholesky_gpu : public hipblas_cholesky_device<T>
+{
+public:
+    using real = typename hipblas_cholesky_device<T>::real;
+
+    hipblas_cholesky_gpu(hipblasHandle_t handle, hipStream_t stream)
+        : m_handle(handle)
+        , m_stream(stream)
+        , m_workspace(handle)
+    {
+    }
+
+    hipblas_cholesky_gpu(const hipblas_cholesky_gpu&) = delete;
+    hipblas_cholesky_gpu& operator=(const hipblas_cholesky_gpu&) = delete;
+
+    // Reserves the n x n workspace of potri
+    hipblasStatus_t prepare(int n)
+    {
+        return m_workspace.reserve(size_t(n) * n * sizeof(T));
+    }
+
+    T* workspace()
+    {
+        return (T*)m_workspace.data();
+    }
+
+    // Uploads wait as well, as the host blocks are reused as soon as they return
+    hipblasStatus_t
+        upload(T* dst, int ld_dst, const T* src, int ld_src, int rows, int cols) override
+    {
+        hipblasStatus_t status
+            = copy2d(dst, ld_dst, src, ld_src, rows, cols, hipMemcpyHostToDevice);
+        return status == HIPBLAS_STATUS_SUCCESS ? synchronize() : status;
+    }
+
+    hipblasStatus_t
+        download(T* dst, int ld_dst, const T* src, int ld_src, int rows, int cols) override
+    {
+        hipblasStatus_t status
+            = copy2d(dst, ld_dst, src, ld_src, rows, cols, hipMemcpyDeviceToHost);
+        return status == HIPBLAS_STATUS_SUCCESS ? synchronize() : status;
+    }
+
+    hipblasStatus_t zero(T* dst, int ld_dst, int rows, int cols) override
+    {
+        if(!rows || !cols)
+            return HIPBLAS_STATUS_SUCCESS;
+        return hipblas_hip_to_status(hipMemset2DAsync(dst,
+                                                      size_t(ld_dst) * sizeof(T),
+                                                      0,
+                                                      size_t(rows) * sizeof(T),
+                                                      cols,
+                                                      m_stream));
+    }
+
+    hipblasStatus_t trsm(hipblasSideMode_t  side,
+                         hipblasFillMode_t  uplo,
+                         hipblasOperation_t trans,
+                         int                m,
+                         int                n,
+                         const T*           A,
+                         int                lda,
+                         T*                 B,
+                         int                ldb) override
+    {
+        return hipblasCholeskyTrsm(m_handle, side, uplo, trans, m, n, A, lda, B, ldb);
+    }
+
+    hipblasStatus_t herk(hipblasFillMode_t  uplo,
+                         hipblasOperation_t trans,
+                         int                n,
+                         int                k,
+                         real               alpha,
+                         const T*           A,
+                         int                lda,
+                         real               beta,
+                         T*                 C,
+                         int                ldc) override
+    {
+        return hipblasCholeskyHerk(m_handle, uplo, trans, n, k, alpha, A, lda, beta, C, ldc);
+    }
+
+private:
+    hipblasStatus_t copy2d(
+        T* dst, int ld_dst, const T* src, int ld_src, int rows, int cols, hipMemcpyKind kind)
+    {
+        if(!rows || !cols)
+            return HIPBLAS_STATUS_SUCCESS;
+        return hipblas_hip_to_status(hipMemcpy2DAsync(dst,
+                                                      size_t(ld_dst) * sizeof(T),
+                                                      src,
+                                                      size_t(ld_src) * sizeof(T),
+                                                      size_t(rows) * sizeof(T),
+                                                      cols,
+                                                      kind,
+                                                      m_stream));
+    }
+
+    hipblasStatus_t synchronize()
+    {
+        return hipblas_hip_to_status(hipStreamSynchronize(m_stream));
+    }
+
+    hipblasHandle_t        m_handle;
+    hipStream_t            m_stream;
+    hipblas_device_scratch m_workspace;
+};
+
+enum class hipblasCholeskyRoutine
+{
+    potrf,
+    potrs,
+    potri
+};
+
+// Pointers of problem b of a potrf, potrs or potri call
+template <typename T>
+struct hipblasCholeskyProblem
+{
+    T* A;
+    T* B;
+};
+
+// Returns -i for the first argument i, counted after the handle, whose check fails, or 0
+static int hipblasCholeskyInfo(std::initializer_list<bool> invalid)
+{
+    int position = 1;
+    for(bool bad : invalid)
+    {
+        if(bad)
+            return -position;
+        position++;
+    }
+    return 0;
+}
+
+static bool hipblasCholeskyValid(hipblasFillMode_t uplo, int n, bool A, int lda, bool info)
+{
+    return (uplo == HIPBLAS_FILL_MODE_UPPER || uplo == HIPBLAS_FILL_MODE_LOWER) && n >= 0
+           && (A || !n) && lda >= std::max(1, n) && info;
+}
+
+// Runs routine on the batch_count problems given by problem(b) one after the other,
+// with the handle in host pointer mode for the trsm and herk scalars, and writes the
+// infos of potrf and potri to deviceInfo
+template <typename T, typename Problem>
+static hipblasStatus_t hipblasCholeskyRun(hipblasHandle_t        handle,
+                                          hipblasCholeskyRoutine routine,
+                                          hipblasFillMode_t      uplo,
+                                          int                    n,
+                                          int                    nrhs,
+                                          int                    lda,
+                                          int                    ldb,
+                                          int*                   deviceInfo,
+                                          int                    batch_count,
+                                          Problem&&              problem)
+{
+    hipStream_t          stream;
+    hipblasPointerMode_t mode;
+    hipblasStatus_t      status = hipblasGetStream(handle, &stream);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasGetPointerMode(handle, &mode);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    hipblas_cholesky_gpu<T> device(handle, stream);
+    std::vector<int>        infos(batch_count, 0);
+    if(routine == hipblasCholeskyRoutine::potri && batch_count > 0)
+        status = device.prepare(n);
+    for(int b = 0; b < batch_count && status == HIPBLAS_STATUS_SUCCESS; b++)
+    {
+        hipblasCholeskyProblem<T> p = problem(b);
+        switch(routine)
+        {
+        case hipblasCholeskyRoutine::potrf:
+            status = hipblas_potrf_blocked(device, uplo, n, p.A, lda, infos[b]);
+            break;
+        case hipblasCholeskyRoutine::potrs:
+            status = hipblas_potrs_blocked(device, uplo, n, nrhs, p.A, lda, p.B, ldb);
+            break;
+        case hipblasCholeskyRoutine::potri:
+            status = hipblas_potri_blocked(
+                device, uplo, n, p.A, lda, device.workspace(), infos[b]);
+            break;
+        }
+    }
+    if(status == HIPBLAS_STATUS_SUCCESS && deviceInfo && batch_count > 0)
+        status = hipblas_handle_memcpy(
+            handle, deviceInfo, infos.data(), sizeof(int) * batch_count, hipMemcpyHostToDevice);
+
+    hipblasStatus_t restored = hipblasSetPointerMode(handle, mode);
+    return status == HIPBLAS_STATUS_SUCCESS ? restored : status;
+}
+
+// potrf or potri of batch_count matrices strideA apart
+template <typename T>
+static hipblasStatus_t hipblasCholeskyFactor(hipblasHandle_t        handle,
+                                             hipblasCholeskyRoutine routine,
+                                             hipblasFillMode_t      uplo,
+                                             int                    n,
+                                             T*                     A,
+                                             int                    lda,
+                                             hipblasStride          strideA,
+                                             int*                   info,
+                                             int                    batch_count)
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    bool valid = batch_count >= 0
+                 && hipblasCholeskyValid(uplo, n, A || !batch_count, lda, info || !batch_count);
+    if(!valid)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblasCholeskyRun<T>(
+        handle, routine, uplo, n, 0, lda, 0, info, batch_count, [&](int b) {
+            return hipblasCholeskyProblem<T>{A + b * strideA, nullptr};
+        });
+}
+
+// potrf or potri of the batch_count matrices of the device array A
+template <typename T>
+static hipblasStatus_t hipblasCholeskyFactor(hipblasHandle_t        handle,
+                                             hipblasCholeskyRoutine routine,
+                                             hipblasFillMode_t      uplo,
+                                             int                    n,
+                                             T* const               A[],
+                                             int                    lda,
+                                             int*                   info,
+                                             int                    batch_count)
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    bool valid = batch_count >= 0
+                 && hipblasCholeskyValid(uplo, n, A || !batch_count, lda, info || !batch_count);
+    if(!valid)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblas_batch_pointers<T> A_ptrs(handle, A, batch_count);
+    return hipblasCholeskyRun<T>(
+        handle, routine, uplo, n, 0, lda, 0, info, batch_count, [&](int b) {
+            return hipblasCholeskyProblem<T>{A_ptrs[b], nullptr};
+        });
+}
+
+// potrs of batch_count systems with matrices strideA and right hand sides strideB
+// apart. info is set on the host as by the rocSOLVER backend, counting the strides
+// and the batch count of strided calls.
+template <typename T>
+static hipblasStatus_t hipblasCholeskySolve(hipblasHandle_t   handle,
+                                            hipblasFillMode_t uplo,
+                                            int               n,
+                                            int               nrhs,
+                                            T*                A,
+                                            int               lda,
+                                            hipblasStride     strideA,
+                                            T*                B,
+                                            int               ldb,
+                                            hipblasStride     strideB,
+                                            int*              info,
+                                            int               batch_count,
+                                            bool              strided)
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!info)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    bool bad_uplo = uplo != HIPBLAS_FILL_MODE_UPPER && uplo != HIPBLAS_FILL_MODE_LOWER;
+    if(strided)
+        *info = hipblasCholeskyInfo({bad_uplo,
+                                     n < 0,
+                                     nrhs < 0,
+                                     !A && n && batch_count,
+                                     lda < std::max(1, n),
+                                     false,
+                                     !B && n && nrhs && batch_count,
+                                     ldb < std::max(1, n),
+                                     false,
+                                     false,
+                                     batch_count < 0});
+    else
+        *info = hipblasCholeskyInfo({bad_uplo,
+                                     n < 0,
+                                     nrhs < 0,
+                                     !A && n,
+                                     lda < std::max(1, n),
+                                     !B && n && nrhs,
+                                     ldb < std::max(1, n)});
+    if(*info)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblasCholeskyRun<T>(handle,
+                                 hipblasCholeskyRoutine::potrs,
+                                 uplo,
+                                 n,
+                                 nrhs,
+                                 lda,
+                                 ldb,
+                                 nullptr,
+                                 batch_count,
+                                 [&](int b) {
+                                     return hipblasCholeskyProblem<T>{A + b * strideA,
+                                                                      B + b * strideB};
+                                 });
+}
+
+// potrs of the batch_count systems of the device arrays A and B
+template <typename T>
+static hipblasStatus_t hipblasCholeskySolve(hipblasHandle_t   handle,
+                                            hipblasFillMode_t uplo,
+                                            int               n,
+                                            int               nrhs,
+                                            T* const          A[],
+                                            int               lda,
+                                            T* const          B[],
+                                            int               ldb,
+                                            int*              info,
+                                            int               batch_count)
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!info)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    bool bad_uplo = uplo != HIPBLAS_FILL_MODE_UPPER && uplo != HIPBLAS_FILL_MODE_LOWER;
+
+    *info = hipblasCholeskyInfo({bad_uplo,
+                                 n < 0,
+                                 nrhs < 0,
+                                 !A && n && batch_count,
+                                 lda < std::max(1, n),
+                                 !B && n && nrhs && batch_count,
+                                 ldb < std::max(1, n),
+                                 false,
+                                 batch_count < 0});
+    if(*info)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblas_batch_pointers<T> A_ptrs(handle, A, batch_count);
+    hipblas_batch_pointers<T> B_ptrs(handle, B, batch_count);
+    return hipblasCholeskyRun<T>(handle,
+                                 hipblasCholeskyRoutine::potrs,
+                                 uplo,
+                                 n,
+                                 nrhs,
+                                 lda,
+                                 ldb,
+                                 nullptr,
+                                 batch_count,
+                                 [&](int b) {
+                                     return hipblasCholeskyProblem<T>{A_ptrs[b], B_ptrs[b]};
+                                 });
+}
+
+extern "C" {
+
+// potrf
+hipblasStatus_t hipblasSpotrf(hipblasHandle_t         handle,
+                              const hipblasFillMode_t uplo,
+                              const int               n,
+                              float*                  A,
+                              const int               lda,
+                              int*                    info)
+try
+{
+    HIPBLAS_TRACE("potrf", "f32_r").uplo(uplo).n(n).lda(lda);
+    return hipblasCholeskyFactor(
+        handle, hipblasCholeskyRoutine::potrf, uplo, n, A, lda, 0, info, 1);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDpotrf(hipblasHandle_t         handle,
+                              const hipblasFillMode_t uplo,
+                              const int               n,
+                              double*                 A,
+                              const int               lda,
+                              int*                    info)
+try
+{
+    HIPBLAS_TRACE("potrf", "f64_r").uplo(uplo).n(n).lda(lda);
+    return hipblasCholeskyFactor(
+        handle, hipblasCholeskyRoutine::potrf, uplo, n, A, lda, 0, info, 1);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCpotrf(hipblasHandle_t         handle,
+                              const hipblasFillMode_t uplo,
+                              const int               n,
+                              hipblasComplex*         A,
+                              const int               lda,
+                              int*                    info)
+try
+{
+    HIPBLAS_TRACE("potrf", "f32_c").uplo(uplo).n(n).lda(lda);
+    return hipblasCholeskyFactor(
+        handle, hipblasCholeskyRoutine::potrf, uplo, n, (hipComplex*)A, lda, 0, info, 1);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZpotrf(hipblasHandle_t         handle,
+                              const hipblasFillMode_t uplo,
+                              const int               n,
+                              hipblasDoubleComplex*   A,
+                              const int               lda,
+                              int*                    info)
+try
+{
+    HIPBLAS_TRACE("potrf", "f64_c").uplo(uplo).n(n).lda(lda);
+    return hipblasCholeskyFactor(
+        handle, hipblasCholeskyRoutine::potrf, uplo, n, (hipDoubleComplex*)A, lda, 0, info, 1);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCpotrf_v2(hipblasHandle_t         handle,
+                                 const hipblasFillMode_t uplo,
+                                 const int               n,
+                                 hipComplex*             A,
+                                 const int               lda,
+                                 int*                    info)
+try
+{
+    HIPBLAS_TRACE("potrf", "f32_c").uplo(uplo).n(n).lda(lda);
+    return hipblasCholeskyFactor(
+        handle, hipblasCholeskyRoutine::potrf, uplo, n, A, lda, 0, info, 1);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZpotrf_v2(hipblasHandle_t         handle,
+                                 const hipblasFillMode_t uplo,
+                                 const int               n,
+                                 hipDoubleComplex*       A,
+                                 const int               lda,
+                                 int*                    info)
+try
+{
+    HIPBLAS_TRACE("potrf", "f64_c").uplo(uplo).n(n).lda(lda);
+    return hipblasCholeskyFactor(
+        handle, hipblasCholeskyRoutine::potrf, uplo, n, A, lda, 0, info, 1);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// potrf_batched
+hipblasStatus_t hipblasSpotrfBatched(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     float* const            A[],
+                                     const int               lda,
+                                     int*                    info,
+                                     const int               batchCount)
+try
+{
+    HIPBLAS_TRACE("potrf_batched", "f32_r").uplo(uplo).n(n).lda(lda).batch_count(batchCount);
+    return hipblasCholeskyFactor(
+        handle, hipblasCholeskyRoutine::potrf, uplo, n, A, lda, info, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDpotrfBatched(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     double* const           A[],
+                                     const int               lda,
+                                     int*                    info,
+                                     const int               batchCount)
+try
+{
+    HIPBLAS_TRACE("potrf_batched", "f64_r").uplo(uplo).n(n).lda(lda).batch_count(batchCount);
+    return hipblasCholeskyFactor(
+        handle, hipblasCholeskyRoutine::potrf, uplo, n, A, lda, info, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCpotrfBatched(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     hipblasComplex* const   A[],
+                                     const int               lda,
+                                     int*                    info,
+                                     const int               batchCount)
+try
+{
+    HIPBLAS_TRACE("potrf_batched", "f32_c").uplo(uplo).n(n).lda(lda).batch_count(batchCount);
+    return hipblasCholeskyFactor(handle,
+                                 hipblasCholeskyRoutine::potrf,
+                                 uplo,
+                                 n,
+                                 (hipComplex* const*)A,
+                                 lda,
+                                 info,
+                                 batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZpotrfBatched(hipblasHandle_t             handle,
+                                     const hipblasFillMode_t     uplo,
+                                     const int                   n,
+                                     hipblasDoubleComplex* const A[],
+                                     const int                   lda,
+                                     int*                        info,
+                                     const int                   batchCount)
+try
+{
+    HIPBLAS_TRACE("potrf_batched", "f64_c").uplo(uplo).n(n).lda(lda).batch_count(batchCount);
+    return hipblasCholeskyFactor(handle,
+                                 hipblasCholeskyRoutine::potrf,
+                                 uplo,
+                                 n,
+                                 (hipDoubleComplex* const*)A,
+                                 lda,
+                                 info,
+                                 batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCpotrfBatched_v2(hipblasHandle_t         handle,
+                                        const hipblasFillMode_t uplo,
+                                        const int               n,
+                                        hipComplex* const       A[],
+                                        const int               lda,
+                                        int*                    info,
+                                        const int               batchCount)
+try
+{
+    HIPBLAS_TRACE("potrf_batched", "f32_c").uplo(uplo).n(n).lda(lda).batch_count(batchCount);
+    return hipblasCholeskyFactor(
+        handle, hipblasCholeskyRoutine::potrf, uplo, n, A, lda, info, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZpotrfBatched_v2(hipblasHandle_t         handle,
+                                        const hipblasFillMode_t uplo,
+                                        const int               n,
+                                        hipDoubleComplex* const A[],
+                                        const int               lda,
+                                        int*                    info,
+                                        const int               batchCount)
+try
+{
+    HIPBLAS_TRACE("potrf_batched", "f64_c").uplo(uplo).n(n).lda(lda).batch_count(batchCount);
+    return hipblasCholeskyFactor(
+        handle, hipblasCholeskyRoutine::potrf, uplo, n, A, lda, info, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// potrf_strided_batched
+hipblasStatus_t hipblasSpotrfStridedBatched(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            float*                  A,
+                                            const int               lda,
+                                            const hipblasStride     strideA,
+                                            int*                    info,
+                                            const int               batchCount)
+try
+{
+    HIPBLAS_TRACE("potrf_strided_batched", "f32_r")
+        .uplo(uplo)
+        .n(n)
+        .lda(lda)
+        .stride_a(strideA)
+        .batch_count(batchCount);
+    return hipblasCholeskyFactor(
+        handle, hipblasCholeskyRoutine::potrf, uplo, n, A, lda, strideA, info, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDpotrfStridedBatched(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            double*                 A,
+                                            const int               lda,
+                                            const hipblasStride     strideA,
+                                            int*                    info,
+                                            const int               batchCount)
+try
+{
+    HIPBLAS_TRACE("potrf_strided_batched", "f64_r")
+        .uplo(uplo)
+        .n(n)
+        .lda(lda)
+        .stride_a(strideA)
+        .batch_count(batchCount);
+    return hipblasCholeskyFactor(
+        handle, hipblasCholeskyRoutine::potrf, uplo, n, A, lda, strideA, info, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCpotrfStridedBatched(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            hipblasComplex*         A,
+                                            const int               lda,
+                                            const hipblasStride     strideA,
+                                            int*                    info,
+                                            const int               batchCount)
+try
+{
+    HIPBLAS_TRACE("potrf_strided_batched", "f32_c")
+        .uplo(uplo)
+        .n(n)
+        .lda(lda)
+        .stride_a(strideA)
+        .batch_count(batchCount);
+    return hipblasCholeskyFactor(handle,
+                                 hipblasCholeskyRoutine::potrf,
+                                 uplo,
+                                 n,
+                                 (hipComplex*)A,
+                                 lda,
+                                 strideA,
+                                 info,
+                                 batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZpotrfStridedBatched(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            hipblasDoubleComplex*   A,
+                                            const int               lda,
+                                            const hipblasStride     strideA,
+                                            int*                    info,
+                                            const int               batchCount)
+try
+{
+    HIPBLAS_TRACE("potrf_strided_batched", "f64_c")
+        .uplo(uplo)
+        .n(n)
+        .lda(lda)
+        .stride_a(strideA)
+        .batch_count(batchCount);
+    return hipblasCholeskyFactor(handle,
+                                 hipblasCholeskyRoutine::potrf,
+                                 uplo,
+                                 n,
+                                 (hipDoubleComplex*)A,
+                                 lda,
+                                 strideA,
+                                 info,
+                                 batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCpotrfStridedBatched_v2(hipblasHandle_t         handle,
+                                               const hipblasFillMode_t uplo,
+                                               const int               n,
+                                               hipComplex*             A,
+                                               const int               lda,
+                                               const hipblasStride     strideA,
+                                               int*                    info,
+                                               const int               batchCount)
+try
+{
+    HIPBLAS_TRACE("potrf_strided_batched", "f32_c")
+        .uplo(uplo)
+        .n(n)
+        .lda(lda)
+        .stride_a(strideA)
+        .batch_count(batchCount);
+    return hipblasCholeskyFactor(
+        handle, hipblasCholeskyRoutine::potrf, uplo, n, A, lda, strideA, info, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZpotrfStridedBatched_v2(hipblasHandle_t         handle,
+                                               const hipblasFillMode_t uplo,
+                                               const int               n,
+                                               hipDoubleComplex*       A,
+                                               const int               lda,
+                                               const hipblasStride     strideA,
+                                               int*                    info,
+                                               const int               batchCount)
+try
+{
+    HIPBLAS_TRACE("potrf_strided_batched", "f64_c")
+        .uplo(uplo)
+        .n(n)
+        .lda(lda)
+        .stride_a(strideA)
+        .batch_count(batchCount);
+    return hipblasCholeskyFactor(
+        handle, hipblasCholeskyRoutine::potrf, uplo, n, A, lda, strideA, info, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// potrs
+hipblasStatus_t hipblasSpotrs(hipblasHandle_t         handle,
+                              const hipblasFillMode_t uplo,
+                              const int               n,
+                              const int               nrhs,
+                              float*                  A,
+                              const int               lda,
+                              float*                  B,
+                              const int               ldb,
+                              int*                    info)
+try
+{
+    HIPBLAS_TRACE("potrs", "f32_r").uplo(uplo).n(n).lda(lda).ldb(ldb);
+    return hipblasCholeskySolve(handle, uplo, n, nrhs, A, lda, 0, B, ldb, 0, info, 1, false);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDpotrs(hipblasHandle_t         handle,
+                              const hipblasFillMode_t uplo,
+                              const int               n,
+                              const int               nrhs,
+                              double*                 A,
+                              const int               lda,
+                              double*                 B,
+                              const int               ldb,
+                              int*                    info)
+try
+{
+    HIPBLAS_TRACE("potrs", "f64_r").uplo(uplo).n(n).lda(lda).ldb(ldb);
+    return hipblasCholeskySolve(handle, uplo, n, nrhs, A, lda, 0, B, ldb, 0, info, 1, false);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCpotrs(hipblasHandle_t         handle,
+                              const hipblasFillMode_t uplo,
+                              const int               n,
+                              const int               nrhs,
+                              hipblasComplex*         A,
+                              const int               lda,
+                              hipblasComplex*         B,
+                              const int               ldb,
+                              int*                    info)
+try
+{
+    HIPBLAS_TRACE("potrs", "f32_c").uplo(uplo).n(n).lda(lda).ldb(ldb);
+    return hipblasCholeskySolve(
+        handle, uplo, n, nrhs, (hipComplex*)A, lda, 0, (hipComplex*)B, ldb, 0, info, 1, false);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZpotrs(hipblasHandle_t         handle,
+                              const hipblasFillMode_t uplo,
+                              const int               n,
+                              const int               nrhs,
+                              hipblasDoubleComplex*   A,
+                              const int               lda,
+                              hipblasDoubleComplex*   B,
+                              const int               ldb,
+                              int*                    info)
+try
+{
+    HIPBLAS_TRACE("potrs", "f64_c").uplo(uplo).n(n).lda(lda).ldb(ldb);
+    return hipblasCholeskySolve(handle,
+                                uplo,
+                                n,
+                                nrhs,
+                                (hipDoubleComplex*)A,
+                                lda,
+                                0,
+                                (hipDoubleComplex*)B,
+                                ldb,
+                                0,
+                                info,
+                                1,
+                                false);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCpotrs_v2(hipblasHandle_t         handle,
+                                 const hipblasFillMode_t uplo,
+                                 const int               n,
+                                 const int               nrhs,
+                                 hipComplex*             A,
+                                 const int               lda,
+                                 hipComplex*             B,
+                                 const int               ldb,
+                                 int*                    info)
+try
+{
+    HIPBLAS_TRACE("potrs", "f32_c").uplo(uplo).n(n).lda(lda).ldb(ldb);
+    return hipblasCholeskySolve(handle, uplo, n, nrhs, A, lda, 0, B, ldb, 0, info, 1, false);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZpotrs_v2(hipblasHandle_t         handle,
+                                 const hipblasFillMode_t uplo,
+                                 const int               n,
+                                 const int               nrhs,
+                                 hipDoubleComplex*       A,
+                                 const int               lda,
+                                 hipDoubleComplex*       B,
+                                 const int               ldb,
+                                 int*                    info)
+try
+{
+    HIPBLAS_TRACE("potrs", "f64_c").uplo(uplo).n(n).lda(lda).ldb(ldb);
+    return hipblasCholeskySolve(handle, uplo, n, nrhs, A, lda, 0, B, ldb, 0, info, 1, false);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// potrs_batched
+hipblasStatus_t hipblasSpotrsBatched(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     const int               nrhs,
+                                     float* const            A[],
+                                     const int               lda,
+                                     float* const            B[],
+                                     const int               ldb,
+                                     int*                    info,
+                                     const int               batchCount)
+try
+{
+    HIPBLAS_TRACE("potrs_batched", "f32_r")
+        .uplo(uplo)
+        .n(n)
+        .lda(lda)
+        .ldb(ldb)
+        .batch_count(batchCount);
+    return hipblasCholeskySolve(handle, uplo, n, nrhs, A, lda, B, ldb, info, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDpotrsBatched(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     const int               nrhs,
+                                     double* const           A[],
+                                     const int               lda,
+                                     double* const           B[],
+                                     const int               ldb,
+                                     int*                    info,
+                                     const int               batchCount)
+try
+{
+    HIPBLAS_TRACE("potrs_batched", "f64_r")
+        .uplo(uplo)
+        .n(n)
+        .lda(lda)
+        .ldb(ldb)
+        .batch_count(batchCount);
+    return hipblasCholeskySolve(handle, uplo, n, nrhs, A, lda, B, ldb, info, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCpotrsBatched(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     const int               nrhs,
+                                     hipblasComplex* const   A[],
+                                     const int               lda,
+                                     hipblasComplex* const   B[],
+                                     const int               ldb,
+                                     int*                    info,
+                                     const int               batchCount)
+try
+{
+    HIPBLAS_TRACE("potrs_batched", "f32_c")
+        .uplo(uplo)
+        .n(n)
+        .lda(lda)
+        .ldb(ldb)
+        .batch_count(batchCount);
+    return hipblasCholeskySolve(handle,
+                                uplo,
+                                n,
+                                nrhs,
+                                (hipComplex* const*)A,
+                                lda,
+                                (hipComplex* const*)B,
+                                ldb,
+                                info,
+                                batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZpotrsBatched(hipblasHandle_t             handle,
+                                     const hipblasFillMode_t     uplo,
+                                     const int                   n,
+                                     const int                   nrhs,
+                                     hipblasDoubleComplex* const A[],
+                                     const int                   lda,
+                                     hipblasDoubleComplex* const B[],
+                                     const int                   ldb,
+                                     int*                        info,
+                                     const int                   batchCount)
+try
+{
+    HIPBLAS_TRACE("potrs_batched", "f64_c")
+        .uplo(uplo)
+        .n(n)
+        .lda(lda)
+        .ldb(ldb)
+        .batch_count(batchCount);
+    return hipblasCholeskySolve(handle,
+                                uplo,
+                                n,
+                                nrhs,
+                                (hipDoubleComplex* const*)A,
+                                lda,
+                                (hipDoubleComplex* const*)B,
+                                ldb,
+                                info,
+                                batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCpotrsBatched_v2(hipblasHandle_t         handle,
+                                        const hipblasFillMode_t uplo,
+                                        const int               n,
+                                        const int               nrhs,
+                                        hipComplex* const       A[],
+                                        const int               lda,
+                                        hipComplex* const       B[],
+                                        const int               ldb,
+                                        int*                    info,
+                                        const int               batchCount)
+try
+{
+    HIPBLAS_TRACE("potrs_batched", "f32_c")
+        .uplo(uplo)
+        .n(n)
+        .lda(lda)
+        .ldb(ldb)
+        .batch_count(batchCount);
+    return hipblasCholeskySolve(handle, uplo, n, nrhs, A, lda, B, ldb, info, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZpotrsBatched_v2(hipblasHandle_t         handle,
+                                        const hipblasFillMode_t uplo,
+                                        const int               n,
+                                        const int               nrhs,
+                                        hipDoubleComplex* const A[],
+                                        const int               lda,
+                                        hipDoubleComplex* const B[],
+                                        const int               ldb,
+                                        int*                    info,
+                                        const int               batchCount)
+try
+{
+    HIPBLAS_TRACE("potrs_batched", "f64_c")
+        .uplo(uplo)
+        .n(n)
+        .lda(lda)
+        .ldb(ldb)
+        .batch_count(batchCount);
+    return hipblasCholeskySolve(handle, uplo, n, nrhs, A, lda, B, ldb, info, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// potrs_strided_batched
+hipblasStatus_t hipblasSpotrsStridedBatched(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            const int               nrhs,
+                                            float*                  A,
+                                            const int               lda,
+                                            const hipblasStride     strideA,
+                                            float*                  B,
+                                            const int               ldb,
+                                            const hipblasStride     strideB,
+                                            int*                    info,
+                                            const int               batchCount)
+try
+{
+    HIPBLAS_TRACE("potrs_strided_batched", "f32_r")
+        .uplo(uplo)
+        .n(n)
+        .lda(lda)
+        .stride_a(strideA)
+        .ldb(ldb)
+        .stride_b(strideB)
+        .batch_count(batchCount);
+    return hipblasCholeskySolve(
+        handle, uplo, n, nrhs, A, lda, strideA, B, ldb, strideB, info, batchCount, true);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDpotrsStridedBatched(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            const int               nrhs,
+                                            double*                 A,
+                                            const int               lda,
+                                            const hipblasStride     strideA,
+                                            double*                 B,
+                                            const int               ldb,
+                                            const hipblasStride     strideB,
+                                            int*                    info,
+                                            const int               batchCount)
+try
+{
+    HIPBLAS_TRACE("potrs_strided_batched", "f64_r")
+        .uplo(uplo)
+        .n(n)
+        .lda(lda)
+        .stride_a(strideA)
+        .ldb(ldb)
+        .stride_b(strideB)
+        .batch_count(batchCount);
+    return hipblasCholeskySolve(
+        handle, uplo, n, nrhs, A, lda, strideA, B, ldb, strideB, info, batchCount, true);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCpotrsStridedBatched(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            const int               nrhs,
+                                            hipblasComplex*         A,
+                                            const int               lda,
+                                            const hipblasStride     strideA,
+                                            hipblasComplex*         B,
+                                            const int               ldb,
+                                            const hipblasStride     strideB,
+                                            int*                    info,
+                                            const int               batchCount)
+try
+{
+    HIPBLAS_TRACE("potrs_strided_batched", "f32_c")
+        .uplo(uplo)
+        .n(n)
+        .lda(lda)
+        .stride_a(strideA)
+        .ldb(ldb)
+        .stride_b(strideB)
+        .batch_count(batchCount);
+    return hipblasCholeskySolve(handle,
+                                uplo,
+                                n,
+                                nrhs,
+                                (hipComplex*)A,
+                                lda,
+                                strideA,
+                                (hipComplex*)B,
+                                ldb,
+                                strideB,
+                                info,
+                                batchCount,
+                                true);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZpotrsStridedBatched(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            const int               nrhs,
+                                            hipblasDoubleComplex*   A,
+                                            const int               lda,
+                                            const hipblasStride     strideA,
+                                            hipblasDoubleComplex*   B,
+                                            const int               ldb,
+                                            const hipblasStride     strideB,
+                                            int*                    info,
+                                            const int               batchCount)
+try
+{
+    HIPBLAS_TRACE("potrs_strided_batched", "f64_c")
+        .uplo(uplo)
+        .n(n)
+        .lda(lda)
+        .stride_a(strideA)
+        .ldb(ldb)
+        .stride_b(strideB)
+        .batch_count(batchCount);
+    return hipblasCholeskySolve(handle,
+                                uplo,
+                                n,
+                                nrhs,
+                                (hipDoubleComplex*)A,
+                                lda,
+                                strideA,
+                                (hipDoubleComplex*)B,
+                                ldb,
+                                strideB,
+                                info,
+                                batchCount,
+                                true);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCpotrsStridedBatched_v2(hipblasHandle_t         handle,
+                                               const hipblasFillMode_t uplo,
+                                               const int               n,
+                                               const int               nrhs,
+                                               hipComplex*             A,
+                                               const int               lda,
+                                               const hipblasStride     strideA,
+                                               hipComplex*             B,
+                                               const int               ldb,
+                                               const hipblasStride     strideB,
+                                               int*                    info,
+                                               const int               batchCount)
+try
+{
+    HIPBLAS_TRACE("potrs_strided_batched", "f32_c")
+        .uplo(uplo)
+        .n(n)
+        .lda(lda)
+        .stride_a(strideA)
+        .ldb(ldb)
+        .stride_b(strideB)
+        .batch_count(batchCount);
+    return hipblasCholeskySolve(
+        handle, uplo, n, nrhs, A, lda, strideA, B, ldb, strideB, info, batchCount, true);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZpotrsStridedBatched_v2(hipblasHandle_t         handle,
+                                               const hipblasFillMode_t uplo,
+                                               const int               n,
+                                               const int               nrhs,
+                                               hipDoubleComplex*       A,
+                                               const int               lda,
+                                               const hipblasStride     strideA,
+                                               hipDoubleComplex*       B,
+                                               const int               ldb,
+                                               const hipblasStride     strideB,
+                                               int*                    info,
+                                               const int               batchCount)
+try
+{
+    HIPBLAS_TRACE("potrs_strided_batched", "f64_c")
+        .uplo(uplo)
+        .n(n)
+        .lda(lda)
+        .stride_a(strideA)
+        .ldb(ldb)
+        .stride_b(strideB)
+        .batch_count(batchCount);
+    return hipblasCholeskySolve(
+        handle, uplo, n, nrhs, A, lda, strideA, B, ldb, strideB, info, batchCount, true);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// potri
+hipblasStatus_t hipblasSpotri(hipblasHandle_t         handle,
+                              const hipblasFillMode_t uplo,
+                              const int               n,
+                              float*                  A,
+                              const int               lda,
+                              int*                    info)
+try
+{
+    HIPBLAS_TRACE("potri", "f32_r").uplo(uplo).n(n).lda(lda);
+    return hipblasCholeskyFactor(
+        handle, hipblasCholeskyRoutine::potri, uplo, n, A, lda, 0, info, 1);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDpotri(hipblasHandle_t         handle,
+                              const hipblasFillMode_t uplo,
+                              const int               n,
+                              double*                 A,
+                              const int               lda,
+                              int*                    info)
+try
+{
+    HIPBLAS_TRACE("potri", "f64_r").uplo(uplo).n(n).lda(lda);
+    return hipblasCholeskyFactor(
+        handle, hipblasCholeskyRoutine::potri, uplo, n, A, lda, 0, info, 1);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCpotri(hipblasHandle_t         handle,
+                              const hipblasFillMode_t uplo,
+                              const int               n,
+                              hipblasComplex*         A,
+                              const int               lda,
+                              int*                    info)
+try
+{
+    HIPBLAS_TRACE("potri", "f32_c").uplo(uplo).n(n).lda(lda);
+    return hipblasCholeskyFactor(
+        handle, hipblasCholeskyRoutine::potri, uplo, n, (hipComplex*)A, lda, 0, info, 1);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZpotri(hipblasHandle_t         handle,
+                              const hipblasFillMode_t uplo,
+                              const int               n,
+                              hipblasDoubleComplex*   A,
+                              const int               lda,
+                              int*                    info)
+try
+{
+    HIPBLAS_TRACE("potri", "f64_c").uplo(uplo).n(n).lda(lda);
+    return hipblasCholeskyFactor(
+        handle, hipblasCholeskyRoutine::potri, uplo, n, (hipDoubleComplex*)A, lda, 0, info, 1);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCpotri_v2(hipblasHandle_t         handle,
+                                 const hipblasFillMode_t uplo,
+                                 const int               n,
+                                 hipComplex*             A,
+                                 const int               lda,
+                                 int*                    info)
+try
+{
+    HIPBLAS_TRACE("potri", "f32_c").uplo(uplo).n(n).lda(lda);
+    return hipblasCholeskyFactor(
+        handle, hipblasCholeskyRoutine::potri, uplo, n, A, lda, 0, info, 1);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZpotri_v2(hipblasHandle_t         handle,
+                                 const hipblasFillMode_t uplo,
+                                 const int               n,
+                                 hipDoubleComplex*       A,
+                                 const int               lda,
+                                 int*                    info)
+try
+{
+    HIPBLAS_TRACE("potri", "f64_c").uplo(uplo).n(n).lda(lda);
+    return hipblasCholeskyFactor(
+        handle, hipblasCholeskyRoutine::potri, uplo, n, A, lda, 0, info, 1);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// potri_batched
+hipblasStatus_t hipblasSpotriBatched(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     float* const            A[],
+                                     const int               lda,
+                                     int*                    info,
+                                     const int               batchCount)
+try
+{
+    HIPBLAS_TRACE("potri_batched", "f32_r").uplo(uplo).n(n).lda(lda).batch_count(batchCount);
+    return hipblasCholeskyFactor(
+        handle, hipblasCholeskyRoutine::potri, uplo, n, A, lda, info, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDpotriBatched(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     double* const           A[],
+                                     const int               lda,
+                                     int*                    info,
+                                     const int               batchCount)
+try
+{
+    HIPBLAS_TRACE("potri_batched", "f64_r").uplo(uplo).n(n).lda(lda).batch_count(batchCount);
+    return hipblasCholeskyFactor(
+        handle, hipblasCholeskyRoutine::potri, uplo, n, A, lda, info, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCpotriBatched(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     hipblasComplex* const   A[],
+                                     const int               lda,
+                                     int*                    info,
+                                     const int               batchCount)
+try
+{
+    HIPBLAS_TRACE("potri_batched", "f32_c").uplo(uplo).n(n).lda(lda).batch_count(batchCount);
+    return hipblasCholeskyFactor(handle,
+                                 hipblasCholeskyRoutine::potri,
+                                 uplo,
+                                 n,
+                                 (hipComplex* const*)A,
+                                 lda,
+                                 info,
+                                 batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZpotriBatched(hipblasHandle_t             handle,
+                                     const hipblasFillMode_t     uplo,
+                                     const int                   n,
+                                     hipblasDoubleComplex* const A[],
+                                     const int                   lda,
+                                     int*                        info,
+                                     const int                   batchCount)
+try
+{
+    HIPBLAS_TRACE("potri_batched", "f64_c").uplo(uplo).n(n).lda(lda).batch_count(batchCount);
+    return hipblasCholeskyFactor(handle,
+                                 hipblasCholeskyRoutine::potri,
+                                 uplo,
+                                 n,
+                                 (hipDoubleComplex* const*)A,
+                                 lda,
+                                 info,
+                                 batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCpotriBatched_v2(hipblasHandle_t         handle,
+                                        const hipblasFillMode_t uplo,
+                                        const int               n,
+                                        hipComplex* const       A[],
+                                        const int               lda,
+                                        int*                    info,
+                                        const int               batchCount)
+try
+{
+    HIPBLAS_TRACE("potri_batched", "f32_c").uplo(uplo).n(n).lda(lda).batch_count(batchCount);
+    return hipblasCholeskyFactor(
+        handle, hipblasCholeskyRoutine::potri, uplo, n, A, lda, info, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZpotriBatched_v2(hipblasHandle_t         handle,
+                                        const hipblasFillMode_t uplo,
+                                        const int               n,
+                                        hipDoubleComplex* const A[],
+                                        const int               lda,
+                                        int*                    info,
+                                        const int               batchCount)
+try
+{
+    HIPBLAS_TRACE("potri_batched", "f64_c").uplo(uplo).n(n).lda(lda).batch_count(batchCount);
+    return hipblasCholeskyFactor(
+        handle, hipblasCholeskyRoutine::potri, uplo, n, A, lda, info, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// potri_strided_batched
+hipblasStatus_t hipblasSpotriStridedBatched(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            float*                  A,
+                                            const int               lda,
+                                            const hipblasStride     strideA,
+                                            int*                    info,
+                                            const int               batchCount)
+try
+{
+    HIPBLAS_TRACE("potri_strided_batched", "f32_r")
+        .uplo(uplo)
+        .n(n)
+        .lda(lda)
+        .stride_a(strideA)
+        .batch_count(batchCount);
+    return hipblasCholeskyFactor(
+        handle, hipblasCholeskyRoutine::potri, uplo, n, A, lda, strideA, info, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDpotriStridedBatched(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            double*                 A,
+                                            const int               lda,
+                                            const hipblasStride     strideA,
+                                            int*                    info,
+                                            const int               batchCount)
+try
+{
+    HIPBLAS_TRACE("potri_strided_batched", "f64_r")
+        .uplo(uplo)
+        .n(n)
+        .lda(lda)
+        .stride_a(strideA)
+        .batch_count(batchCount);
+    return hipblasCholeskyFactor(
+        handle, hipblasCholeskyRoutine::potri, uplo, n, A, lda, strideA, info, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCpotriStridedBatched(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            hipblasComplex*         A,
+                                            const int               lda,
+                                            const hipblasStride     strideA,
+                                            int*                    info,
+                                            const int               batchCount)
+try
+{
+    HIPBLAS_TRACE("potri_strided_batched", "f32_c")
+        .uplo(uplo)
+        .n(n)
+        .lda(lda)
+        .stride_a(strideA)
+        .batch_count(batchCount);
+    return hipblasCholeskyFactor(handle,
+                                 hipblasCholeskyRoutine::potri,
+                                 uplo,
+                                 n,
+                                 (hipComplex*)A,
+                                 lda,
+                                 strideA,
+                                 info,
+                                 batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZpotriStridedBatched(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            hipblasDoubleComplex*   A,
+                                            const int               lda,
+                                            const hipblasStride     strideA,
+                                            int*                    info,
+                                            const int               batchCount)
+try
+{
+    HIPBLAS_TRACE("potri_strided_batched", "f64_c")
+        .uplo(uplo)
+        .n(n)
+        .lda(lda)
+        .stride_a(strideA)
+        .batch_count(batchCount);
+    return hipblasCholeskyFactor(handle,
+                                 hipblasCholeskyRoutine::potri,
+                                 uplo,
+                                 n,
+                                 (hipDoubleComplex*)A,
+                                 lda,
+                                 strideA,
+                                 info,
+                                 batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCpotriStridedBatched_v2(hipblasHandle_t         handle,
+                                               const hipblasFillMode_t uplo,
+                                               const int               n,
+                                               hipComplex*             A,
+                                               const int               lda,
+                                               const hipblasStride     strideA,
+                                               int*                    info,
+                                               const int               batchCount)
+try
+{
+    HIPBLAS_TRACE("potri_strided_batched", "f32_c")
+        .uplo(uplo)
+        .n(n)
+        .lda(lda)
+        .stride_a(strideA)
+        .batch_count(batchCount);
+    return hipblasCholeskyFactor(
+        handle, hipblasCholeskyRoutine::potri, uplo, n, A, lda, strideA, info, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZpotriStridedBatched_v2(hipblasHandle_t         handle,
+                                               const hipblasFillMode_t uplo,
+                                               const int               n,
+                                               hipDoubleComplex*       A,
+                                               const int               lda,
+                                               const hipblasStride     strideA,
+                                               int*                    info,
+                                               const int               batchCount)
+try
+{
+    HIPBLAS_TRACE("potri_strided_batched", "f64_c")
+        .uplo(uplo)
+        .n(n)
+        .lda(lda)
+        .stride_a(strideA)
+        .batch_count(batchCount);
+    return hipblasCholeskyFactor(
+        handle, hipblasCholeskyRoutine::potri, uplo, n, A, lda, strideA, info, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+} // extern "C"
+
+#endif
@@ -0,0 +1,238 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "pack.hpp"
+#include "exceptions.hpp"
+#include "stream_pool.hpp"
+#include <algorithm>
+#include <memory>
+
+struct hipblasPackedMatrix
+{
+    void*       data;
+    size_t      size;
+    hipDataType type;
+    int         m;
+    int         k;
+    int64_t     ld;
+    int         device;
+};
+
+static size_t hipblas_pack_type_size(hipDataType type)
+{
+    switch(type)
+    {
+    case HIP_R_8I:
+        return 1;
+    case HIP_R_16F:
+    case HIP_R_16BF:
+        return 2;
+    case HIP_R_32F:
+        return 4;
+    case HIP_R_64F:
+    case HIP_C_32F:
+        return 8;
+    case HIP_C_64F:
+        return 16;
+    default:
+        return 0;
+    }
+}
+
+// Columns of the packed matrix start on 128 byte boundaries
+static int64_t hipblas_pack_ld(int k, size_t type_size)
+{
+    int64_t align = std::max<int64_t>(128 / type_size, 1);
+    return std::max<int64_t>((k + align - 1) / align * align, align);
+}
+
+static hipblasStatus_t hipblas_pack_check(hipblasHandle_t    handle,
+                                          hipblasOperation_t transA,
+                                          int                m,
+                                          int                k,
+                                          hipDataType        aType,
+                                          size_t&            type_size)
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(transA != HIPBLAS_OP_N && transA != HIPBLAS_OP_T && transA != HIPBLAS_OP_C)
+        return HIPBLAS_STATUS_INVALID_ENUM;
+    if(m < 0 || k < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    type_size = hipblas_pack_type_size(aType);
+    return type_size ? HIPBLAS_STATUS_SUCCESS : HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+extern "C" {
+
+hipblasStatus_t hipblasMatrixPackGetSize(hipblasHandle_t    handle,
+                                         hipblasOperation_t transA,
+                                         int                m,
+                                         int                k,
+                                         hipDataType        aType,
+                                         size_t*            sizeInBytes)
+try
+{
+    size_t          type_size;
+    hipblasStatus_t status = hipblas_pack_check(handle, transA, m, k, aType, type_size);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    if(!sizeInBytes)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    *sizeInBytes = size_t(hipblas_pack_ld(k, type_size)) * m * type_size;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasMatrixPack(hipblasHandle_t        handle,
+                                  hipblasOperation_t     transA,
+                                  int                    m,
+                                  int                    k,
+                                  const void*            A,
+                                  hipDataType            aType,
+                                  int                    lda,
+                                  hipblasPackedMatrix_t* packedA)
+try
+{
+    size_t          type_size;
+    hipblasStatus_t status = hipblas_pack_check(handle, transA, m, k, aType, type_size);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    if(!packedA || lda < std::max(transA == HIPBLAS_OP_N ? m : k, 1) || (!A && m && k))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipStream_t stream;
+    status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    auto packed  = std::make_unique<hipblasPackedMatrix>();
+    packed->type = aType;
+    packed->m    = m;
+    packed->k    = k;
+    packed->ld   = hipblas_pack_ld(k, type_size);
+    packed->size = size_t(packed->ld) * m * type_size;
+    status       = hipblas_hip_to_status(hipGetDevice(&packed->device));
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    if(hipMalloc(&packed->data, std::max(packed->size, size_t(1))) != hipSuccess)
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+
+    bool complex = aType == HIP_C_32F || aType == HIP_C_64F;
+    status       = hipblas_launch_pack(transA,
+                                 m,
+                                 k,
+                                 A,
+                                 lda,
+                                 packed->data,
+                                 packed->ld,
+                                 type_size,
+                                 complex && transA == HIPBLAS_OP_C,
+                                 stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        (void)hipFree(packed->data);
+        return status;
+    }
+
+    *packedA = packed.release();
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasMatrixPackDestroy(hipblasPackedMatrix_t packedA)
+try
+{
+    if(!packedA)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    // hipFree waits for the work using the packed matrix to finish
+    hipError_t error = hipFree(packedA->data);
+    delete packedA;
+    return hipblas_hip_to_status(error);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmPackedEx(hipblasHandle_t       handle,
+                                    hipblasPackedMatrix_t packedA,
+                                    hipblasOperation_t    transB,
+                                    int                   m,
+                                    int                   n,
+                                    int                   k,
+                                    const void*           alpha,
+                                    const void*           B,
+                                    hipDataType           bType,
+                                    int                   ldb,
+                                    const void*           beta,
+                                    void*                 C,
+                                    hipDataType           cType,
+                                    int                   ldc,
+                                    hipblasComputeType_t  computeType,
+                                    hipblasGemmAlgo_t     algo)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!packedA || m != packedA->m || k != packedA->k)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    int device;
+    if(hipGetDevice(&device) != hipSuccess || device != packedA->device)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    // The packed matrix is op(A) transposed, so the gemm uses its transpose
+    return hipblasGemmEx_v2(handle,
+                            HIPBLAS_OP_T,
+                            transB,
+                            m,
+                            n,
+                            k,
+                            alpha,
+                            packedA->data,
+                            packedA->type,
+                            int(packedA->ld),
+                            B,
+                            bType,
+                            ldb,
+                            beta,
+                            C,
+                            cType,
+                            ldc,
+                            computeType,
+                            algo);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+} // extern "C"
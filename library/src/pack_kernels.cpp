@@ -0,0 +1,177 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "pack.hpp"
+#include <algorithm>
+#include <hip/hip_runtime.h>
+
+#define HIPBLAS_PACK_DIM 32
+#define HIPBLAS_PACK_ROWS 8
+
+struct hipblas_pack_c32
+{
+    float x, y;
+};
+
+struct hipblas_pack_c64
+{
+    double x, y;
+};
+
+template <typename T>
+__device__ inline T hipblas_pack_conj(T a)
+{
+    a.y = -a.y;
+    return a;
+}
+
+// Each block packs a HIPBLAS_PACK_DIM square tile of op(A) per step, going down the rows
+// of op(A) with gridDim.y. Without transpose the tile goes through shared memory so that
+// both A and P are accessed along their columns.
+template <typename T, bool TRANS, bool CONJ>
+__global__ void __launch_bounds__(HIPBLAS_PACK_DIM* HIPBLAS_PACK_ROWS)
+    hipblas_pack_kernel(int64_t m, int64_t k, const T* A, int64_t lda, T* P, int64_t ldp)
+{
+    __shared__ T tile[HIPBLAS_PACK_DIM][HIPBLAS_PACK_DIM + 1];
+
+    int64_t p0 = int64_t(blockIdx.x) * HIPBLAS_PACK_DIM;
+    for(int64_t i0 = int64_t(blockIdx.y) * HIPBLAS_PACK_DIM; i0 < m;
+        i0 += int64_t(gridDim.y) * HIPBLAS_PACK_DIM)
+    {
+        if(TRANS)
+        {
+            // op(A)(i, p) = A[p + i * lda], read and written along p
+            int64_t p = p0 + threadIdx.x;
+            for(int r = threadIdx.y; r < HIPBLAS_PACK_DIM; r += HIPBLAS_PACK_ROWS)
+            {
+                int64_t i = i0 + r;
+                if(i < m && p < k)
+                {
+                    T a = A[p + i * lda];
+                    if constexpr(CONJ)
+                        a = hipblas_pack_conj(a);
+                    P[p + i * ldp] = a;
+                }
+            }
+        }
+        else
+        {
+            // op(A)(i, p) = A[i + p * lda], read along i and written along p
+            for(int r = threadIdx.y; r < HIPBLAS_PACK_DIM; r += HIPBLAS_PACK_ROWS)
+            {
+                int64_t i = i0 + threadIdx.x;
+                int64_t p = p0 + r;
+                if(i < m && p < k)
+                    tile[r][threadIdx.x] = A[i + p * lda];
+            }
+            __syncthreads();
+            for(int r = threadIdx.y; r < HIPBLAS_PACK_DIM; r += HIPBLAS_PACK_ROWS)
+            {
+                int64_t i = i0 + r;
+                int64_t p = p0 + threadIdx.x;
+                if(i < m && p < k)
+                    P[p + i * ldp] = tile[threadIdx.x][r];
+            }
+            __syncthreads();
+        }
+    }
+}
+
+template <typename T, bool CONJ = false>
+static hipblasStatus_t hipblas_launch_pack_template(hipblasOperation_t trans,
+                                                    int64_t            m,
+                                                    int64_t            k,
+                                                    const void*        A,
+                                                    int64_t            lda,
+                                                    void*              P,
+                                                    int64_t            ldp,
+                                                    hipStream_t        stream)
+{
+    dim3 threads(HIPBLAS_PACK_DIM, HIPBLAS_PACK_ROWS);
+    dim3 grid((k + HIPBLAS_PACK_DIM - 1) / HIPBLAS_PACK_DIM,
+              std::min<int64_t>((m + HIPBLAS_PACK_DIM - 1) / HIPBLAS_PACK_DIM, 65535));
+
+    if(trans == HIPBLAS_OP_N)
+        hipLaunchKernelGGL((hipblas_pack_kernel<T, false, false>),
+                           grid,
+                           threads,
+                           0,
+                           stream,
+                           m,
+                           k,
+                           (const T*)A,
+                           lda,
+                           (T*)P,
+                           ldp);
+    else
+        hipLaunchKernelGGL((hipblas_pack_kernel<T, true, CONJ>),
+                           grid,
+                           threads,
+                           0,
+                           stream,
+                           m,
+                           k,
+                           (const T*)A,
+                           lda,
+                           (T*)P,
+                           ldp);
+    return hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                           : HIPBLAS_STATUS_EXECUTION_FAILED;
+}
+
+hipblasStatus_t hipblas_launch_pack(hipblasOperation_t trans,
+                                    int64_t            m,
+                                    int64_t            k,
+                                    const void*        A,
+                                    int64_t            lda,
+                                    void*              P,
+                                    int64_t            ldp,
+                                    size_t             size,
+                                    bool               conjugate,
+                                    hipStream_t        stream)
+{
+    if(m <= 0 || k <= 0)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    switch(size)
+    {
+    case 1:
+        return hipblas_launch_pack_template<uint8_t>(trans, m, k, A, lda, P, ldp, stream);
+    case 2:
+        return hipblas_launch_pack_template<uint16_t>(trans, m, k, A, lda, P, ldp, stream);
+    case 4:
+        return hipblas_launch_pack_template<uint32_t>(trans, m, k, A, lda, P, ldp, stream);
+    case 8:
+        return conjugate ? hipblas_launch_pack_template<hipblas_pack_c32, true>(
+                   trans, m, k, A, lda, P, ldp, stream)
+                         : hipblas_launch_pack_template<uint64_t>(
+                             trans, m, k, A, lda, P, ldp, stream);
+    case 16:
+        return conjugate ? hipblas_launch_pack_template<hipblas_pack_c64, true>(
+                   trans, m, k, A, lda, P, ldp, stream)
+                         : hipblas_launch_pack_template<hipblas_pack_c64>(
+                             trans, m, k, A, lda, P, ldp, stream);
+    default:
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+}
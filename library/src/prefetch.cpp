@@ -0,0 +1,172 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "prefetch.hpp"
+#include "exceptions.hpp"
+#include "handle_state.hpp"
+#include <atomic>
+#include <memory>
+#include <mutex>
+
+// Number of handles prefetching, so that the entry points only look up the state of
+// their handle while one is
+static std::atomic<int> hipblas_prefetch_handles{0};
+
+// Finds the allocation holding [ptr, ptr + bytes). Memory the runtime does not know,
+// such as pageable host memory, is taken to be just the range itself.
+static hipblas_allocation hipblas_query_allocation(const void* ptr, size_t bytes)
+{
+    hipblas_allocation allocation{reinterpret_cast<uintptr_t>(ptr), bytes, false};
+
+    hipPointerAttribute_t attributes;
+    if(hipPointerGetAttributes(&attributes, ptr) != hipSuccess)
+    {
+        (void)hipGetLastError();
+        return allocation;
+    }
+    allocation.managed = attributes.isManaged != 0;
+
+    hipDeviceptr_t base = nullptr;
+    size_t         size = 0;
+    if(hipMemGetAddressRange(&base, &size, const_cast<void*>(ptr)) == hipSuccess && base)
+    {
+        allocation.base = reinterpret_cast<uintptr_t>(base);
+        allocation.size = size;
+    }
+    else
+        (void)hipGetLastError();
+    return allocation;
+}
+
+hipblas_handle_prefetch::hipblas_handle_prefetch() = default;
+
+hipblas_handle_prefetch::~hipblas_handle_prefetch()
+{
+    set_mode(HIPBLAS_PREFETCH_MODE_OFF);
+}
+
+void hipblas_handle_prefetch::set_mode(hipblasPrefetchMode_t mode)
+{
+    hipblasPrefetchMode_t previous = m_mode.exchange(mode);
+    if(previous == HIPBLAS_PREFETCH_MODE_OFF && mode != HIPBLAS_PREFETCH_MODE_OFF)
+        hipblas_prefetch_handles++;
+    else if(previous != HIPBLAS_PREFETCH_MODE_OFF && mode == HIPBLAS_PREFETCH_MODE_OFF)
+        hipblas_prefetch_handles--;
+}
+
+void hipblas_handle_prefetch::prefetch(hipblasHandle_t                               handle,
+                                       std::initializer_list<hipblas_prefetch_range> ranges)
+{
+    hipStream_t            stream    = nullptr;
+    hipStreamCaptureStatus capturing = hipStreamCaptureStatusNone;
+    int                    device    = 0;
+    if(hipblasGetStream(handle, &stream) != HIPBLAS_STATUS_SUCCESS
+       || hipStreamIsCapturing(stream, &capturing) != hipSuccess
+       || capturing != hipStreamCaptureStatusNone || hipGetDevice(&device) != hipSuccess)
+        return;
+
+    for(const hipblas_prefetch_range& range : ranges)
+    {
+        if(!range.bytes || !m_allocations.managed(range.ptr, range.bytes, hipblas_query_allocation))
+            continue;
+
+        if(hipMemPrefetchAsync(range.ptr, range.bytes, device, stream) != hipSuccess)
+        {
+            // Most likely the allocation was freed and the address reused
+            (void)hipGetLastError();
+            m_allocations.forget(range.ptr);
+            continue;
+        }
+        m_prefetches.fetch_add(1, std::memory_order_relaxed);
+        m_bytes.fetch_add(range.bytes, std::memory_order_relaxed);
+    }
+}
+
+hipblas_handle_prefetch* hipblas_prefetching(hipblasHandle_t handle)
+{
+    if(!hipblas_prefetch_handles.load(std::memory_order_relaxed) || !handle)
+        return nullptr;
+
+    hipblas_handle_prefetch* prefetch = hipblas_get_handle_state(handle).prefetch.get();
+    return prefetch && prefetch->mode() != HIPBLAS_PREFETCH_MODE_OFF ? prefetch : nullptr;
+}
+
+hipblasStatus_t hipblasSetPrefetchMode(hipblasHandle_t handle, hipblasPrefetchMode_t mode)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(mode != HIPBLAS_PREFETCH_MODE_OFF && mode != HIPBLAS_PREFETCH_MODE_MANAGED)
+        return HIPBLAS_STATUS_INVALID_ENUM;
+
+    static std::mutex           mutex;
+    std::lock_guard<std::mutex> lock(mutex);
+    hipblas_handle_state&       state = hipblas_get_handle_state(handle);
+    if(!state.prefetch)
+    {
+        if(mode == HIPBLAS_PREFETCH_MODE_OFF)
+            return HIPBLAS_STATUS_SUCCESS;
+        state.prefetch = std::make_unique<hipblas_handle_prefetch>();
+    }
+    state.prefetch->set_mode(mode);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGetPrefetchMode(hipblasHandle_t handle, hipblasPrefetchMode_t* mode)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!mode)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblas_handle_prefetch* prefetch = hipblas_get_handle_state(handle).prefetch.get();
+    *mode                             = prefetch ? prefetch->mode() : HIPBLAS_PREFETCH_MODE_OFF;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t
+    hipblasGetPrefetchStats(hipblasHandle_t handle, uint64_t* prefetches, uint64_t* bytes)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!prefetches || !bytes)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblas_handle_prefetch* prefetch = hipblas_get_handle_state(handle).prefetch.get();
+    *prefetches                       = prefetch ? prefetch->prefetches() : 0;
+    *bytes                            = prefetch ? prefetch->bytes() : 0;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
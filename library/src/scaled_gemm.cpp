@@ -0,0 +1,424 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "device_scratch.hpp"
+#include "scaled_gemm.hpp"
+#include "exceptions.hpp"
+#include <algorithm>
+
+static bool hipblas_is_fp8(hipDataType type)
+{
+    return type == HIPBLAS_R_8F_E4M3 || type == HIPBLAS_R_8F_E5M2
+           || type == HIPBLAS_R_8F_E4M3_FNUZ || type == HIPBLAS_R_8F_E5M2_FNUZ;
+}
+
+static size_t hipblas_scaled_gemm_align(size_t size)
+{
+    return (size + hipblas_workspace_alignment - 1) / hipblas_workspace_alignment
+           * hipblas_workspace_alignment;
+}
+
+// The three scaled gemm functions: A, B and C are device arrays of the matrices of the
+// batch when batched, and the first matrices of strided batches otherwise.
+static hipblasStatus_t hipblasGemmScaledEx_template(hipblasHandle_t        handle,
+                                                    hipblasOperation_t     transA,
+                                                    hipblasOperation_t     transB,
+                                                    int                    m,
+                                                    int                    n,
+                                                    int                    k,
+                                                    const void*            alpha,
+                                                    const void*            A,
+                                                    hipDataType            aType,
+                                                    int                    lda,
+                                                    hipblasStride          strideA,
+                                                    const float*           scaleA,
+                                                    hipblasGemmScaleMode_t scaleModeA,
+                                                    const void*            B,
+                                                    hipDataType            bType,
+                                                    int                    ldb,
+                                                    hipblasStride          strideB,
+                                                    const float*           scaleB,
+                                                    hipblasGemmScaleMode_t scaleModeB,
+                                                    const void*            beta,
+                                                    void*                  C,
+                                                    hipDataType            cType,
+                                                    int                    ldc,
+                                                    hipblasStride          strideC,
+                                                    int                    batchCount,
+                                                    bool                   batched,
+                                                    hipblasComputeType_t   computeType,
+                                                    hipblasGemmAlgo_t      algo)
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    for(auto trans : {transA, transB})
+        if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T && trans != HIPBLAS_OP_C)
+            return HIPBLAS_STATUS_INVALID_ENUM;
+    for(auto mode : {scaleModeA, scaleModeB})
+        if(mode != HIPBLAS_GEMM_SCALE_TENSOR && mode != HIPBLAS_GEMM_SCALE_VECTOR)
+            return HIPBLAS_STATUS_INVALID_ENUM;
+
+    int64_t rowsA = transA == HIPBLAS_OP_N ? m : k, colsA = transA == HIPBLAS_OP_N ? k : m;
+    int64_t rowsB = transB == HIPBLAS_OP_N ? k : n, colsB = transB == HIPBLAS_OP_N ? n : k;
+    if(m < 0 || n < 0 || k < 0 || batchCount < 0 || lda < std::max<int64_t>(rowsA, 1)
+       || ldb < std::max<int64_t>(rowsB, 1) || ldc < std::max(m, 1))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    if(!hipblas_is_fp8(aType) || !hipblas_is_fp8(bType)
+       || (cType != HIP_R_32F && cType != HIP_R_16F && cType != HIP_R_16BF)
+       || computeType != HIPBLAS_COMPUTE_32F)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    if(!m || !n || !batchCount)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    hipblasPointerMode_t mode;
+    hipblasStatus_t      status = hipblasGetPointerMode(handle, &mode);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    if(!alpha || !beta || !C || (k && (!A || !B)))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipStream_t stream;
+    status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // The product goes straight to C when it is one float matrix or a strided batch of them
+    bool   direct = cType == HIP_R_32F && !batched;
+    size_t sizeA  = hipblas_scaled_gemm_align(sizeof(float) * rowsA * colsA * batchCount);
+    size_t sizeB  = hipblas_scaled_gemm_align(sizeof(float) * rowsB * colsB * batchCount);
+    size_t sizeD  = direct ? 0 : sizeof(float) * m * n * batchCount;
+
+    hipblas_device_scratch scratch(handle);
+    status = scratch.reserve(std::max<size_t>(sizeA + sizeB + sizeD, 1));
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    float* dA = (float*)scratch.data();
+    float* dB = (float*)((char*)scratch.data() + sizeA);
+    float* dD = (float*)((char*)scratch.data() + sizeA + sizeB);
+
+    hipblas_fp8_decode_args decodeA;
+    decodeA.type        = aType;
+    decodeA.rows        = rowsA;
+    decodeA.cols        = colsA;
+    decodeA.A           = A;
+    decodeA.batched     = batched;
+    decodeA.lda         = lda;
+    decodeA.stride      = strideA;
+    decodeA.D           = dA;
+    decodeA.batch_count = batchCount;
+    decodeA.scale       = scaleA;
+    decodeA.vector      = scaleModeA == HIPBLAS_GEMM_SCALE_VECTOR;
+    decodeA.by_row      = transA == HIPBLAS_OP_N; // a row of op(A)
+
+    hipblas_fp8_decode_args decodeB;
+    decodeB.type        = bType;
+    decodeB.rows        = rowsB;
+    decodeB.cols        = colsB;
+    decodeB.A           = B;
+    decodeB.batched     = batched;
+    decodeB.lda         = ldb;
+    decodeB.stride      = strideB;
+    decodeB.D           = dB;
+    decodeB.batch_count = batchCount;
+    decodeB.scale       = scaleB;
+    decodeB.vector      = scaleModeB == HIPBLAS_GEMM_SCALE_VECTOR;
+    decodeB.by_row      = transB != HIPBLAS_OP_N; // a column of op(B)
+
+    status = hipblas_launch_fp8_decode(decodeA, stream);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblas_launch_fp8_decode(decodeB, stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // The decoded matrices are real, so a conjugate transpose is a transpose
+    hipblasOperation_t opA = transA == HIPBLAS_OP_N ? HIPBLAS_OP_N : HIPBLAS_OP_T;
+    hipblasOperation_t opB = transB == HIPBLAS_OP_N ? HIPBLAS_OP_N : HIPBLAS_OP_T;
+
+    if(direct)
+        return hipblasGemmStridedBatchedEx_v2(handle,
+                                              opA,
+                                              opB,
+                                              m,
+                                              n,
+                                              k,
+                                              alpha,
+                                              dA,
+                                              HIP_R_32F,
+                                              std::max<int>(rowsA, 1),
+                                              rowsA * colsA,
+                                              dB,
+                                              HIP_R_32F,
+                                              std::max<int>(rowsB, 1),
+                                              rowsB * colsB,
+                                              beta,
+                                              C,
+                                              cType,
+                                              ldc,
+                                              strideC,
+                                              batchCount,
+                                              computeType,
+                                              algo);
+
+    status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    float one = 1, zero = 0;
+    status    = hipblasGemmStridedBatchedEx_v2(handle,
+                                            opA,
+                                            opB,
+                                            m,
+                                            n,
+                                            k,
+                                            &one,
+                                            dA,
+                                            HIP_R_32F,
+                                            std::max<int>(rowsA, 1),
+                                            rowsA * colsA,
+                                            dB,
+                                            HIP_R_32F,
+                                            std::max<int>(rowsB, 1),
+                                            rowsB * colsB,
+                                            &zero,
+                                            dD,
+                                            HIP_R_32F,
+                                            m,
+                                            int64_t(m) * n,
+                                            batchCount,
+                                            computeType,
+                                            algo);
+    (void)hipblasSetPointerMode(handle, mode);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    hipblas_scaled_output_args output;
+    output.type        = cType;
+    output.m           = m;
+    output.n           = n;
+    output.D           = dD;
+    output.C           = C;
+    output.batched     = batched;
+    output.ldc         = ldc;
+    output.stride      = strideC;
+    output.batch_count = batchCount;
+    if(mode == HIPBLAS_POINTER_MODE_HOST)
+    {
+        output.alpha = *(const float*)alpha;
+        output.beta  = *(const float*)beta;
+    }
+    else
+    {
+        output.alpha_ptr = (const float*)alpha;
+        output.beta_ptr  = (const float*)beta;
+    }
+    return hipblas_launch_scaled_output(output, stream);
+}
+
+extern "C" {
+
+hipblasStatus_t hipblasGemmScaledEx(hipblasHandle_t        handle,
+                                    hipblasOperation_t     transA,
+                                    hipblasOperation_t     transB,
+                                    int                    m,
+                                    int                    n,
+                                    int                    k,
+                                    const void*            alpha,
+                                    const void*            A,
+                                    hipDataType            aType,
+                                    int                    lda,
+                                    const float*           scaleA,
+                                    hipblasGemmScaleMode_t scaleModeA,
+                                    const void*            B,
+                                    hipDataType            bType,
+                                    int                    ldb,
+                                    const float*           scaleB,
+                                    hipblasGemmScaleMode_t scaleModeB,
+                                    const void*            beta,
+                                    void*                  C,
+                                    hipDataType            cType,
+                                    int                    ldc,
+                                    hipblasComputeType_t   computeType,
+                                    hipblasGemmAlgo_t      algo)
+try
+{
+    return hipblasGemmScaledEx_template(handle,
+                                        transA,
+                                        transB,
+                                        m,
+                                        n,
+                                        k,
+                                        alpha,
+                                        A,
+                                        aType,
+                                        lda,
+                                        0,
+                                        scaleA,
+                                        scaleModeA,
+                                        B,
+                                        bType,
+                                        ldb,
+                                        0,
+                                        scaleB,
+                                        scaleModeB,
+                                        beta,
+                                        C,
+                                        cType,
+                                        ldc,
+                                        0,
+                                        1,
+                                        false,
+                                        computeType,
+                                        algo);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmBatchedScaledEx(hipblasHandle_t        handle,
+                                           hipblasOperation_t     transA,
+                                           hipblasOperation_t     transB,
+                                           int                    m,
+                                           int                    n,
+                                           int                    k,
+                                           const void*            alpha,
+                                           const void*            A[],
+                                           hipDataType            aType,
+                                           int                    lda,
+                                           const float*           scaleA,
+                                           hipblasGemmScaleMode_t scaleModeA,
+                                           const void*            B[],
+                                           hipDataType            bType,
+                                           int                    ldb,
+                                           const float*           scaleB,
+                                           hipblasGemmScaleMode_t scaleModeB,
+                                           const void*            beta,
+                                           void*                  C[],
+                                           hipDataType            cType,
+                                           int                    ldc,
+                                           int                    batchCount,
+                                           hipblasComputeType_t   computeType,
+                                           hipblasGemmAlgo_t      algo)
+try
+{
+    return hipblasGemmScaledEx_template(handle,
+                                        transA,
+                                        transB,
+                                        m,
+                                        n,
+                                        k,
+                                        alpha,
+                                        A,
+                                        aType,
+                                        lda,
+                                        0,
+                                        scaleA,
+                                        scaleModeA,
+                                        B,
+                                        bType,
+                                        ldb,
+                                        0,
+                                        scaleB,
+                                        scaleModeB,
+                                        beta,
+                                        C,
+                                        cType,
+                                        ldc,
+                                        0,
+                                        batchCount,
+                                        true,
+                                        computeType,
+                                        algo);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmStridedBatchedScaledEx(hipblasHandle_t        handle,
+                                                  hipblasOperation_t     transA,
+                                                  hipblasOperation_t     transB,
+                                                  int                    m,
+                                                  int                    n,
+                                                  int                    k,
+                                                  const void*            alpha,
+                                                  const void*            A,
+                                                  hipDataType            aType,
+                                                  int                    lda,
+                                                  hipblasStride          strideA,
+                                                  const float*           scaleA,
+                                                  hipblasGemmScaleMode_t scaleModeA,
+                                                  const void*            B,
+                                                  hipDataType            bType,
+                                                  int                    ldb,
+                                                  hipblasStride          strideB,
+                                                  const float*           scaleB,
+                                                  hipblasGemmScaleMode_t scaleModeB,
+                                                  const void*            beta,
+                                                  void*                  C,
+                                                  hipDataType            cType,
+                                                  int                    ldc,
+                                                  hipblasStride          strideC,
+                                                  int                    batchCount,
+                                                  hipblasComputeType_t   computeType,
+                                                  hipblasGemmAlgo_t      algo)
+try
+{
+    return hipblasGemmScaledEx_template(handle,
+                                        transA,
+                                        transB,
+                                        m,
+                                        n,
+                                        k,
+                                        alpha,
+                                        A,
+                                        aType,
+                                        lda,
+                                        strideA,
+                                        scaleA,
+                                        scaleModeA,
+                                        B,
+                                        bType,
+                                        ldb,
+                                        strideB,
+                                        scaleB,
+                                        scaleModeB,
+                                        beta,
+                                        C,
+                                        cType,
+                                        ldc,
+                                        strideC,
+                                        batchCount,
+                                        false,
+                                        computeType,
+                                        algo);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+} // extern "C"
@@ -0,0 +1,152 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "scaled_gemm.hpp"
+#include <algorithm>
+#include <hip/hip_bfloat16.h>
+#include <hip/hip_fp16.h>
+#include <hip/hip_runtime.h>
+
+// Exact value of an 8-bit float with EBITS exponent bits and 7 - EBITS mantissa bits. The
+// OCP E4M3 format has no infinity and NaN S.1111.111, E5M2 follows IEEE, and the FNUZ
+// formats have a bias one larger, no infinity and NaN 0x80.
+template <int EBITS, bool FNUZ>
+__device__ inline float hipblas_fp8_to_float(uint8_t x)
+{
+    constexpr int mbits = 7 - EBITS;
+    constexpr int bias  = (1 << (EBITS - 1)) - 1 + (FNUZ ? 1 : 0);
+
+    int sign = x >> 7;
+    int e    = (x >> mbits) & ((1 << EBITS) - 1);
+    int m    = x & ((1 << mbits) - 1);
+
+    if(FNUZ ? x == 0x80 : (EBITS == 4 ? e == 15 && m == 7 : e == 31 && m))
+        return __int_as_float(0x7fc00000);
+    if(!FNUZ && EBITS == 5 && e == 31)
+        return __int_as_float(sign ? 0xff800000 : 0x7f800000);
+
+    float v = e ? ldexpf(float(m + (1 << mbits)), e - bias - mbits)
+                : ldexpf(float(m), 1 - bias - mbits);
+    return sign ? -v : v;
+}
+
+template <int EBITS, bool FNUZ>
+__global__ void __launch_bounds__(256) hipblas_fp8_decode_kernel(hipblas_fp8_decode_args args)
+{
+    int64_t r = int64_t(blockIdx.x) * blockDim.x + threadIdx.x;
+    if(r >= args.rows)
+        return;
+
+    for(int64_t b = blockIdx.z; b < args.batch_count; b += gridDim.z)
+    {
+        const uint8_t* A = args.batched ? ((const uint8_t* const*)args.A)[b]
+                                        : (const uint8_t*)args.A + b * args.stride;
+        float*         D = args.D + b * args.rows * args.cols;
+        for(int64_t c = blockIdx.y; c < args.cols; c += gridDim.y)
+        {
+            float x = hipblas_fp8_to_float<EBITS, FNUZ>(A[r + c * args.lda]);
+            if(args.scale)
+                x *= args.scale[args.vector ? (args.by_row ? r : c) : 0];
+            D[r + c * args.rows] = x;
+        }
+    }
+}
+
+template <typename T>
+__global__ void __launch_bounds__(256)
+    hipblas_scaled_output_kernel(hipblas_scaled_output_args args)
+{
+    int64_t i = int64_t(blockIdx.x) * blockDim.x + threadIdx.x;
+    if(i >= args.m)
+        return;
+
+    float alpha = args.alpha_ptr ? *args.alpha_ptr : args.alpha;
+    float beta  = args.beta_ptr ? *args.beta_ptr : args.beta;
+    for(int64_t b = blockIdx.z; b < args.batch_count; b += gridDim.z)
+    {
+        T*           C = args.batched ? ((T* const*)args.C)[b] : (T*)args.C + b * args.stride;
+        const float* D = args.D + b * args.m * args.n;
+        for(int64_t j = blockIdx.y; j < args.n; j += gridDim.y)
+        {
+            float x = alpha * D[i + j * args.m];
+            if(beta != 0)
+                x += beta * float(C[i + j * args.ldc]);
+            C[i + j * args.ldc] = T(x);
+        }
+    }
+}
+
+static dim3 hipblas_scaled_gemm_grid(int64_t rows, int64_t cols, int64_t batch_count)
+{
+    return dim3((rows + 255) / 256,
+                std::min<int64_t>(cols, 65535),
+                std::min<int64_t>(batch_count, 65535));
+}
+
+hipblasStatus_t hipblas_launch_fp8_decode(const hipblas_fp8_decode_args& args, hipStream_t stream)
+{
+    if(args.rows <= 0 || args.cols <= 0 || args.batch_count <= 0)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    dim3 grid = hipblas_scaled_gemm_grid(args.rows, args.cols, args.batch_count);
+    if(args.type == HIPBLAS_R_8F_E4M3)
+        hipLaunchKernelGGL((hipblas_fp8_decode_kernel<4, false>), grid, 256, 0, stream, args);
+    else if(args.type == HIPBLAS_R_8F_E5M2)
+        hipLaunchKernelGGL((hipblas_fp8_decode_kernel<5, false>), grid, 256, 0, stream, args);
+    else if(args.type == HIPBLAS_R_8F_E4M3_FNUZ)
+        hipLaunchKernelGGL((hipblas_fp8_decode_kernel<4, true>), grid, 256, 0, stream, args);
+    else if(args.type == HIPBLAS_R_8F_E5M2_FNUZ)
+        hipLaunchKernelGGL((hipblas_fp8_decode_kernel<5, true>), grid, 256, 0, stream, args);
+    else
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    return hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                           : HIPBLAS_STATUS_EXECUTION_FAILED;
+}
+
+hipblasStatus_t hipblas_launch_scaled_output(const hipblas_scaled_output_args& args,
+                                             hipStream_t                       stream)
+{
+    if(args.m <= 0 || args.n <= 0 || args.batch_count <= 0)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    dim3 grid = hipblas_scaled_gemm_grid(args.m, args.n, args.batch_count);
+    switch(args.type)
+    {
+    case HIP_R_32F:
+        hipLaunchKernelGGL((hipblas_scaled_output_kernel<float>), grid, 256, 0, stream, args);
+        break;
+    case HIP_R_16F:
+        hipLaunchKernelGGL((hipblas_scaled_output_kernel<__half>), grid, 256, 0, stream, args);
+        break;
+    case HIP_R_16BF:
+        hipLaunchKernelGGL(
+            (hipblas_scaled_output_kernel<hip_bfloat16>), grid, 256, 0, stream, args);
+        break;
+    default:
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+
+    return hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                           : HIPBLAS_STATUS_EXECUTION_FAILED;
+}
@@ -0,0 +1,408 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "staging.hpp"
+#include "exceptions.hpp"
+#include "stream_pool.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <map>
+#include <memory>
+#include <mutex>
+
+static size_t hipblasStagingEnvSize(const char* name, size_t fallback)
+{
+    const char* value = getenv(name);
+    if(!value || !*value)
+        return fallback;
+    return size_t(std::strtoull(value, nullptr, 0));
+}
+
+static int hipblasStagingDefaultThreads()
+{
+    return int(std::min<unsigned>(4, std::max<unsigned>(1, std::thread::hardware_concurrency())));
+}
+
+// HIPBLAS_STAGING=0 turns the engine off. Copies smaller than the threshold are left
+// to the backend, as the packing does not pay for itself there.
+static const bool   hipblas_staging_enabled = hipblasStagingEnvSize("HIPBLAS_STAGING", 1) != 0;
+static const size_t hipblas_staging_threshold
+    = hipblasStagingEnvSize("HIPBLAS_STAGING_THRESHOLD", size_t(1) << 20);
+static const size_t hipblas_staging_chunk_bytes = std::min(
+    std::max<size_t>(hipblasStagingEnvSize("HIPBLAS_STAGING_CHUNK_SIZE", size_t(4) << 20), 4096),
+    size_t(1) << 30);
+static const int hipblas_staging_threads = std::max(
+    1, int(hipblasStagingEnvSize("HIPBLAS_STAGING_THREADS", hipblasStagingDefaultThreads())));
+
+// Two pinned chunks and the events of the last DMA that used each of them. A chunk
+// is only written, by the CPU or by a DMA, once its event has completed, so a stager
+// can be handed to the next copy while the DMAs of an async set are in flight.
+class hipblas_stager
+{
+public:
+    hipError_t init(size_t bytes)
+    {
+        for(int i = 0; i < 2; i++)
+        {
+            hipError_t error = hipHostMalloc(&m_buffers[i], bytes, hipHostMallocDefault);
+            if(error == hipSuccess)
+                error = hipEventCreateWithFlags(&m_events[i], hipEventDisableTiming);
+            if(error != hipSuccess)
+            {
+                release();
+                return error;
+            }
+        }
+        return hipSuccess;
+    }
+
+    void* buffer(int index) const
+    {
+        return m_buffers[index % 2];
+    }
+
+    hipEvent_t event(int index) const
+    {
+        return m_events[index % 2];
+    }
+
+private:
+    void release()
+    {
+        for(int i = 0; i < 2; i++)
+        {
+            if(m_buffers[i])
+                (void)hipHostFree(m_buffers[i]);
+            if(m_events[i])
+                (void)hipEventDestroy(m_events[i]);
+            m_buffers[i] = nullptr;
+            m_events[i]  = nullptr;
+        }
+    }
+
+    void*      m_buffers[2] = {};
+    hipEvent_t m_events[2]  = {};
+};
+
+// Process-wide pool of stagers per device. hipblasSetMatrix and friends have no
+// handle, so there is nothing smaller to hang the pool on. Each copy takes a stager
+// for its duration; concurrent copies get their own.
+class hipblas_staging_pool
+{
+public:
+    static hipblas_staging_pool& instance()
+    {
+        // Never destroyed: the HIP runtime may already be gone when static objects are
+        // destroyed at exit, and the pinned memory is released with the process
+        static hipblas_staging_pool* pool = new hipblas_staging_pool;
+        return *pool;
+    }
+
+    std::unique_ptr<hipblas_stager> acquire(int device, hipError_t& error)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            auto& stagers = m_free[device];
+            if(!stagers.empty())
+            {
+                std::unique_ptr<hipblas_stager> stager = std::move(stagers.back());
+                stagers.pop_back();
+                error = hipSuccess;
+                return stager;
+            }
+        }
+
+        auto stager = std::make_unique<hipblas_stager>();
+        error       = stager->init(hipblas_staging_chunk_bytes);
+        if(error != hipSuccess)
+            stager.reset();
+        return stager;
+    }
+
+    void release(int device, std::unique_ptr<hipblas_stager> stager)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_free[device].push_back(std::move(stager));
+    }
+
+    void record(uint64_t bytes, bool timed, std::chrono::steady_clock::time_point start)
+    {
+        m_copies += 1;
+        m_bytes += bytes;
+        if(timed)
+        {
+            auto elapsed = std::chrono::steady_clock::now() - start;
+            m_timed_bytes += bytes;
+            m_nanoseconds += std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+        }
+    }
+
+    void get_stats(uint64_t* copies, uint64_t* bytes, double* gigabytes_per_second) const
+    {
+        uint64_t nanoseconds  = m_nanoseconds;
+        *copies               = m_copies;
+        *bytes                = m_bytes;
+        *gigabytes_per_second = nanoseconds ? double(m_timed_bytes) / nanoseconds : 0.0;
+    }
+
+    void reset_stats()
+    {
+        m_copies      = 0;
+        m_bytes       = 0;
+        m_timed_bytes = 0;
+        m_nanoseconds = 0;
+    }
+
+private:
+    std::mutex                                                  m_mutex;
+    std::map<int, std::vector<std::unique_ptr<hipblas_stager>>> m_free;
+
+    std::atomic<uint64_t> m_copies{0};
+    std::atomic<uint64_t> m_bytes{0};
+    std::atomic<uint64_t> m_timed_bytes{0};
+    std::atomic<uint64_t> m_nanoseconds{0};
+};
+
+// A stager of the current device, returned to the pool on destruction
+class hipblas_staging_lease
+{
+public:
+    hipblas_staging_lease()
+    {
+        m_error = hipGetDevice(&m_device);
+        if(m_error == hipSuccess)
+            m_stager = hipblas_staging_pool::instance().acquire(m_device, m_error);
+    }
+
+    ~hipblas_staging_lease()
+    {
+        if(m_stager)
+            hipblas_staging_pool::instance().release(m_device, std::move(m_stager));
+    }
+
+    hipError_t error() const
+    {
+        return m_error;
+    }
+
+    const hipblas_stager& stager() const
+    {
+        return *m_stager;
+    }
+
+private:
+    int                             m_device = 0;
+    hipError_t                      m_error  = hipSuccess;
+    std::unique_ptr<hipblas_stager> m_stager;
+};
+
+static std::vector<hipblas_matrix_tile>
+    hipblasStagingTiles(int64_t rows, int64_t cols, int elem_size)
+{
+    int64_t tile_rows, tile_cols;
+    hipblas_staging_tile_shape(rows, elem_size, hipblas_staging_chunk_bytes, tile_rows, tile_cols);
+
+    std::vector<hipblas_matrix_tile> tiles;
+    hipblas_for_each_tile(rows, cols, tile_rows, tile_cols, [&](hipblas_matrix_tile tile) {
+        tiles.push_back(tile);
+        return HIPBLAS_STATUS_SUCCESS;
+    });
+    return tiles;
+}
+
+bool hipblas_use_staging(int64_t     rows,
+                         int64_t     cols,
+                         int         elem_size,
+                         const void* host,
+                         int64_t     ld_host,
+                         const void* device,
+                         int64_t     ld_device)
+{
+    if(!hipblas_staging_enabled || !host || !device || rows <= 0 || cols <= 0 || elem_size <= 0
+       || ld_host < rows || ld_device < rows)
+        return false;
+    if(uint64_t(rows) * uint64_t(cols) * uint64_t(elem_size) < hipblas_staging_threshold)
+        return false;
+
+    // Memory the runtime does not know about is pageable; pinned, device and managed
+    // memory are copied directly by the backend
+    hipPointerAttribute_t attributes;
+    if(hipPointerGetAttributes(&attributes, host) != hipSuccess)
+    {
+        (void)hipGetLastError();
+        return true;
+    }
+    return attributes.type == hipMemoryTypeUnregistered;
+}
+
+hipblasStatus_t hipblas_staged_set_matrix(int64_t     rows,
+                                          int64_t     cols,
+                                          int         elem_size,
+                                          const void* A,
+                                          int64_t     lda,
+                                          void*       B,
+                                          int64_t     ldb,
+                                          hipStream_t stream,
+                                          bool        async)
+{
+    auto                  start = std::chrono::steady_clock::now();
+    hipblas_staging_lease lease;
+    if(lease.error() != hipSuccess)
+        return hipblas_hip_to_status(lease.error());
+
+    const hipblas_stager&            stager = lease.stager();
+    std::vector<hipblas_matrix_tile> tiles  = hipblasStagingTiles(rows, cols, elem_size);
+
+    // Packing tile i + 1 into one chunk overlaps the DMA of tile i from the other
+    hipError_t error = hipSuccess;
+    for(size_t i = 0; i < tiles.size() && error == hipSuccess; i++)
+    {
+        const hipblas_matrix_tile& tile = tiles[i];
+
+        error = hipEventSynchronize(stager.event(i));
+        if(error != hipSuccess)
+            break;
+
+        hipblas_copy_columns(stager.buffer(i),
+                             tile.m,
+                             (const char*)A + (tile.row + tile.col * lda) * elem_size,
+                             lda,
+                             tile.m,
+                             tile.n,
+                             elem_size,
+                             hipblas_staging_threads);
+
+        error = hipMemcpy2DAsync((char*)B + (tile.row + tile.col * ldb) * elem_size,
+                                 ldb * elem_size,
+                                 stager.buffer(i),
+                                 size_t(tile.m) * elem_size,
+                                 size_t(tile.m) * elem_size,
+                                 tile.n,
+                                 hipMemcpyHostToDevice,
+                                 stream);
+        if(error == hipSuccess)
+            error = hipEventRecord(stager.event(i), stream);
+    }
+
+    if(error == hipSuccess && !async)
+        error = hipStreamSynchronize(stream);
+    if(error != hipSuccess)
+        return hipblas_hip_to_status(error);
+
+    // The DMAs of an async set may still be running, so only synchronous sets are timed
+    hipblas_staging_pool::instance().record(uint64_t(rows) * cols * elem_size, !async, start);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblas_staged_get_matrix(int64_t     rows,
+                                          int64_t     cols,
+                                          int         elem_size,
+                                          const void* A,
+                                          int64_t     lda,
+                                          void*       B,
+                                          int64_t     ldb,
+                                          hipStream_t stream)
+{
+    auto                  start = std::chrono::steady_clock::now();
+    hipblas_staging_lease lease;
+    if(lease.error() != hipSuccess)
+        return hipblas_hip_to_status(lease.error());
+
+    const hipblas_stager&            stager = lease.stager();
+    std::vector<hipblas_matrix_tile> tiles  = hipblasStagingTiles(rows, cols, elem_size);
+
+    auto fetch = [&](size_t i) {
+        const hipblas_matrix_tile& tile = tiles[i];
+
+        hipError_t error = hipEventSynchronize(stager.event(i));
+        if(error == hipSuccess)
+            error = hipMemcpy2DAsync(stager.buffer(i),
+                                     size_t(tile.m) * elem_size,
+                                     (const char*)A + (tile.row + tile.col * lda) * elem_size,
+                                     lda * elem_size,
+                                     size_t(tile.m) * elem_size,
+                                     tile.n,
+                                     hipMemcpyDeviceToHost,
+                                     stream);
+        if(error == hipSuccess)
+            error = hipEventRecord(stager.event(i), stream);
+        return error;
+    };
+
+    // The DMA of tile i + 1 into one chunk overlaps unpacking tile i from the other.
+    // B is pageable host memory written by the CPU, so even an async get has to wait
+    // for the last tile.
+    hipError_t error = fetch(0);
+    for(size_t i = 0; i < tiles.size() && error == hipSuccess; i++)
+    {
+        const hipblas_matrix_tile& tile = tiles[i];
+
+        if(i + 1 < tiles.size())
+            error = fetch(i + 1);
+        if(error == hipSuccess)
+            error = hipEventSynchronize(stager.event(i));
+        if(error != hipSuccess)
+            break;
+
+        hipblas_copy_columns((char*)B + (tile.row + tile.col * ldb) * elem_size,
+                             ldb,
+                             stager.buffer(i),
+                             tile.m,
+                             tile.m,
+                             tile.n,
+                             elem_size,
+                             hipblas_staging_threads);
+    }
+    if(error != hipSuccess)
+        return hipblas_hip_to_status(error);
+
+    hipblas_staging_pool::instance().record(uint64_t(rows) * cols * elem_size, true, start);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+extern "C" hipblasStatus_t
+    hipblasGetStagingStats(uint64_t* copies, uint64_t* bytes, double* gigabytesPerSecond)
+try
+{
+    if(!copies || !bytes || !gigabytesPerSecond)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblas_staging_pool::instance().get_stats(copies, bytes, gigabytesPerSecond);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+extern "C" hipblasStatus_t hipblasResetStagingStats()
+try
+{
+    hipblas_staging_pool::instance().reset_stats();
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
@@ -0,0 +1,373 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "stats.hpp"
+#include "exceptions.hpp"
+#include "handle_state.hpp"
+#include <memory>
+#include <new>
+
+// Number of handles whose mode is not HIPBLAS_STATS_MODE_OFF, so that the entry points
+// only look up the statistics of their handle while one is
+std::atomic<int> hipblas_stats_handles{0};
+
+// Timed calls not yet added past which a call waits for the oldest one
+static constexpr size_t hipblas_stats_max_pending = 4096;
+
+// The process statistics and the directory are never destroyed, since handles left at
+// exit are destroyed with the table of handle states after them
+hipblas_stats_table& hipblas_process_stats()
+{
+    static hipblas_stats_table* table = new hipblas_stats_table;
+    return *table;
+}
+
+// Open addressing table from handles to their statistics. Calls look up their handle
+// without a lock; slots are only written with m_mutex held. A removed handle keeps its
+// slot with no statistics, so that the slots after it stay reachable, and the slot is
+// given to the next handle added there.
+class hipblas_stats_directory
+{
+public:
+    static hipblas_stats_directory& instance()
+    {
+        static hipblas_stats_directory* directory = new hipblas_stats_directory;
+        return *directory;
+    }
+
+    hipblas_handle_stats* find(const void* handle) const
+    {
+        for(size_t i = 0, slot = hash(handle); i < capacity; i++, slot = (slot + 1) % capacity)
+        {
+            const void* key = m_slots[slot].handle.load(std::memory_order_acquire);
+            if(key == handle)
+                return m_slots[slot].stats.load(std::memory_order_acquire);
+            if(!key)
+                break;
+        }
+        return nullptr;
+    }
+
+    void add(const void* handle, hipblas_handle_stats* stats)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        slot_t* free = nullptr;
+        for(size_t i = 0, slot = hash(handle); i < capacity; i++, slot = (slot + 1) % capacity)
+        {
+            const void* key = m_slots[slot].handle.load(std::memory_order_relaxed);
+            if(key == handle)
+            {
+                m_slots[slot].stats.store(stats, std::memory_order_release);
+                return;
+            }
+            if(!free && !m_slots[slot].stats.load(std::memory_order_relaxed))
+                free = &m_slots[slot];
+            if(!key)
+                break;
+        }
+        if(!free)
+            throw std::bad_alloc();
+
+        free->stats.store(stats, std::memory_order_release);
+        free->handle.store(handle, std::memory_order_release);
+    }
+
+    void remove(const void* handle)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        for(size_t i = 0, slot = hash(handle); i < capacity; i++, slot = (slot + 1) % capacity)
+        {
+            const void* key = m_slots[slot].handle.load(std::memory_order_relaxed);
+            if(key == handle)
+                m_slots[slot].stats.store(nullptr, std::memory_order_release);
+            if(key == handle || !key)
+                return;
+        }
+    }
+
+    // Calls f on the statistics of every handle, which are not destroyed meanwhile
+    template <typename F>
+    void for_each(F&& f)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for(slot_t& slot : m_slots)
+            if(hipblas_handle_stats* stats = slot.stats.load(std::memory_order_relaxed))
+                f(*stats);
+    }
+
+private:
+    static constexpr size_t capacity = 4096;
+
+    struct slot_t
+    {
+        std::atomic<const void*>           handle{nullptr};
+        std::atomic<hipblas_handle_stats*> stats{nullptr};
+    };
+
+    static size_t hash(const void* handle)
+    {
+        return size_t((uintptr_t(handle) >> 4) * 0x9E3779B97F4A7C15ull >> 32) % capacity;
+    }
+
+    hipblas_stats_directory() = default;
+
+    std::mutex m_mutex;
+    slot_t     m_slots[capacity];
+};
+
+hipblas_handle_stats* hipblas_find_handle_stats(hipblasHandle_t handle)
+{
+    return hipblas_stats_directory::instance().find(handle);
+}
+
+hipblas_handle_stats::hipblas_handle_stats(hipblasHandle_t handle)
+    : m_handle(handle)
+{
+    hipblas_stats_directory::instance().add(handle, this);
+}
+
+hipblas_handle_stats::~hipblas_handle_stats()
+{
+    // Remove the statistics from the directory first, so that hipblasGetStats with no
+    // handle does not collect them while they are destroyed
+    hipblas_stats_directory::instance().remove(m_handle);
+    set_mode(HIPBLAS_STATS_MODE_OFF);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    resolve(true);
+    for(hipEvent_t event : m_events)
+        (void)hipEventDestroy(event);
+}
+
+void hipblas_handle_stats::set_mode(hipblasStatsMode_t mode)
+{
+    hipblasStatsMode_t old = m_mode.exchange(mode);
+    if(old == HIPBLAS_STATS_MODE_OFF && mode != HIPBLAS_STATS_MODE_OFF)
+        hipblas_stats_handles++;
+    else if(old != HIPBLAS_STATS_MODE_OFF && mode == HIPBLAS_STATS_MODE_OFF)
+        hipblas_stats_handles--;
+}
+
+hipEvent_t hipblas_handle_stats::start_timer(hipblasHandle_t handle, hipStream_t* stream)
+{
+    if(mode() != HIPBLAS_STATS_MODE_TIMED
+       || hipblasGetStream(handle, stream) != HIPBLAS_STATUS_SUCCESS)
+        return nullptr;
+
+    // Events cannot be recorded on a stream being captured
+    hipStreamCaptureStatus capturing = hipStreamCaptureStatusNone;
+    if(hipStreamIsCapturing(*stream, &capturing) != hipSuccess
+       || capturing != hipStreamCaptureStatusNone)
+        return nullptr;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    resolve(false);
+    if(m_pending.size() >= hipblas_stats_max_pending)
+    {
+        (void)hipEventSynchronize(m_pending.front().stop);
+        resolve(false);
+    }
+
+    // Two events are taken, the start event now and the stop event in add
+    while(m_events.size() < 2)
+    {
+        hipEvent_t event;
+        if(hipEventCreate(&event) != hipSuccess)
+            return nullptr;
+        m_events.push_back(event);
+    }
+
+    hipEvent_t start = m_events.back();
+    if(hipEventRecord(start, *stream) != hipSuccess)
+        return nullptr;
+    m_events.pop_back();
+    return start;
+}
+
+void hipblas_handle_stats::add(const hipblas_trace_record& record,
+                               hipEvent_t                  event,
+                               hipStream_t                 stream)
+{
+    int family = hipblas_stats_family_of(record.function);
+    if(family < 0)
+        return;
+
+    hipblas_stats_count count = hipblas_stats_count_of(family, record);
+    m_table.add(family, count);
+    hipblas_process_stats().add(family, count);
+
+    if(!event)
+        return;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    hipEvent_t stop = m_events.empty() ? nullptr : m_events.back();
+    if(stop && hipEventRecord(stop, stream) == hipSuccess)
+    {
+        m_events.pop_back();
+        m_pending.push_back({family, event, stop});
+    }
+    else
+        m_events.push_back(event);
+}
+
+void hipblas_handle_stats::resolve(bool wait)
+{
+    while(!m_pending.empty())
+    {
+        timed_call& call = m_pending.front();
+        if(wait)
+            (void)hipEventSynchronize(call.stop);
+        else if(hipEventQuery(call.stop) != hipSuccess)
+            break;
+
+        float ms = 0;
+        if(hipEventElapsedTime(&ms, call.start, call.stop) == hipSuccess)
+        {
+            uint64_t ns = uint64_t(double(ms) * 1e6);
+            m_table.add_device_time(call.family, ns);
+            hipblas_process_stats().add_device_time(call.family, ns);
+        }
+        m_events.push_back(call.start);
+        m_events.push_back(call.stop);
+        m_pending.pop_front();
+    }
+}
+
+void hipblas_handle_stats::collect()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    resolve(true);
+}
+
+void hipblas_handle_stats::reset()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    resolve(true);
+    m_table.reset();
+}
+
+hipblasStatus_t hipblasSetStatsMode(hipblasHandle_t handle, hipblasStatsMode_t mode)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(mode != HIPBLAS_STATS_MODE_OFF && mode != HIPBLAS_STATS_MODE_COUNT
+       && mode != HIPBLAS_STATS_MODE_TIMED)
+        return HIPBLAS_STATUS_INVALID_ENUM;
+
+    static std::mutex           mutex;
+    std::lock_guard<std::mutex> lock(mutex);
+    hipblas_handle_state&       state = hipblas_get_handle_state(handle);
+    if(!state.stats)
+    {
+        if(mode == HIPBLAS_STATS_MODE_OFF)
+            return HIPBLAS_STATUS_SUCCESS;
+        state.stats = std::make_unique<hipblas_handle_stats>(handle);
+    }
+    state.stats->set_mode(mode);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGetStatsMode(hipblasHandle_t handle, hipblasStatsMode_t* mode)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!mode)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblas_handle_stats* stats = hipblas_get_handle_state(handle).stats.get();
+    *mode                       = stats ? stats->mode() : HIPBLAS_STATS_MODE_OFF;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGetStats(hipblasHandle_t handle, hipblasRoutineStats_t* stats, int* count)
+try
+{
+    if(!count || (stats && *count < 0))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    const hipblas_stats_table* table = &hipblas_process_stats();
+    if(handle)
+    {
+        hipblas_handle_stats* handle_stats = hipblas_get_handle_state(handle).stats.get();
+        if(!handle_stats)
+        {
+            *count = 0;
+            return HIPBLAS_STATUS_SUCCESS;
+        }
+        handle_stats->collect();
+        table = &handle_stats->table();
+    }
+    else
+        hipblas_stats_directory::instance().for_each(
+            [](hipblas_handle_stats& handle_stats) { handle_stats.collect(); });
+
+    int capacity = *count, families = 0;
+    for(int family = 0; family < hipblas_stats_family_count; family++)
+    {
+        hipblasRoutineStats_t routine = table->read(family);
+        if(!routine.calls)
+            continue;
+        if(stats && families < capacity)
+            stats[families] = routine;
+        families++;
+    }
+
+    *count = families;
+    return stats && families > capacity ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasResetStats(hipblasHandle_t handle)
+try
+{
+    if(!handle)
+    {
+        hipblas_process_stats().reset();
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    hipblas_handle_stats* stats = hipblas_get_handle_state(handle).stats.get();
+    if(stats)
+        stats->reset();
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
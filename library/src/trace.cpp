@@ -0,0 +1,221 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "trace.hpp"
+#include "stats.hpp"
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+static bool hipblasTraceEnvFlag(const char* name)
+{
+    const char* value = getenv(name);
+    return value && *value && std::strcmp(value, "0") != 0;
+}
+
+const bool hipblas_trace_enabled         = hipblasTraceEnvFlag("HIPBLAS_TRACE");
+const bool hipblas_trace_latency_enabled = hipblasTraceEnvFlag("HIPBLAS_TRACE_LATENCY");
+
+// Owns the ring of every thread that has made a traced call and drains them to the
+// trace file from a background thread, so that traced calls never do I/O.
+class hipblas_trace_writer
+{
+public:
+    static hipblas_trace_writer& instance()
+    {
+        static hipblas_trace_writer writer;
+        return writer;
+    }
+
+    std::shared_ptr<hipblas_trace_ring> add_ring()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        auto ring = std::make_shared<hipblas_trace_ring>(uint32_t(m_rings.size()));
+        m_rings.push_back(ring);
+        if(!m_thread.joinable())
+            m_thread = std::thread(&hipblas_trace_writer::run, this);
+        return ring;
+    }
+
+    ~hipblas_trace_writer()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_cv.notify_one();
+        if(m_thread.joinable())
+            m_thread.join();
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        flush();
+        m_file << (m_json ? "\n]\n" : "\n");
+
+        uint64_t dropped = 0;
+        for(auto& ring : m_rings)
+            dropped += ring->dropped();
+        if(dropped)
+            fprintf(stderr,
+                    "hipBLAS trace: %llu calls were not recorded because the trace buffer was "
+                    "full\n",
+                    (unsigned long long)dropped);
+    }
+
+private:
+    hipblas_trace_writer()
+    {
+        const char* format = getenv("HIPBLAS_TRACE_FORMAT");
+        m_json             = format && std::strcmp(format, "json") == 0;
+
+        const char* path = getenv("HIPBLAS_TRACE_PATH");
+        m_file.open(path ? path : (m_json ? "hipblas_trace.json" : "hipblas_trace.csv"),
+                    std::ios::trunc);
+        if(!m_file)
+            fprintf(stderr, "hipBLAS trace: cannot open trace file, calls will not be saved\n");
+
+        m_file << (m_json ? "[" : hipblas_trace_csv_header());
+    }
+
+    void run()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        while(!m_stop)
+        {
+            m_cv.wait_for(lock, std::chrono::milliseconds(100));
+            flush();
+        }
+    }
+
+    // Called with m_mutex held
+    void flush()
+    {
+        for(auto& ring : m_rings)
+            ring->drain([this](const hipblas_trace_record& record) {
+                m_file << (m_json && m_records ? ",\n" : "\n")
+                       << hipblas_trace_format(record, m_json);
+                m_records++;
+            });
+        m_file.flush();
+    }
+
+    std::mutex                                       m_mutex;
+    std::condition_variable                          m_cv;
+    std::thread                                      m_thread;
+    bool                                             m_stop    = false;
+    bool                                             m_json    = false;
+    uint64_t                                         m_records = 0;
+    std::ofstream                                    m_file;
+    std::vector<std::shared_ptr<hipblas_trace_ring>> m_rings;
+};
+
+// Set while a call is counted in the statistics of its handle, so that only the
+// outermost of nested entry points is counted
+static thread_local bool hipblas_stats_counting = false;
+
+hipblas_trace_record& hipblas_trace_scope::start(hipblasHandle_t handle,
+                                                 const char*     routine,
+                                                 const char*     function,
+                                                 const char*     precision)
+{
+    // Setters on a record that could not be reserved go here and are discarded
+    thread_local hipblas_trace_record discarded;
+
+    // Record of a call which is counted but not traced
+    thread_local hipblas_trace_record counted;
+
+    if(hipblas_stats_handles.load(std::memory_order_relaxed) && !hipblas_stats_counting)
+    {
+        m_stats = hipblas_find_handle_stats(handle);
+        if(m_stats && m_stats->mode() == HIPBLAS_STATS_MODE_OFF)
+            m_stats = nullptr;
+    }
+
+    if(hipblas_trace_enabled)
+    {
+        thread_local std::shared_ptr<hipblas_trace_ring> ring
+            = hipblas_trace_writer::instance().add_ring();
+
+        m_record = ring->reserve();
+        if(m_record)
+            m_ring = ring.get();
+    }
+
+    if(!m_record && m_stats)
+    {
+        counted  = hipblas_trace_record{};
+        m_record = &counted;
+    }
+    if(!m_record)
+    {
+        discarded = hipblas_trace_record{};
+        return discarded;
+    }
+
+    m_record->routine   = routine;
+    m_record->function  = function;
+    m_record->precision = precision;
+
+    if(m_ring)
+    {
+        hipblasPointerMode_t mode;
+        if(hipblasGetPointerMode(handle, &mode) == HIPBLAS_STATUS_SUCCESS)
+            m_record->pointer_mode = mode;
+
+        hipStream_t stream;
+        if(hipblasGetStream(handle, &stream) == HIPBLAS_STATUS_SUCCESS)
+            m_record->stream = stream;
+    }
+
+    if(m_stats)
+    {
+        hipblas_stats_counting = true;
+        m_event                = m_stats->start_timer(handle, &m_stream);
+    }
+
+    m_start                = std::chrono::steady_clock::now();
+    m_record->timestamp_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                 m_start.time_since_epoch())
+                                 .count();
+    return *m_record;
+}
+
+void hipblas_trace_scope::finish()
+{
+    if(m_stats)
+    {
+        m_stats->add(*m_record, m_event, m_stream);
+        hipblas_stats_counting = false;
+    }
+
+    if(!m_ring)
+        return;
+    if(hipblas_trace_latency_enabled)
+        m_record->latency_us = std::chrono::duration<double, std::micro>(
+                                   std::chrono::steady_clock::now() - m_start)
+                                   .count();
+    m_ring->commit();
+}
@@ -0,0 +1,1470 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "xt_engine.hpp"
+#include "device_scratch.hpp"
+#include "handle_state.hpp"
+#include "ilp64_emulation.hpp"
+#include "stream_pool.hpp"
+#include <memory>
+
+// Resources of one device of a hipblasXt context: a hipBLAS handle, a stream per
+// slot and the device memory of both slots. They are created when the device first
+// runs a routine and grown as needed. The out-of-core functions instead lend the
+// handle of the caller and two streams of its pool, which stay with their owner, and
+// the memory is then a hipblas_device_scratch of that handle.
+class hipblas_xt_gpu
+{
+public:
+    explicit hipblas_xt_gpu(int id)
+        : m_id(id)
+    {
+    }
+
+    hipblas_xt_gpu(int id, hipblasHandle_t handle, hipStream_t stream0, hipStream_t stream1)
+        : m_id(id)
+        , m_handle(handle)
+        , m_streams{stream0, stream1}
+        , m_borrowed(true)
+        , m_scratch(std::make_unique<hipblas_device_scratch>(handle))
+    {
+    }
+
+    hipblas_xt_gpu(const hipblas_xt_gpu&) = delete;
+    hipblas_xt_gpu& operator=(const hipblas_xt_gpu&) = delete;
+
+    ~hipblas_xt_gpu()
+    {
+        if(hipSetDevice(m_id) != hipSuccess)
+            return;
+        if(m_memory)
+            (void)hipFree(m_memory);
+        if(m_borrowed)
+            return;
+        for(hipStream_t stream : m_streams)
+            if(stream)
+                (void)hipStreamDestroy(stream);
+        if(m_handle)
+            (void)hipblasDestroy(m_handle);
+    }
+
+    int id() const
+    {
+        return m_id;
+    }
+
+    hipblasStatus_t prepare(size_t slot_bytes)
+    {
+        hipError_t error = hipSetDevice(m_id);
+        for(int slot = 0; slot < 2 && error == hipSuccess; slot++)
+            if(!m_streams[slot])
+                error = hipStreamCreateWithFlags(&m_streams[slot], hipStreamNonBlocking);
+        if(error == hipSuccess && slot_bytes > m_slot_bytes && m_scratch)
+        {
+            hipblasStatus_t status = m_scratch->reserve(2 * slot_bytes);
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+            m_slot_bytes = slot_bytes;
+        }
+        else if(error == hipSuccess && slot_bytes > m_slot_bytes)
+        {
+            // The previous routine has finished with the memory
+            if(m_memory)
+                (void)hipFree(m_memory);
+            m_slot_bytes = 0;
+            error        = hipMalloc(&m_memory, 2 * slot_bytes);
+            if(error == hipSuccess)
+                m_slot_bytes = slot_bytes;
+            else
+                m_memory = nullptr;
+        }
+        if(error != hipSuccess)
+            return hipblas_hip_to_status(error);
+
+        return m_handle ? HIPBLAS_STATUS_SUCCESS : hipblasCreate(&m_handle);
+    }
+
+    void* memory(int slot) const
+    {
+        return (char*)(m_scratch ? m_scratch->data() : m_memory) + slot * m_slot_bytes;
+    }
+
+    hipStream_t stream(int slot) const
+    {
+        return m_streams[slot];
+    }
+
+    // The handle, set to run on the stream of a slot
+    hipblasStatus_t handle(int slot, hipblasHandle_t* handle)
+    {
+        *handle = m_handle;
+        return hipblasSetStream(m_handle, m_streams[slot]);
+    }
+
+private:
+    int             m_id;
+    hipblasHandle_t m_handle     = nullptr;
+    hipStream_t     m_streams[2] = {};
+    void*           m_memory     = nullptr;
+    size_t          m_slot_bytes = 0;
+    bool            m_borrowed   = false;
+
+    // Memory of the borrowed handle, taken from its user workspace when it has one
+    std::unique_ptr<hipblas_device_scratch> m_scratch;
+};
+
+struct hipblasXtContext
+{
+    std::vector<std::unique_ptr<hipblas_xt_gpu>> gpus;
+    int                                          block_dim = 1024;
+};
+
+static hipblasStatus_t hipblasXtGemmTile(hipblasHandle_t    handle,
+                                         hipblasOperation_t transA,
+                                         hipblasOperation_t transB,
+                                         int                m,
+                                         int                n,
+                                         int                k,
+                                         const float*       alpha,
+                                         const float*       A,
+                                         int                lda,
+                                         const float*       B,
+                                         int                ldb,
+                                         const float*       beta,
+                                         float*             C,
+                                         int                ldc)
+{
+    return hipblasSgemm(handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+static hipblasStatus_t hipblasXtGemmTile(hipblasHandle_t    handle,
+                                         hipblasOperation_t transA,
+                                         hipblasOperation_t transB,
+                                         int                m,
+                                         int                n,
+                                         int                k,
+                                         const double*      alpha,
+                                         const double*      A,
+                                         int                lda,
+                                         const double*      B,
+                                         int                ldb,
+                                         const double*      beta,
+                                         double*            C,
+                                         int                ldc)
+{
+    return hipblasDgemm(handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+static hipblasStatus_t hipblasXtGemmTile(hipblasHandle_t    handle,
+                                         hipblasOperation_t transA,
+                                         hipblasOperation_t transB,
+                                         int                m,
+                                         int                n,
+                                         int                k,
+                                         const hipComplex*  alpha,
+                                         const hipComplex*  A,
+                                         int                lda,
+                                         const hipComplex*  B,
+                                         int                ldb,
+                                         const hipComplex*  beta,
+                                         hipComplex*        C,
+                                         int                ldc)
+{
+    return hipblasCgemm_v2(handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+static hipblasStatus_t hipblasXtGemmTile(hipblasHandle_t         handle,
+                                         hipblasOperation_t      transA,
+                                         hipblasOperation_t      transB,
+                                         int                     m,
+                                         int                     n,
+                                         int                     k,
+                                         const hipDoubleComplex* alpha,
+                                         const hipDoubleComplex* A,
+                                         int                     lda,
+                                         const hipDoubleComplex* B,
+                                         int                     ldb,
+                                         const hipDoubleComplex* beta,
+                                         hipDoubleComplex*       C,
+                                         int                     ldc)
+{
+    return hipblasZgemm_v2(handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+static hipblasStatus_t hipblasXtTrsmTile(hipblasHandle_t    handle,
+                                         hipblasSideMode_t  side,
+                                         hipblasFillMode_t  uplo,
+                                         hipblasOperation_t transA,
+                                         hipblasDiagType_t  diag,
+                                         int                m,
+                                         int                n,
+                                         const float*       alpha,
+                                         const float*       A,
+                                         int                lda,
+                                         float*             B,
+                                         int                ldb)
+{
+    return hipblasStrsm(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
+}
+
+static hipblasStatus_t hipblasXtTrsmTile(hipblasHandle_t    handle,
+                                         hipblasSideMode_t  side,
+                                         hipblasFillMode_t  uplo,
+                                         hipblasOperation_t transA,
+                                         hipblasDiagType_t  diag,
+                                         int                m,
+                                         int                n,
+                                         const double*      alpha,
+                                         const double*      A,
+                                         int                lda,
+                                         double*            B,
+                                         int                ldb)
+{
+    return hipblasDtrsm(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
+}
+
+static hipblasStatus_t hipblasXtTrsmTile(hipblasHandle_t    handle,
+                                         hipblasSideMode_t  side,
+                                         hipblasFillMode_t  uplo,
+                                         hipblasOperation_t transA,
+                                         hipblasDiagType_t  diag,
+                                         int                m,
+                                         int                n,
+                                         const hipComplex*  alpha,
+                                         const hipComplex*  A,
+                                         int                lda,
+                                         hipComplex*        B,
+                                         int                ldb)
+{
+    return hipblasCtrsm_v2(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
+}
+
+static hipblasStatus_t hipblasXtTrsmTile(hipblasHandle_t         handle,
+                                         hipblasSideMode_t       side,
+                                         hipblasFillMode_t       uplo,
+                                         hipblasOperation_t      transA,
+                                         hipblasDiagType_t       diag,
+                                         int                     m,
+                                         int                     n,
+                                         const hipDoubleComplex* alpha,
+                                         const hipDoubleComplex* A,
+                                         int                     lda,
+                                         hipDoubleComplex*       B,
+                                         int                     ldb)
+{
+    return hipblasZtrsm_v2(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
+}
+
+// hipblas_xt_device of a GPU, for values of type T
+template <typename T>
+class hipblas_xt_gpu_device : public hipblas_xt_device<T>
+{
+public:
+    explicit hipblas_xt_gpu_device(hipblas_xt_gpu& gpu)
+        : m_gpu(gpu)
+    {
+    }
+
+    hipblasStatus_t prepare(size_t elements) override
+    {
+        return m_gpu.prepare(elements * sizeof(T));
+    }
+
+    T* memory(int slot) override
+    {
+        return (T*)m_gpu.memory(slot);
+    }
+
+    hipblasStatus_t upload(int      slot,
+                           T*       dst,
+                           int64_t  ld_dst,
+                           const T* src,
+                           int64_t  ld_src,
+                           int64_t  rows,
+                           int64_t  cols) override
+    {
+        return copy(slot, dst, ld_dst, src, ld_src, rows, cols, hipMemcpyHostToDevice);
+    }
+
+    hipblasStatus_t download(int      slot,
+                             T*       dst,
+                             int64_t  ld_dst,
+                             const T* src,
+                             int64_t  ld_src,
+                             int64_t  rows,
+                             int64_t  cols) override
+    {
+        return copy(slot, dst, ld_dst, src, ld_src, rows, cols, hipMemcpyDeviceToHost);
+    }
+
+    hipblasStatus_t gemm(int                slot,
+                         hipblasOperation_t trans_a,
+                         hipblasOperation_t trans_b,
+                         int64_t            m,
+                         int64_t            n,
+                         int64_t            k,
+                         T                  alpha,
+                         const T*           A,
+                         int64_t            lda,
+                         const T*           B,
+                         int64_t            ldb,
+                         T                  beta,
+                         T*                 C,
+                         int64_t            ldc) override
+    {
+        if(!hipblas_fits_int32(m, n, k, lda, ldb, ldc))
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+        hipblasHandle_t handle;
+        hipblasStatus_t status = m_gpu.handle(slot, &handle);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        return hipblasXtGemmTile(
+            handle, trans_a, trans_b, m, n, k, &alpha, A, lda, B, ldb, &beta, C, ldc);
+    }
+
+    hipblasStatus_t trsm(int                slot,
+                         hipblasSideMode_t  side,
+                         hipblasFillMode_t  uplo,
+                         hipblasOperation_t trans,
+                         hipblasDiagType_t  diag,
+                         int64_t            m,
+                         int64_t            n,
+                         T                  alpha,
+                         const T*           A,
+                         int64_t            lda,
+                         T*                 B,
+                         int64_t            ldb) override
+    {
+        if(!hipblas_fits_int32(m, n, lda, ldb))
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+        hipblasHandle_t handle;
+        hipblasStatus_t status = m_gpu.handle(slot, &handle);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        return hipblasXtTrsmTile(handle, side, uplo, trans, diag, m, n, &alpha, A, lda, B, ldb);
+    }
+
+    hipblasStatus_t synchronize(int slot) override
+    {
+        return hipblas_hip_to_status(hipStreamSynchronize(m_gpu.stream(slot)));
+    }
+
+private:
+    hipblasStatus_t copy(int           slot,
+                         T*            dst,
+                         int64_t       ld_dst,
+                         const T*      src,
+                         int64_t       ld_src,
+                         int64_t       rows,
+                         int64_t       cols,
+                         hipMemcpyKind kind)
+    {
+        if(!rows || !cols)
+            return HIPBLAS_STATUS_SUCCESS;
+        return hipblas_hip_to_status(hipMemcpy2DAsync(dst,
+                                                      ld_dst * sizeof(T),
+                                                      src,
+                                                      ld_src * sizeof(T),
+                                                      rows * sizeof(T),
+                                                      cols,
+                                                      kind,
+                                                      m_gpu.stream(slot)));
+    }
+
+    hipblas_xt_gpu& m_gpu;
+};
+
+// Runs call with the devices of a context, restoring the current device after
+template <typename T, typename Call>
+static hipblasStatus_t hipblasXtDispatch(hipblasXtHandle_t handle, Call&& call)
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    std::vector<std::unique_ptr<hipblas_xt_gpu_device<T>>> storage;
+    std::vector<hipblas_xt_device<T>*>                     devices;
+    for(auto& gpu : handle->gpus)
+    {
+        storage.emplace_back(new hipblas_xt_gpu_device<T>(*gpu));
+        devices.push_back(storage.back().get());
+    }
+
+    int device;
+    if(hipGetDevice(&device) != hipSuccess)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+    hipblasStatus_t status = call(devices, int64_t(handle->block_dim));
+    (void)hipSetDevice(device);
+    return status;
+}
+
+extern "C" {
+
+hipblasStatus_t hipblasXtCreate(hipblasXtHandle_t* handle)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    int device;
+    if(hipGetDevice(&device) != hipSuccess)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    auto context = std::make_unique<hipblasXtContext>();
+    context->gpus.emplace_back(new hipblas_xt_gpu(device));
+    *handle = context.release();
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasXtDestroy(hipblasXtHandle_t handle)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    int device;
+    if(hipGetDevice(&device) != hipSuccess)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+    delete handle;
+    (void)hipSetDevice(device);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasXtDeviceSelect(hipblasXtHandle_t handle, int nbDevices, int deviceId[])
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    int count;
+    if(hipGetDeviceCount(&count) != hipSuccess)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(nbDevices <= 0 || !deviceId)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    for(int i = 0; i < nbDevices; i++)
+        if(deviceId[i] < 0 || deviceId[i] >= count
+           || std::count(deviceId, deviceId + i, deviceId[i]))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+    int current;
+    if(hipGetDevice(&current) != hipSuccess)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+    // Devices kept in the list keep their resources
+    std::vector<std::unique_ptr<hipblas_xt_gpu>> gpus;
+    for(int i = 0; i < nbDevices; i++)
+    {
+        auto kept = std::find_if(handle->gpus.begin(), handle->gpus.end(), [&](auto& gpu) {
+            return gpu && gpu->id() == deviceId[i];
+        });
+        if(kept != handle->gpus.end())
+            gpus.push_back(std::move(*kept));
+        else
+            gpus.emplace_back(new hipblas_xt_gpu(deviceId[i]));
+    }
+    handle->gpus = std::move(gpus);
+    (void)hipSetDevice(current);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasXtSetBlockDim(hipblasXtHandle_t handle, int blockDim)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(blockDim <= 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    handle->block_dim = blockDim;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasXtGetBlockDim(hipblasXtHandle_t handle, int* blockDim)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!blockDim)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    *blockDim = handle->block_dim;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// gemm
+hipblasStatus_t hipblasXtSgemm(hipblasXtHandle_t  handle,
+                               hipblasOperation_t transa,
+                               hipblasOperation_t transb,
+                               size_t             m,
+                               size_t             n,
+                               size_t             k,
+                               const float*       alpha,
+                               const float*       A,
+                               size_t             lda,
+                               const float*       B,
+                               size_t             ldb,
+                               const float*       beta,
+                               float*             C,
+                               size_t             ldc)
+try
+{
+    return hipblasXtDispatch<float>(handle, [&](auto& devices, int64_t nb) {
+        return hipblas_xt_gemm(devices,
+                               nb,
+                               transa,
+                               transb,
+                               m,
+                               n,
+                               k,
+                               alpha,
+                               A,
+                               lda,
+                               B,
+                               ldb,
+                               beta,
+                               C,
+                               ldc);
+    });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasXtDgemm(hipblasXtHandle_t  handle,
+                               hipblasOperation_t transa,
+                               hipblasOperation_t transb,
+                               size_t             m,
+                               size_t             n,
+                               size_t             k,
+                               const double*      alpha,
+                               const double*      A,
+                               size_t             lda,
+                               const double*      B,
+                               size_t             ldb,
+                               const double*      beta,
+                               double*            C,
+                               size_t             ldc)
+try
+{
+    return hipblasXtDispatch<double>(handle, [&](auto& devices, int64_t nb) {
+        return hipblas_xt_gemm(devices,
+                               nb,
+                               transa,
+                               transb,
+                               m,
+                               n,
+                               k,
+                               alpha,
+                               A,
+                               lda,
+                               B,
+                               ldb,
+                               beta,
+                               C,
+                               ldc);
+    });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasXtCgemm(hipblasXtHandle_t  handle,
+                               hipblasOperation_t transa,
+                               hipblasOperation_t transb,
+                               size_t             m,
+                               size_t             n,
+                               size_t             k,
+                               const hipComplex*  alpha,
+                               const hipComplex*  A,
+                               size_t             lda,
+                               const hipComplex*  B,
+                               size_t             ldb,
+                               const hipComplex*  beta,
+                               hipComplex*        C,
+                               size_t             ldc)
+try
+{
+    return hipblasXtDispatch<hipComplex>(handle, [&](auto& devices, int64_t nb) {
+        return hipblas_xt_gemm(devices,
+                               nb,
+                               transa,
+                               transb,
+                               m,
+                               n,
+                               k,
+                               alpha,
+                               A,
+                               lda,
+                               B,
+                               ldb,
+                               beta,
+                               C,
+                               ldc);
+    });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasXtZgemm(hipblasXtHandle_t       handle,
+                               hipblasOperation_t      transa,
+                               hipblasOperation_t      transb,
+                               size_t                  m,
+                               size_t                  n,
+                               size_t                  k,
+                               const hipDoubleComplex* alpha,
+                               const hipDoubleComplex* A,
+                               size_t                  lda,
+                               const hipDoubleComplex* B,
+                               size_t                  ldb,
+                               const hipDoubleComplex* beta,
+                               hipDoubleComplex*       C,
+                               size_t                  ldc)
+try
+{
+    return hipblasXtDispatch<hipDoubleComplex>(handle, [&](auto& devices, int64_t nb) {
+        return hipblas_xt_gemm(devices,
+                               nb,
+                               transa,
+                               transb,
+                               m,
+                               n,
+                               k,
+                               alpha,
+                               A,
+                               lda,
+                               B,
+                               ldb,
+                               beta,
+                               C,
+                               ldc);
+    });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// syrk
+hipblasStatus_t hipblasXtSsyrk(hipblasXtHandle_t  handle,
+                               hipblasFillMode_t  uplo,
+                               hipblasOperation_t trans,
+                               size_t             n,
+                               size_t             k,
+                               const float*       alpha,
+                               const float*       A,
+                               size_t             lda,
+                               const float*       beta,
+                               float*             C,
+                               size_t             ldc)
+try
+{
+    return hipblasXtDispatch<float>(handle, [&](auto& devices, int64_t nb) {
+        return hipblas_xt_syrk(devices, nb, uplo, trans, n, k, alpha, A, lda, beta, C, ldc);
+    });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasXtDsyrk(hipblasXtHandle_t  handle,
+                               hipblasFillMode_t  uplo,
+                               hipblasOperation_t trans,
+                               size_t             n,
+                               size_t             k,
+                               const double*      alpha,
+                               const double*      A,
+                               size_t             lda,
+                               const double*      beta,
+                               double*            C,
+                               size_t             ldc)
+try
+{
+    return hipblasXtDispatch<double>(handle, [&](auto& devices, int64_t nb) {
+        return hipblas_xt_syrk(devices, nb, uplo, trans, n, k, alpha, A, lda, beta, C, ldc);
+    });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasXtCsyrk(hipblasXtHandle_t  handle,
+                               hipblasFillMode_t  uplo,
+                               hipblasOperation_t trans,
+                               size_t             n,
+                               size_t             k,
+                               const hipComplex*  alpha,
+                               const hipComplex*  A,
+                               size_t             lda,
+                               const hipComplex*  beta,
+                               hipComplex*        C,
+                               size_t             ldc)
+try
+{
+    return hipblasXtDispatch<hipComplex>(handle, [&](auto& devices, int64_t nb) {
+        return hipblas_xt_syrk(devices, nb, uplo, trans, n, k, alpha, A, lda, beta, C, ldc);
+    });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasXtZsyrk(hipblasXtHandle_t       handle,
+                               hipblasFillMode_t       uplo,
+                               hipblasOperation_t      trans,
+                               size_t                  n,
+                               size_t                  k,
+                               const hipDoubleComplex* alpha,
+                               const hipDoubleComplex* A,
+                               size_t                  lda,
+                               const hipDoubleComplex* beta,
+                               hipDoubleComplex*       C,
+                               size_t                  ldc)
+try
+{
+    return hipblasXtDispatch<hipDoubleComplex>(handle, [&](auto& devices, int64_t nb) {
+        return hipblas_xt_syrk(devices, nb, uplo, trans, n, k, alpha, A, lda, beta, C, ldc);
+    });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// trsm
+hipblasStatus_t hipblasXtStrsm(hipblasXtHandle_t  handle,
+                               hipblasSideMode_t  side,
+                               hipblasFillMode_t  uplo,
+                               hipblasOperation_t trans,
+                               hipblasDiagType_t  diag,
+                               size_t             m,
+                               size_t             n,
+                               const float*       alpha,
+                               const float*       A,
+                               size_t             lda,
+                               float*             B,
+                               size_t             ldb)
+try
+{
+    return hipblasXtDispatch<float>(handle, [&](auto& devices, int64_t nb) {
+        return hipblas_xt_trsm(devices, nb, side, uplo, trans, diag, m, n, alpha, A, lda, B, ldb);
+    });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasXtDtrsm(hipblasXtHandle_t  handle,
+                               hipblasSideMode_t  side,
+                               hipblasFillMode_t  uplo,
+                               hipblasOperation_t trans,
+                               hipblasDiagType_t  diag,
+                               size_t             m,
+                               size_t             n,
+                               const double*      alpha,
+                               const double*      A,
+                               size_t             lda,
+                               double*            B,
+                               size_t             ldb)
+try
+{
+    return hipblasXtDispatch<double>(handle, [&](auto& devices, int64_t nb) {
+        return hipblas_xt_trsm(devices, nb, side, uplo, trans, diag, m, n, alpha, A, lda, B, ldb);
+    });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasXtCtrsm(hipblasXtHandle_t  handle,
+                               hipblasSideMode_t  side,
+                               hipblasFillMode_t  uplo,
+                               hipblasOperation_t trans,
+                               hipblasDiagType_t  diag,
+                               size_t             m,
+                               size_t             n,
+                               const hipComplex*  alpha,
+                               const hipComplex*  A,
+                               size_t             lda,
+                               hipComplex*        B,
+                               size_t             ldb)
+try
+{
+    return hipblasXtDispatch<hipComplex>(handle, [&](auto& devices, int64_t nb) {
+        return hipblas_xt_trsm(devices, nb, side, uplo, trans, diag, m, n, alpha, A, lda, B, ldb);
+    });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasXtZtrsm(hipblasXtHandle_t       handle,
+                               hipblasSideMode_t       side,
+                               hipblasFillMode_t       uplo,
+                               hipblasOperation_t      trans,
+                               hipblasDiagType_t       diag,
+                               size_t                  m,
+                               size_t                  n,
+                               const hipDoubleComplex* alpha,
+                               const hipDoubleComplex* A,
+                               size_t                  lda,
+                               hipDoubleComplex*       B,
+                               size_t                  ldb)
+try
+{
+    return hipblasXtDispatch<hipDoubleComplex>(handle, [&](auto& devices, int64_t nb) {
+        return hipblas_xt_trsm(devices, nb, side, uplo, trans, diag, m, n, alpha, A, lda, B, ldb);
+    });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// symm
+hipblasStatus_t hipblasXtSsymm(hipblasXtHandle_t handle,
+                               hipblasSideMode_t side,
+                               hipblasFillMode_t uplo,
+                               size_t            m,
+                               size_t            n,
+                               const float*      alpha,
+                               const float*      A,
+                               size_t            lda,
+                               const float*      B,
+                               size_t            ldb,
+                               const float*      beta,
+                               float*            C,
+                               size_t            ldc)
+try
+{
+    return hipblasXtDispatch<float>(handle, [&](auto& devices, int64_t nb) {
+        return hipblas_xt_symm(devices, nb, side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc);
+    });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasXtDsymm(hipblasXtHandle_t handle,
+                               hipblasSideMode_t side,
+                               hipblasFillMode_t uplo,
+                               size_t            m,
+                               size_t            n,
+                               const double*     alpha,
+                               const double*     A,
+                               size_t            lda,
+                               const double*     B,
+                               size_t            ldb,
+                               const double*     beta,
+                               double*           C,
+                               size_t            ldc)
+try
+{
+    return hipblasXtDispatch<double>(handle, [&](auto& devices, int64_t nb) {
+        return hipblas_xt_symm(devices, nb, side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc);
+    });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasXtCsymm(hipblasXtHandle_t handle,
+                               hipblasSideMode_t side,
+                               hipblasFillMode_t uplo,
+                               size_t            m,
+                               size_t            n,
+                               const hipComplex* alpha,
+                               const hipComplex* A,
+                               size_t            lda,
+                               const hipComplex* B,
+                               size_t            ldb,
+                               const hipComplex* beta,
+                               hipComplex*       C,
+                               size_t            ldc)
+try
+{
+    return hipblasXtDispatch<hipComplex>(handle, [&](auto& devices, int64_t nb) {
+        return hipblas_xt_symm(devices, nb, side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc);
+    });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasXtZsymm(hipblasXtHandle_t       handle,
+                               hipblasSideMode_t       side,
+                               hipblasFillMode_t       uplo,
+                               size_t                  m,
+                               size_t                  n,
+                               const hipDoubleComplex* alpha,
+                               const hipDoubleComplex* A,
+                               size_t                  lda,
+                               const hipDoubleComplex* B,
+                               size_t                  ldb,
+                               const hipDoubleComplex* beta,
+                               hipDoubleComplex*       C,
+                               size_t                  ldc)
+try
+{
+    return hipblasXtDispatch<hipDoubleComplex>(handle, [&](auto& devices, int64_t nb) {
+        return hipblas_xt_symm(devices, nb, side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc);
+    });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+} // extern "C"
+
+// Runs call with the current device of handle, lent to the engine with tiles that fit
+// the out-of-core memory budget of the handle. The work runs on two streams of the
+// handle's pool that first wait for the work queued on the handle's stream; the
+// stream and pointer mode of the handle are restored after.
+template <typename T, typename Call>
+static hipblasStatus_t hipblasOutOfCoreDispatch(
+    hipblasHandle_t handle, int64_t m, int64_t n, int64_t k, Call&& call)
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    hipblas_handle_state&               state    = hipblas_get_handle_state(handle);
+    const hipblas_out_of_core_settings& settings = state.out_of_core;
+
+    int device;
+    if(hipGetDevice(&device) != hipSuccess)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+    // With a user workspace the tiles take at most half of it, and the backend the rest
+    const hipblas_user_workspace& workspace = state.user_workspace;
+    size_t                        budget    = settings.budget;
+    if(workspace.set)
+        budget = budget ? std::min(budget, workspace.size / 2) : workspace.size / 2;
+    else if(!budget)
+    {
+        size_t free, total;
+        if(hipMemGetInfo(&free, &total) != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+        budget = free / 4 * 3;
+    }
+    int64_t nb = hipblas_xt_product_block(budget, sizeof(T), m, n, k);
+
+    hipblas_xt_progress progress;
+    if(settings.progress)
+        progress = [&settings](int64_t done, int64_t total) {
+            settings.progress(done, total, settings.user_data);
+        };
+
+    hipblasPointerMode_t mode;
+    hipblasStatus_t      status = hipblasGetPointerMode(handle, &mode);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    hipblas_handle_streams streams(handle, state.stream_pool);
+    status = streams.fork(2);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_xt_gpu gpu(
+            device, handle, state.stream_pool.stream(0), state.stream_pool.stream(1));
+        hipblas_xt_gpu_device<T>           gpu_device(gpu);
+        std::vector<hipblas_xt_device<T>*> devices{&gpu_device};
+
+        status = call(devices, nb, progress);
+
+        hipblasStatus_t joined = streams.join(2);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = joined;
+    }
+
+    hipblasStatus_t restored = streams.select(-1);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = restored;
+    restored = hipblasSetPointerMode(handle, mode);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = restored;
+    (void)hipSetDevice(device);
+    return status;
+}
+
+extern "C" {
+
+hipblasStatus_t hipblasSetOutOfCoreMemoryBudget(hipblasHandle_t handle, size_t bytes)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    hipblas_get_handle_state(handle).out_of_core.budget = bytes;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGetOutOfCoreMemoryBudget(hipblasHandle_t handle, size_t* bytes)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!bytes)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    *bytes = hipblas_get_handle_state(handle).out_of_core.budget;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasSetOutOfCoreProgressCallback(hipblasHandle_t            handle,
+                                                    hipblasOutOfCoreProgress_t callback,
+                                                    void*                      userData)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    hipblas_out_of_core_settings& settings = hipblas_get_handle_state(handle).out_of_core;
+    settings.progress                      = callback;
+    settings.user_data                     = userData;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasSgemmOutOfCore(hipblasHandle_t    handle,
+                                      hipblasOperation_t transA,
+                                      hipblasOperation_t transB,
+                                      int64_t            m,
+                                      int64_t            n,
+                                      int64_t            k,
+                                      const float*       alpha,
+                                      const float*       A,
+                                      int64_t            lda,
+                                      const float*       B,
+                                      int64_t            ldb,
+                                      const float*       beta,
+                                      float*             C,
+                                      int64_t            ldc)
+try
+{
+    return hipblasOutOfCoreDispatch<float>(
+        handle, m, n, k, [&](auto& devices, int64_t nb, auto& progress) {
+            return hipblas_xt_gemm_strided_batched(devices,
+                                                   nb,
+                                                   transA,
+                                                   transB,
+                                                   m,
+                                                   n,
+                                                   k,
+                                                   alpha,
+                                                   A,
+                                                   lda,
+                                                   0,
+                                                   B,
+                                                   ldb,
+                                                   0,
+                                                   beta,
+                                                   C,
+                                                   ldc,
+                                                   0,
+                                                   1,
+                                                   progress);
+        });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasSgemmStridedBatchedOutOfCore(hipblasHandle_t    handle,
+                                                    hipblasOperation_t transA,
+                                                    hipblasOperation_t transB,
+                                                    int64_t            m,
+                                                    int64_t            n,
+                                                    int64_t            k,
+                                                    const float*       alpha,
+                                                    const float*       A,
+                                                    int64_t            lda,
+                                                    hipblasStride      strideA,
+                                                    const float*       B,
+                                                    int64_t            ldb,
+                                                    hipblasStride      strideB,
+                                                    const float*       beta,
+                                                    float*             C,
+                                                    int64_t            ldc,
+                                                    hipblasStride      strideC,
+                                                    int64_t            batchCount)
+try
+{
+    return hipblasOutOfCoreDispatch<float>(
+        handle, m, n, k, [&](auto& devices, int64_t nb, auto& progress) {
+            return hipblas_xt_gemm_strided_batched(devices,
+                                                   nb,
+                                                   transA,
+                                                   transB,
+                                                   m,
+                                                   n,
+                                                   k,
+                                                   alpha,
+                                                   A,
+                                                   lda,
+                                                   strideA,
+                                                   B,
+                                                   ldb,
+                                                   strideB,
+                                                   beta,
+                                                   C,
+                                                   ldc,
+                                                   strideC,
+                                                   batchCount,
+                                                   progress);
+        });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDgemmOutOfCore(hipblasHandle_t    handle,
+                                      hipblasOperation_t transA,
+                                      hipblasOperation_t transB,
+                                      int64_t            m,
+                                      int64_t            n,
+                                      int64_t            k,
+                                      const double*      alpha,
+                                      const double*      A,
+                                      int64_t            lda,
+                                      const double*      B,
+                                      int64_t            ldb,
+                                      const double*      beta,
+                                      double*            C,
+                                      int64_t            ldc)
+try
+{
+    return hipblasOutOfCoreDispatch<double>(
+        handle, m, n, k, [&](auto& devices, int64_t nb, auto& progress) {
+            return hipblas_xt_gemm_strided_batched(devices,
+                                                   nb,
+                                                   transA,
+                                                   transB,
+                                                   m,
+                                                   n,
+                                                   k,
+                                                   alpha,
+                                                   A,
+                                                   lda,
+                                                   0,
+                                                   B,
+                                                   ldb,
+                                                   0,
+                                                   beta,
+                                                   C,
+                                                   ldc,
+                                                   0,
+                                                   1,
+                                                   progress);
+        });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDgemmStridedBatchedOutOfCore(hipblasHandle_t    handle,
+                                                    hipblasOperation_t transA,
+                                                    hipblasOperation_t transB,
+                                                    int64_t            m,
+                                                    int64_t            n,
+                                                    int64_t            k,
+                                                    const double*      alpha,
+                                                    const double*      A,
+                                                    int64_t            lda,
+                                                    hipblasStride      strideA,
+                                                    const double*      B,
+                                                    int64_t            ldb,
+                                                    hipblasStride      strideB,
+                                                    const double*      beta,
+                                                    double*            C,
+                                                    int64_t            ldc,
+                                                    hipblasStride      strideC,
+                                                    int64_t            batchCount)
+try
+{
+    return hipblasOutOfCoreDispatch<double>(
+        handle, m, n, k, [&](auto& devices, int64_t nb, auto& progress) {
+            return hipblas_xt_gemm_strided_batched(devices,
+                                                   nb,
+                                                   transA,
+                                                   transB,
+                                                   m,
+                                                   n,
+                                                   k,
+                                                   alpha,
+                                                   A,
+                                                   lda,
+                                                   strideA,
+                                                   B,
+                                                   ldb,
+                                                   strideB,
+                                                   beta,
+                                                   C,
+                                                   ldc,
+                                                   strideC,
+                                                   batchCount,
+                                                   progress);
+        });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgemmOutOfCore(hipblasHandle_t    handle,
+                                      hipblasOperation_t transA,
+                                      hipblasOperation_t transB,
+                                      int64_t            m,
+                                      int64_t            n,
+                                      int64_t            k,
+                                      const hipComplex*  alpha,
+                                      const hipComplex*  A,
+                                      int64_t            lda,
+                                      const hipComplex*  B,
+                                      int64_t            ldb,
+                                      const hipComplex*  beta,
+                                      hipComplex*        C,
+                                      int64_t            ldc)
+try
+{
+    return hipblasOutOfCoreDispatch<hipComplex>(
+        handle, m, n, k, [&](auto& devices, int64_t nb, auto& progress) {
+            return hipblas_xt_gemm_strided_batched(devices,
+                                                   nb,
+                                                   transA,
+                                                   transB,
+                                                   m,
+                                                   n,
+                                                   k,
+                                                   alpha,
+                                                   A,
+                                                   lda,
+                                                   0,
+                                                   B,
+                                                   ldb,
+                                                   0,
+                                                   beta,
+                                                   C,
+                                                   ldc,
+                                                   0,
+                                                   1,
+                                                   progress);
+        });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgemmStridedBatchedOutOfCore(hipblasHandle_t    handle,
+                                                    hipblasOperation_t transA,
+                                                    hipblasOperation_t transB,
+                                                    int64_t            m,
+                                                    int64_t            n,
+                                                    int64_t            k,
+                                                    const hipComplex*  alpha,
+                                                    const hipComplex*  A,
+                                                    int64_t            lda,
+                                                    hipblasStride      strideA,
+                                                    const hipComplex*  B,
+                                                    int64_t            ldb,
+                                                    hipblasStride      strideB,
+                                                    const hipComplex*  beta,
+                                                    hipComplex*        C,
+                                                    int64_t            ldc,
+                                                    hipblasStride      strideC,
+                                                    int64_t            batchCount)
+try
+{
+    return hipblasOutOfCoreDispatch<hipComplex>(
+        handle, m, n, k, [&](auto& devices, int64_t nb, auto& progress) {
+            return hipblas_xt_gemm_strided_batched(devices,
+                                                   nb,
+                                                   transA,
+                                                   transB,
+                                                   m,
+                                                   n,
+                                                   k,
+                                                   alpha,
+                                                   A,
+                                                   lda,
+                                                   strideA,
+                                                   B,
+                                                   ldb,
+                                                   strideB,
+                                                   beta,
+                                                   C,
+                                                   ldc,
+                                                   strideC,
+                                                   batchCount,
+                                                   progress);
+        });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgemmOutOfCore(hipblasHandle_t         handle,
+                                      hipblasOperation_t      transA,
+                                      hipblasOperation_t      transB,
+                                      int64_t                 m,
+                                      int64_t                 n,
+                                      int64_t                 k,
+                                      const hipDoubleComplex* alpha,
+                                      const hipDoubleComplex* A,
+                                      int64_t                 lda,
+                                      const hipDoubleComplex* B,
+                                      int64_t                 ldb,
+                                      const hipDoubleComplex* beta,
+                                      hipDoubleComplex*       C,
+                                      int64_t                 ldc)
+try
+{
+    return hipblasOutOfCoreDispatch<hipDoubleComplex>(
+        handle, m, n, k, [&](auto& devices, int64_t nb, auto& progress) {
+            return hipblas_xt_gemm_strided_batched(devices,
+                                                   nb,
+                                                   transA,
+                                                   transB,
+                                                   m,
+                                                   n,
+                                                   k,
+                                                   alpha,
+                                                   A,
+                                                   lda,
+                                                   0,
+                                                   B,
+                                                   ldb,
+                                                   0,
+                                                   beta,
+                                                   C,
+                                                   ldc,
+                                                   0,
+                                                   1,
+                                                   progress);
+        });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgemmStridedBatchedOutOfCore(hipblasHandle_t         handle,
+                                                    hipblasOperation_t      transA,
+                                                    hipblasOperation_t      transB,
+                                                    int64_t                 m,
+                                                    int64_t                 n,
+                                                    int64_t                 k,
+                                                    const hipDoubleComplex* alpha,
+                                                    const hipDoubleComplex* A,
+                                                    int64_t                 lda,
+                                                    hipblasStride           strideA,
+                                                    const hipDoubleComplex* B,
+                                                    int64_t                 ldb,
+                                                    hipblasStride           strideB,
+                                                    const hipDoubleComplex* beta,
+                                                    hipDoubleComplex*       C,
+                                                    int64_t                 ldc,
+                                                    hipblasStride           strideC,
+                                                    int64_t                 batchCount)
+try
+{
+    return hipblasOutOfCoreDispatch<hipDoubleComplex>(
+        handle, m, n, k, [&](auto& devices, int64_t nb, auto& progress) {
+            return hipblas_xt_gemm_strided_batched(devices,
+                                                   nb,
+                                                   transA,
+                                                   transB,
+                                                   m,
+                                                   n,
+                                                   k,
+                                                   alpha,
+                                                   A,
+                                                   lda,
+                                                   strideA,
+                                                   B,
+                                                   ldb,
+                                                   strideB,
+                                                   beta,
+                                                   C,
+                                                   ldc,
+                                                   strideC,
+                                                   batchCount,
+                                                   progress);
+        });
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+} // extern "C"